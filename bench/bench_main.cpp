@@ -0,0 +1,355 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Driver of the flavor microbenchmarks
+//
+// Usage: bench_mpfr_bin_ieee754_flavor [--filter=<substring>] [--min-time=<seconds>]
+//                                       [--repetitions=<n>] [--json=<file>|-]
+//
+// A benchmark is selected by --filter if the substring occurs in its name
+// "<group>/<function>/<variant>/<distribution>". Each selected benchmark is
+// calibrated until one run takes at least --min-time seconds and then executed
+// --repetitions times. The fastest and the mean time per operation are printed
+// as a table and, if --json is given, written as a JSON document to the file
+// (or to stdout for "-").
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <mpfr.h>
+
+#include "p1788/version.hpp"
+#include "bench/util/bench_harness.hpp"
+
+
+namespace p1788_bench
+{
+
+namespace
+{
+
+// raw pool of bare double intervals
+std::vector<REP<double>> generate(distribution d, unsigned stream)
+{
+    std::mt19937_64 gen(1788u + 31u * static_cast<unsigned>(d) + stream);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    const double inf = std::numeric_limits<double>::infinity();
+
+    std::vector<REP<double>> pool;
+    pool.reserve(input_size);
+
+    for (std::size_t i = 0; i < input_size; ++i)
+    {
+        double sign = unit(gen) < 0.5 ? -1.0 : 1.0;
+
+        switch (d)
+        {
+        case distribution::narrow:
+        {
+            double m = 0.5 + 99.5 * unit(gen);
+            double r = std::ldexp(m, -41);
+            pool.push_back(sign > 0.0 ? REP<double>(m - r, m + r) : REP<double>(-m - r, -m + r));
+            break;
+        }
+        case distribution::wide:
+        {
+            double l = 0.1 + 9.9 * unit(gen);
+            double u = l + 1.0 + 999.0 * unit(gen);
+            pool.push_back(sign > 0.0 ? REP<double>(l, u) : REP<double>(-u, -l));
+            break;
+        }
+        case distribution::straddling_zero:
+            pool.push_back(REP<double>(-0.1 - 99.9 * unit(gen), 0.1 + 99.9 * unit(gen)));
+            break;
+        default:
+        {
+            double b = sign * 100.0 * unit(gen);
+            switch (i % 3)
+            {
+            case 0:
+                pool.push_back(REP<double>(-inf, b));
+                break;
+            case 1:
+                pool.push_back(REP<double>(b, inf));
+                break;
+            default:
+                pool.push_back(REP<double>(-inf, inf));
+            }
+        }
+        }
+    }
+
+    return pool;
+}
+
+// pools for all distributions and streams
+template<typename T>
+struct pools
+{
+    std::vector<REP<T>> bare[4][3];
+    std::vector<REP_DEC<T>> dec[4][3];
+
+    pools()
+    {
+        for (distribution d : distributions)
+        {
+            std::size_t di = static_cast<std::size_t>(d);
+
+            for (unsigned s = 0; s < 3; ++s)
+            {
+                for (auto const& x : generate(d, s))
+                {
+                    bare[di][s].push_back(F<T>::convert_type(x));
+                    dec[di][s].push_back(F<T>::new_dec(bare[di][s].back()));
+                }
+            }
+        }
+    }
+
+    static pools const& get()
+    {
+        static pools p;
+        return p;
+    }
+};
+
+std::string literal(double x)
+{
+    if (std::isinf(x))
+        return x < 0.0 ? "-inf" : "+inf";
+
+    std::ostringstream s;
+    s.precision(17);
+    s << x;
+    return s.str();
+}
+
+} // namespace
+
+
+template<typename T>
+std::vector<REP<T>> const& inputs(distribution d, unsigned stream)
+{
+    return pools<T>::get().bare[static_cast<std::size_t>(d)][stream];
+}
+
+template<typename T>
+std::vector<REP_DEC<T>> const& dec_inputs(distribution d, unsigned stream)
+{
+    return pools<T>::get().dec[static_cast<std::size_t>(d)][stream];
+}
+
+template std::vector<REP<double>> const& inputs<double>(distribution, unsigned);
+template std::vector<REP<float>> const& inputs<float>(distribution, unsigned);
+template std::vector<REP_DEC<double>> const& dec_inputs<double>(distribution, unsigned);
+template std::vector<REP_DEC<float>> const& dec_inputs<float>(distribution, unsigned);
+
+std::vector<std::string> const& text_inputs(distribution d)
+{
+    static std::vector<std::string> literals[4];
+
+    std::vector<std::string>& pool = literals[static_cast<std::size_t>(d)];
+
+    if (pool.empty())
+    {
+        for (auto const& x : inputs<double>(d, 0))
+            pool.push_back("[" + literal(x.first) + "," + literal(x.second) + "]");
+    }
+
+    return pool;
+}
+
+} // namespace p1788_bench
+
+
+namespace
+{
+
+struct result
+{
+    p1788_bench::benchmark const* bench;
+    std::size_t iterations;
+    double ns_min;
+    double ns_mean;
+};
+
+double seconds(p1788_bench::benchmark const& b, std::size_t n)
+{
+    auto start = std::chrono::steady_clock::now();
+    b.run(n);
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+result measure(p1788_bench::benchmark const& b, double min_time, unsigned repetitions)
+{
+    // calibration
+    std::size_t n = 1;
+    double t = seconds(b, n);
+
+    while (t < min_time)
+    {
+        double factor = t > 0.0 ? std::min(100.0, std::max(2.0, 1.4 * min_time / t)) : 100.0;
+        n = static_cast<std::size_t>(n * factor);
+        t = seconds(b, n);
+    }
+
+    double t_min = t;
+    double t_sum = t;
+
+    for (unsigned r = 1; r < repetitions; ++r)
+    {
+        t = seconds(b, n);
+        t_min = std::min(t_min, t);
+        t_sum += t;
+    }
+
+    return result { &b, n, 1e9 * t_min / n, 1e9 * t_sum / (repetitions * n) };
+}
+
+std::string name(p1788_bench::benchmark const& b)
+{
+    return b.group + "/" + b.function + "/" + b.variant + "/" + b.distribution;
+}
+
+void write_json(std::ostream& os, std::vector<result> const& results, double min_time, unsigned repetitions)
+{
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"library_version\": \"" << P1788_VERSION_STRING << "\",\n";
+    os << "    \"mpfr_version\": \"" << mpfr_get_version() << "\",\n";
+    os << "    \"compiler\": \"" << __VERSION__ << "\",\n";
+    os << "    \"min_time\": " << min_time << ",\n";
+    os << "    \"repetitions\": " << repetitions << "\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        p1788_bench::benchmark const& b = *results[i].bench;
+
+        os << (i ? ",\n" : "\n");
+        os << "    {\"name\": \"" << name(b) << "\", "
+           << "\"group\": \"" << b.group << "\", "
+           << "\"function\": \"" << b.function << "\", "
+           << "\"variant\": \"" << b.variant << "\", "
+           << "\"distribution\": \"" << b.distribution << "\", "
+           << "\"iterations\": " << results[i].iterations << ", "
+           << "\"ns_per_op\": " << results[i].ns_min << ", "
+           << "\"ns_per_op_mean\": " << results[i].ns_mean << "}";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+bool option(std::string const& arg, std::string const& key, std::string& value)
+{
+    if (arg.compare(0, key.size(), key) != 0)
+        return false;
+
+    value = arg.substr(key.size());
+    return true;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    std::string json;
+    double min_time = 0.01;
+    unsigned repetitions = 3;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        std::string value;
+
+        if (option(arg, "--filter=", value))
+            filter = value;
+        else if (option(arg, "--json=", value))
+            json = value;
+        else if (option(arg, "--min-time=", value))
+            min_time = std::atof(value.c_str());
+        else if (option(arg, "--repetitions=", value))
+            repetitions = std::max(1, std::atoi(value.c_str()));
+        else
+        {
+            std::cerr << "usage: " << argv[0]
+                      << " [--filter=<substring>] [--min-time=<seconds>] [--repetitions=<n>] [--json=<file>|-]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<result> results;
+
+    for (auto const& b : p1788_bench::registry())
+    {
+        if (!filter.empty() && name(b).find(filter) == std::string::npos)
+            continue;
+
+        results.push_back(measure(b, min_time, repetitions));
+
+        if (json != "-")
+        {
+            std::printf("%-64s %14.1f ns/op %14.1f ns/op (mean)\n",
+                        name(b).c_str(), results.back().ns_min, results.back().ns_mean);
+            std::fflush(stdout);
+        }
+    }
+
+    if (json == "-")
+    {
+        write_json(std::cout, results, min_time, repetitions);
+    }
+    else if (!json.empty())
+    {
+        std::ofstream os(json);
+
+        if (!os)
+        {
+            std::cerr << "unable to open " << json << std::endl;
+            return 1;
+        }
+
+        write_json(os, results, min_time, repetitions);
+    }
+
+    return 0;
+}
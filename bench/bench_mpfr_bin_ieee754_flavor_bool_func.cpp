@@ -0,0 +1,128 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Boolean functions
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "bool_func"
+
+using p1788_bench::F;
+using p1788_bench::REP;
+
+
+P1788_BENCH_PREDICATE(is_empty, F<R>::is_empty(x))
+P1788_BENCH_PREDICATE(is_entire, F<R>::is_entire(x))
+P1788_BENCH_BINARY_OPERAND_MIXED(equal, F<R>::equal(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(subset, F<R>::subset(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(less, F<R>::less(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(precedes, F<R>::precedes(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(interior, F<R>::interior(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(strictly_less, F<R>::strictly_less(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(strictly_precedes, F<R>::strictly_precedes(x, y))
+P1788_BENCH_BINARY_OPERAND_MIXED(disjoint, F<R>::disjoint(x, y))
+
+
+namespace
+{
+
+// The array versions evaluate a block of intervals given by their bounds per
+// call, the block is started at every block-th iteration such that the reported
+// time is the time per interval.
+struct bool_mask_registrar
+{
+    static const std::size_t block = 256;
+
+    struct bounds
+    {
+        std::vector<double> inf;
+        std::vector<double> sup;
+
+        explicit bounds(std::vector<REP<double>> const& x)
+        {
+            for (auto const& r : x)
+            {
+                inf.push_back(r.first);
+                sup.push_back(r.second);
+            }
+        }
+    };
+
+    bool_mask_registrar()
+    {
+        using p1788_bench::distribution;
+
+        for (distribution d : p1788_bench::distributions)
+        {
+            pools.emplace_back(p1788_bench::inputs<double>(d, 0));
+            bounds const& x = pools.back();
+            pools.emplace_back(p1788_bench::inputs<double>(d, 1));
+            bounds const& y = pools.back();
+            REP<double> const& c = p1788_bench::inputs<double>(d, 1)[0];
+
+            p1788_bench::add(P1788_BENCH_GROUP, "is_empty_mask", "bare", d,
+                             [&x](std::size_t i)
+            {
+                static std::uint64_t out[block / 64];
+                if (i % block == 0)
+                    F<double>::is_empty(&x.inf[i], &x.sup[i], out, block);
+                return out[i % block / 64];
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "subset_mask", "bare", d,
+                             [&x, &y](std::size_t i)
+            {
+                static std::uint64_t out[block / 64];
+                if (i % block == 0)
+                    F<double>::subset(&x.inf[i], &x.sup[i], &y.inf[i], &y.sup[i], out, block);
+                return out[i % block / 64];
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "subset_mask", "bare_fixed", d,
+                             [&x, &c](std::size_t i)
+            {
+                static std::uint64_t out[block / 64];
+                if (i % block == 0)
+                    F<double>::subset(&x.inf[i], &x.sup[i], c, out, block);
+                return out[i % block / 64];
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "disjoint_mask", "bare", d,
+                             [&x, &y](std::size_t i)
+            {
+                static std::uint64_t out[block / 64];
+                if (i % block == 0)
+                    F<double>::disjoint(&x.inf[i], &x.sup[i], &y.inf[i], &y.sup[i], out, block);
+                return out[i % block / 64];
+            });
+        }
+    }
+
+    // bounds in SoA layout, the registrar lives as long as the registry
+    std::list<bounds> pools;
+} bool_mask_registrar_instance;
+
+} // namespace
@@ -0,0 +1,36 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Cancellative addition and subtraction
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "cancel_func"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_BINARY(cancel_minus, F<R>::cancel_minus(x, y))
+P1788_BENCH_BINARY(cancel_plus, F<R>::cancel_plus(x, y))
@@ -0,0 +1,74 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Forward-mode elementary functions
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "elem_func"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_UNARY(pos, F<R>::pos(x))
+P1788_BENCH_UNARY(neg, F<R>::neg(x))
+P1788_BENCH_BINARY(add, F<R>::add(x, y))
+P1788_BENCH_BINARY(sub, F<R>::sub(x, y))
+P1788_BENCH_BINARY(mul, F<R>::mul(x, y))
+P1788_BENCH_BINARY(div, F<R>::div(x, y))
+P1788_BENCH_UNARY(recip, F<R>::recip(x))
+P1788_BENCH_UNARY(sqr, F<R>::sqr(x))
+P1788_BENCH_UNARY(sqrt, F<R>::sqrt(x))
+P1788_BENCH_TERNARY(fma, F<R>::fma(x, y, z))
+P1788_BENCH_UNARY(pown, F<R>::pown(x, 3))
+P1788_BENCH_BINARY(pow, F<R>::pow(x, y))
+P1788_BENCH_UNARY(exp, F<R>::exp(x))
+P1788_BENCH_UNARY(exp2, F<R>::exp2(x))
+P1788_BENCH_UNARY(exp10, F<R>::exp10(x))
+P1788_BENCH_UNARY(log, F<R>::log(x))
+P1788_BENCH_UNARY(log2, F<R>::log2(x))
+P1788_BENCH_UNARY(log10, F<R>::log10(x))
+P1788_BENCH_UNARY(sin, F<R>::sin(x))
+P1788_BENCH_UNARY(cos, F<R>::cos(x))
+P1788_BENCH_UNARY(tan, F<R>::tan(x))
+P1788_BENCH_UNARY(asin, F<R>::asin(x))
+P1788_BENCH_UNARY(acos, F<R>::acos(x))
+P1788_BENCH_UNARY(atan, F<R>::atan(x))
+P1788_BENCH_BINARY(atan2, F<R>::atan2(x, y))
+P1788_BENCH_UNARY(sinh, F<R>::sinh(x))
+P1788_BENCH_UNARY(cosh, F<R>::cosh(x))
+P1788_BENCH_UNARY(tanh, F<R>::tanh(x))
+P1788_BENCH_UNARY(asinh, F<R>::asinh(x))
+P1788_BENCH_UNARY(acosh, F<R>::acosh(x))
+P1788_BENCH_UNARY(atanh, F<R>::atanh(x))
+P1788_BENCH_UNARY(sign, F<R>::sign(x))
+P1788_BENCH_UNARY(ceil, F<R>::ceil(x))
+P1788_BENCH_UNARY(floor, F<R>::floor(x))
+P1788_BENCH_UNARY(trunc, F<R>::trunc(x))
+P1788_BENCH_UNARY(round_ties_to_even, F<R>::round_ties_to_even(x))
+P1788_BENCH_UNARY(round_ties_to_away, F<R>::round_ties_to_away(x))
+P1788_BENCH_UNARY(abs, F<R>::abs(x))
+P1788_BENCH_BINARY(min, F<R>::min(x, y))
+P1788_BENCH_BINARY(max, F<R>::max(x, y))
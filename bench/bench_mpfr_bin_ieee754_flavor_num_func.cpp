@@ -0,0 +1,114 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Numeric functions
+
+#include <list>
+#include <vector>
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "num_func"
+
+using p1788_bench::F;
+using p1788_bench::REP;
+
+
+P1788_BENCH_UNARY(inf, F<R>::inf(x))
+P1788_BENCH_UNARY(sup, F<R>::sup(x))
+P1788_BENCH_UNARY(mid, F<R>::mid(x))
+P1788_BENCH_UNARY(rad, F<R>::rad(x))
+P1788_BENCH_UNARY(mid_rad, F<R>::mid_rad(x))
+P1788_BENCH_UNARY(wid, F<R>::wid(x))
+P1788_BENCH_UNARY(mag, F<R>::mag(x))
+P1788_BENCH_UNARY(mig, F<R>::mig(x))
+
+
+namespace
+{
+
+// The array versions evaluate a block of intervals given by their bounds per
+// call, the block is started at every block-th iteration such that the reported
+// time is the time per interval.
+struct num_array_registrar
+{
+    static const std::size_t block = 256;
+
+    struct bounds
+    {
+        std::vector<double> inf;
+        std::vector<double> sup;
+
+        explicit bounds(std::vector<REP<double>> const& x)
+        {
+            for (auto const& r : x)
+            {
+                inf.push_back(r.first);
+                sup.push_back(r.second);
+            }
+        }
+    };
+
+    typedef void (*array_func)(double const*, double const*, double*, std::size_t);
+
+    num_array_registrar()
+    {
+        using p1788_bench::distribution;
+
+        std::pair<char const*, array_func> const funcs[] =
+        {
+            { "mid_array", &F<double>::mid },
+            { "rad_array", &F<double>::rad },
+            { "wid_array", &F<double>::wid },
+            { "mag_array", &F<double>::mag },
+            { "mig_array", &F<double>::mig }
+        };
+
+        for (distribution d : p1788_bench::distributions)
+        {
+            pools.emplace_back(p1788_bench::inputs<double>(d, 0));
+            bounds const& x = pools.back();
+
+            for (auto const& f : funcs)
+            {
+                array_func g = f.second;
+
+                p1788_bench::add(P1788_BENCH_GROUP, f.first, "bare", d,
+                                 [&x, g](std::size_t i)
+                {
+                    static double out[block];
+                    if (i % block == 0)
+                        g(&x.inf[i], &x.sup[i], out, block);
+                    return out[i % block];
+                });
+            }
+        }
+    }
+
+    // bounds in SoA layout, the registrar lives as long as the registry
+    std::list<bounds> pools;
+} num_array_registrar_instance;
+
+} // namespace
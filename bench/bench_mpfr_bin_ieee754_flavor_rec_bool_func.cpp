@@ -0,0 +1,37 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Recommended boolean functions
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "rec_bool_func"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_PREDICATE(is_common_interval, F<R>::is_common_interval(x))
+P1788_BENCH_PREDICATE(is_singleton, F<R>::is_singleton(x))
+P1788_BENCH_PREDICATE(is_member, F<R>::is_member(1.0, x))
@@ -0,0 +1,53 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Recommended forward-mode elementary functions
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "rec_elem_func"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_UNARY(rootn, F<R>::rootn(x, 3))
+P1788_BENCH_UNARY(expm1, F<R>::expm1(x))
+P1788_BENCH_UNARY(log1p, F<R>::log1p(x))
+P1788_BENCH_BINARY(compoundm1, F<R>::compoundm1(x, y))
+P1788_BENCH_BINARY(hypot, F<R>::hypot(x, y))
+P1788_BENCH_UNARY(rsqrt, F<R>::rsqrt(x))
+
+// The pi-scaled functions require MPFR >= 4.2.0
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,2,0)
+
+P1788_BENCH_UNARY(sinpi, F<R>::sinpi(x))
+P1788_BENCH_UNARY(cospi, F<R>::cospi(x))
+P1788_BENCH_UNARY(tanpi, F<R>::tanpi(x))
+P1788_BENCH_UNARY(asinpi, F<R>::asinpi(x))
+P1788_BENCH_UNARY(acospi, F<R>::acospi(x))
+P1788_BENCH_UNARY(atanpi, F<R>::atanpi(x))
+P1788_BENCH_BINARY(atan2pi, F<R>::atan2pi(x, y))
+
+#endif
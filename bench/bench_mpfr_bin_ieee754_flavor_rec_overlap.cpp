@@ -0,0 +1,78 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Interval overlapping
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "rec_overlap"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_BINARY_OPERAND_MIXED(overlap, F<R>::overlap(x, y))
+
+
+namespace
+{
+
+// The batched overlap classifies a block of pairs per call, the block is started
+// at every block-th iteration such that the reported time is the time per pair.
+struct overlap_batch_registrar
+{
+    static const std::size_t block = 64;
+
+    overlap_batch_registrar()
+    {
+        using p1788_bench::distribution;
+
+        for (distribution d : p1788_bench::distributions)
+        {
+            auto const& x = p1788_bench::inputs<double>(d, 0);
+            auto const& y = p1788_bench::inputs<double>(d, 1);
+            auto const& xd = p1788_bench::dec_inputs<double>(d, 0);
+            auto const& yd = p1788_bench::dec_inputs<double>(d, 1);
+
+            p1788_bench::add(P1788_BENCH_GROUP, "overlap_batch", "bare", d,
+                             [&x, &y](std::size_t i)
+            {
+                static p1788::overlapping::overlapping_state out[block];
+                if (i % block == 0)
+                    F<double>::overlap(&x[i], &y[i], out, block);
+                return out[i % block];
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "overlap_batch", "dec", d,
+                             [&xd, &yd](std::size_t i)
+            {
+                static p1788::overlapping::overlapping_state out[block];
+                if (i % block == 0)
+                    F<double>::overlap(&xd[i], &yd[i], out, block);
+                return out[i % block];
+            });
+        }
+    }
+} overlap_batch_registrar_instance;
+
+} // namespace
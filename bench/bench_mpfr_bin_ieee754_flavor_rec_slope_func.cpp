@@ -0,0 +1,44 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Recommended slope functions
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "rec_slope_func"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_UNARY(exp_slope1, F<R>::exp_slope1(x))
+P1788_BENCH_UNARY(exp_slope2, F<R>::exp_slope2(x))
+P1788_BENCH_UNARY(log_slope1, F<R>::log_slope1(x))
+P1788_BENCH_UNARY(log_slope2, F<R>::log_slope2(x))
+P1788_BENCH_UNARY(cos_slope2, F<R>::cos_slope2(x))
+P1788_BENCH_UNARY(sin_slope3, F<R>::sin_slope3(x))
+P1788_BENCH_UNARY(asin_slope3, F<R>::asin_slope3(x))
+P1788_BENCH_UNARY(atan_slope3, F<R>::atan_slope3(x))
+P1788_BENCH_UNARY(cosh_slope2, F<R>::cosh_slope2(x))
+P1788_BENCH_UNARY(sinh_slope3, F<R>::sinh_slope3(x))
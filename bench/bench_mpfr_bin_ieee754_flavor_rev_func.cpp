@@ -0,0 +1,58 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Reverse-mode elementary functions
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "rev_func"
+
+using p1788_bench::F;
+
+
+P1788_BENCH_UNARY(sqr_rev, F<R>::sqr_rev(x))
+P1788_BENCH_BINARY(sqr_rev_x, F<R>::sqr_rev(x, y))
+P1788_BENCH_UNARY(abs_rev, F<R>::abs_rev(x))
+P1788_BENCH_BINARY(abs_rev_x, F<R>::abs_rev(x, y))
+P1788_BENCH_UNARY(pown_rev, F<R>::pown_rev(x, 3))
+P1788_BENCH_BINARY(pown_rev_x, F<R>::pown_rev(x, y, 3))
+P1788_BENCH_UNARY(sin_rev, F<R>::sin_rev(x))
+P1788_BENCH_BINARY(sin_rev_x, F<R>::sin_rev(x, y))
+P1788_BENCH_UNARY(cos_rev, F<R>::cos_rev(x))
+P1788_BENCH_BINARY(cos_rev_x, F<R>::cos_rev(x, y))
+P1788_BENCH_UNARY(tan_rev, F<R>::tan_rev(x))
+P1788_BENCH_BINARY(tan_rev_x, F<R>::tan_rev(x, y))
+P1788_BENCH_UNARY(cosh_rev, F<R>::cosh_rev(x))
+P1788_BENCH_BINARY(cosh_rev_x, F<R>::cosh_rev(x, y))
+P1788_BENCH_BINARY(mul_rev, F<R>::mul_rev(x, y))
+P1788_BENCH_TERNARY(mul_rev_x, F<R>::mul_rev(x, y, z))
+P1788_BENCH_BINARY(pow_rev1, F<R>::pow_rev1(x, y))
+P1788_BENCH_TERNARY(pow_rev1_x, F<R>::pow_rev1(x, y, z))
+P1788_BENCH_BINARY(pow_rev2, F<R>::pow_rev2(x, y))
+P1788_BENCH_TERNARY(pow_rev2_x, F<R>::pow_rev2(x, y, z))
+P1788_BENCH_BINARY(atan2_rev1, F<R>::atan2_rev1(x, y))
+P1788_BENCH_TERNARY(atan2_rev1_x, F<R>::atan2_rev1(x, y, z))
+P1788_BENCH_BINARY(atan2_rev2, F<R>::atan2_rev2(x, y))
+P1788_BENCH_TERNARY(atan2_rev2_x, F<R>::atan2_rev2(x, y, z))
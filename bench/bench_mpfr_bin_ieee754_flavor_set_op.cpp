@@ -0,0 +1,98 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Set operations
+
+#include <cstddef>
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "set_op"
+
+using p1788_bench::F;
+using p1788_bench::REP;
+using p1788_bench::REP_DEC;
+
+
+P1788_BENCH_BINARY(intersection, F<R>::intersection(x, y))
+P1788_BENCH_BINARY(convex_hull, F<R>::convex_hull(x, y))
+
+
+namespace
+{
+
+// The array versions reduce a block of intervals per call, the block is
+// started at every block-th iteration such that the reported time is the time
+// per interval. The intersection of a block stops early as soon as it is empty.
+struct reduction_registrar
+{
+    static const std::size_t block = 256;
+
+    reduction_registrar()
+    {
+        using p1788_bench::distribution;
+
+        for (distribution d : p1788_bench::distributions)
+        {
+            auto const& x = p1788_bench::inputs<double>(d, 0);
+            auto const& xd = p1788_bench::dec_inputs<double>(d, 0);
+
+            p1788_bench::add(P1788_BENCH_GROUP, "intersection_array", "bare", d,
+                             [&x](std::size_t i)
+            {
+                static REP<double> r;
+                if (i % block == 0)
+                    r = F<double>::intersection(&x[i], block);
+                return r;
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "intersection_array", "dec", d,
+                             [&xd](std::size_t i)
+            {
+                static REP_DEC<double> r;
+                if (i % block == 0)
+                    r = F<double>::intersection(&xd[i], block);
+                return r;
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "convex_hull_array", "bare", d,
+                             [&x](std::size_t i)
+            {
+                static REP<double> r;
+                if (i % block == 0)
+                    r = F<double>::convex_hull(&x[i], block);
+                return r;
+            });
+            p1788_bench::add(P1788_BENCH_GROUP, "convex_hull_array", "dec", d,
+                             [&xd](std::size_t i)
+            {
+                static REP_DEC<double> r;
+                if (i % block == 0)
+                    r = F<double>::convex_hull(&xd[i], block);
+                return r;
+            });
+        }
+    }
+} reduction_registrar_instance;
+
+} // namespace
@@ -0,0 +1,92 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Constructors and conversions
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "setup_func"
+
+using p1788_bench::F;
+using p1788_bench::REP;
+using p1788_bench::REP_DEC;
+using p1788_bench::distribution;
+
+
+namespace
+{
+
+// The constructors do not share the operand structure of the other flavor
+// functions, hence the variants are registered individually.
+struct setup_func_registrar
+{
+    setup_func_registrar()
+    {
+        using p1788_bench::add;
+
+        for (distribution d : p1788_bench::distributions)
+        {
+            auto const& x = p1788_bench::inputs<double>(d, 0);
+            auto const& xd = p1788_bench::dec_inputs<double>(d, 0);
+            auto const& t = p1788_bench::text_inputs(d);
+
+            add(P1788_BENCH_GROUP, "nums_to_interval", "bare", d,
+                [&x](std::size_t i) { return F<double>::nums_to_interval(x[i].first, x[i].second); });
+            add(P1788_BENCH_GROUP, "nums_to_interval", "bare_mixed", d,
+                [&x](std::size_t i) { return F<float>::nums_to_interval(x[i].first, x[i].second); });
+            add(P1788_BENCH_GROUP, "nums_to_interval", "dec", d,
+                [&x](std::size_t i) { return F<double>::nums_to_decorated_interval(x[i].first, x[i].second); });
+            add(P1788_BENCH_GROUP, "nums_to_interval", "dec_mixed", d,
+                [&x](std::size_t i) { return F<float>::nums_to_decorated_interval(x[i].first, x[i].second); });
+
+            add(P1788_BENCH_GROUP, "text_to_interval", "bare", d,
+                [&t](std::size_t i) { return F<double>::text_to_interval(t[i]); });
+            add(P1788_BENCH_GROUP, "text_to_interval", "dec", d,
+                [&t](std::size_t i) { return F<double>::text_to_decorated_interval(t[i]); });
+
+            add(P1788_BENCH_GROUP, "convert_type", "bare_mixed", d,
+                [&x](std::size_t i) { return F<float>::convert_type(x[i]); });
+            add(P1788_BENCH_GROUP, "convert_type", "dec_mixed", d,
+                [&xd](std::size_t i) { return F<float>::convert_type(xd[i]); });
+
+            add(P1788_BENCH_GROUP, "new_dec", "bare", d,
+                [&x](std::size_t i) { return F<double>::new_dec(x[i]); });
+            add(P1788_BENCH_GROUP, "new_dec", "bare_mixed", d,
+                [&x](std::size_t i) { return F<float>::new_dec(x[i]); });
+
+            add(P1788_BENCH_GROUP, "set_dec", "bare", d,
+                [&x](std::size_t i) { return F<double>::set_dec(x[i], p1788::decoration::decoration::dac); });
+            add(P1788_BENCH_GROUP, "set_dec", "bare_mixed", d,
+                [&x](std::size_t i) { return F<float>::set_dec(x[i], p1788::decoration::decoration::dac); });
+
+            add(P1788_BENCH_GROUP, "interval_part", "dec", d,
+                [&xd](std::size_t i) { return F<double>::interval_part(xd[i]); });
+            add(P1788_BENCH_GROUP, "interval_part", "dec_mixed", d,
+                [&xd](std::size_t i) { return F<float>::interval_part(xd[i]); });
+        }
+    }
+} setup_func_registrar_instance;
+
+} // namespace
@@ -0,0 +1,106 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// Unchecked variants of the basic arithmetic operations, registered under the
+// same function and variant names as in elem_func for a direct comparison
+
+#include "bench/util/bench_harness.hpp"
+
+#define P1788_BENCH_GROUP "unchecked_func"
+
+using p1788_bench::F;
+using p1788_bench::distribution;
+
+
+namespace
+{
+
+const auto UNCHECKED = p1788::infsup::unchecked;
+
+// The unchecked functions have no mixed type variants, hence only the bare
+// and the decorated variant are registered.
+struct unchecked_func_registrar
+{
+    template<typename X, typename Op>
+    static void unary(char const* function, distribution d, X const& x, char const* variant, Op op)
+    {
+        p1788_bench::add(P1788_BENCH_GROUP, function, variant, d,
+                         [&x, op](std::size_t i) { return op(x[i]); });
+    }
+
+    template<typename X, typename Op>
+    static void binary(char const* function, distribution d, X const& x, X const& y, char const* variant, Op op)
+    {
+        p1788_bench::add(P1788_BENCH_GROUP, function, variant, d,
+                         [&x, &y, op](std::size_t i) { return op(x[i], y[i]); });
+    }
+
+    unchecked_func_registrar()
+    {
+        typedef p1788_bench::REP<double> R;
+        typedef p1788_bench::REP_DEC<double> RD;
+
+        for (distribution d : p1788_bench::distributions)
+        {
+            auto const& x = p1788_bench::inputs<double>(d, 0);
+            auto const& y = p1788_bench::inputs<double>(d, 1);
+            auto const& z = p1788_bench::inputs<double>(d, 2);
+            auto const& xd = p1788_bench::dec_inputs<double>(d, 0);
+            auto const& yd = p1788_bench::dec_inputs<double>(d, 1);
+            auto const& zd = p1788_bench::dec_inputs<double>(d, 2);
+
+            unary("neg", d, x, "bare", [](R const& a) { return F<double>::neg(a, UNCHECKED); });
+            unary("neg", d, xd, "dec", [](RD const& a) { return F<double>::neg(a, UNCHECKED); });
+
+            binary("add", d, x, y, "bare", [](R const& a, R const& b) { return F<double>::add(a, b, UNCHECKED); });
+            binary("add", d, xd, yd, "dec", [](RD const& a, RD const& b) { return F<double>::add(a, b, UNCHECKED); });
+
+            binary("sub", d, x, y, "bare", [](R const& a, R const& b) { return F<double>::sub(a, b, UNCHECKED); });
+            binary("sub", d, xd, yd, "dec", [](RD const& a, RD const& b) { return F<double>::sub(a, b, UNCHECKED); });
+
+            binary("mul", d, x, y, "bare", [](R const& a, R const& b) { return F<double>::mul(a, b, UNCHECKED); });
+            binary("mul", d, xd, yd, "dec", [](RD const& a, RD const& b) { return F<double>::mul(a, b, UNCHECKED); });
+
+            binary("div", d, x, y, "bare", [](R const& a, R const& b) { return F<double>::div(a, b, UNCHECKED); });
+            binary("div", d, xd, yd, "dec", [](RD const& a, RD const& b) { return F<double>::div(a, b, UNCHECKED); });
+
+            unary("recip", d, x, "bare", [](R const& a) { return F<double>::recip(a, UNCHECKED); });
+            unary("recip", d, xd, "dec", [](RD const& a) { return F<double>::recip(a, UNCHECKED); });
+
+            unary("sqr", d, x, "bare", [](R const& a) { return F<double>::sqr(a, UNCHECKED); });
+            unary("sqr", d, xd, "dec", [](RD const& a) { return F<double>::sqr(a, UNCHECKED); });
+
+            unary("sqrt", d, x, "bare", [](R const& a) { return F<double>::sqrt(a, UNCHECKED); });
+            unary("sqrt", d, xd, "dec", [](RD const& a) { return F<double>::sqrt(a, UNCHECKED); });
+
+            p1788_bench::add(P1788_BENCH_GROUP, "fma", "bare", d,
+                             [&x, &y, &z](std::size_t i) { return F<double>::fma(x[i], y[i], z[i], UNCHECKED); });
+            p1788_bench::add(P1788_BENCH_GROUP, "fma", "dec", d,
+                             [&xd, &yd, &zd](std::size_t i) { return F<double>::fma(xd[i], yd[i], zd[i], UNCHECKED); });
+        }
+    }
+} unchecked_func_registrar_instance;
+
+} // namespace
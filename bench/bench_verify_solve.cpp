@@ -0,0 +1,259 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+// Benchmark of p1788::linalg::verify_solve across system sizes
+//
+// Usage: bench_verify_solve [--sizes=<n>,<n>,...] [--threads=<t>,<t>,...]
+//                           [--repetitions=<n>] [--json=<file>|-]
+//
+// Every size is solved for every number of threads (0 = hardware concurrency)
+// on a diagonally dominant random system with intervals of relative width 2^-30.
+// The fastest of --repetitions runs is reported, together with the time of the
+// approximate inverse alone and the maximal width of the enclosure.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "p1788/version.hpp"
+#include "p1788/p1788.hpp"
+#include "p1788/linalg/verify_solve.hpp"
+
+
+namespace
+{
+
+typedef p1788::infsup::interval<double, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> I;
+typedef p1788::linalg::interval_vector<double, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> IV;
+typedef p1788::linalg::interval_matrix<double, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> IM;
+
+struct result
+{
+    std::size_t size;
+    unsigned threads;
+    double seconds;
+    double seconds_inverse;
+    double max_width;
+    bool verified;
+};
+
+void random_system(std::size_t n, IM& a, IV& b)
+{
+    std::mt19937_64 gen(1788u + n);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+
+    a = IM(n, n);
+    b = IV(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            double m = unit(gen) + (i == j ? static_cast<double>(n) : 0.0);
+            double r = std::ldexp(std::abs(m), -30);
+            a(i, j) = I(m - r, m + r);
+        }
+
+        double m = unit(gen);
+        double r = std::ldexp(std::abs(m), -30);
+        b[i] = I(m - r, m + r);
+    }
+}
+
+template<typename Func>
+double seconds(Func f, unsigned repetitions)
+{
+    double best = 0.0;
+
+    for (unsigned r = 0; r < repetitions; ++r)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop = std::chrono::steady_clock::now();
+
+        double t = std::chrono::duration<double>(stop - start).count();
+        best = r ? std::min(best, t) : t;
+    }
+
+    return best;
+}
+
+result measure(std::size_t n, unsigned threads, unsigned repetitions)
+{
+    IM a;
+    IV b;
+    random_system(n, a, b);
+
+    std::vector<double> am(n * n);
+    for (std::size_t i = 0; i < n * n; ++i)
+        am[i] = mid(a.data()[i]);
+
+    unsigned old = p1788::util::set_num_threads(threads);
+
+    IV x;
+    bool verified = false;
+    std::vector<double> r;
+
+    double t = seconds([&] { verified = p1788::linalg::verify_solve(a, b, x); }, repetitions);
+    double t_inv = seconds([&] { p1788::linalg::approximate_inverse(am, n, r); }, repetitions);
+
+    p1788::util::set_num_threads(old);
+
+    double w = 0.0;
+    for (auto const& xi : x)
+        w = std::max(w, wid(xi));
+
+    return result { n, threads, t, t_inv, w, verified };
+}
+
+std::vector<std::size_t> parse_list(std::string const& s)
+{
+    std::vector<std::size_t> l;
+    std::istringstream is(s);
+    std::string item;
+
+    while (std::getline(is, item, ','))
+        l.push_back(static_cast<std::size_t>(std::atol(item.c_str())));
+
+    return l;
+}
+
+void write_json(std::ostream& os, std::vector<result> const& results, unsigned repetitions)
+{
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"library_version\": \"" << P1788_VERSION_STRING << "\",\n";
+    os << "    \"compiler\": \"" << __VERSION__ << "\",\n";
+    os << "    \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"repetitions\": " << repetitions << "\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        result const& r = results[i];
+
+        os << (i ? ",\n" : "\n");
+        os << "    {\"name\": \"verify_solve/" << r.size << "/" << r.threads << "\", "
+           << "\"size\": " << r.size << ", "
+           << "\"threads\": " << r.threads << ", "
+           << "\"seconds\": " << r.seconds << ", "
+           << "\"seconds_inverse\": " << r.seconds_inverse << ", "
+           << "\"max_width\": " << r.max_width << ", "
+           << "\"verified\": " << (r.verified ? "true" : "false") << "}";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+bool option(std::string const& arg, std::string const& key, std::string& value)
+{
+    if (arg.compare(0, key.size(), key) != 0)
+        return false;
+
+    value = arg.substr(key.size());
+    return true;
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::size_t> sizes = { 10, 50, 100, 200, 500 };
+    std::vector<std::size_t> threads = { 1, 0 };
+    std::string json;
+    unsigned repetitions = 3;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        std::string value;
+
+        if (option(arg, "--sizes=", value))
+            sizes = parse_list(value);
+        else if (option(arg, "--threads=", value))
+            threads = parse_list(value);
+        else if (option(arg, "--json=", value))
+            json = value;
+        else if (option(arg, "--repetitions=", value))
+            repetitions = std::max(1, std::atoi(value.c_str()));
+        else
+        {
+            std::cerr << "usage: " << argv[0]
+                      << " [--sizes=<n>,<n>,...] [--threads=<t>,<t>,...] [--repetitions=<n>] [--json=<file>|-]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<result> results;
+
+    for (std::size_t n : sizes)
+    {
+        for (std::size_t t : threads)
+        {
+            results.push_back(measure(n, static_cast<unsigned>(t), repetitions));
+
+            if (json != "-")
+            {
+                result const& r = results.back();
+
+                std::printf("verify_solve n=%-6zu threads=%-3u %12.6f s %12.6f s (inverse)  max width %.3e%s\n",
+                            r.size, r.threads, r.seconds, r.seconds_inverse, r.max_width,
+                            r.verified ? "" : "  NOT VERIFIED");
+                std::fflush(stdout);
+            }
+        }
+    }
+
+    if (json == "-")
+    {
+        write_json(std::cout, results, repetitions);
+    }
+    else if (!json.empty())
+    {
+        std::ofstream os(json);
+
+        if (!os)
+        {
+            std::cerr << "unable to open " << json << std::endl;
+            return 1;
+        }
+
+        write_json(os, results, repetitions);
+    }
+
+    return 0;
+}
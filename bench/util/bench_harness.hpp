@@ -0,0 +1,334 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_BENCH_UTIL_BENCH_HARNESS_HPP
+#define LIBIEEEP1788_BENCH_UTIL_BENCH_HARNESS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+
+
+// Self-contained microbenchmark harness for the flavor functions.
+//
+// Every benchmark is registered during static initialization by one of the
+// P1788_BENCH_* macros below and executed by bench_main.cpp. A benchmark
+// evaluates one flavor function in one variant (bare, bare_mixed, dec, dec_mixed)
+// on one input distribution (narrow, wide, straddling_zero, unbounded).
+//
+// The macros expect the translation unit to define P1788_BENCH_GROUP as a
+// string literal naming the function group. The expression passed to a macro
+// is written in terms of the result flavor F<R> and the operands x, y and z.
+
+namespace p1788_bench
+{
+
+template<typename T>
+using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
+
+template<typename T>
+using REP = typename F<T>::representation;
+
+template<typename T>
+using REP_DEC = typename F<T>::representation_dec;
+
+
+// Input distributions
+enum class distribution
+{
+    narrow,             // bounded, relative width 2^-40, not containing 0
+    wide,               // bounded, width up to 1000, not containing 0
+    straddling_zero,    // bounded, containing 0 in the interior
+    unbounded           // half-unbounded and entire intervals
+};
+
+const distribution distributions[] = { distribution::narrow, distribution::wide,
+                                       distribution::straddling_zero, distribution::unbounded
+                                     };
+
+inline char const* distribution_name(distribution d)
+{
+    switch (d)
+    {
+    case distribution::narrow:
+        return "narrow";
+    case distribution::wide:
+        return "wide";
+    case distribution::straddling_zero:
+        return "straddling_zero";
+    default:
+        return "unbounded";
+    }
+}
+
+
+// Number of inputs per pool, has to be a power of two
+const std::size_t input_size = 1024;
+
+// Pools of bare and decorated input intervals, stream selects an independent
+// pool for the second and third operand
+template<typename T>
+std::vector<REP<T>> const& inputs(distribution d, unsigned stream);
+
+template<typename T>
+std::vector<REP_DEC<T>> const& dec_inputs(distribution d, unsigned stream);
+
+// Pool of interval literals
+std::vector<std::string> const& text_inputs(distribution d);
+
+
+// Prevents the compiler from discarding the computation of value
+template<typename T>
+inline void do_not_optimize(T const& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+
+struct benchmark
+{
+    std::string group;
+    std::string function;
+    std::string variant;
+    std::string distribution;
+
+    // performs the given number of iterations
+    std::function<void(std::size_t)> run;
+};
+
+inline std::vector<benchmark>& registry()
+{
+    static std::vector<benchmark> benchmarks;
+    return benchmarks;
+}
+
+template<typename Op>
+void add(std::string const& group, std::string const& function,
+         std::string const& variant, distribution d, Op op)
+{
+    registry().push_back(benchmark {group, function, variant, distribution_name(d),
+                                    [op](std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            do_not_optimize(op(i & (input_size - 1)));
+    }
+                                   });
+}
+
+
+// f(x), mixed type variant F<float>::f(double)
+template<typename Op>
+struct unary
+{
+    static void add(std::string const& group, std::string const& function)
+    {
+        for (distribution d : distributions)
+        {
+            auto const& x = inputs<double>(d, 0);
+            auto const& xd = dec_inputs<double>(d, 0);
+
+            p1788_bench::add(group, function, "bare", d,
+                             [&x](std::size_t i) { return Op::template apply<double>(x[i]); });
+            p1788_bench::add(group, function, "bare_mixed", d,
+                             [&x](std::size_t i) { return Op::template apply<float>(x[i]); });
+            p1788_bench::add(group, function, "dec", d,
+                             [&xd](std::size_t i) { return Op::template apply<double>(xd[i]); });
+            p1788_bench::add(group, function, "dec_mixed", d,
+                             [&xd](std::size_t i) { return Op::template apply<float>(xd[i]); });
+        }
+    }
+};
+
+// f(x) without a mixed type variant
+template<typename Op>
+struct predicate
+{
+    static void add(std::string const& group, std::string const& function)
+    {
+        for (distribution d : distributions)
+        {
+            auto const& x = inputs<double>(d, 0);
+            auto const& xd = dec_inputs<double>(d, 0);
+
+            p1788_bench::add(group, function, "bare", d,
+                             [&x](std::size_t i) { return Op::template apply<double>(x[i]); });
+            p1788_bench::add(group, function, "dec", d,
+                             [&xd](std::size_t i) { return Op::template apply<double>(xd[i]); });
+        }
+    }
+};
+
+// f(x, y), mixed type variant F<float>::f(double, double)
+template<typename Op>
+struct binary
+{
+    static void add(std::string const& group, std::string const& function)
+    {
+        for (distribution d : distributions)
+        {
+            auto const& x = inputs<double>(d, 0);
+            auto const& y = inputs<double>(d, 1);
+            auto const& xd = dec_inputs<double>(d, 0);
+            auto const& yd = dec_inputs<double>(d, 1);
+
+            p1788_bench::add(group, function, "bare", d,
+                             [&x, &y](std::size_t i) { return Op::template apply<double>(x[i], y[i]); });
+            p1788_bench::add(group, function, "bare_mixed", d,
+                             [&x, &y](std::size_t i) { return Op::template apply<float>(x[i], y[i]); });
+            p1788_bench::add(group, function, "dec", d,
+                             [&xd, &yd](std::size_t i) { return Op::template apply<double>(xd[i], yd[i]); });
+            p1788_bench::add(group, function, "dec_mixed", d,
+                             [&xd, &yd](std::size_t i) { return Op::template apply<float>(xd[i], yd[i]); });
+        }
+    }
+};
+
+// f(x, y) with a mixed type operand, mixed type variant F<double>::f(double, float)
+template<typename Op>
+struct binary_operand_mixed
+{
+    static void add(std::string const& group, std::string const& function)
+    {
+        for (distribution d : distributions)
+        {
+            auto const& x = inputs<double>(d, 0);
+            auto const& y = inputs<double>(d, 1);
+            auto const& yf = inputs<float>(d, 1);
+            auto const& xd = dec_inputs<double>(d, 0);
+            auto const& yd = dec_inputs<double>(d, 1);
+            auto const& ydf = dec_inputs<float>(d, 1);
+
+            p1788_bench::add(group, function, "bare", d,
+                             [&x, &y](std::size_t i) { return Op::template apply<double>(x[i], y[i]); });
+            p1788_bench::add(group, function, "bare_mixed", d,
+                             [&x, &yf](std::size_t i) { return Op::template apply<double>(x[i], yf[i]); });
+            p1788_bench::add(group, function, "dec", d,
+                             [&xd, &yd](std::size_t i) { return Op::template apply<double>(xd[i], yd[i]); });
+            p1788_bench::add(group, function, "dec_mixed", d,
+                             [&xd, &ydf](std::size_t i) { return Op::template apply<double>(xd[i], ydf[i]); });
+        }
+    }
+};
+
+// f(x, y, z), mixed type variant F<float>::f(double, double, double)
+template<typename Op>
+struct ternary
+{
+    static void add(std::string const& group, std::string const& function)
+    {
+        for (distribution d : distributions)
+        {
+            auto const& x = inputs<double>(d, 0);
+            auto const& y = inputs<double>(d, 1);
+            auto const& z = inputs<double>(d, 2);
+            auto const& xd = dec_inputs<double>(d, 0);
+            auto const& yd = dec_inputs<double>(d, 1);
+            auto const& zd = dec_inputs<double>(d, 2);
+
+            p1788_bench::add(group, function, "bare", d,
+                             [&x, &y, &z](std::size_t i) { return Op::template apply<double>(x[i], y[i], z[i]); });
+            p1788_bench::add(group, function, "bare_mixed", d,
+                             [&x, &y, &z](std::size_t i) { return Op::template apply<float>(x[i], y[i], z[i]); });
+            p1788_bench::add(group, function, "dec", d,
+                             [&xd, &yd, &zd](std::size_t i) { return Op::template apply<double>(xd[i], yd[i], zd[i]); });
+            p1788_bench::add(group, function, "dec_mixed", d,
+                             [&xd, &yd, &zd](std::size_t i) { return Op::template apply<float>(xd[i], yd[i], zd[i]); });
+        }
+    }
+};
+
+template<typename Kind>
+struct registrar
+{
+    registrar(char const* group, char const* function)
+    {
+        Kind::add(group, function);
+    }
+};
+
+} // namespace p1788_bench
+
+
+#define P1788_BENCH_UNARY(ID, EXPR)                                                 \
+    namespace {                                                                     \
+    struct ID ## _op                                                                \
+    {                                                                               \
+        template<typename R, typename X>                                            \
+        static auto apply(X const& x) -> decltype(EXPR) { return EXPR; }            \
+    };                                                                              \
+    p1788_bench::registrar<p1788_bench::unary<ID ## _op>>                           \
+        ID ## _registrar(P1788_BENCH_GROUP, #ID);                                   \
+    }
+
+#define P1788_BENCH_PREDICATE(ID, EXPR)                                             \
+    namespace {                                                                     \
+    struct ID ## _op                                                                \
+    {                                                                               \
+        template<typename R, typename X>                                            \
+        static auto apply(X const& x) -> decltype(EXPR) { return EXPR; }            \
+    };                                                                              \
+    p1788_bench::registrar<p1788_bench::predicate<ID ## _op>>                       \
+        ID ## _registrar(P1788_BENCH_GROUP, #ID);                                   \
+    }
+
+#define P1788_BENCH_BINARY(ID, EXPR)                                                \
+    namespace {                                                                     \
+    struct ID ## _op                                                                \
+    {                                                                               \
+        template<typename R, typename X, typename Y>                                \
+        static auto apply(X const& x, Y const& y) -> decltype(EXPR) { return EXPR; }\
+    };                                                                              \
+    p1788_bench::registrar<p1788_bench::binary<ID ## _op>>                          \
+        ID ## _registrar(P1788_BENCH_GROUP, #ID);                                   \
+    }
+
+#define P1788_BENCH_BINARY_OPERAND_MIXED(ID, EXPR)                                  \
+    namespace {                                                                     \
+    struct ID ## _op                                                                \
+    {                                                                               \
+        template<typename R, typename X, typename Y>                                \
+        static auto apply(X const& x, Y const& y) -> decltype(EXPR) { return EXPR; }\
+    };                                                                              \
+    p1788_bench::registrar<p1788_bench::binary_operand_mixed<ID ## _op>>            \
+        ID ## _registrar(P1788_BENCH_GROUP, #ID);                                   \
+    }
+
+#define P1788_BENCH_TERNARY(ID, EXPR)                                               \
+    namespace {                                                                     \
+    struct ID ## _op                                                                \
+    {                                                                               \
+        template<typename R, typename X, typename Y, typename Z>                    \
+        static auto apply(X const& x, Y const& y, Z const& z) -> decltype(EXPR)     \
+        { return EXPR; }                                                            \
+    };                                                                              \
+    p1788_bench::registrar<p1788_bench::ternary<ID ## _op>>                         \
+        ID ## _registrar(P1788_BENCH_GROUP, #ID);                                   \
+    }
+
+
+#endif // LIBIEEEP1788_BENCH_UTIL_BENCH_HARNESS_HPP
@@ -36,6 +36,7 @@
 #include <iostream>
 #include <vector>
 #include <iterator>
+#include <utility>
 
 #include "p1788/p1788.hpp"
 
@@ -64,8 +65,9 @@ void ia_bisect(I<T> (*f) (I<T> const&),     // function to be analyzed
         else
         {
             // recursive call with subintervals [inf(x),mid(x)] and [mid(x),sup(x)]
-            ia_bisect(f, I<T>(inf(x), mid(x)), eps, it);
-            ia_bisect(f, I<T>(mid(x), sup(x)), eps, it);
+            std::pair<I<T>, I<T>> parts = bisect(x);
+            ia_bisect(f, parts.first, eps, it);
+            ia_bisect(f, parts.second, eps, it);
         }
     }
 }
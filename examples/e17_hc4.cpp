@@ -0,0 +1,72 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+//   Simple example demonstrating the HC4 contractor for solving a system of
+//   nonlinear equations by branch and prune
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <vector>
+#include <iterator>
+
+#include "p1788/p1788.hpp"
+#include "p1788/contractor/hc4.hpp"
+
+// Template type alias to define a generic bare infsup interval with a setbased
+// infsup flavor based on mpfr supporting IEEE754 bound types.
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+
+int main()
+{
+    // expression DAG with the variables x and y
+    p1788::contractor::dag<I<double>> d;
+    auto x = d.variable(0);
+    auto y = d.variable(1);
+
+    // constraints x^2 + y^2 = 4 and x * y = 1
+    p1788::contractor::hc4<I<double>> c(d);
+    c.add_constraint(d.add(d.sqr(x), d.sqr(y)), I<double>(4.0,4.0));
+    c.add_constraint(d.mul(x, y), I<double>(1.0,1.0));
+
+    // solve over the box [-10,10] x [-10,10]
+    std::vector<std::vector<I<double>>> boxes;
+    c.branch_and_prune({I<double>(-10.0,10.0), I<double>(-10.0,10.0)}, 1e-8, std::back_inserter(boxes));
+
+    std::cout << "solutions of x^2 + y^2 = 4, x * y = 1 (over the box [-10,10] x [-10,10]):" << std::endl;
+    for (auto const& b : boxes)
+        std::cout << "    " << b[0] << " x " << b[1] << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+//   Interval Newton with derivatives from automatic differentiation
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <vector>
+#include <iterator>
+
+#include "p1788/p1788.hpp"
+#include "p1788/ad/gradient.hpp"
+
+// Template type alias to define a generic bare infsup interval with a setbased
+// infsup flavor based on mpfr supporting IEEE754 bound types.
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+// Value and derivative of a function of one variable
+template<typename T>
+using G = p1788::ad::gradient<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+
+// root finding method using Interval Newton, f is evaluated with the
+// gradient type and delivers the range and the derivative at once
+template<typename T, class OutputIt>
+void ia_newton(G<T> (*f) (G<T> const&),     // function to be analyzed
+               I<T> const& x,               // start interval
+               T eps,                       // epsilon
+               OutputIt it)                 // output iterator
+{
+    // range and derivative over x
+    G<T> fx = f(G<T>::variable(x));
+
+    // check if 0 is a member of f(x)
+    if ( !is_member(0.0, fx.value()) )
+        return;
+
+    // Newton step
+    T m = mid(x);
+    I<T> c = I<T>(m,m);
+    auto z = mul_rev_to_pair(fx.derivative(), f(G<T>(c)).value());      // z = f(c) / df(x)
+
+    // pairwise intersection of z and x
+    I<T> v1 = intersection(x, c - z.first);
+    I<T> v2 = intersection(x, c - z.second);
+
+    // bisection if v1 == x
+    if (v1 == x)
+    {
+        v1 = I<T>(inf(x), m);
+        v2 = I<T>(m, sup(x));
+    }
+
+    if (!is_empty(v1))
+    {
+        // check if v1 is a tight enough enclosure of 0
+        if (wid(v1) < eps)
+            *it++ = v1;     // save root
+        else
+            // recursive call with subinterval v1
+            ia_newton(f, v1, eps, it);
+    }
+
+    if (!is_empty(v2))
+    {
+        // check if v2 is a tight enough enclosure of 0
+        if (wid(v2) < eps)
+            *it++ = v2;     // save root
+        else
+            // recursive call with subinterval v2
+            ia_newton(f, v2, eps, it);
+    }
+}
+
+// f(x) = sin(x) - x / 4, no derivative has to be written by hand
+template<typename T>
+G<T> f (G<T> const& x)
+{
+    return sin(x) - x / I<T>(4.0,4.0);
+}
+
+
+int main()
+{
+    std::vector<I<double>> roots;
+
+    // start root finding
+    ia_newton(f, I<double>(-5.0,5.0), 0.00001, std::back_inserter(roots));
+
+    std::cout << "roots of f(x) = sin(x) - x/4 (over the range [-5,5]):" << std::endl;
+    for (auto i : roots)
+        std::cout << "    " << i << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,799 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_AD_GRADIENT_HPP
+#define LIBIEEEP1788_P1788_AD_GRADIENT_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "p1788/infsup/interval.hpp"
+
+
+namespace p1788
+{
+
+namespace ad
+{
+
+
+/// \brief Interval value together with an enclosure of its gradient
+///
+/// Forward mode automatic differentiation over bare intervals. A gradient
+/// stores an enclosure of the range of a function u over a box and
+/// enclosures of the ranges of the N partial derivatives of u over the same box.
+/// The overloaded operations and elementary functions propagate both with the
+/// chain rule evaluated in interval arithmetic, hence the derivatives of an
+/// arbitrary expression are enclosed without a hand-written derivative,
+/// e.g. for the interval Newton operator or the mean value form.
+///
+/// The derivatives are stored in a <c>std::array</c> of fixed size N,
+/// therefore a gradient needs no dynamic memory and all loops run over a
+/// compile-time number of components.
+///
+/// \note For the piecewise constant functions <c>sign</c>, <c>ceil</c>,
+/// <c>floor</c>, <c>trunc</c>, <c>round_ties_to_even</c> and
+/// <c>round_ties_to_away</c> the derivative is [0,0] if the function is
+/// constant over the argument and [Entire] if a discontinuity may be
+/// contained. For <c>abs</c>, <c>min</c> and <c>max</c> the hull of the
+/// one-sided derivatives is used, which is valid for the mean value form.
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+/// \tparam N number of independent variables
+///
+template<typename T, template<typename> class Flavor, std::size_t N = 1>
+class gradient
+{
+public:
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+    typedef std::array<interval_type, N> derivative_type;
+
+
+    /// \brief Number of independent variables
+    static constexpr std::size_t num_variables()
+    {
+        return N;
+    }
+
+    /// \brief Creates an empty value with zero derivatives
+    gradient()
+        : value_(), d_(zero())
+    { }
+
+    /// \brief Creates the constant \p x, all derivatives are [0,0]
+    gradient(interval_type const& x)
+        : value_(x), d_(zero())
+    { }
+
+    /// \brief Creates a value \p x with the derivatives \p d
+    gradient(interval_type const& x, derivative_type const& d)
+        : value_(x), d_(d)
+    { }
+
+    /// \brief Creates the independent variable \p i with the range \p x
+    ///
+    /// The derivative with respect to variable \p i is [1,1], all others are [0,0].
+    static gradient variable(interval_type const& x, std::size_t i = 0)
+    {
+        gradient g(x);
+        g.d_[i] = interval_type(1.0, 1.0);
+        return g;
+    }
+
+
+    /// \brief Enclosure of the value
+    interval_type const& value() const
+    {
+        return value_;
+    }
+
+    /// \brief Enclosure of the partial derivative with respect to variable \p i
+    interval_type const& derivative(std::size_t i = 0) const
+    {
+        return d_[i];
+    }
+
+    /// \brief Enclosures of all partial derivatives
+    derivative_type const& derivatives() const
+    {
+        return d_;
+    }
+
+private:
+
+    static derivative_type zero()
+    {
+        derivative_type d;
+        d.fill(interval_type(0.0, 0.0));
+        return d;
+    }
+
+    interval_type value_;
+    derivative_type d_;
+};
+
+
+// gradient with the value v and the derivatives f * du, i.e. the chain rule
+// for g(u) with v = g(u) and f = g'(u)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> chain_rule(typename gradient<T, Flavor, N>::interval_type const& v,
+        typename gradient<T, Flavor, N>::interval_type const& f,
+        gradient<T, Flavor, N> const& u)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = f * u.derivative(i);
+
+    return gradient<T, Flavor, N>(v, d);
+}
+
+// derivative of a piecewise constant function g with v = g(u), [0,0] if v is
+// a singleton and entire otherwise
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> piecewise_constant(typename gradient<T, Flavor, N>::interval_type const& v,
+        gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(v, interval_type::is_singleton(v) ? interval_type(0.0, 0.0) : interval_type::entire(), u);
+}
+
+
+// -----------------------------------------------------------------------------
+// Arithmetic operations
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> pos(gradient<T, Flavor, N> const& u)
+{
+    return u;
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> neg(gradient<T, Flavor, N> const& u)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = -u.derivative(i);
+
+    return gradient<T, Flavor, N>(-u.value(), d);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> add(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = u.derivative(i) + w.derivative(i);
+
+    return gradient<T, Flavor, N>(u.value() + w.value(), d);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sub(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = u.derivative(i) - w.derivative(i);
+
+    return gradient<T, Flavor, N>(u.value() - w.value(), d);
+}
+
+// (u w)' = u' w + u w'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> mul(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = u.derivative(i) * w.value() + u.value() * w.derivative(i);
+
+    return gradient<T, Flavor, N>(u.value() * w.value(), d);
+}
+
+// (u / w)' = (u' - (u / w) w') / w
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> div(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+    typename gradient<T, Flavor, N>::interval_type v = u.value() / w.value();
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = (u.derivative(i) - v * w.derivative(i)) / w.value();
+
+    return gradient<T, Flavor, N>(v, d);
+}
+
+// (1 / u)' = -(1 / u)^2 u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> recip(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::recip(u.value());
+    return chain_rule(v, -interval_type::sqr(v), u);
+}
+
+// (u^2)' = 2 u u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sqr(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::sqr(u.value()), interval_type(2.0, 2.0) * u.value(), u);
+}
+
+// sqrt(u)' = u' / (2 sqrt(u))
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sqrt(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::sqrt(u.value());
+    return chain_rule(v, interval_type::recip(interval_type(2.0, 2.0) * v), u);
+}
+
+// (u v + w)' = u' v + u v' + w'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> fma(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& v,
+                                  gradient<T, Flavor, N> const& w)
+{
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = u.derivative(i) * v.value() + u.value() * v.derivative(i) + w.derivative(i);
+
+    return gradient<T, Flavor, N>(gradient<T, Flavor, N>::interval_type::fma(u.value(), v.value(), w.value()), d);
+}
+
+
+// -----------------------------------------------------------------------------
+// Power functions
+// -----------------------------------------------------------------------------
+
+// (u^p)' = p u^(p-1) u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> pown(gradient<T, Flavor, N> const& u, int p)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    if (p == 0)
+        return chain_rule(interval_type::pown(u.value(), 0), interval_type(0.0, 0.0), u);
+
+    interval_type f(static_cast<double>(p), static_cast<double>(p));
+    return chain_rule(interval_type::pown(u.value(), p), f * interval_type::pown(u.value(), p - 1), u);
+}
+
+// (u^w)' = u^w (w' log(u) + w u' / u)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> pow(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    typename gradient<T, Flavor, N>::derivative_type d;
+    interval_type v = interval_type::pow(u.value(), w.value());
+    interval_type l = interval_type::log(u.value());
+    interval_type q = w.value() / u.value();
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = v * (w.derivative(i) * l + q * u.derivative(i));
+
+    return gradient<T, Flavor, N>(v, d);
+}
+
+
+// -----------------------------------------------------------------------------
+// Exponential and logarithmic functions
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> exp(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::exp(u.value());
+    return chain_rule(v, v, u);
+}
+
+// exp2(u)' = log(2) exp2(u) u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> exp2(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::exp2(u.value());
+    return chain_rule(v, interval_type::log(interval_type(2.0, 2.0)) * v, u);
+}
+
+// exp10(u)' = log(10) exp10(u) u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> exp10(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::exp10(u.value());
+    return chain_rule(v, interval_type::log(interval_type(10.0, 10.0)) * v, u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> log(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::log(u.value()), interval_type::recip(u.value()), u);
+}
+
+// log2(u)' = u' / (log(2) u)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> log2(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::log2(u.value()),
+                      interval_type::recip(interval_type::log(interval_type(2.0, 2.0)) * u.value()), u);
+}
+
+// log10(u)' = u' / (log(10) u)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> log10(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::log10(u.value()),
+                      interval_type::recip(interval_type::log(interval_type(10.0, 10.0)) * u.value()), u);
+}
+
+
+// -----------------------------------------------------------------------------
+// Trigonometric functions
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sin(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::sin(u.value()), interval_type::cos(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> cos(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::cos(u.value()), -interval_type::sin(u.value()), u);
+}
+
+// tan(u)' = (1 + tan(u)^2) u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> tan(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::tan(u.value());
+    return chain_rule(v, interval_type(1.0, 1.0) + interval_type::sqr(v), u);
+}
+
+// asin(u)' = u' / sqrt(1 - u^2)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> asin(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::asin(u.value()),
+                      interval_type::recip(interval_type::sqrt(interval_type(1.0, 1.0) - interval_type::sqr(u.value()))), u);
+}
+
+// acos(u)' = -u' / sqrt(1 - u^2)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> acos(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::acos(u.value()),
+                      -interval_type::recip(interval_type::sqrt(interval_type(1.0, 1.0) - interval_type::sqr(u.value()))), u);
+}
+
+// atan(u)' = u' / (1 + u^2)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> atan(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::atan(u.value()),
+                      interval_type::recip(interval_type(1.0, 1.0) + interval_type::sqr(u.value())), u);
+}
+
+// atan2(y, x)' = (x y' - y x') / (x^2 + y^2)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> atan2(gradient<T, Flavor, N> const& y, gradient<T, Flavor, N> const& x)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    typename gradient<T, Flavor, N>::derivative_type d;
+    interval_type r = interval_type::sqr(x.value()) + interval_type::sqr(y.value());
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = (x.value() * y.derivative(i) - y.value() * x.derivative(i)) / r;
+
+    return gradient<T, Flavor, N>(interval_type::atan2(y.value(), x.value()), d);
+}
+
+
+// -----------------------------------------------------------------------------
+// Hyperbolic functions
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sinh(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::sinh(u.value()), interval_type::cosh(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> cosh(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::cosh(u.value()), interval_type::sinh(u.value()), u);
+}
+
+// tanh(u)' = (1 - tanh(u)^2) u'
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> tanh(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    interval_type v = interval_type::tanh(u.value());
+    return chain_rule(v, interval_type(1.0, 1.0) - interval_type::sqr(v), u);
+}
+
+// asinh(u)' = u' / sqrt(u^2 + 1)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> asinh(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::asinh(u.value()),
+                      interval_type::recip(interval_type::sqrt(interval_type::sqr(u.value()) + interval_type(1.0, 1.0))), u);
+}
+
+// acosh(u)' = u' / sqrt(u^2 - 1)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> acosh(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::acosh(u.value()),
+                      interval_type::recip(interval_type::sqrt(interval_type::sqr(u.value()) - interval_type(1.0, 1.0))), u);
+}
+
+// atanh(u)' = u' / (1 - u^2)
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> atanh(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::atanh(u.value()),
+                      interval_type::recip(interval_type(1.0, 1.0) - interval_type::sqr(u.value())), u);
+}
+
+
+// -----------------------------------------------------------------------------
+// Integer functions, absolute value, min and max
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sign(gradient<T, Flavor, N> const& u)
+{
+    return piecewise_constant(gradient<T, Flavor, N>::interval_type::sign(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> ceil(gradient<T, Flavor, N> const& u)
+{
+    return piecewise_constant(gradient<T, Flavor, N>::interval_type::ceil(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> floor(gradient<T, Flavor, N> const& u)
+{
+    return piecewise_constant(gradient<T, Flavor, N>::interval_type::floor(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> trunc(gradient<T, Flavor, N> const& u)
+{
+    return piecewise_constant(gradient<T, Flavor, N>::interval_type::trunc(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> round_ties_to_even(gradient<T, Flavor, N> const& u)
+{
+    return piecewise_constant(gradient<T, Flavor, N>::interval_type::round_ties_to_even(u.value()), u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> round_ties_to_away(gradient<T, Flavor, N> const& u)
+{
+    return piecewise_constant(gradient<T, Flavor, N>::interval_type::round_ties_to_away(u.value()), u);
+}
+
+// abs(u)' = sign(u) u', [-1,1] u' if u contains 0
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> abs(gradient<T, Flavor, N> const& u)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    return chain_rule(interval_type::abs(u.value()), interval_type::sign(u.value()), u);
+}
+
+// u' if u < w, w' if w < u, the hull of u' and w' otherwise
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> min(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    if (interval_type::strictly_precedes(u.value(), w.value()))
+        return u;
+
+    if (interval_type::strictly_precedes(w.value(), u.value()))
+        return w;
+
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = interval_type::convex_hull(u.derivative(i), w.derivative(i));
+
+    return gradient<T, Flavor, N>(interval_type::min(u.value(), w.value()), d);
+}
+
+// u' if u > w, w' if w > u, the hull of u' and w' otherwise
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> max(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    typedef typename gradient<T, Flavor, N>::interval_type interval_type;
+
+    if (interval_type::strictly_precedes(w.value(), u.value()))
+        return u;
+
+    if (interval_type::strictly_precedes(u.value(), w.value()))
+        return w;
+
+    typename gradient<T, Flavor, N>::derivative_type d;
+
+    for (std::size_t i = 0; i < N; ++i)
+        d[i] = interval_type::convex_hull(u.derivative(i), w.derivative(i));
+
+    return gradient<T, Flavor, N>(interval_type::max(u.value(), w.value()), d);
+}
+
+
+// -----------------------------------------------------------------------------
+// Mixed operations with constant intervals
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> add(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return add(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> add(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return add(gradient<T, Flavor, N>(u), w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sub(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return sub(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> sub(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return sub(gradient<T, Flavor, N>(u), w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> mul(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return mul(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> mul(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return mul(gradient<T, Flavor, N>(u), w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> div(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return div(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> div(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return div(gradient<T, Flavor, N>(u), w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> pow(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return pow(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> pow(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return pow(gradient<T, Flavor, N>(u), w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> atan2(gradient<T, Flavor, N> const& y, typename gradient<T, Flavor, N>::interval_type const& x)
+{
+    return atan2(y, gradient<T, Flavor, N>(x));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> atan2(typename gradient<T, Flavor, N>::interval_type const& y, gradient<T, Flavor, N> const& x)
+{
+    return atan2(gradient<T, Flavor, N>(y), x);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> min(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return min(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> min(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return min(gradient<T, Flavor, N>(u), w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> max(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return max(u, gradient<T, Flavor, N>(w));
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> max(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return max(gradient<T, Flavor, N>(u), w);
+}
+
+
+// -----------------------------------------------------------------------------
+// Operators
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator+(gradient<T, Flavor, N> const& u)
+{
+    return pos(u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator-(gradient<T, Flavor, N> const& u)
+{
+    return neg(u);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator+(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    return add(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator+(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return add(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator+(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return add(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator-(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    return sub(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator-(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return sub(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator-(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return sub(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator*(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    return mul(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator*(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return mul(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator*(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return mul(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator/(gradient<T, Flavor, N> const& u, gradient<T, Flavor, N> const& w)
+{
+    return div(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator/(gradient<T, Flavor, N> const& u, typename gradient<T, Flavor, N>::interval_type const& w)
+{
+    return div(u, w);
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline gradient<T, Flavor, N> operator/(typename gradient<T, Flavor, N>::interval_type const& u, gradient<T, Flavor, N> const& w)
+{
+    return div(u, w);
+}
+
+
+} // namespace ad
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_AD_GRADIENT_HPP
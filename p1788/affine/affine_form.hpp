@@ -0,0 +1,705 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_AFFINE_AFFINE_FORM_HPP
+#define LIBIEEEP1788_P1788_AFFINE_AFFINE_FORM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "p1788/infsup/interval.hpp"
+#include "p1788/affine/arena.hpp"
+
+
+namespace p1788
+{
+
+namespace affine
+{
+
+
+/// \brief Affine form <c>x0 + x1 e1 + ... + xn en</c> over the noise symbols <c>ei</c> &isin; [-1,1]
+///
+/// Affine arithmetic (Comba, Stolfi) keeps track of first order correlations
+/// between quantities which share noise symbols, e.g. <c>x - x</c> is exactly
+/// 0. For long dependent computations the enclosures are much tighter than
+/// those of inf-sup interval arithmetic.
+///
+/// The central value and the coefficients are of type T and the operations
+/// are performed with rounding to nearest. The rounding errors are computed
+/// exactly with the error-free transformations TwoSum and TwoProduct (via
+/// <c>std::fma</c>), accumulated with directed rounding emulated by
+/// <c>std::nextafter</c> and attached to a new noise symbol together with the
+/// error of the linearization of the nonlinear operations. Hence the result
+/// of every operation is a rigorous enclosure.
+///
+/// Only the nonzero coefficients are stored, sorted by their noise symbol,
+/// in a <c>std::vector</c> using the arena_allocator.
+///
+/// Affine forms are converted from and to bare intervals of the flavor.
+/// Empty and unbounded intervals can not be represented as an affine form;
+/// they are stored as an interval (see is_special()) and operations with such
+/// an operand are evaluated in interval arithmetic.
+///
+/// \tparam T type used for the central value and the coefficients
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+/// \note The floating-point environment has to be in the default rounding mode.
+///
+template<typename T, template<typename> class Flavor>
+class affine_form
+{
+public:
+
+    static_assert(std::numeric_limits<T>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+    /// \brief Coefficient of a noise symbol
+    struct term
+    {
+        std::size_t symbol;
+        T coefficient;
+    };
+
+    typedef std::vector<term, arena_allocator<term>> term_list;
+
+
+    /// \brief Creates the empty set
+    affine_form()
+        : center_(0), terms_(), special_(true), range_()
+    { }
+
+    /// \brief Creates the constant \p c
+    explicit affine_form(T c)
+        : affine_form(interval_type(c, c))
+    { }
+
+    /// \brief Converts the interval \p x into an affine form
+    ///
+    /// The midpoint of \p x becomes the central value and the radius the
+    /// coefficient of a new noise symbol. Empty and unbounded intervals are
+    /// stored as they are.
+    explicit affine_form(interval_type const& x)
+        : center_(0), terms_(), special_(true), range_(x)
+    {
+        if (!interval_type::is_common_interval(x))
+            return;
+
+        T l = interval_type::inf(x);
+        T u = interval_type::sup(x);
+
+        center_ = interval_type::mid(x);
+        special_ = false;
+
+        if (l != u)
+        {
+            term t = { new_symbol(), std::max(add_up(u, -center_), add_up(center_, -l)) };
+            terms_.push_back(t);
+        }
+    }
+
+
+    /// \brief Returns a new noise symbol, the symbols are increasing
+    static std::size_t new_symbol()
+    {
+        static std::atomic<std::size_t> next(0);
+        return ++next;
+    }
+
+
+    /// \brief Central value x0
+    T center() const
+    {
+        return center_;
+    }
+
+    /// \brief Nonzero coefficients, sorted by the noise symbols
+    term_list const& terms() const
+    {
+        return terms_;
+    }
+
+    /// \brief Upper bound of <c>|x1| + ... + |xn|</c>
+    T radius() const
+    {
+        T r = 0;
+
+        for (auto const& t : terms_)
+            r = add_up(r, std::abs(t.coefficient));
+
+        return r;
+    }
+
+    /// \brief Returns true if the value is an empty or unbounded interval
+    /// which is not represented as an affine form
+    bool is_special() const
+    {
+        return special_;
+    }
+
+    /// \brief Enclosure of the range of the affine form
+    interval_type to_interval() const
+    {
+        if (special_)
+            return range_;
+
+        T r = radius();
+        return interval_type(-add_up(-center_, r), add_up(center_, r));
+    }
+
+
+    // -------------------------------------------------------------------------
+    // Operations
+    // -------------------------------------------------------------------------
+
+    static affine_form neg(affine_form const& x)
+    {
+        if (x.special_)
+            return affine_form(interval_type::neg(x.range_));
+
+        affine_form z = x;
+        z.center_ = -z.center_;
+
+        for (auto& t : z.terms_)
+            t.coefficient = -t.coefficient;
+
+        return z;
+    }
+
+    static affine_form add(affine_form const& x, affine_form const& y)
+    {
+        if (x.special_ || y.special_)
+            return affine_form(interval_type::add(x.to_interval(), y.to_interval()));
+
+        return combine(x, y, 1);
+    }
+
+    static affine_form sub(affine_form const& x, affine_form const& y)
+    {
+        if (x.special_ || y.special_)
+            return affine_form(interval_type::sub(x.to_interval(), y.to_interval()));
+
+        return combine(x, y, -1);
+    }
+
+    /// \brief Sum of \p x and the constant \p c
+    static affine_form add(affine_form const& x, T c)
+    {
+        if (x.special_)
+            return affine_form(interval_type::add(x.range_, interval_type(c, c)));
+
+        T err = 0;
+        term_list t = x.terms_;
+
+        return make(two_sum(x.center_, c, err), t, err);
+    }
+
+    /// \brief Product of \p x and the constant \p c
+    static affine_form mul(affine_form const& x, T c)
+    {
+        if (x.special_)
+            return affine_form(interval_type::mul(x.range_, interval_type(c, c)));
+
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() + 1);
+
+        T z = two_prod(x.center_, c, err);
+
+        for (auto const& xi : x.terms_)
+            push(t, xi.symbol, two_prod(xi.coefficient, c, err));
+
+        return make(z, t, err);
+    }
+
+    /// \brief Product, the quadratic term is bounded by <c>radius(x) radius(y)</c>
+    static affine_form mul(affine_form const& x, affine_form const& y)
+    {
+        if (x.special_ || y.special_)
+            return affine_form(interval_type::mul(x.to_interval(), y.to_interval()));
+
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() + y.terms_.size() + 1);
+
+        T const x0 = x.center_;
+        T const y0 = y.center_;
+        T z = two_prod(x0, y0, err);
+
+        auto i = x.terms_.begin();
+        auto j = y.terms_.begin();
+
+        while (i != x.terms_.end() || j != y.terms_.end())
+        {
+            if (j == y.terms_.end() || (i != x.terms_.end() && i->symbol < j->symbol))
+            {
+                push(t, i->symbol, two_prod(y0, i->coefficient, err));
+                ++i;
+            }
+            else if (i == x.terms_.end() || j->symbol < i->symbol)
+            {
+                push(t, j->symbol, two_prod(x0, j->coefficient, err));
+                ++j;
+            }
+            else
+            {
+                T a = two_prod(y0, i->coefficient, err);
+                T b = two_prod(x0, j->coefficient, err);
+                push(t, i->symbol, two_sum(a, b, err));
+                ++i;
+                ++j;
+            }
+        }
+
+        err = add_up(err, mul_up(x.radius(), y.radius()));
+
+        return make(z, t, err);
+    }
+
+    static affine_form div(affine_form const& x, affine_form const& y)
+    {
+        if (x.special_ || y.special_)
+            return affine_form(interval_type::div(x.to_interval(), y.to_interval()));
+
+        return mul(x, recip(y));
+    }
+
+    /// \brief Square, the quadratic term is in <c>[0, radius(x)^2]</c>
+    static affine_form sqr(affine_form const& x)
+    {
+        if (x.special_)
+            return affine_form(interval_type::sqr(x.range_));
+
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() + 1);
+
+        T const r = x.radius();
+        T half = r / 2;
+
+        if (half * 2 != r)
+            half = next_up(half);
+
+        T const h = mul_up(half, r);
+
+        T z = two_sum(two_prod(x.center_, x.center_, err), h, err);
+
+        for (auto const& xi : x.terms_)
+            push(t, xi.symbol, two_prod(2 * x.center_, xi.coefficient, err));
+
+        return make(z, t, add_up(err, h));
+    }
+
+    static affine_form recip(affine_form const& x)
+    {
+        interval_type xi = x.to_interval();
+
+        if (x.special_ || interval_type::is_member(static_cast<T>(0), xi))
+            return affine_form(interval_type::recip(xi));
+
+        return min_range(x,
+                         [](interval_type const& t) { return interval_type::recip(t); },
+                         [](interval_type const& t) { return interval_type::neg(interval_type::recip(interval_type::sqr(t))); },
+                         interval_type::inf(xi) > 0);
+    }
+
+    static affine_form sqrt(affine_form const& x)
+    {
+        interval_type xi = x.to_interval();
+
+        if (x.special_ || !(interval_type::inf(xi) >= 0))
+            return affine_form(interval_type::sqrt(xi));
+
+        return min_range(x,
+                         [](interval_type const& t) { return interval_type::sqrt(t); },
+                         [](interval_type const& t) { return interval_type::recip(interval_type::mul(interval_type(2.0, 2.0), interval_type::sqrt(t))); },
+                         false);
+    }
+
+    static affine_form exp(affine_form const& x)
+    {
+        if (x.special_)
+            return affine_form(interval_type::exp(x.range_));
+
+        return min_range(x,
+                         [](interval_type const& t) { return interval_type::exp(t); },
+                         [](interval_type const& t) { return interval_type::exp(t); },
+                         true);
+    }
+
+    static affine_form log(affine_form const& x)
+    {
+        interval_type xi = x.to_interval();
+
+        if (x.special_ || !(interval_type::inf(xi) > 0))
+            return affine_form(interval_type::log(xi));
+
+        return min_range(x,
+                         [](interval_type const& t) { return interval_type::log(t); },
+                         [](interval_type const& t) { return interval_type::recip(t); },
+                         false);
+    }
+
+private:
+
+    static T next_up(T x)
+    {
+        return std::nextafter(x, std::numeric_limits<T>::infinity());
+    }
+
+    // exact error e = a + b - s of s = a + b (TwoSum)
+    static T sum_error(T a, T b, T s)
+    {
+        T bb = s - a;
+        return (a - (s - bb)) + (b - bb);
+    }
+
+    // a * b may be inexact although the error computed by fma is 0
+    static bool tiny_product(T a, T b, T p)
+    {
+        return a != 0 && b != 0
+               && std::abs(p) < std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+    }
+
+    // upper bound of a + b
+    static T add_up(T a, T b)
+    {
+        T s = a + b;
+        return sum_error(a, b, s) > 0 ? next_up(s) : s;
+    }
+
+    // upper bound of a * b
+    static T mul_up(T a, T b)
+    {
+        T p = a * b;
+        return std::fma(a, b, -p) > 0 || tiny_product(a, b, p) ? next_up(p) : p;
+    }
+
+    // a + b rounded to nearest, the rounding error (TwoSum) is added to err
+    static T two_sum(T a, T b, T& err)
+    {
+        T s = a + b;
+        T e = sum_error(a, b, s);
+
+        if (e != 0)
+            err = add_up(err, std::abs(e));
+
+        return s;
+    }
+
+    // a * b rounded to nearest, the rounding error (TwoProduct) is added to
+    // err. Below min/eps the error computed by fma may be rounded, next_up
+    // covers the remaining error of at most denorm_min/2.
+    static T two_prod(T a, T b, T& err)
+    {
+        T p = a * b;
+        T e = std::fma(a, b, -p);
+
+        if (tiny_product(a, b, p))
+            err = next_up(add_up(err, std::abs(e)));
+        else if (e != 0)
+            err = add_up(err, std::abs(e));
+
+        return p;
+    }
+
+    static void push(term_list& t, std::size_t symbol, T coefficient)
+    {
+        if (coefficient != 0)
+        {
+            term s = { symbol, coefficient };
+            t.push_back(s);
+        }
+    }
+
+    // affine form with the central value c, the terms t and the error err
+    // attached to a new noise symbol, entire on overflow
+    static affine_form make(T c, term_list& t, T err)
+    {
+        push(t, err != 0 ? new_symbol() : 0, err);
+
+        bool finite = std::isfinite(c) && std::isfinite(err);
+
+        for (auto const& s : t)
+            finite = finite && std::isfinite(s.coefficient);
+
+        if (!finite)
+            return affine_form(interval_type::entire());
+
+        affine_form z;
+        z.center_ = c;
+        z.terms_.swap(t);
+        z.special_ = false;
+
+        return z;
+    }
+
+    // x + s y with s = 1 or s = -1
+    static affine_form combine(affine_form const& x, affine_form const& y, T s)
+    {
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() + y.terms_.size() + 1);
+
+        T z = two_sum(x.center_, s * y.center_, err);
+
+        auto i = x.terms_.begin();
+        auto j = y.terms_.begin();
+
+        while (i != x.terms_.end() || j != y.terms_.end())
+        {
+            if (j == y.terms_.end() || (i != x.terms_.end() && i->symbol < j->symbol))
+            {
+                t.push_back(*i);
+                ++i;
+            }
+            else if (i == x.terms_.end() || j->symbol < i->symbol)
+            {
+                push(t, j->symbol, s * j->coefficient);
+                ++j;
+            }
+            else
+            {
+                push(t, i->symbol, two_sum(i->coefficient, s * j->coefficient, err));
+                ++i;
+                ++j;
+            }
+        }
+
+        return make(z, t, err);
+    }
+
+    // Min-range approximation f(x) = alpha x + zeta + delta e for a function
+    // f with a monotone derivative df on [a,b] = to_interval(x). alpha is a
+    // lower bound of min f' on [a,b], taken at a if df_increasing and at b
+    // otherwise. Then g(t) = f(t) - alpha t is nondecreasing on [a,b] and its
+    // range is enclosed by the hull of g(a) and g(b), with midpoint zeta and
+    // radius delta.
+    template<class F, class DF>
+    static affine_form min_range(affine_form const& x, F f, DF df, bool df_increasing)
+    {
+        interval_type xi = x.to_interval();
+        T a = interval_type::inf(xi);
+        T b = interval_type::sup(xi);
+
+        interval_type ia(a, a);
+        interval_type ib(b, b);
+
+        T alpha = interval_type::inf(df(df_increasing ? ia : ib));
+
+        if (!std::isfinite(alpha))
+            return affine_form(f(xi));
+
+        interval_type al(alpha, alpha);
+        interval_type r = interval_type::convex_hull(interval_type::sub(f(ia), interval_type::mul(al, ia)),
+                          interval_type::sub(f(ib), interval_type::mul(al, ib)));
+
+        if (!interval_type::is_common_interval(r))
+            return affine_form(f(xi));
+
+        T zeta = interval_type::mid(r);
+        T delta = std::max(add_up(interval_type::sup(r), -zeta), add_up(zeta, -interval_type::inf(r)));
+
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() + 1);
+
+        T z = two_sum(two_prod(alpha, x.center_, err), zeta, err);
+
+        for (auto const& s : x.terms_)
+            push(t, s.symbol, two_prod(alpha, s.coefficient, err));
+
+        return make(z, t, add_up(err, delta));
+    }
+
+    T center_;
+    term_list terms_;
+    bool special_;
+    interval_type range_;
+};
+
+
+// -----------------------------------------------------------------------------
+// Functions and operators
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor>
+inline typename affine_form<T, Flavor>::interval_type to_interval(affine_form<T, Flavor> const& x)
+{
+    return x.to_interval();
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> neg(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::neg(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> add(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> sub(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> mul(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> div(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::div(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> sqr(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::sqr(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> recip(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::recip(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> sqrt(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::sqrt(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> exp(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::exp(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> log(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::log(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator-(affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::neg(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator+(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator+(affine_form<T, Flavor> const& x, typename affine_form<T, Flavor>::bound_type c)
+{
+    return affine_form<T, Flavor>::add(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator+(typename affine_form<T, Flavor>::bound_type c, affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::add(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator-(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator-(affine_form<T, Flavor> const& x, typename affine_form<T, Flavor>::bound_type c)
+{
+    return affine_form<T, Flavor>::add(x, -c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator-(typename affine_form<T, Flavor>::bound_type c, affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::add(affine_form<T, Flavor>::neg(x), c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator*(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator*(affine_form<T, Flavor> const& x, typename affine_form<T, Flavor>::bound_type c)
+{
+    return affine_form<T, Flavor>::mul(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator*(typename affine_form<T, Flavor>::bound_type c, affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::mul(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator/(affine_form<T, Flavor> const& x, affine_form<T, Flavor> const& y)
+{
+    return affine_form<T, Flavor>::div(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator/(affine_form<T, Flavor> const& x, typename affine_form<T, Flavor>::bound_type c)
+{
+    return affine_form<T, Flavor>::div(x, affine_form<T, Flavor>(c));
+}
+
+template<typename T, template<typename> class Flavor>
+inline affine_form<T, Flavor> operator/(typename affine_form<T, Flavor>::bound_type c, affine_form<T, Flavor> const& x)
+{
+    return affine_form<T, Flavor>::mul(affine_form<T, Flavor>::recip(x), c);
+}
+
+
+} // namespace affine
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_AFFINE_AFFINE_FORM_HPP
@@ -0,0 +1,284 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_AFFINE_ARENA_HPP
+#define LIBIEEEP1788_P1788_AFFINE_ARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+
+namespace p1788
+{
+
+namespace affine
+{
+
+
+/// \brief Memory pool for the noise symbols of affine forms
+///
+/// Blocks are grouped into size classes of powers of two, starting with
+/// <c>min_block</c> bytes, and are recycled through free lists local to each
+/// thread. New blocks are carved out of chunks of <c>chunk_size</c> bytes,
+/// hence the creation and destruction of short-lived affine forms does not call
+/// <c>operator new</c> in the steady state. Requests larger than the biggest
+/// size class are forwarded to <c>operator new</c>.
+///
+/// A block may be released by a different thread than the one which allocated
+/// it. It is put into the free list of the releasing thread. If a thread
+/// releases more than <c>chunk_size</c> bytes of a size class without
+/// allocating them again, they are moved to a global free list, and so are the
+/// free lists and the unused part of the current chunk of a thread when it
+/// exits. A thread refills an empty free list from the global one before it
+/// carves a new block, hence memory released by other or finished threads is
+/// reused. The chunks are linked into a global list and are kept until the
+/// end of the program.
+class arena
+{
+public:
+
+    static const std::size_t min_block = 16;
+    static const std::size_t num_classes = 12;
+    static const std::size_t chunk_size = std::size_t(1) << 16;
+
+    /// \brief Allocates a block of at least \p bytes bytes
+    static void* allocate(std::size_t bytes)
+    {
+        std::size_t k = size_class(bytes);
+
+        if (k == num_classes)
+            return ::operator new(bytes);
+
+        state& s = local();
+
+        if (!s.free[k] && global()[k].load(std::memory_order_relaxed))
+            s.free[k] = global()[k].exchange(nullptr);
+
+        if (s.free[k])
+        {
+            node* n = s.free[k];
+            s.free[k] = n->next;
+
+            if (s.released[k] > 0)
+                --s.released[k];
+
+            return n;
+        }
+
+        std::size_t const b = min_block << k;
+
+        if (s.left < b)
+        {
+            s.release_chunk();
+            s.pos = new_chunk();
+            s.left = chunk_size - min_block;
+        }
+
+        void* p = s.pos;
+        s.pos += b;
+        s.left -= b;
+
+        return p;
+    }
+
+    /// \brief Releases the block \p p, \p bytes has to be the size of the request
+    static void deallocate(void* p, std::size_t bytes)
+    {
+        std::size_t k = size_class(bytes);
+
+        if (k == num_classes)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        state& s = local();
+
+        node* n = static_cast<node*>(p);
+        n->next = s.free[k];
+        s.free[k] = n;
+
+        // the blocks released since the last move form the front of the list
+        if (s.released[k] == 0)
+            s.released_last[k] = n;
+
+        if (++s.released[k] == chunk_size / (min_block << k))
+        {
+            s.free[k] = s.released_last[k]->next;
+            push_global(k, n, s.released_last[k]);
+            s.released[k] = 0;
+        }
+    }
+
+private:
+
+    struct node
+    {
+        node* next;
+    };
+
+    // free lists and the unused part of the current chunk of a thread, which
+    // are moved to the global free lists when the thread exits
+    struct state
+    {
+        node* free[num_classes];
+        std::size_t released[num_classes];
+        node* released_last[num_classes];
+        char* pos;
+        std::size_t left;
+
+        ~state()
+        {
+            for (std::size_t k = 0; k < num_classes; ++k)
+            {
+                if (!free[k])
+                    continue;
+
+                node* last = free[k];
+                while (last->next)
+                    last = last->next;
+
+                push_global(k, free[k], last);
+            }
+
+            release_chunk();
+        }
+
+        // splits the unused part of the current chunk into blocks for the
+        // global free lists
+        void release_chunk()
+        {
+            for (std::size_t k = num_classes; k-- > 0; )
+            {
+                std::size_t const b = min_block << k;
+
+                while (left >= b)
+                {
+                    node* n = reinterpret_cast<node*>(pos);
+                    push_global(k, n, n);
+                    pos += b;
+                    left -= b;
+                }
+            }
+        }
+    };
+
+    static std::size_t size_class(std::size_t bytes)
+    {
+        std::size_t k = 0;
+
+        for (std::size_t b = min_block; k < num_classes && bytes > b; b *= 2)
+            ++k;
+
+        return k;
+    }
+
+    static state& local()
+    {
+        static thread_local state s = { {}, {}, {}, nullptr, 0 };
+        return s;
+    }
+
+    // free lists shared by all threads, a list is taken as a whole
+    static std::atomic<node*>* global()
+    {
+        static std::atomic<node*> lists[num_classes];
+        return lists;
+    }
+
+    // prepends the list [first, last] to the global free list of class k
+    static void push_global(std::size_t k, node* first, node* last)
+    {
+        std::atomic<node*>& g = global()[k];
+
+        last->next = g.load();
+        while (!g.compare_exchange_weak(last->next, first))
+            ;
+    }
+
+    // the first min_block bytes of a chunk link it into the global list
+    static char* new_chunk()
+    {
+        static std::atomic<node*> chunks(nullptr);
+
+        char* c = static_cast<char*>(::operator new(chunk_size));
+        node* n = reinterpret_cast<node*>(c);
+
+        n->next = chunks.load();
+        while (!chunks.compare_exchange_weak(n->next, n))
+            ;
+
+        return c + min_block;
+    }
+};
+
+
+/// \brief Standard allocator based on the arena
+template<typename T>
+class arena_allocator
+{
+public:
+
+    typedef T value_type;
+
+    arena_allocator()
+    { }
+
+    template<typename T_>
+    arena_allocator(arena_allocator<T_> const&)
+    { }
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(arena::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        arena::deallocate(p, n * sizeof(T));
+    }
+};
+
+template<typename T1, typename T2>
+inline bool operator==(arena_allocator<T1> const&, arena_allocator<T2> const&)
+{
+    return true;
+}
+
+template<typename T1, typename T2>
+inline bool operator!=(arena_allocator<T1> const&, arena_allocator<T2> const&)
+{
+    return false;
+}
+
+
+} // namespace affine
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_AFFINE_ARENA_HPP
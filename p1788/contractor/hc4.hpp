@@ -0,0 +1,690 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_CONTRACTOR_HC4_HPP
+#define LIBIEEEP1788_P1788_CONTRACTOR_HC4_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace p1788
+{
+
+namespace contractor
+{
+
+
+/// \brief Operations of the nodes of an expression DAG
+///
+enum class op
+{
+    variable,
+    constant,
+    neg,
+    add,
+    sub,
+    mul,
+    div,
+    sqr,
+    pown,
+    pow,
+    sqrt,
+    exp,
+    log,
+    sin,
+    cos,
+    tan,
+    cosh,
+    atan2,
+    abs
+};
+
+
+/// \brief Expression DAG over bare intervals
+///
+/// The nodes of the DAG are created by the member functions below and identified
+/// by their index. Operands have to be created before the operation using them,
+/// hence the nodes are stored in topological order. Common subexpressions are
+/// shared by using the same node more than once.
+///
+/// \tparam Interval bare interval type, e.g. <c>p1788::infsup::interval<double, mpfr_bin_ieee754_flavor></c>
+///
+template<typename Interval>
+class dag
+{
+public:
+
+    typedef Interval interval_type;
+
+    /// Index of a node
+    typedef std::size_t node_type;
+
+    /// \brief Node of the DAG
+    struct node
+    {
+        op operation;
+        node_type lhs;      // (first) operand or index of a variable
+        node_type rhs;      // second operand of a binary operation
+        int p;              // exponent of pown
+        Interval value;     // value of a constant
+    };
+
+
+    dag()
+        : nodes_(), variables_(0)
+    { }
+
+
+///@name Leaves
+///
+///@{
+
+    /// \brief Variable with index \p i of a box
+    node_type variable(std::size_t i)
+    {
+        variables_ = std::max(variables_, i + 1);
+        return push(op::variable, i, 0, 0, Interval());
+    }
+
+    /// \brief Constant \p c
+    node_type constant(Interval const& c)
+    {
+        return push(op::constant, 0, 0, 0, c);
+    }
+
+///@}
+
+///@name Operations
+///
+/// The operands have to be nodes of this DAG.
+///
+///@{
+
+    node_type neg(node_type x)
+    {
+        return push(op::neg, x, 0, 0, Interval());
+    }
+
+    node_type add(node_type x, node_type y)
+    {
+        return push(op::add, x, y, 0, Interval());
+    }
+
+    node_type sub(node_type x, node_type y)
+    {
+        return push(op::sub, x, y, 0, Interval());
+    }
+
+    node_type mul(node_type x, node_type y)
+    {
+        return push(op::mul, x, y, 0, Interval());
+    }
+
+    node_type div(node_type x, node_type y)
+    {
+        return push(op::div, x, y, 0, Interval());
+    }
+
+    node_type sqr(node_type x)
+    {
+        return push(op::sqr, x, 0, 0, Interval());
+    }
+
+    node_type pown(node_type x, int p)
+    {
+        return push(op::pown, x, 0, p, Interval());
+    }
+
+    node_type pow(node_type x, node_type y)
+    {
+        return push(op::pow, x, y, 0, Interval());
+    }
+
+    node_type sqrt(node_type x)
+    {
+        return push(op::sqrt, x, 0, 0, Interval());
+    }
+
+    node_type exp(node_type x)
+    {
+        return push(op::exp, x, 0, 0, Interval());
+    }
+
+    node_type log(node_type x)
+    {
+        return push(op::log, x, 0, 0, Interval());
+    }
+
+    node_type sin(node_type x)
+    {
+        return push(op::sin, x, 0, 0, Interval());
+    }
+
+    node_type cos(node_type x)
+    {
+        return push(op::cos, x, 0, 0, Interval());
+    }
+
+    node_type tan(node_type x)
+    {
+        return push(op::tan, x, 0, 0, Interval());
+    }
+
+    node_type cosh(node_type x)
+    {
+        return push(op::cosh, x, 0, 0, Interval());
+    }
+
+    /// \brief atan2(\p y, \p x)
+    node_type atan2(node_type y, node_type x)
+    {
+        return push(op::atan2, y, x, 0, Interval());
+    }
+
+    node_type abs(node_type x)
+    {
+        return push(op::abs, x, 0, 0, Interval());
+    }
+
+///@}
+
+
+    /// \brief Number of nodes
+    std::size_t size() const
+    {
+        return nodes_.size();
+    }
+
+    /// \brief Number of variables, i.e. the largest variable index + 1
+    std::size_t variables() const
+    {
+        return variables_;
+    }
+
+    node const& operator[](node_type n) const
+    {
+        return nodes_[n];
+    }
+
+    /// \brief Forward evaluation of all nodes over the box \p x
+    ///
+    /// \param x box with at least variables() components
+    /// \param values result, value of every node
+    void forward(std::vector<Interval> const& x, std::vector<Interval>& values) const
+    {
+        values.resize(nodes_.size());
+
+        for (node_type n = 0; n < nodes_.size(); ++n)
+            values[n] = eval(n, x, values);
+    }
+
+    /// \brief Forward evaluation of the node \p n over the box \p x
+    ///
+    /// The values of the operands of \p n are taken from \p values.
+    Interval eval(node_type n, std::vector<Interval> const& x, std::vector<Interval> const& values) const
+    {
+        node const& v = nodes_[n];
+
+        switch (v.operation)
+        {
+        case op::variable:
+            return x[v.lhs];
+        case op::constant:
+            return v.value;
+        case op::neg:
+            return Interval::neg(values[v.lhs]);
+        case op::add:
+            return Interval::add(values[v.lhs], values[v.rhs]);
+        case op::sub:
+            return Interval::sub(values[v.lhs], values[v.rhs]);
+        case op::mul:
+            return Interval::mul(values[v.lhs], values[v.rhs]);
+        case op::div:
+            return Interval::div(values[v.lhs], values[v.rhs]);
+        case op::sqr:
+            return Interval::sqr(values[v.lhs]);
+        case op::pown:
+            return Interval::pown(values[v.lhs], v.p);
+        case op::pow:
+            return Interval::pow(values[v.lhs], values[v.rhs]);
+        case op::sqrt:
+            return Interval::sqrt(values[v.lhs]);
+        case op::exp:
+            return Interval::exp(values[v.lhs]);
+        case op::log:
+            return Interval::log(values[v.lhs]);
+        case op::sin:
+            return Interval::sin(values[v.lhs]);
+        case op::cos:
+            return Interval::cos(values[v.lhs]);
+        case op::tan:
+            return Interval::tan(values[v.lhs]);
+        case op::cosh:
+            return Interval::cosh(values[v.lhs]);
+        case op::atan2:
+            return Interval::atan2(values[v.lhs], values[v.rhs]);
+        case op::abs:
+            return Interval::abs(values[v.lhs]);
+        }
+
+        // Something went wrong
+        return Interval::entire();
+    }
+
+private:
+
+    node_type push(op o, node_type lhs, node_type rhs, int p, Interval const& value)
+    {
+        nodes_.push_back(node {o, lhs, rhs, p, value});
+        return nodes_.size() - 1;
+    }
+
+    std::vector<node> nodes_;
+    std::size_t variables_;
+};
+
+
+
+/// \brief HC4 contractor for a set of constraints over an expression DAG
+///
+/// A constraint \f$f(x) \in r\f$ is given by a node \f$f\f$ of the DAG and
+/// an interval \f$r\f$. HC4-revise contracts a box for one constraint by a forward
+/// evaluation of the subexpressions of \f$f\f$ followed by a backward projection
+/// using the reverse functions, e.g. <c>sqr_rev</c>, <c>mul_rev</c> or <c>sin_rev</c>,
+/// and <c>intersection</c>. Only the nodes reachable from \f$f\f$ are evaluated.
+///
+/// contract() applies HC4-revise until a fixpoint is reached. A constraint is
+/// only revised again if one of its variables has been narrowed by more than
+/// the ratio set by set_ratio(). branch_and_prune() combines contract() with
+/// bisection of the widest component.
+///
+/// \note An object holds scratch memory for the evaluation and must not be
+/// used concurrently.
+///
+/// \tparam Interval bare interval type
+///
+template<typename Interval>
+class hc4
+{
+public:
+
+    typedef Interval interval_type;
+    typedef typename Interval::bound_type bound_type;
+    typedef typename dag<Interval>::node_type node_type;
+
+    /// Box, vector of intervals indexed by the variable index
+    typedef std::vector<Interval> box_type;
+
+
+    /// \brief Creates a contractor without constraints for the DAG \p d
+    ///
+    /// \note The contractor refers to \p d, which has to outlive it. Nodes may
+    /// be added to \p d at any time.
+    explicit hc4(dag<Interval> const& d)
+        : dag_(d), constraints_(), occurrences_(), values_(), ratio_(0.01)
+    { }
+
+
+    /// \brief Adds the constraint \f$f(x) \in r\f$
+    ///
+    /// \param f node of the DAG
+    /// \param r range of \p f, e.g. [0,0] for an equation or [-inf,0] for an inequality
+    /// \return index of the constraint
+    std::size_t add_constraint(node_type f, Interval const& r)
+    {
+        constraint c {f, r, std::vector<node_type>(), std::vector<std::size_t>()};
+
+        values_.resize(dag_.size());
+        occurrences_.resize(dag_.variables());
+
+        // collect the nodes reachable from f
+        std::vector<bool> reachable(f + 1, false);
+        reachable[f] = true;
+
+        for (node_type n = f + 1; n-- > 0; )
+        {
+            if (!reachable[n])
+                continue;
+
+            typename dag<Interval>::node const& v = dag_[n];
+
+            switch (v.operation)
+            {
+            case op::variable:
+                c.vars.push_back(v.lhs);
+                break;
+            case op::constant:
+                break;
+            case op::add:
+            case op::sub:
+            case op::mul:
+            case op::div:
+            case op::pow:
+            case op::atan2:
+                reachable[v.rhs] = true;
+                reachable[v.lhs] = true;
+                break;
+            default:
+                reachable[v.lhs] = true;
+            }
+        }
+
+        for (node_type n = 0; n <= f; ++n)
+            if (reachable[n])
+                c.nodes.push_back(n);
+
+        std::sort(c.vars.begin(), c.vars.end());
+        c.vars.erase(std::unique(c.vars.begin(), c.vars.end()), c.vars.end());
+
+        for (std::size_t i : c.vars)
+            occurrences_[i].push_back(constraints_.size());
+
+        constraints_.push_back(c);
+
+        return constraints_.size() - 1;
+    }
+
+    /// \brief Number of constraints
+    std::size_t size() const
+    {
+        return constraints_.size();
+    }
+
+    /// \brief Minimal relative narrowing of a variable to revise its constraints again
+    ///
+    /// \param ratio value in [0,1), default 0.01
+    void set_ratio(bound_type ratio)
+    {
+        ratio_ = ratio;
+    }
+
+    bound_type ratio() const
+    {
+        return ratio_;
+    }
+
+
+    /// \brief HC4-revise of the constraint \p i
+    ///
+    /// \param i index of the constraint
+    /// \param x box with at least <c>dag.variables()</c> components, contracted in place
+    /// \return false if the constraint is proven to be infeasible over \p x, in
+    ///         this case the components of \p x are undefined
+    bool revise(std::size_t i, box_type& x)
+    {
+        constraint const& c = constraints_[i];
+
+        // forward evaluation
+        for (node_type n : c.nodes)
+            values_[n] = dag_.eval(n, x, values_);
+
+        values_[c.f] = Interval::intersection(values_[c.f], c.range);
+
+        // backward projection
+        for (auto it = c.nodes.rbegin(); it != c.nodes.rend(); ++it)
+        {
+            if (Interval::is_empty(values_[*it]) || !project(*it, x))
+                return false;
+        }
+
+        return true;
+    }
+
+    /// \brief Contracts the box \p x for all constraints until a fixpoint is reached
+    ///
+    /// \return false if the constraints are proven to be infeasible over \p x,
+    ///         in this case all components of \p x are set to the empty set
+    bool contract(box_type& x)
+    {
+        std::deque<std::size_t> queue;
+        std::vector<bool> queued(constraints_.size(), true);
+
+        for (std::size_t i = 0; i < constraints_.size(); ++i)
+            queue.push_back(i);
+
+        box_type old;
+
+        while (!queue.empty())
+        {
+            std::size_t i = queue.front();
+            queue.pop_front();
+            queued[i] = false;
+
+            constraint const& c = constraints_[i];
+
+            old.clear();
+            for (std::size_t v : c.vars)
+                old.push_back(x[v]);
+
+            if (!revise(i, x))
+            {
+                std::fill(x.begin(), x.end(), Interval::empty());
+                return false;
+            }
+
+            // schedule the constraints of the narrowed variables
+            for (std::size_t k = 0; k < c.vars.size(); ++k)
+            {
+                if (!narrowed(old[k], x[c.vars[k]]))
+                    continue;
+
+                for (std::size_t j : occurrences_[c.vars[k]])
+                {
+                    if (j != i && !queued[j])
+                    {
+                        queue.push_back(j);
+                        queued[j] = true;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// \brief Branch and prune
+    ///
+    /// Contracts the box \p x and bisects the widest component of the remaining
+    /// boxes until their width is less than \p eps. Boxes which can not be
+    /// bisected any further are reported as well.
+    ///
+    /// \param x initial box
+    /// \param eps maximal width of a component of a reported box
+    /// \param it output iterator receiving the boxes of type box_type which
+    ///        enclose all solutions within \p x
+    template<class OutputIt>
+    OutputIt branch_and_prune(box_type const& x, bound_type eps, OutputIt it)
+    {
+        std::vector<box_type> stack(1, x);
+
+        while (!stack.empty())
+        {
+            box_type b = std::move(stack.back());
+            stack.pop_back();
+
+            if (!contract(b))
+                continue;
+
+            // widest component
+            std::size_t k = 0;
+            bound_type w = -std::numeric_limits<bound_type>::infinity();
+
+            for (std::size_t i = 0; i < b.size(); ++i)
+            {
+                bound_type wi = Interval::wid(b[i]);
+
+                if (wi > w)
+                {
+                    w = wi;
+                    k = i;
+                }
+            }
+
+            if (w < eps)
+            {
+                *it++ = b;
+                continue;
+            }
+
+            std::pair<Interval, Interval> parts = Interval::bisect(b[k]);
+
+            // no further bisection possible
+            if (parts.first == b[k] || parts.second == b[k])
+            {
+                *it++ = b;
+                continue;
+            }
+
+            stack.push_back(b);
+            stack.back()[k] = parts.first;
+            b[k] = parts.second;
+            stack.push_back(std::move(b));
+        }
+
+        return it;
+    }
+
+private:
+
+    struct constraint
+    {
+        node_type f;                        // root node
+        Interval range;
+        std::vector<node_type> nodes;       // nodes reachable from f, topological order
+        std::vector<std::size_t> vars;      // variables of the constraint
+    };
+
+    // projects the value of node n onto its operands
+    bool project(node_type n, box_type& x)
+    {
+        typename dag<Interval>::node const& v = dag_[n];
+
+        Interval const& z = values_[n];
+        Interval& a = values_[v.lhs];
+
+        switch (v.operation)
+        {
+        case op::variable:
+            x[v.lhs] = Interval::intersection(x[v.lhs], z);
+            return !Interval::is_empty(x[v.lhs]);
+        case op::constant:
+            return true;
+        case op::neg:
+            a = Interval::intersection(a, Interval::neg(z));
+            break;
+        case op::add:
+            a = Interval::intersection(a, Interval::sub(z, values_[v.rhs]));
+            values_[v.rhs] = Interval::intersection(values_[v.rhs], Interval::sub(z, a));
+            break;
+        case op::sub:
+            a = Interval::intersection(a, Interval::add(z, values_[v.rhs]));
+            values_[v.rhs] = Interval::intersection(values_[v.rhs], Interval::sub(a, z));
+            break;
+        case op::mul:
+            a = Interval::mul_rev(values_[v.rhs], z, a);
+            values_[v.rhs] = Interval::mul_rev(a, z, values_[v.rhs]);
+            break;
+        case op::div:
+            a = Interval::intersection(a, Interval::mul(z, values_[v.rhs]));
+            values_[v.rhs] = Interval::mul_rev(z, a, values_[v.rhs]);
+            break;
+        case op::sqr:
+            a = Interval::sqr_rev(z, a);
+            break;
+        case op::pown:
+            a = Interval::pown_rev(z, a, v.p);
+            break;
+        case op::pow:
+            a = Interval::pow_rev1(values_[v.rhs], z, a);
+            values_[v.rhs] = Interval::pow_rev2(a, z, values_[v.rhs]);
+            break;
+        case op::sqrt:
+            a = Interval::intersection(a, Interval::sqr(z));
+            break;
+        case op::exp:
+            a = Interval::intersection(a, Interval::log(z));
+            break;
+        case op::log:
+            a = Interval::intersection(a, Interval::exp(z));
+            break;
+        case op::sin:
+            a = Interval::sin_rev(z, a);
+            break;
+        case op::cos:
+            a = Interval::cos_rev(z, a);
+            break;
+        case op::tan:
+            a = Interval::tan_rev(z, a);
+            break;
+        case op::cosh:
+            a = Interval::cosh_rev(z, a);
+            break;
+        case op::atan2:
+            a = Interval::atan2_rev1(values_[v.rhs], z, a);
+            values_[v.rhs] = Interval::atan2_rev2(a, z, values_[v.rhs]);
+            break;
+        case op::abs:
+            a = Interval::abs_rev(z, a);
+            break;
+        }
+
+        return !Interval::is_empty(a);
+    }
+
+    // true if x was narrowed to y by more than the ratio
+    bool narrowed(Interval const& x, Interval const& y) const
+    {
+        bound_type const inf = std::numeric_limits<bound_type>::infinity();
+
+        bound_type wx = Interval::wid(x);
+        bound_type wy = Interval::wid(y);
+
+        if (wx == inf)
+            return wy < inf
+                   || (Interval::inf(x) == -inf && Interval::inf(y) > -inf)
+                   || (Interval::sup(x) == inf && Interval::sup(y) < inf);
+
+        return wy < (1 - ratio_) * wx;
+    }
+
+    dag<Interval> const& dag_;
+    std::vector<constraint> constraints_;
+    std::vector<std::vector<std::size_t>> occurrences_;     // constraints of a variable
+    std::vector<Interval> values_;                          // values of the nodes
+    bound_type ratio_;
+};
+
+
+} // namespace contractor
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_CONTRACTOR_HC4_HPP
@@ -0,0 +1,680 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_DD_DD_INTERVAL_HPP
+#define LIBIEEEP1788_P1788_DD_DD_INTERVAL_HPP
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include "p1788/exception/exception.hpp"
+#include "p1788/infsup/interval.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+#include "p1788/util/mixed_type_traits.hpp"
+#include "p1788/util/mpfr_var.hpp"
+#include "p1788/dd/double_double.hpp"
+
+
+namespace p1788
+{
+
+namespace dd
+{
+
+
+/// \brief Bare inf-sup interval with double_double bounds
+///
+/// The bounds carry 106 significant bits, the exponent range is the one of
+/// double. The operations are computed with the directed double_double
+/// operations and follow the set-based flavor, e.g. sqrt([-4,4]) = [0,2].
+///
+/// Intervals of an IEEE flavor with bounds of type float, double or long
+/// double are converted implicitly in the mixed type operations. The result
+/// type of the bounds is determined by p1788::util::max_precision_type, which
+/// is double_double for all of these types.
+///
+class dd_interval
+{
+public:
+
+    typedef double_double bound_type;
+
+
+    /// \brief Creates the empty set
+    dd_interval()
+        : l_(std::numeric_limits<double>::infinity()), u_(-std::numeric_limits<double>::infinity())
+    { }
+
+    /// \brief Creates the interval [\p lower, \p upper]
+    ///
+    /// If the bounds do not specify a valid interval, the empty set is
+    /// returned and an undefined_operation is signaled.
+    dd_interval(double_double const& lower, double_double const& upper)
+        : dd_interval()
+    {
+        if (lower <= upper
+                && lower.hi() != std::numeric_limits<double>::infinity()
+                && upper.hi() != -std::numeric_limits<double>::infinity())
+        {
+            l_ = lower;
+            u_ = upper;
+        }
+        else
+        {
+            p1788::exception::signal_undefined_operation();
+        }
+    }
+
+    /// \brief Creates the interval [\p lower, \p upper], rounded outward
+    template<typename T>
+    dd_interval(T lower, T upper)
+        : dd_interval(convert(lower, std::round_toward_neg_infinity),
+                      convert(upper, std::round_toward_infinity))
+    {
+        static_assert(std::is_floating_point<T>::value, "Only floating point bounds are supported!");
+    }
+
+    /// \brief Converts the interval \p x of an IEEE flavor, rounded outward
+    template<typename T, template<typename> class Flavor>
+    explicit dd_interval(p1788::infsup::interval<T, Flavor> const& x)
+        : dd_interval()
+    {
+        static_assert(std::is_same<typename p1788::util::max_precision_type<T, double_double>::type,
+                      double_double>::value, "Type is more precise than double_double!");
+
+        typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+        if (!interval_type::is_empty(x))
+        {
+            l_ = convert(interval_type::inf(x), std::round_toward_neg_infinity);
+            u_ = convert(interval_type::sup(x), std::round_toward_infinity);
+        }
+    }
+
+
+    /// \brief Empty set
+    static dd_interval empty()
+    {
+        return dd_interval();
+    }
+
+    /// \brief Entire set
+    static dd_interval entire()
+    {
+        return dd_interval(-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+    }
+
+
+    /// \brief Lower bound, +inf for the empty set
+    double_double const& lower() const
+    {
+        return l_;
+    }
+
+    /// \brief Upper bound, -inf for the empty set
+    double_double const& upper() const
+    {
+        return u_;
+    }
+
+    /// \brief Encloses the interval in the smallest interval of the IEEE flavor with bounds of type T
+    template<typename T>
+    p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> to_interval() const
+    {
+        typedef p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> interval_type;
+
+        if (is_empty(*this))
+            return interval_type();
+
+        return interval_type(l_.get<T>(std::round_toward_neg_infinity), u_.get<T>(std::round_toward_infinity));
+    }
+
+
+// -----------------------------------------------------------------------------
+// Numeric functions and predicates
+// -----------------------------------------------------------------------------
+
+    static bool is_empty(dd_interval const& x)
+    {
+        return x.u_ < x.l_;
+    }
+
+    static bool is_entire(dd_interval const& x)
+    {
+        return x.l_.hi() == -std::numeric_limits<double>::infinity()
+               && x.u_.hi() == std::numeric_limits<double>::infinity();
+    }
+
+    static bool is_member(double m, dd_interval const& x)
+    {
+        return x.l_ <= double_double(m) && double_double(m) <= x.u_;
+    }
+
+    static bool subset(dd_interval const& x, dd_interval const& y)
+    {
+        return is_empty(x) || (y.l_ <= x.l_ && x.u_ <= y.u_);
+    }
+
+    static bool equal(dd_interval const& x, dd_interval const& y)
+    {
+        return (is_empty(x) && is_empty(y)) || (x.l_ == y.l_ && x.u_ == y.u_);
+    }
+
+    /// \brief Width of \p x rounded upward to double, NaN for the empty set
+    static double wid(dd_interval const& x)
+    {
+        if (is_empty(x))
+            return std::numeric_limits<double>::quiet_NaN();
+
+        return double_double::sub(x.u_, x.l_, std::round_toward_infinity).get<double>(std::round_toward_infinity);
+    }
+
+
+// -----------------------------------------------------------------------------
+// Set operations
+// -----------------------------------------------------------------------------
+
+    static dd_interval intersection(dd_interval const& x, dd_interval const& y)
+    {
+        if (is_empty(x) || is_empty(y) || x.u_ < y.l_ || y.u_ < x.l_)
+            return empty();
+
+        return bounds(x.l_ < y.l_ ? y.l_ : x.l_, x.u_ < y.u_ ? x.u_ : y.u_);
+    }
+
+    static dd_interval convex_hull(dd_interval const& x, dd_interval const& y)
+    {
+        if (is_empty(x))
+            return y;
+
+        if (is_empty(y))
+            return x;
+
+        return bounds(x.l_ < y.l_ ? x.l_ : y.l_, x.u_ < y.u_ ? y.u_ : x.u_);
+    }
+
+
+// -----------------------------------------------------------------------------
+// Forward elementary functions
+// -----------------------------------------------------------------------------
+
+    static dd_interval pos(dd_interval const& x)
+    {
+        return x;
+    }
+
+    static dd_interval neg(dd_interval const& x)
+    {
+        if (is_empty(x))
+            return x;
+
+        return bounds(double_double::neg(x.u_), double_double::neg(x.l_));
+    }
+
+    static dd_interval add(dd_interval const& x, dd_interval const& y)
+    {
+        if (is_empty(x) || is_empty(y))
+            return empty();
+
+        return bounds(double_double::add(x.l_, y.l_, down), double_double::add(x.u_, y.u_, up));
+    }
+
+    static dd_interval sub(dd_interval const& x, dd_interval const& y)
+    {
+        if (is_empty(x) || is_empty(y))
+            return empty();
+
+        return bounds(double_double::sub(x.l_, y.u_, down), double_double::sub(x.u_, y.l_, up));
+    }
+
+    static dd_interval mul(dd_interval const& x, dd_interval const& y)
+    {
+        if (is_empty(x) || is_empty(y))
+            return empty();
+
+        int xl = x.l_.sign();
+        int xu = x.u_.sign();
+        int yl = y.l_.sign();
+        int yu = y.u_.sign();
+
+        if (xl >= 0)
+        {
+            if (yl >= 0)
+                return bounds(double_double::mul(x.l_, y.l_, down), double_double::mul(x.u_, y.u_, up));
+            else if (yu <= 0)
+                return bounds(double_double::mul(x.u_, y.l_, down), double_double::mul(x.l_, y.u_, up));
+            else
+                return bounds(double_double::mul(x.u_, y.l_, down), double_double::mul(x.u_, y.u_, up));
+        }
+        else if (xu <= 0)
+        {
+            if (yl >= 0)
+                return bounds(double_double::mul(x.l_, y.u_, down), double_double::mul(x.u_, y.l_, up));
+            else if (yu <= 0)
+                return bounds(double_double::mul(x.u_, y.u_, down), double_double::mul(x.l_, y.l_, up));
+            else
+                return bounds(double_double::mul(x.l_, y.u_, down), double_double::mul(x.l_, y.l_, up));
+        }
+        else
+        {
+            if (yl >= 0)
+                return bounds(double_double::mul(x.l_, y.u_, down), double_double::mul(x.u_, y.u_, up));
+            else if (yu <= 0)
+                return bounds(double_double::mul(x.u_, y.l_, down), double_double::mul(x.l_, y.l_, up));
+
+            double_double l1 = double_double::mul(x.l_, y.u_, down);
+            double_double l2 = double_double::mul(x.u_, y.l_, down);
+            double_double u1 = double_double::mul(x.l_, y.l_, up);
+            double_double u2 = double_double::mul(x.u_, y.u_, up);
+
+            return bounds(l1 < l2 ? l1 : l2, u1 < u2 ? u2 : u1);
+        }
+    }
+
+    static dd_interval div(dd_interval const& x, dd_interval const& y)
+    {
+        if (is_empty(x) || is_empty(y))
+            return empty();
+
+        int xl = x.l_.sign();
+        int xu = x.u_.sign();
+        int yl = y.l_.sign();
+        int yu = y.u_.sign();
+
+        if (yl == 0 && yu == 0)
+            return empty();
+
+        if (xl == 0 && xu == 0)
+            return bounds(double_double(), double_double());
+
+        if ((yl < 0 && yu > 0) || (xl < 0 && xu > 0 && (yl == 0 || yu == 0)))
+            return entire();
+
+        double_double const inf = std::numeric_limits<double>::infinity();
+
+        if (xu <= 0)
+        {
+            if (yu < 0)
+                return bounds(double_double::div(x.u_, y.l_, down), double_double::div(x.l_, y.u_, up));
+            else if (yl > 0)
+                return bounds(double_double::div(x.l_, y.l_, down), double_double::div(x.u_, y.u_, up));
+            else if (yu == 0)
+                return bounds(double_double::div(x.u_, y.l_, down), inf);
+            else
+                return bounds(double_double::neg(inf), double_double::div(x.u_, y.u_, up));
+        }
+        else if (xl >= 0)
+        {
+            if (yu < 0)
+                return bounds(double_double::div(x.u_, y.u_, down), double_double::div(x.l_, y.l_, up));
+            else if (yl > 0)
+                return bounds(double_double::div(x.l_, y.u_, down), double_double::div(x.u_, y.l_, up));
+            else if (yu == 0)
+                return bounds(double_double::neg(inf), double_double::div(x.l_, y.l_, up));
+            else
+                return bounds(double_double::div(x.l_, y.u_, down), inf);
+        }
+        else
+        {
+            if (yu < 0)
+                return bounds(double_double::div(x.u_, y.u_, down), double_double::div(x.l_, y.u_, up));
+            else
+                return bounds(double_double::div(x.l_, y.l_, down), double_double::div(x.u_, y.l_, up));
+        }
+    }
+
+    static dd_interval recip(dd_interval const& x)
+    {
+        return div(dd_interval(1.0, 1.0), x);
+    }
+
+    static dd_interval sqr(dd_interval const& x)
+    {
+        if (is_empty(x))
+            return empty();
+
+        if (x.l_.sign() >= 0)
+            return bounds(double_double::mul(x.l_, x.l_, down), double_double::mul(x.u_, x.u_, up));
+
+        if (x.u_.sign() <= 0)
+            return bounds(double_double::mul(x.u_, x.u_, down), double_double::mul(x.l_, x.l_, up));
+
+        double_double m = double_double::neg(x.l_) < x.u_ ? x.u_ : x.l_;
+        return bounds(double_double(), double_double::mul(m, m, up));
+    }
+
+    static dd_interval sqrt(dd_interval const& x)
+    {
+        if (is_empty(x) || x.u_.sign() < 0)
+            return empty();
+
+        return bounds(x.l_.sign() <= 0 ? double_double() : double_double::sqrt(x.l_, down),
+                      double_double::sqrt(x.u_, up));
+    }
+
+
+// -----------------------------------------------------------------------------
+// Input and output
+// -----------------------------------------------------------------------------
+
+    /// \brief Writes the interval as <c>[l,u]</c> with 33 significant decimal digits rounded outward
+    template<typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
+                                                         dd_interval const& x)
+    {
+        if (is_empty(x))
+            return os << "[empty]";
+
+        mpfr_t l, u;
+        mpfr_init2(l, 2 * std::numeric_limits<double>::digits + 1);
+        mpfr_init2(u, 2 * std::numeric_limits<double>::digits + 1);
+
+        mpfr_set_d(l, x.l_.hi(), MPFR_RNDD);
+        mpfr_add_d(l, l, x.l_.lo(), MPFR_RNDD);
+        mpfr_set_d(u, x.u_.hi(), MPFR_RNDU);
+        mpfr_add_d(u, u, x.u_.lo(), MPFR_RNDU);
+
+        char buffer[128];
+        mpfr_sprintf(buffer, "[%.33RDg,%.33RUg]", l, u);
+
+        mpfr_clear(l);
+        mpfr_clear(u);
+
+        return os << buffer;
+    }
+
+
+private:
+
+    static const std::float_round_style down = std::round_toward_neg_infinity;
+    static const std::float_round_style up = std::round_toward_infinity;
+
+    // Interval with valid bounds, no check
+    static dd_interval bounds(double_double const& l, double_double const& u)
+    {
+        dd_interval r;
+        r.l_ = l;
+        r.u_ = u;
+        return r;
+    }
+
+    static double_double convert(float x, std::float_round_style)
+    {
+        return double_double(x);
+    }
+
+    static double_double convert(double x, std::float_round_style)
+    {
+        return double_double(x);
+    }
+
+    static double_double convert(long double x, std::float_round_style rnd)
+    {
+        return double_double(x, rnd);
+    }
+
+    double_double l_;
+    double_double u_;
+};
+
+
+// -----------------------------------------------------------------------------
+// Free functions and operators
+// -----------------------------------------------------------------------------
+
+inline bool is_empty(dd_interval const& x)
+{
+    return dd_interval::is_empty(x);
+}
+
+inline bool is_entire(dd_interval const& x)
+{
+    return dd_interval::is_entire(x);
+}
+
+inline bool is_member(double m, dd_interval const& x)
+{
+    return dd_interval::is_member(m, x);
+}
+
+inline bool subset(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::subset(x, y);
+}
+
+inline bool equal(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::equal(x, y);
+}
+
+inline double wid(dd_interval const& x)
+{
+    return dd_interval::wid(x);
+}
+
+inline dd_interval intersection(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::intersection(x, y);
+}
+
+inline dd_interval convex_hull(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::convex_hull(x, y);
+}
+
+inline dd_interval pos(dd_interval const& x)
+{
+    return dd_interval::pos(x);
+}
+
+inline dd_interval neg(dd_interval const& x)
+{
+    return dd_interval::neg(x);
+}
+
+inline dd_interval add(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::add(x, y);
+}
+
+inline dd_interval sub(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::sub(x, y);
+}
+
+inline dd_interval mul(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::mul(x, y);
+}
+
+inline dd_interval div(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::div(x, y);
+}
+
+inline dd_interval recip(dd_interval const& x)
+{
+    return dd_interval::recip(x);
+}
+
+inline dd_interval sqr(dd_interval const& x)
+{
+    return dd_interval::sqr(x);
+}
+
+inline dd_interval sqrt(dd_interval const& x)
+{
+    return dd_interval::sqrt(x);
+}
+
+inline dd_interval operator+(dd_interval const& x)
+{
+    return dd_interval::pos(x);
+}
+
+inline dd_interval operator-(dd_interval const& x)
+{
+    return dd_interval::neg(x);
+}
+
+inline dd_interval operator+(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::add(x, y);
+}
+
+inline dd_interval operator-(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::sub(x, y);
+}
+
+inline dd_interval operator*(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::mul(x, y);
+}
+
+inline dd_interval operator/(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::div(x, y);
+}
+
+inline bool operator==(dd_interval const& x, dd_interval const& y)
+{
+    return dd_interval::equal(x, y);
+}
+
+inline bool operator!=(dd_interval const& x, dd_interval const& y)
+{
+    return !dd_interval::equal(x, y);
+}
+
+
+// Mixed type operations with intervals of an IEEE flavor
+
+template<typename T, template<typename> class Flavor>
+dd_interval add(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return dd_interval::add(x, dd_interval(y));
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval add(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return dd_interval::add(dd_interval(x), y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval sub(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return dd_interval::sub(x, dd_interval(y));
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval sub(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return dd_interval::sub(dd_interval(x), y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval mul(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return dd_interval::mul(x, dd_interval(y));
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval mul(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return dd_interval::mul(dd_interval(x), y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval div(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return dd_interval::div(x, dd_interval(y));
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval div(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return dd_interval::div(dd_interval(x), y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator+(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator+(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator-(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator-(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator*(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator*(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator/(dd_interval const& x, p1788::infsup::interval<T, Flavor> const& y)
+{
+    return div(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+dd_interval operator/(p1788::infsup::interval<T, Flavor> const& x, dd_interval const& y)
+{
+    return div(x, y);
+}
+
+
+} // namespace dd
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_DD_DD_INTERVAL_HPP
@@ -0,0 +1,507 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_DD_DOUBLE_DOUBLE_HPP
+#define LIBIEEEP1788_P1788_DD_DOUBLE_DOUBLE_HPP
+
+#include <cmath>
+#include <limits>
+
+#include "p1788/util/mixed_type_traits.hpp"
+#include "p1788/infsup/interval.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+
+
+namespace p1788
+{
+
+namespace dd
+{
+
+
+/// \brief Unevaluated sum <c>hi + lo</c> of two doubles with 106 significant bits
+///
+/// The pair is normalized, i.e. <c>hi</c> is <c>hi + lo</c> rounded to
+/// nearest, hence the representation of a value is unique and values are
+/// ordered lexicographically by (hi, lo).
+///
+/// The arithmetic operations take a rounding direction,
+/// <c>std::round_toward_neg_infinity</c> or <c>std::round_toward_infinity</c>,
+/// and return a lower or upper bound of the exact result:
+///
+/// - add and mul evaluate the exact result as a sum of doubles with the
+///   error-free transformations TwoSum and TwoProduct (via <c>std::fma</c>)
+///   and round only the small tail in the requested direction. Exact results
+///   are returned exactly.
+/// - div and sqrt compute an approximation rounded to nearest, widen it by an
+///   error bound and verify the bound with directed multiplications.
+///
+/// Results which overflow, and quotients and roots which can not be verified
+/// near the ends of the exponent range, are computed in double precision
+/// with the intervals of the flavor mpfr_bin_ieee754_flavor<double>.
+///
+/// \note The floating-point environment has to be in the default rounding mode.
+///
+class double_double
+{
+public:
+
+    /// \brief Zero
+    double_double()
+        : hi_(0.0), lo_(0.0)
+    { }
+
+    /// \brief Converts \p x, exact
+    double_double(double x)
+        : hi_(x), lo_(0.0)
+    { }
+
+    /// \brief Converts \p x, exact
+    double_double(float x)
+        : hi_(x), lo_(0.0)
+    { }
+
+    /// \brief Creates the normalized pair of <c>hi + lo</c>, exact for finite values
+    double_double(double hi, double lo)
+        : hi_(hi + lo), lo_(std::isfinite(hi_) ? sum_error(hi, lo, hi_) : 0.0)
+    { }
+
+    /// \brief Converts \p x rounded in the direction \p rnd
+    double_double(long double x, std::float_round_style rnd)
+        : hi_(static_cast<double>(x)), lo_(0.0)
+    {
+        bool up = rnd == std::round_toward_infinity;
+
+        if (std::isinf(hi_) && std::isfinite(x))
+        {
+            if (x > 0)
+                hi_ = up ? hi_ : std::numeric_limits<double>::max();
+            else
+                hi_ = up ? -std::numeric_limits<double>::max() : hi_;
+        }
+        else if (std::isfinite(x))
+        {
+            // exact, x - hi has at most 11 significant bits
+            long double d = x - hi_;
+            double l = static_cast<double>(d);
+
+            if (up && l < d)
+                l = next_up(l);
+            else if (!up && l > d)
+                l = next_down(l);
+
+            *this = double_double(hi_, l);
+        }
+    }
+
+
+    double hi() const
+    {
+        return hi_;
+    }
+
+    double lo() const
+    {
+        return lo_;
+    }
+
+    /// \brief Sign of the value, -1, 0 or 1
+    int sign() const
+    {
+        return hi_ > 0.0 ? 1 : (hi_ < 0.0 ? -1 : 0);
+    }
+
+    /// \brief Returns the value as the type T rounded in the direction \p rnd
+    template<typename T>
+    T get(std::float_round_style rnd) const;
+
+
+    static double_double neg(double_double const& x)
+    {
+        double_double r;
+        r.hi_ = -x.hi_;
+        r.lo_ = -x.lo_;
+        return r;
+    }
+
+    static double_double abs(double_double const& x)
+    {
+        return x.hi_ < 0.0 ? neg(x) : x;
+    }
+
+    static double_double add(double_double const& x, double_double const& y, std::float_round_style rnd)
+    {
+        bool up = rnd == std::round_toward_infinity;
+
+        if (!std::isfinite(x.hi_) || !std::isfinite(y.hi_))
+            return double_double(x.hi_ + y.hi_);
+
+        // x + y = vh + vl + sl + tl exactly
+        double sl, tl, vl;
+        double sh = two_sum(x.hi_, y.hi_, sl);
+        double th = two_sum(x.lo_, y.lo_, tl);
+        double vh = two_sum(sh, th, vl);
+
+        double l = add_dir(vl, add_dir(sl, tl, up), up);
+        double_double r(vh, l);
+
+        if (!std::isfinite(r.hi_))
+            return fallback(interval_type::add(enclose(x), enclose(y)), up);
+
+        return r;
+    }
+
+    static double_double sub(double_double const& x, double_double const& y, std::float_round_style rnd)
+    {
+        return add(x, neg(y), rnd);
+    }
+
+    /// \brief Product, 0 times infinity is 0
+    static double_double mul(double_double const& x, double_double const& y, std::float_round_style rnd)
+    {
+        bool up = rnd == std::round_toward_infinity;
+
+        if (x.hi_ == 0.0 || y.hi_ == 0.0)
+            return double_double();
+
+        if (!std::isfinite(x.hi_) || !std::isfinite(y.hi_))
+            return double_double(x.hi_ * y.hi_);
+
+        double_double r = mul_dir(x, y, up);
+
+        if (!std::isfinite(r.hi_))
+            return fallback(interval_type::mul(enclose(x), enclose(y)), up);
+
+        return r;
+    }
+
+    /// \brief Quotient, \p y has to be nonzero and not both operands infinite
+    static double_double div(double_double const& x, double_double const& y, std::float_round_style rnd)
+    {
+        bool up = rnd == std::round_toward_infinity;
+
+        if (x.hi_ == 0.0)
+            return double_double();
+
+        // |x| / |y| rounded in the opposite direction for a negative quotient
+        bool negative = (x.hi_ < 0.0) != (y.hi_ < 0.0);
+        double_double q = div_positive(abs(x), abs(y), up != negative);
+
+        return negative ? neg(q) : q;
+    }
+
+    /// \brief Square root, \p x has to be nonnegative
+    static double_double sqrt(double_double const& x, std::float_round_style rnd)
+    {
+        bool up = rnd == std::round_toward_infinity;
+
+        if (x.hi_ == 0.0 || !std::isfinite(x.hi_))
+            return double_double(std::sqrt(x.hi_));
+
+        double s = std::sqrt(x.hi_);
+        double e = std::fma(-s, s, x.hi_);
+        double_double r(s, (e + x.lo_) / (2.0 * s));
+
+        return refine(r, x, up,
+                      [](double_double const& z, bool u) { return mul_dir(z, z, u); },
+                      [&x]() { return interval_type::sqrt(enclose(x)); });
+    }
+
+
+    friend bool operator==(double_double const& x, double_double const& y)
+    {
+        return x.hi_ == y.hi_ && x.lo_ == y.lo_;
+    }
+
+    friend bool operator!=(double_double const& x, double_double const& y)
+    {
+        return !(x == y);
+    }
+
+    friend bool operator<(double_double const& x, double_double const& y)
+    {
+        return x.hi_ < y.hi_ || (x.hi_ == y.hi_ && x.lo_ < y.lo_);
+    }
+
+    friend bool operator>(double_double const& x, double_double const& y)
+    {
+        return y < x;
+    }
+
+    friend bool operator<=(double_double const& x, double_double const& y)
+    {
+        return x.hi_ < y.hi_ || (x.hi_ == y.hi_ && x.lo_ <= y.lo_);
+    }
+
+    friend bool operator>=(double_double const& x, double_double const& y)
+    {
+        return y <= x;
+    }
+
+private:
+
+    typedef p1788::infsup::interval<double, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> interval_type;
+
+    static double next_up(double x)
+    {
+        return std::nextafter(x, std::numeric_limits<double>::infinity());
+    }
+
+    static double next_down(double x)
+    {
+        return std::nextafter(x, -std::numeric_limits<double>::infinity());
+    }
+
+    // exact error e = a + b - s of s = a + b (TwoSum)
+    static double sum_error(double a, double b, double s)
+    {
+        double bb = s - a;
+        return (a - (s - bb)) + (b - bb);
+    }
+
+    static double two_sum(double a, double b, double& e)
+    {
+        double s = a + b;
+        e = sum_error(a, b, s);
+        return s;
+    }
+
+    // a + b rounded upward or downward
+    static double add_dir(double a, double b, bool up)
+    {
+        double s = a + b;
+        double e = sum_error(a, b, s);
+
+        if (up)
+            return e > 0.0 ? next_up(s) : s;
+
+        return e < 0.0 ? next_down(s) : s;
+    }
+
+    // a * b may be inexact although the error computed by fma is 0
+    static bool tiny_product(double a, double b, double p)
+    {
+        return a != 0.0 && b != 0.0
+               && std::abs(p) < std::numeric_limits<double>::min() / std::numeric_limits<double>::epsilon();
+    }
+
+    // Error a * b - p of p = a * b (TwoProduct), rounded upward or downward.
+    // Below min/eps the error computed by fma may be rounded by at most
+    // denorm_min/2.
+    static double prod_error(double a, double b, double p, bool up)
+    {
+        double e = std::fma(a, b, -p);
+
+        if (tiny_product(a, b, p))
+            e = up ? next_up(e) : next_down(e);
+
+        return e;
+    }
+
+    // x * y = p + (e + q + r) + (qe + re + s) with the products of the parts,
+    // the small terms are accumulated with directed rounding
+    static double_double mul_dir(double_double const& x, double_double const& y, bool up)
+    {
+        double p = x.hi_ * y.hi_;
+        double q = x.hi_ * y.lo_;
+        double r = x.lo_ * y.hi_;
+        double s = x.lo_ * y.lo_;
+
+        double e = prod_error(x.hi_, y.hi_, p, up);
+        double qe = prod_error(x.hi_, y.lo_, q, up);
+        double re = prod_error(x.lo_, y.hi_, r, up);
+        double se = prod_error(x.lo_, y.lo_, s, up);
+
+        double b1, b2;
+        double a1 = two_sum(e, q, b1);
+        double a2 = two_sum(a1, r, b2);
+
+        double small = add_dir(add_dir(add_dir(b1, b2, up), add_dir(qe, re, up), up),
+                               add_dir(s, se, up), up);
+
+        double l;
+        double h = two_sum(p, a2, l);
+
+        return double_double(h, add_dir(l, small, up));
+    }
+
+    // The exact result z of f is the solution of g(z) = a for a function g
+    // increasing for positive z. The approximation r is returned if the
+    // evaluation of g in the opposite direction shows that it is a bound in
+    // the direction up, otherwise r is widened by a relative error bound and
+    // verified again. If this fails the result of the interval function
+    // fallback is used.
+    template<typename G, typename F>
+    static double_double refine(double_double const& r, double_double const& a, bool up, G g, F fallback_func)
+    {
+        if (std::isfinite(r.hi_) && r.hi_ > 0.0)
+        {
+            if (up ? g(r, false) >= a : g(r, true) <= a)
+                return r;
+
+            for (int k : { -105, -101, -93 })
+            {
+                double eps = std::ldexp(std::abs(r.hi_), k) + std::numeric_limits<double>::denorm_min();
+                double_double w(r.hi_, add_dir(r.lo_, up ? eps : -eps, up));
+
+                if (std::isfinite(w.hi_) && (up ? g(w, false) >= a : g(w, true) <= a))
+                    return w;
+            }
+        }
+
+        return fallback(fallback_func(), up);
+    }
+
+    // x / y for positive x and y
+    static double_double div_positive(double_double const& x, double_double const& y, bool up)
+    {
+        if (!std::isfinite(x.hi_) || !std::isfinite(y.hi_))
+            return double_double(x.hi_ / y.hi_);
+
+        double th = x.hi_ / y.hi_;
+        double ph = y.hi_ * th;
+        double pl = std::fma(y.hi_, th, -ph) + y.lo_ * th;
+        double d = (x.hi_ - ph) + (x.lo_ - pl);
+        double_double q(th, d / y.hi_);
+
+        return refine(q, x, up,
+                      [&y](double_double const& z, bool u) { return mul_dir(z, y, u); },
+                      [&x, &y]() { return interval_type::div(enclose(x), enclose(y)); });
+    }
+
+    static interval_type enclose(double_double const& x)
+    {
+        return interval_type(add_dir(x.hi_, x.lo_, false), add_dir(x.hi_, x.lo_, true));
+    }
+
+    static double_double fallback(interval_type const& x, bool up)
+    {
+        return double_double(up ? interval_type::sup(x) : interval_type::inf(x));
+    }
+
+    template<typename T> friend class dd_get_trait;
+
+    double hi_;
+    double lo_;
+};
+
+
+// Trait to return the value of a double_double as the type T
+template<typename T> class dd_get_trait
+{
+    static_assert(!std::is_same<T,T>::value,
+                  "Type is not supported by dd_get_trait!");
+};
+
+// double
+template<> class dd_get_trait<double>
+{
+public:
+    static double apply(double_double const& x, bool up)
+    {
+        return double_double::add_dir(x.hi_, x.lo_, up);
+    }
+};
+
+// float
+template<> class dd_get_trait<float>
+{
+public:
+    static float apply(double_double const& x, bool up)
+    {
+        double d = double_double::add_dir(x.hi_, x.lo_, up);
+        float f = static_cast<float>(d);
+
+        if (up && f < d)
+            return std::nextafter(f, std::numeric_limits<float>::infinity());
+
+        if (!up && f > d)
+            return std::nextafter(f, -std::numeric_limits<float>::infinity());
+
+        return f;
+    }
+};
+
+// long double
+template<> class dd_get_trait<long double>
+{
+public:
+    static long double apply(double_double const& x, bool up)
+    {
+        long double h = x.hi_;
+        long double l = x.lo_;
+        long double s = h + l;
+
+        if (!std::isfinite(s))
+            return s;
+
+        long double bb = s - h;
+        long double e = (h - (s - bb)) + (l - bb);
+
+        if (up && e > 0)
+            return std::nextafter(s, std::numeric_limits<long double>::infinity());
+
+        if (!up && e < 0)
+            return std::nextafter(s, -std::numeric_limits<long double>::infinity());
+
+        return s;
+    }
+};
+
+template<typename T>
+T double_double::get(std::float_round_style rnd) const
+{
+    return dd_get_trait<T>::apply(*this, rnd == std::round_toward_infinity);
+}
+
+
+} // namespace dd
+
+
+namespace util
+{
+
+// Ignore the warning about non-virtual destructors
+// on GCC  push the last diagnostic state and disable -Weffc++
+//TODO support other compiler
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Weffc++"
+
+template<>
+class type_precision_order<p1788::dd::double_double>
+    : public std::integral_constant<ieee754_binary_precision_order,
+      ieee754_binary_precision_order::double_double_type>
+{ };
+
+// on GCC  enable the diagnostic state -Weffc++ again
+#pragma GCC diagnostic pop
+
+} // namespace util
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_DD_DOUBLE_DOUBLE_HPP
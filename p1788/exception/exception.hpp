@@ -28,6 +28,42 @@
 
 #include <stdexcept>
 
+
+//------------------------------------------------------------------------------
+//                        Exception policy
+//------------------------------------------------------------------------------
+
+// P1788_EXCEPTION_POLICY selects at compile time what the signal functions
+// (signal_undefined_operation(), ...) do:
+//
+// P1788_EXCEPTION_POLICY_THROW (default): The flag is added to the exception
+//      state and an exception is thrown if its bit is set in the control word,
+//      see set_throw_exception_cwd().
+// P1788_EXCEPTION_POLICY_FLAGS: The flag is added to the exception state but no
+//      exception is ever thrown, the control word has no effect.
+// P1788_EXCEPTION_POLICY_NONE: Nothing is recorded and nothing is thrown, the
+//      signal functions reduce to a constant and the exception state stays
+//      none_bit.
+//
+// The policy has to be defined before any header of the library is included
+// and has to be the same for all translation units of a program (including the
+// compiled library libp1788).
+
+#define P1788_EXCEPTION_POLICY_THROW 0
+#define P1788_EXCEPTION_POLICY_FLAGS 1
+#define P1788_EXCEPTION_POLICY_NONE 2
+
+#ifndef P1788_EXCEPTION_POLICY
+#define P1788_EXCEPTION_POLICY P1788_EXCEPTION_POLICY_THROW
+#endif
+
+#if P1788_EXCEPTION_POLICY != P1788_EXCEPTION_POLICY_THROW \
+    && P1788_EXCEPTION_POLICY != P1788_EXCEPTION_POLICY_FLAGS \
+    && P1788_EXCEPTION_POLICY != P1788_EXCEPTION_POLICY_NONE
+#error "P1788_EXCEPTION_POLICY has to be one of P1788_EXCEPTION_POLICY_THROW, P1788_EXCEPTION_POLICY_FLAGS or P1788_EXCEPTION_POLICY_NONE"
+#endif
+
+
 namespace p1788
 {
 
@@ -229,68 +265,94 @@ inline bool invalid_operand()
     return state() & invalid_operand_bit;
 }
 
+/// \brief Signal policy: adds the flag to the exception state and throws
+/// \p Exception if the bit is set for the <c>throw_exception_cwd</c>.
+struct throw_policy
+{
+    template<typename Exception>
+    static exception_bits signal(exception_bits bit)
+    {
+        state() |= bit;
+
+        // Throw exception if necessary
+        if (cwd() & bit)
+            throw Exception();
+
+        return state();
+    }
+};
+
+/// \brief Signal policy: adds the flag to the exception state, never throws.
+struct flags_policy
+{
+    template<typename Exception>
+    static exception_bits signal(exception_bits bit) noexcept
+    {
+        return state() |= bit;
+    }
+};
+
+/// \brief Signal policy: neither records nor throws.
+///
+/// \note The signaled bit is returned, hence a caller testing the result of
+/// a signal function still detects the exceptional case.
+struct no_op_policy
+{
+    template<typename Exception>
+    static exception_bits signal(exception_bits bit) noexcept
+    {
+        return bit;
+    }
+};
+
+/// \brief Signal policy selected by <c>P1788_EXCEPTION_POLICY</c>.
+#if P1788_EXCEPTION_POLICY == P1788_EXCEPTION_POLICY_FLAGS
+typedef flags_policy signal_policy;
+#elif P1788_EXCEPTION_POLICY == P1788_EXCEPTION_POLICY_NONE
+typedef no_op_policy signal_policy;
+#else
+typedef throw_policy signal_policy;
+#endif
+
+
 /// \brief Adds the flag for an undefined operation to the exception state.
 ///
 /// \return The current exception state of the active thread (= old exception state <c>| undefined_operation_bit</c>) if no exception is thrown.
 /// \exception undefined_operation_exception  Throws exception if the <c>undefined_operation_bit</c> is set for the <c>throw_exception_cwd</c>.
-/// \note Thread local storage is used for the exception state.
+/// \note Thread local storage is used for the exception state. The behavior depends on <c>P1788_EXCEPTION_POLICY</c>, see \link signal_policy \endlink.
 inline exception_bits signal_undefined_operation()
 {
-    state() |= undefined_operation_bit;
-
-    // Throw exception if necessary
-    if (cwd() & undefined_operation_bit)
-        throw undefined_operation_exception();
-
-    return state();
+    return signal_policy::signal<undefined_operation_exception>(undefined_operation_bit);
 }
 
 /// \brief Adds the flag for a possibly undefined operation to the exception state.
 ///
 /// \return The current exception state of the active thread (= old exception state <c>| possibly_undefined_operation_bit</c>) if no exception is thrown.
 /// \exception possibly_undefined_operation_exception  Throws exception if the <c>possibly_undefined_operation_bit</c> is set for the <c>throw_exception_cwd</c>.
-/// \note Thread local storage is used for the exception state.
+/// \note Thread local storage is used for the exception state. The behavior depends on <c>P1788_EXCEPTION_POLICY</c>, see \link signal_policy \endlink.
 inline exception_bits signal_possibly_undefined_operation()
 {
-    state() |= possibly_undefined_operation_bit;
-
-    // Throw exception if necessary
-    if (cwd() & possibly_undefined_operation_bit)
-        throw possibly_undefined_operation_exception();
-
-    return state();
+    return signal_policy::signal<possibly_undefined_operation_exception>(possibly_undefined_operation_bit);
 }
 
 /// \brief Adds the flag for an interval part of NaI exception to the exception state.
 ///
 /// \return The current exception state of the active thread (= old exception state <c>| interval_part_of_nai_bit</c>) if no exception is thrown.
 /// \exception interval_part_of_nai_exception  Throws exception if the <c>interval_part_of_nai_bit</c> is set for the <c>throw_exception_cwd</c>.
-/// \note Thread local storage is used for the exception state.
+/// \note Thread local storage is used for the exception state. The behavior depends on <c>P1788_EXCEPTION_POLICY</c>, see \link signal_policy \endlink.
 inline exception_bits signal_interval_part_of_nai()
 {
-    state() |= interval_part_of_nai_bit;
-
-    // Throw exception if necessary
-    if (cwd() & interval_part_of_nai_bit)
-        throw interval_part_of_nai_exception();
-
-    return state();
+    return signal_policy::signal<interval_part_of_nai_exception>(interval_part_of_nai_bit);
 }
 
 /// \brief Adds the flag for an invalid operand to the exception state.
 ///
 /// \return The current exception state of the active thread (= old exception state <c>| invalid_operand_bit</c>) if no exception is thrown.
 /// \exception invalid_operand_exception  Throws exception if the <c>invalid_operand_bit</c> is set for the <c>throw_exception_cwd</c>.
-/// \note Thread local storage is used for the exception state.
+/// \note Thread local storage is used for the exception state. The behavior depends on <c>P1788_EXCEPTION_POLICY</c>, see \link signal_policy \endlink.
 inline exception_bits signal_invalid_operand()
 {
-    state() |= invalid_operand_bit;
-
-    // Throw exception if necessary
-    if (cwd() & invalid_operand_bit)
-        throw invalid_operand_exception();
-
-    return state();
+    return signal_policy::signal<invalid_operand_exception>(invalid_operand_bit);
 }
 
 
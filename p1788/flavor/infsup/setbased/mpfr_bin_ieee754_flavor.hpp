@@ -29,12 +29,17 @@
 #include <utility>
 #include <limits>
 #include <cfenv>
+#include <cfloat>
 #include <cmath>
 #include <iostream>
 #include <algorithm>
 #include <cctype>
 #include <sstream>
 #include <regex>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 #include <gmp.h>
 #include <mpfr.h>
@@ -48,6 +53,7 @@
 #include "p1788/util/mixed_type_traits.hpp"
 
 #include "p1788/infsup/base_interval.hpp"
+#include "p1788/infsup/unchecked.hpp"
 
 
 //------------------------------------------------------------------------------
@@ -194,6 +200,91 @@ public:
 ///@}
 
 
+// -----------------------------------------------------------------------------
+// Unchecked functions
+//
+// p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_unchecked_func_impl.hpp
+// p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_elem_func_impl.hpp
+// -----------------------------------------------------------------------------
+
+///@name Unchecked functions
+///
+/// Variants of the classification functions and of the basic arithmetic operations
+/// selected by the tag \link p1788::infsup::unchecked_t p1788::infsup::unchecked \endlink.
+/// They skip the validation of their operands by \link is_valid(representation const&) is_valid \endlink
+/// and are intended for hot loops on values which have already been validated at
+/// construction or input. The checked operations validate their operands and forward
+/// to these variants, hence both compute identical results for valid operands.
+/// For an invalid operand the result is unspecified and no exception is signaled.
+///
+///@{
+
+    /// \brief Checks if \p x is a representation for an empty bare interval, \p x has to be valid.
+    static bool is_empty(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Checks if \p x is a representation for an entire bare interval, \p x has to be valid.
+    static bool is_entire(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Checks if \p x is a representation for a common bare interval, \p x has to be valid.
+    static bool is_common_interval(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked neg of bare interval, see \link neg(representation const&) neg \endlink
+    static representation neg(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked neg of decorated interval, see \link neg(representation_dec const&) neg \endlink
+    static representation_dec neg(representation_dec const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked add of bare intervals, see \link add(representation const&, representation const&) add \endlink
+    static representation add(representation const& x, representation const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked add of decorated intervals, see \link add(representation_dec const&, representation_dec const&) add \endlink
+    static representation_dec add(representation_dec const& x, representation_dec const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked sub of bare intervals, see \link sub(representation const&, representation const&) sub \endlink
+    static representation sub(representation const& x, representation const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked sub of decorated intervals, see \link sub(representation_dec const&, representation_dec const&) sub \endlink
+    static representation_dec sub(representation_dec const& x, representation_dec const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked mul of bare intervals, see \link mul(representation const&, representation const&) mul \endlink
+    static representation mul(representation const& x, representation const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked mul of decorated intervals, see \link mul(representation_dec const&, representation_dec const&) mul \endlink
+    static representation_dec mul(representation_dec const& x, representation_dec const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked div of bare intervals, see \link div(representation const&, representation const&) div \endlink
+    static representation div(representation const& x, representation const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked div of decorated intervals, see \link div(representation_dec const&, representation_dec const&) div \endlink
+    static representation_dec div(representation_dec const& x, representation_dec const& y, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked recip of bare interval, see \link recip(representation const&) recip \endlink
+    static representation recip(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked recip of decorated interval, see \link recip(representation_dec const&) recip \endlink
+    static representation_dec recip(representation_dec const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked sqr of bare interval, see \link sqr(representation const&) sqr \endlink
+    static representation sqr(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked sqr of decorated interval, see \link sqr(representation_dec const&) sqr \endlink
+    static representation_dec sqr(representation_dec const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked sqrt of bare interval, see \link sqrt(representation const&) sqrt \endlink
+    static representation sqrt(representation const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked sqrt of decorated interval, see \link sqrt(representation_dec const&) sqrt \endlink
+    static representation_dec sqrt(representation_dec const& x, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked fma of bare intervals, see \link fma(representation const&, representation const&, representation const&) fma \endlink
+    static representation fma(representation const& x, representation const& y, representation const& z, p1788::infsup::unchecked_t);
+
+    /// \brief Unchecked fma of decorated intervals, see \link fma(representation_dec const&, representation_dec const&, representation_dec const&) fma \endlink
+    static representation_dec fma(representation_dec const& x, representation_dec const& y, representation_dec const& z, p1788::infsup::unchecked_t);
+
+///@}
+
+
 
 // -----------------------------------------------------------------------------
 // Utility functions
@@ -296,6 +387,38 @@ public:
     template<typename T_>
     static representation_dec convert_hull(representation_dec_type<T_> const& x);
 
+private:
+
+    // Kinds of a conversion of T_ to T, selected at compile time: exact widening
+    // (plain cast), narrowing between hardware binary floating point types (cast
+    // and a correction by one ulp) and conversion via MPFR otherwise
+    typedef std::integral_constant<int, 0> widening_conversion;
+    typedef std::integral_constant<int, 1> narrowing_conversion;
+    typedef std::integral_constant<int, 2> mpfr_conversion;
+
+    template<typename T_>
+    using conversion_kind = std::integral_constant < int,
+          !std::is_floating_point<T>::value || !std::is_floating_point<T_>::value
+          || std::numeric_limits<T>::radix != 2 || std::numeric_limits<T_>::radix != 2 ? 2
+          : std::numeric_limits<T>::digits >= std::numeric_limits<T_>::digits
+          && std::numeric_limits<T>::max_exponent >= std::numeric_limits<T_>::max_exponent
+          && std::numeric_limits<T>::min_exponent <= std::numeric_limits<T_>::min_exponent ? 0
+          : std::numeric_limits<T>::digits <= std::numeric_limits<T_>::digits
+          && std::numeric_limits<T>::max_exponent <= std::numeric_limits<T_>::max_exponent
+          && std::numeric_limits<T>::min_exponent >= std::numeric_limits<T_>::min_exponent ? 1
+          : 2 >;
+
+    template<typename T_>
+    static T convert_rnd(T_ x, std::float_round_style rnd, widening_conversion);
+
+    template<typename T_>
+    static T convert_rnd(T_ x, std::float_round_style rnd, narrowing_conversion);
+
+    template<typename T_>
+    static T convert_rnd(T_ x, std::float_round_style rnd, mpfr_conversion);
+
+public:
+
 ///@}
 
 
@@ -639,6 +762,112 @@ public:
     static representation_dec convex_hull(representation_dec_type<T1> const& x,
                                           representation_dec_type<T2> const& y);
 
+    /// \brief Array version. Intersection of the \p n bare intervals \p x.
+    ///
+    /// The bounds are reduced by a maximum and a minimum, the reduction stops
+    /// early as soon as the intersection of a block of intervals is empty.
+    ///
+    /// \param x Array of interval representations
+    /// \param n Number of intervals
+    /// \return \li Empty interval if one representation is invalid (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown)
+    ///         \li Entire interval if \p n is 0
+    ///         \li Intersection of all intervals otherwise.
+    /// \note Representations after an empty intermediate result are not validated.
+    static representation intersection(representation const* x, std::size_t n);
+
+    /// \brief Array version. Intersection of the \p n decorated intervals \p x.
+    ///
+    /// \param x Array of decorated interval representations
+    /// \param n Number of intervals
+    /// \return \li NaI if one representation is invalid (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown) or NaI
+    ///         \li Intersection of the bare intervals decorated with trv otherwise.
+    static representation_dec intersection(representation_dec const* x, std::size_t n);
+
+    /// \brief Array version. Convex hull of the \p n bare intervals \p x.
+    ///
+    /// \param x Array of interval representations
+    /// \param n Number of intervals
+    /// \return \li Empty interval if one representation is invalid (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown)
+    ///         \li Empty interval if \p n is 0
+    ///         \li Convex hull of all intervals otherwise.
+    static representation convex_hull(representation const* x, std::size_t n);
+
+    /// \brief Array version. Convex hull of the \p n decorated intervals \p x.
+    ///
+    /// \param x Array of decorated interval representations
+    /// \param n Number of intervals
+    /// \return \li NaI if one representation is invalid (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown) or NaI
+    ///         \li Convex hull of the bare intervals decorated with trv otherwise.
+    static representation_dec convex_hull(representation_dec const* x, std::size_t n);
+
+    /// \brief Bisection of a bare interval at its midpoint
+    ///
+    /// The interval is split at <c>\link mpfr_bin_ieee754_flavor::mid(representation const& x) mid\endlink</c>,
+    /// hence an unbounded interval is split at -/+ the largest finite number
+    /// and the entire interval at 0.
+    ///
+    /// \param x Interval representation
+    /// \return \li Pair of empty intervals if \p x is an invalid representation (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown)
+    ///         \li Pair of empty intervals if \p x is empty
+    ///         \li \f$([\underline{x}, mid(x)], [mid(x), \overline{x}])\f$ otherwise.
+    static std::pair<representation, representation> bisect(representation const& x);
+
+    /// \brief Bisection of a bare interval at a given ratio
+    ///
+    /// The split point is \f$(1 - ratio) \underline{x} + ratio \overline{x}\f$, computed
+    /// with the infinite bounds replaced by -/+ the largest finite number and
+    /// moved into \p x if it is off by rounding. The ratio is clamped to
+    /// [0,1], a NaN ratio selects the midpoint.
+    ///
+    /// \param x Interval representation
+    /// \param ratio Position of the split point in \p x
+    /// \return \li Pair of empty intervals if \p x is an invalid representation (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown)
+    ///         \li Pair of empty intervals if \p x is empty
+    ///         \li Lower and upper part of \p x otherwise.
+    static std::pair<representation, representation> bisect(representation const& x, T ratio);
+
+    /// \brief Multisection of a bare interval into \p k parts of equal width
+    ///
+    /// The split points are computed as for <c>\link mpfr_bin_ieee754_flavor::bisect(representation const& x, T ratio) bisect\endlink</c>
+    /// with the ratios i/k.
+    ///
+    /// \param x Interval representation
+    /// \param k Number of parts
+    /// \param out Output iterator receiving the \p k parts in increasing order,
+    ///            or \p k empty intervals if \p x is empty or an invalid representation
+    /// \return Output iterator past the last part
+    template<typename OutputIt>
+    static OutputIt multisect(representation const& x, std::size_t k, OutputIt out);
+
+    /// \brief Bisection of a decorated interval at its midpoint
+    ///
+    /// Both parts keep the decoration of \p x.
+    ///
+    /// \param x Decorated interval representation
+    /// \return \li Pair of NaIs if \p x is an invalid representation (and if no \link p1788::exception::invalid_operand_exception p1788::exception::invalid_operand_exception \endlink is thrown) or NaI
+    ///         \li Result of <c>\link mpfr_bin_ieee754_flavor::bisect(representation const& x) bisect\endlink</c>
+    ///             called with the bare interval part otherwise
+    static std::pair<representation_dec, representation_dec> bisect(representation_dec const& x);
+
+    /// \brief Bisection of a decorated interval at a given ratio
+    ///
+    /// See <c>\link mpfr_bin_ieee754_flavor::bisect(representation_dec const& x) bisect\endlink</c>.
+    static std::pair<representation_dec, representation_dec> bisect(representation_dec const& x, T ratio);
+
+    /// \brief Multisection of a decorated interval into \p k parts of equal width
+    ///
+    /// All parts keep the decoration of \p x, \p k NaIs are written if \p x is
+    /// an invalid representation or NaI.
+    template<typename OutputIt>
+    static OutputIt multisect(representation_dec const& x, std::size_t k, OutputIt out);
+
+private:
+
+    // split point of a nonempty interval at the given ratio
+    static T split_point(representation const& x, T ratio);
+
+public:
+
 ///@}
 
 // -----------------------------------------------------------------------------
@@ -908,6 +1137,25 @@ public:
     template<typename T_>
     static std::pair<T, T> mid_rad(representation_dec_type<T_> const& x);
 
+private:
+
+    // The midpoint and the radius are computed by native floating point
+    // operations if T is a binary hardware floating point type and the
+    // floating point environment rounds to nearest without extended precision,
+    // otherwise via MPFR. Both ways give the same results.
+    static bool native_mid_rad();
+
+    // (a + b) / 2 rounded to nearest for finite a, b
+    static T mid_native(T a, T b);
+
+    // a - b rounded upward for a >= b
+    static T sub_rndu_native(T a, T b);
+
+    // midpoint of a nonempty interval, see mid
+    static T mid_nonempty(representation const& x);
+
+public:
+
     /// \brief Width of a bare interval representation
     ///
     /// \param x Interval representation
@@ -1059,6 +1307,74 @@ public:
     template<typename T_>
     static T mig(representation_dec_type<T_> const& x);
 
+    /// \brief Array version. Computes <c>wid([inf[i],sup[i]])</c> for every \f$i < n\f$.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of the results, may be equal to \p inf or \p sup
+    /// \param n Number of intervals
+    ///
+    /// \note The result of an invalid representation is NaN. If there is one, the exception state for an invalid operation is set, see \link p1788::exception::invalid_operand() \endlink.
+    static void wid(T const* inf, T const* sup, T* out, std::size_t n);
+
+    /// \brief Array version. Computes <c>mid([inf[i],sup[i]])</c> for every \f$i < n\f$.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of the results, may be equal to \p inf or \p sup
+    /// \param n Number of intervals
+    ///
+    /// \note The result of an invalid representation is NaN. If there is one, the exception state for an invalid operation is set, see \link p1788::exception::invalid_operand() \endlink.
+    static void mid(T const* inf, T const* sup, T* out, std::size_t n);
+
+    /// \brief Array version. Computes <c>rad([inf[i],sup[i]])</c> for every \f$i < n\f$.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of the results, may be equal to \p inf or \p sup
+    /// \param n Number of intervals
+    ///
+    /// \note The result of an invalid representation is NaN. If there is one, the exception state for an invalid operation is set, see \link p1788::exception::invalid_operand() \endlink.
+    static void rad(T const* inf, T const* sup, T* out, std::size_t n);
+
+    /// \brief Array version. Computes <c>mag([inf[i],sup[i]])</c> for every \f$i < n\f$.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of the results, may be equal to \p inf or \p sup
+    /// \param n Number of intervals
+    ///
+    /// \note The result of an invalid representation is NaN. If there is one, the exception state for an invalid operation is set, see \link p1788::exception::invalid_operand() \endlink.
+    static void mag(T const* inf, T const* sup, T* out, std::size_t n);
+
+    /// \brief Array version. Computes <c>mig([inf[i],sup[i]])</c> for every \f$i < n\f$.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of the results, may be equal to \p inf or \p sup
+    /// \param n Number of intervals
+    ///
+    /// \note The result of an invalid representation is NaN. If there is one, the exception state for an invalid operation is set, see \link p1788::exception::invalid_operand() \endlink.
+    static void mig(T const* inf, T const* sup, T* out, std::size_t n);
+
+private:
+
+    // Kernel of the numeric array versions: out[i] = op(inf[i], sup[i]) for
+    // valid representations and NaN otherwise. op is evaluated for all
+    // elements, without branches, and has to return NaN for an empty interval.
+    template<typename Op>
+    static void num_array(T const* inf, T const* sup, T* out, std::size_t n, Op op);
+
+    // Branch free versions of the native mid and sub_rndu for the array versions
+    static T mid_native_array(T l, T u);
+    static T sub_rndu_native_array(T a, T b);
+
+    // Successor of a nonnegative finite x, by an integer increment of the
+    // representation if T is a 32 or 64 bit IEEE 754 type
+    static T next_up_nonneg(T x);
+
+public:
+
 ///@}
 
 // -----------------------------------------------------------------------------
@@ -1613,6 +1929,260 @@ public:
     template<typename T_>
     static bool disjoint(representation_dec const& x, representation_dec_type<T_> const& y);
 
+    /// \brief Array version. Checks for every \f$i < n\f$ if the bare interval <c>[inf[i],sup[i]]</c> is empty.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void is_empty(T const* inf, T const* sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if the bare interval <c>[inf[i],sup[i]]</c> is the entire real line.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void is_entire(T const* inf, T const* sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>equal(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void equal(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>equal(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void equal(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>equal(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void equal(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>subset(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void subset(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>subset(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void subset(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>subset(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void subset(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>less(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void less(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>less(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void less(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>less(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void less(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>precedes(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void precedes(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>precedes(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void precedes(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>precedes(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void precedes(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>interior(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void interior(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>interior(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void interior(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>interior(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void interior(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>strictly_less(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void strictly_less(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>strictly_less(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void strictly_less(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>strictly_less(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void strictly_less(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>strictly_precedes(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void strictly_precedes(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>strictly_precedes(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void strictly_precedes(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>strictly_precedes(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void strictly_precedes(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>disjoint(x, y)</c> holds for the bare intervals
+    /// <c>x = [x_inf[i],x_sup[i]]</c> and <c>y = [y_inf[i],y_sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param x_inf Array of the lower bounds of \p x
+    /// \param x_sup Array of the upper bounds of \p x
+    /// \param y_inf Array of the lower bounds of \p y
+    /// \param y_sup Array of the upper bounds of \p y
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of a pair containing an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void disjoint(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p y fixed, see <c>disjoint(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void disjoint(T const* x_inf, T const* x_sup, representation const& y, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the interval \p x fixed, see <c>disjoint(x_inf, x_sup, y_inf, y_sup, out, n)</c>.
+    ///
+    static void disjoint(representation const& x, T const* y_inf, T const* y_sup, std::uint64_t* out, std::size_t n);
+
+private:
+
+    // Bounds of the operands of the array versions, either arrays or a fixed interval
+    struct bool_mask_array
+    {
+        T const* inf;
+        T const* sup;
+
+        T lower(std::size_t i) const { return inf[i]; }
+        T upper(std::size_t i) const { return sup[i]; }
+    };
+
+    struct bool_mask_fixed
+    {
+        T inf;
+        T sup;
+
+        T lower(std::size_t) const { return inf; }
+        T upper(std::size_t) const { return sup; }
+    };
+
+    // Kernel of the array versions: op(i) returns the result for i in bit 0
+    // and whether an operand is invalid in bit 1
+    template<typename Op>
+    static void bool_mask(std::uint64_t* out, std::size_t n, Op op);
+
+    // Packs bit 0 of the 64 bytes r into a word
+    static std::uint64_t bool_mask_pack(unsigned char const* r);
+
+    template<unsigned (*Pred)(T, T, T, T), typename X, typename Y>
+    static void bool_mask(X const& x, Y const& y, std::uint64_t* out, std::size_t n);
+
+    // Branch free versions of is_valid without signaling and of the bare
+    // predicates for valid bounds
+    static unsigned bool_mask_valid(T l, T u);
+    static unsigned equal_bit(T xl, T xu, T yl, T yu);
+    static unsigned subset_bit(T xl, T xu, T yl, T yu);
+    static unsigned less_bit(T xl, T xu, T yl, T yu);
+    static unsigned precedes_bit(T xl, T xu, T yl, T yu);
+    static unsigned interior_bit(T xl, T xu, T yl, T yu);
+    static unsigned strictly_less_bit(T xl, T xu, T yl, T yu);
+    static unsigned strictly_precedes_bit(T xl, T xu, T yl, T yu);
+    static unsigned disjoint_bit(T xl, T xu, T yl, T yu);
+
+public:
+
 
 ///@}
 
@@ -1764,185 +2334,276 @@ public:
     static representation_dec div(representation_dec_type<T1> const& x, representation_dec_type<T2> const& y);
 
 
+    // Compound assignment, the result is stored in x
+
     /// \todo TODO
     ///
     ///
-    static representation recip(representation const& x);
+    static void add_assign(representation& x, representation const& y);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation recip(representation_type<T_> const& x);
+    static void add_assign(representation& x, representation_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec recip(representation_dec const& x);
+    static void add_assign(representation_dec& x, representation_dec const& y);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation_dec recip(representation_dec_type<T_> const& x);
+    static void add_assign(representation_dec& x, representation_dec_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation sqrt(representation const& x);
+    static void sub_assign(representation& x, representation const& y);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation sqrt(representation_type<T_> const& x);
+    static void sub_assign(representation& x, representation_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec sqrt(representation_dec const& x);
+    static void sub_assign(representation_dec& x, representation_dec const& y);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation_dec sqrt(representation_dec_type<T_> const& x);
+    static void sub_assign(representation_dec& x, representation_dec_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation fma(representation const& x, representation const& y,
-                              representation const& z );
+    static void mul_assign(representation& x, representation const& y);
 
     /// \todo TODO
     ///
     ///
-    template<typename T1, typename T2, typename T3>
-    static representation fma(representation_type<T1> const& x, representation_type<T2> const& y,
-                              representation_type<T3> const& z );
+    template<typename T_>
+    static void mul_assign(representation& x, representation_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec fma(representation_dec const& x, representation_dec const& y,
-                                  representation_dec const& z );
+    static void mul_assign(representation_dec& x, representation_dec const& y);
 
     /// \todo TODO
     ///
     ///
-    template<typename T1, typename T2, typename T3>
-    static representation_dec fma(representation_dec_type<T1> const& x, representation_dec_type<T2> const& y,
-                                  representation_dec_type<T3> const& z );
+    template<typename T_>
+    static void mul_assign(representation_dec& x, representation_dec_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation sqr(representation const& x);
+    static void div_assign(representation& x, representation const& y);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation sqr(representation_type<T_> const& x);
+    static void div_assign(representation& x, representation_type<T_> const& y);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec sqr(representation_dec const& x);
+    static void div_assign(representation_dec& x, representation_dec const& y);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation_dec sqr(representation_dec_type<T_> const& x);
+    static void div_assign(representation_dec& x, representation_dec_type<T_> const& y);
+
 
     /// \todo TODO
     ///
     ///
-    static representation pown(representation const& x, int p);
+    static representation recip(representation const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation pown(representation_type<T_> const& x, int p);
+    static representation recip(representation_type<T_> const& x);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec pown(representation_dec const& x, int p);
+    static representation_dec recip(representation_dec const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation_dec pown(representation_dec_type<T_> const& x, int p);
+    static representation_dec recip(representation_dec_type<T_> const& x);
 
     /// \todo TODO
     ///
     ///
-    static representation pow(representation const& x, representation const& y);
+    static representation sqrt(representation const& x);
 
     /// \todo TODO
     ///
     ///
-    template<typename T1, typename T2>
-    static representation pow(representation_type<T1> const& x, representation_type<T2> const& y);
+    template<typename T_>
+    static representation sqrt(representation_type<T_> const& x);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec pow(representation_dec const& x, representation_dec const& y);
+    static representation_dec sqrt(representation_dec const& x);
 
     /// \todo TODO
     ///
     ///
-    template<typename T1, typename T2>
-    static representation_dec pow(representation_dec_type<T1> const& x, representation_dec_type<T2> const& y);
+    template<typename T_>
+    static representation_dec sqrt(representation_dec_type<T_> const& x);
 
     /// \todo TODO
     ///
     ///
-    static representation exp(representation const& x);
+    static representation fma(representation const& x, representation const& y,
+                              representation const& z );
 
     /// \todo TODO
     ///
     ///
-    template<typename T_>
-    static representation exp(representation_type<T_> const& x);
+    template<typename T1, typename T2, typename T3>
+    static representation fma(representation_type<T1> const& x, representation_type<T2> const& y,
+                              representation_type<T3> const& z );
 
     /// \todo TODO
     ///
     ///
-    static representation_dec exp(representation_dec const& x);
+    static representation_dec fma(representation_dec const& x, representation_dec const& y,
+                                  representation_dec const& z );
 
     /// \todo TODO
     ///
     ///
-    template<typename T_>
-    static representation_dec exp(representation_dec_type<T_> const& x);
+    template<typename T1, typename T2, typename T3>
+    static representation_dec fma(representation_dec_type<T1> const& x, representation_dec_type<T2> const& y,
+                                  representation_dec_type<T3> const& z );
 
     /// \todo TODO
     ///
     ///
-    static representation exp2(representation const& x);
+    static representation sqr(representation const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation exp2(representation_type<T_> const& x);
+    static representation sqr(representation_type<T_> const& x);
 
     /// \todo TODO
     ///
     ///
-    static representation_dec exp2(representation_dec const& x);
+    static representation_dec sqr(representation_dec const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static representation_dec exp2(representation_dec_type<T_> const& x);
+    static representation_dec sqr(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation pown(representation const& x, int p);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation pown(representation_type<T_> const& x, int p);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec pown(representation_dec const& x, int p);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec pown(representation_dec_type<T_> const& x, int p);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation pow(representation const& x, representation const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation pow(representation_type<T1> const& x, representation_type<T2> const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec pow(representation_dec const& x, representation_dec const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation_dec pow(representation_dec_type<T1> const& x, representation_dec_type<T2> const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation exp(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation exp(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec exp(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec exp(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation exp2(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation exp2(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec exp2(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec exp2(representation_dec_type<T_> const& x);
 
     /// \todo TODO
     ///
@@ -3313,16 +3974,22 @@ public:
     static representation_dec atan2_rev2(representation_dec_type<T1> const& a,
                                          representation_dec_type<T2> const& c);
 
+private:
+    static representation atan2_rev_tan(representation const& c,
+                                        int q);
+
+public:
+
 ///@}
 
 
 
 
 // -----------------------------------------------------------------------------
-// Boolean functions of intervals (Recommended)
+// Forward-mode elementary functions (Recommended)
 // -----------------------------------------------------------------------------
 
-///@name Boolean functions of intervals (Recommended)
+///@name Forward-mode elementary functions (Recommended)
 ///
 ///
 ///@{
@@ -3330,87 +3997,733 @@ public:
     /// \todo TODO
     ///
     ///
-    static bool is_common_interval(representation const& x);
+    static representation rootn(representation const& x, int n);
 
     /// \todo TODO
     ///
     ///
-    static bool is_common_interval(representation_dec const& x);
+    template<typename T_>
+    static representation rootn(representation_type<T_> const& x, int n);
 
     /// \todo TODO
     ///
     ///
-    static bool is_singleton(representation const& x);
+    static representation_dec rootn(representation_dec const& x, int n);
 
     /// \todo TODO
     ///
     ///
-    static bool is_singleton(representation_dec const& x);
+    template<typename T_>
+    static representation_dec rootn(representation_dec_type<T_> const& x, int n);
 
     /// \todo TODO
     ///
     ///
-    static bool is_member(T m, representation const& x);
+    static representation expm1(representation const& x);
 
     /// \todo TODO
     ///
     ///
-    static bool is_member(T m, representation_dec const& x);
+    template<typename T_>
+    static representation expm1(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec expm1(representation_dec const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static bool is_member(T_ m, representation const& x);
+    static representation_dec expm1(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation log1p(representation const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static bool is_member(T_ m, representation_dec const& x);
+    static representation log1p(representation_type<T_> const& x);
 
-///@}
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec log1p(representation_dec const& x);
 
-// -----------------------------------------------------------------------------
-// Extended interval comparisons (Recommended)
-// -----------------------------------------------------------------------------
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec log1p(representation_dec_type<T_> const& x);
 
-///@name Extended interval comparisons (Recommended)
-///
-///
-///@{
+    /// \todo TODO
+    ///
+    ///
+    static representation compoundm1(representation const& x,
+                                     representation const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation compoundm1(representation_type<T1> const& x,
+                                     representation_type<T2> const& y);
 
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec compoundm1(representation_dec const& x,
+                                         representation_dec const& y);
 
     /// \todo TODO
     ///
     ///
-    static p1788::overlapping::overlapping_state overlap(representation const& x,
-            representation const& y);
+    template<typename T1, typename T2>
+    static representation_dec compoundm1(representation_dec_type<T1> const& x,
+                                         representation_dec_type<T2> const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation hypot(representation const& x,
+                                representation const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation hypot(representation_type<T1> const& x,
+                                representation_type<T2> const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec hypot(representation_dec const& x,
+                                    representation_dec const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation_dec hypot(representation_dec_type<T1> const& x,
+                                    representation_dec_type<T2> const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation rsqrt(representation const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static p1788::overlapping::overlapping_state overlap(representation const& x,
-            representation_type<T_> const& y);
+    static representation rsqrt(representation_type<T_> const& x);
 
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec rsqrt(representation_dec const& x);
 
     /// \todo TODO
     ///
     ///
-    static p1788::overlapping::overlapping_state overlap(representation_dec const& x,
-            representation_dec const& y);
+    template<typename T_>
+    static representation_dec rsqrt(representation_dec_type<T_> const& x);
+
+// The pi-scaled functions are backed by the MPFR primitives of MPFR 4.2.0 or newer
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,2,0)
+
+    /// \todo TODO
+    ///
+    ///
+    static representation sinpi(representation const& x);
 
     /// \todo TODO
     ///
     ///
     template<typename T_>
-    static p1788::overlapping::overlapping_state overlap(representation_dec const& x,
-            representation_dec_type<T_> const& y);
+    static representation sinpi(representation_type<T_> const& x);
 
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec sinpi(representation_dec const& x);
 
-///@}
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec sinpi(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation cospi(representation const& x);
 
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation cospi(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec cospi(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec cospi(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation tanpi(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation tanpi(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec tanpi(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec tanpi(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation asinpi(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation asinpi(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec asinpi(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec asinpi(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation acospi(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation acospi(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec acospi(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec acospi(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation atanpi(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation atanpi(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec atanpi(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec atanpi(representation_dec_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation atan2pi(representation const& y,
+                                  representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation atan2pi(representation_type<T1> const& y,
+                                  representation_type<T2> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec atan2pi(representation_dec const& y,
+                                      representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T1, typename T2>
+    static representation_dec atan2pi(representation_dec_type<T1> const& y,
+                                      representation_dec_type<T2> const& x);
+
+#endif
+
+private:
+    static int rootn_ui(mpfr_var& x, unsigned long n, mpfr_rnd_t rnd);
+
+    static T compoundm1_point(T x, T y, mpfr_rnd_t rnd);
+
+public:
+
+///@}
+
+
+
+
+// -----------------------------------------------------------------------------
+// Boolean functions of intervals (Recommended)
+// -----------------------------------------------------------------------------
+
+///@name Boolean functions of intervals (Recommended)
+///
+///
+///@{
+
+    /// \todo TODO
+    ///
+    ///
+    static bool is_common_interval(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static bool is_common_interval(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static bool is_singleton(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static bool is_singleton(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static bool is_member(T m, representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static bool is_member(T m, representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static bool is_member(T_ m, representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static bool is_member(T_ m, representation_dec const& x);
+
+    /// \brief Array version. Checks for every \f$i < n\f$ if <c>m[i]</c> is a member of the bare interval <c>[inf[i],sup[i]]</c>.
+    ///
+    /// The result for \f$i\f$ is stored in bit <c>i % 64</c> of <c>out[i / 64]</c>, the unused bits of the last word are set to 0.
+    ///
+    /// \param m Array of the numbers
+    /// \param inf Array of the lower bounds
+    /// \param sup Array of the upper bounds
+    /// \param out Array of at least <c>(n + 63) / 64</c> words
+    /// \param n Number of intervals
+    ///
+    /// \note The bit of an invalid representation is 0. If there is one, the exception state for an invalid operation is set once, see \link p1788::exception::invalid_operand() \endlink.
+    static void is_member(T const* m, T const* inf, T const* sup, std::uint64_t* out, std::size_t n);
+
+    /// \brief Array version with the number \p m fixed, see <c>is_member(m, inf, sup, out, n)</c>.
+    ///
+    static void is_member(T m, T const* inf, T const* sup, std::uint64_t* out, std::size_t n);
+
+///@}
+
+// -----------------------------------------------------------------------------
+// Extended interval comparisons (Recommended)
+// -----------------------------------------------------------------------------
+
+///@name Extended interval comparisons (Recommended)
+///
+///
+///@{
+
+
+    /// \todo TODO
+    ///
+    ///
+    static p1788::overlapping::overlapping_state overlap(representation const& x,
+            representation const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static p1788::overlapping::overlapping_state overlap(representation const& x,
+            representation_type<T_> const& y);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static p1788::overlapping::overlapping_state overlap(representation_dec const& x,
+            representation_dec const& y);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static p1788::overlapping::overlapping_state overlap(representation_dec const& x,
+            representation_dec_type<T_> const& y);
+
+    /// \brief Batched overlapping classification of bare intervals
+    ///
+    /// Computes <c>out[i] = overlap(x[i], y[i])</c> for <c>i = 0, ..., n-1</c>.
+    /// The four endpoint comparisons of a pair are packed into a bit mask which is
+    /// mapped to the overlapping state by a lookup table, the loop is branch free.
+    /// The results are identical to the scalar version, including empty and
+    /// unbounded intervals. An invalid pair yields <c>undefined</c>.
+    ///
+    /// \note If there is an invalid representation \link p1788::exception::signal_invalid_operand() \endlink
+    /// is called once after the whole batch is classified.
+    static void overlap(representation const* x, representation const* y,
+                        p1788::overlapping::overlapping_state* out, std::size_t n);
+
+    /// \brief Batched overlapping classification of decorated intervals
+    ///
+    /// See \link overlap(representation const*, representation const*, p1788::overlapping::overlapping_state*, std::size_t) overlap \endlink,
+    /// a pair containing NaI yields <c>undefined</c>.
+    static void overlap(representation_dec const* x, representation_dec const* y,
+                        p1788::overlapping::overlapping_state* out, std::size_t n);
+
+private:
+
+    // bits of the index of the lookup table for the batched overlap
+    enum overlap_bits : unsigned
+    {
+        overlap_lt_ac = 1u << 0,            // x.first < y.first
+        overlap_eq_ac = 1u << 1,            // x.first == y.first
+        overlap_lt_bd = 1u << 2,            // x.second < y.second
+        overlap_eq_bd = 1u << 3,            // x.second == y.second
+        overlap_lt_bc = 1u << 4,            // x.second < y.first
+        overlap_eq_bc = 1u << 5,            // x.second == y.first
+        overlap_lt_ad = 1u << 6,            // x.first < y.second
+        overlap_eq_ad = 1u << 7,            // x.first == y.second
+        overlap_empty_x = 1u << 8,          // x is empty
+        overlap_empty_y = 1u << 9,          // y is empty
+        overlap_table_size = 1u << 10
+    };
+
+    // lookup table for the batched overlap indexed by overlap_index(), every
+    // entry is the numeric value of an overlapping state
+    static std::uint16_t const* overlap_table();
+
+    // 1 if x is a valid representation, 0 otherwise, computed without branches
+    // and without signaling
+    static unsigned overlap_valid(representation const& x);
+    static unsigned overlap_valid(representation_dec const& x);
+
+    // bit mask of the endpoint comparisons and the emptiness of x and y
+    static unsigned overlap_index(representation const& x, representation const& y);
+
+    // state encoded by a bit mask of overlap_index()
+    static p1788::overlapping::overlapping_state overlap_state(unsigned index);
+
+public:
+
+///@}
+
+
+
+// -----------------------------------------------------------------------------
+// Slope functions (Recommended)
+// -----------------------------------------------------------------------------
+
+///@name Slope functions (Recommended)
+///
+///
+///@{
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation exp_slope1(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation exp_slope1(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec exp_slope1(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec exp_slope1(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation exp_slope2(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation exp_slope2(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec exp_slope2(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec exp_slope2(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation log_slope1(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation log_slope1(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec log_slope1(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec log_slope1(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation log_slope2(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation log_slope2(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec log_slope2(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec log_slope2(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation cos_slope2(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation cos_slope2(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec cos_slope2(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec cos_slope2(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation sin_slope3(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation sin_slope3(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec sin_slope3(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec sin_slope3(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation asin_slope3(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation asin_slope3(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec asin_slope3(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec asin_slope3(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation atan_slope3(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation atan_slope3(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec atan_slope3(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec atan_slope3(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation cosh_slope2(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation cosh_slope2(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec cosh_slope2(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec cosh_slope2(representation_dec_type<T_> const& x);
+
+
+    /// \todo TODO
+    ///
+    ///
+    static representation sinh_slope3(representation const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation sinh_slope3(representation_type<T_> const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    static representation_dec sinh_slope3(representation_dec const& x);
+
+    /// \todo TODO
+    ///
+    ///
+    template<typename T_>
+    static representation_dec sinh_slope3(representation_dec_type<T_> const& x);
+
+
+private:
+    enum class slope_kind { exp1, exp2, log1, log2, cos2, sin3, asin3, atan3, cosh2, sinh3 };
+
+    static representation slope_point(slope_kind f,
+                                      T x);
+
+public:
+
+///@}
 
 
 };
@@ -3436,7 +4749,10 @@ public:
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_cancel_func_impl.hpp"
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_rec_overlap_impl.hpp"
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_rec_bool_func_impl.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_rec_elem_func_impl.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_rec_slope_func_impl.hpp"
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_setup_func_impl.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_unchecked_func_impl.hpp"
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_util_func_impl.hpp"
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor_validation_func_impl.hpp"
 
@@ -596,6 +596,417 @@ mpfr_bin_ieee754_flavor<T>::disjoint(mpfr_bin_ieee754_flavor<T>::representation_
 }
 
 
+// bool_mask ( kernel )
+template<typename T>
+template<typename Op>
+void
+mpfr_bin_ieee754_flavor<T>::bool_mask(std::uint64_t* out, std::size_t n, Op op)
+{
+    // The results of a word are first stored in bytes by a loop with a
+    // constant trip count and without branches, which the compiler is able to
+    // vectorize, and then packed
+    unsigned char r[64];
+    unsigned flags = 0;
+    std::size_t i = 0;
+
+    for (; i + 64 <= n; i += 64)
+    {
+        for (unsigned j = 0; j < 64; ++j)
+        {
+            r[j] = static_cast<unsigned char>(op(i + j));
+            flags |= r[j];
+        }
+
+        *out++ = bool_mask_pack(r);
+    }
+
+    if (i < n)
+    {
+        for (unsigned j = 0; j < 64; ++j)
+        {
+            r[j] = i + j < n ? static_cast<unsigned char>(op(i + j)) : 0;
+            flags |= r[j];
+        }
+
+        *out = bool_mask_pack(r);
+    }
+
+    if (flags & 2u)
+        p1788::exception::signal_invalid_operand();
+}
+
+// bool_mask_pack
+template<typename T>
+std::uint64_t
+mpfr_bin_ieee754_flavor<T>::bool_mask_pack(unsigned char const* r)
+{
+    std::uint64_t w = 0;
+
+    for (unsigned k = 0; k < 64; k += 8)
+    {
+        // bit 0 of the bytes b = 0,...,7 at bit 8b of x, the multiplication
+        // moves them to the bits 56 + b without carries
+        std::uint64_t x = 0;
+
+        for (unsigned b = 0; b < 8; ++b)
+            x |= std::uint64_t(r[k + b] & 1u) << (8 * b);
+
+        w |= ((x * 0x0102040810204080ULL) >> 56) << k;
+    }
+
+    return w;
+}
+
+// bool_mask ( binary predicate )
+template<typename T>
+template<unsigned (*Pred)(T, T, T, T), typename X, typename Y>
+void
+mpfr_bin_ieee754_flavor<T>::bool_mask(X const& x, Y const& y, std::uint64_t* out, std::size_t n)
+{
+    bool_mask(out, n, [&x, &y](std::size_t i) -> unsigned
+    {
+        T xl = x.lower(i);
+        T xu = x.upper(i);
+        T yl = y.lower(i);
+        T yu = y.upper(i);
+
+        unsigned valid = bool_mask_valid(xl, xu) & bool_mask_valid(yl, yu);
+
+        return (Pred(xl, xu, yl, yu) & valid) | ((valid ^ 1u) << 1);
+    });
+}
+
+// bool_mask_valid
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::bool_mask_valid(T l, T u)
+{
+    // bitwise operators instead of logical ones to keep the computation branch free
+    return (unsigned(l != l) & unsigned(u != u))
+           | (unsigned(l <= u)
+              & unsigned(l != std::numeric_limits<T>::infinity())
+              & unsigned(u != -std::numeric_limits<T>::infinity()));
+}
+
+// The bare predicates for valid bounds, an empty interval is represented by
+// NaN bounds and all comparisons with NaN are false
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::equal_bit(T xl, T xu, T yl, T yu)
+{
+    return (unsigned(xl != xl) & unsigned(yl != yl))
+           | (unsigned(xl == yl) & unsigned(xu == yu));
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::subset_bit(T xl, T xu, T yl, T yu)
+{
+    return unsigned(xl != xl)
+           | (unsigned(yl <= xl) & unsigned(xu <= yu));
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::less_bit(T xl, T xu, T yl, T yu)
+{
+    return (unsigned(xl != xl) & unsigned(yl != yl))
+           | (unsigned(xl <= yl) & unsigned(xu <= yu));
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::precedes_bit(T xl, T xu, T yl, T)
+{
+    return unsigned(xl != xl) | unsigned(yl != yl) | unsigned(xu <= yl);
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::interior_bit(T xl, T xu, T yl, T yu)
+{
+    return unsigned(xl != xl)
+           | ((unsigned(yl < xl)
+               | (unsigned(yl == -std::numeric_limits<T>::infinity())
+                  & unsigned(xl == -std::numeric_limits<T>::infinity())))
+              & (unsigned(xu < yu)
+                 | (unsigned(xu == std::numeric_limits<T>::infinity())
+                    & unsigned(yu == std::numeric_limits<T>::infinity()))));
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::strictly_less_bit(T xl, T xu, T yl, T yu)
+{
+    return (unsigned(xl != xl) & unsigned(yl != yl))
+           | ((unsigned(xl < yl)
+               | (unsigned(xl == -std::numeric_limits<T>::infinity())
+                  & unsigned(yl == -std::numeric_limits<T>::infinity())))
+              & (unsigned(xu < yu)
+                 | (unsigned(xu == std::numeric_limits<T>::infinity())
+                    & unsigned(yu == std::numeric_limits<T>::infinity()))));
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::strictly_precedes_bit(T xl, T xu, T yl, T)
+{
+    return unsigned(xl != xl) | unsigned(yl != yl) | unsigned(xu < yl);
+}
+
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::disjoint_bit(T xl, T xu, T yl, T yu)
+{
+    return unsigned(xl != xl) | unsigned(yl != yl) | unsigned(xu < yl) | unsigned(yu < xl);
+}
+
+// is_empty ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::is_empty(T const* inf, T const* sup, std::uint64_t* out, std::size_t n)
+{
+    bool_mask(out, n, [inf, sup](std::size_t i) -> unsigned
+    {
+        unsigned valid = bool_mask_valid(inf[i], sup[i]);
+
+        return (unsigned(inf[i] != inf[i]) & valid) | ((valid ^ 1u) << 1);
+    });
+}
+
+// is_entire ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::is_entire(T const* inf, T const* sup, std::uint64_t* out, std::size_t n)
+{
+    bool_mask(out, n, [inf, sup](std::size_t i) -> unsigned
+    {
+        unsigned valid = bool_mask_valid(inf[i], sup[i]);
+
+        return (unsigned(inf[i] == -std::numeric_limits<T>::infinity())
+                & unsigned(sup[i] == std::numeric_limits<T>::infinity()) & valid)
+               | ((valid ^ 1u) << 1);
+    });
+}
+
+// equal ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::equal(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                  std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&equal_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// equal ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::equal(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                  std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&equal_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// equal ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::equal(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                  std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&equal_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// subset ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::subset(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                   std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&subset_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// subset ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::subset(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                   std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&subset_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// subset ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::subset(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                   std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&subset_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// less ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::less(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                 std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&less_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// less ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::less(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                 std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&less_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// less ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::less(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                 std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&less_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// precedes ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::precedes(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&precedes_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// precedes ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::precedes(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&precedes_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// precedes ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::precedes(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&precedes_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// interior ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::interior(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&interior_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// interior ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::interior(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&interior_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// interior ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::interior(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&interior_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// strictly_less ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::strictly_less(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                          std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&strictly_less_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// strictly_less ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::strictly_less(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                          std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&strictly_less_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// strictly_less ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::strictly_less(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                          std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&strictly_less_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// strictly_precedes ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::strictly_precedes(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                              std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&strictly_precedes_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// strictly_precedes ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::strictly_precedes(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                              std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&strictly_precedes_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// strictly_precedes ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::strictly_precedes(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                              std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&strictly_precedes_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// disjoint ( bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::disjoint(T const* x_inf, T const* x_sup, T const* y_inf, T const* y_sup,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&disjoint_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+// disjoint ( bare interval, fixed bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::disjoint(T const* x_inf, T const* x_sup, mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&disjoint_bit>(bool_mask_array { x_inf, x_sup }, bool_mask_fixed { y.first, y.second }, out, n);
+}
+
+// disjoint ( fixed bare interval, bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::disjoint(mpfr_bin_ieee754_flavor<T>::representation const& x, T const* y_inf, T const* y_sup,
+                                     std::uint64_t* out, std::size_t n)
+{
+    bool_mask<&disjoint_bit>(bool_mask_fixed { x.first, x.second }, bool_mask_array { y_inf, y_sup }, out, n);
+}
+
+
 } // namespace setbased
 
 } // namespace infsup
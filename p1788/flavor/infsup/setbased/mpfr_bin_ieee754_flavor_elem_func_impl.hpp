@@ -99,7 +99,19 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::neg(mpfr_bin_ieee754_flavor<T>::representation const& x)
 {
-    if (!is_valid(x) || is_empty(x))
+    if (!is_valid(x))
+        return empty();
+
+    return neg(x, p1788::infsup::unchecked);
+}
+
+// neg ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::neg(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked))
         return empty();
 
     return representation(-x.second, -x.first);
@@ -125,10 +137,19 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::neg(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
 {
-    if (!is_valid(x) || is_nai(x))
+    if (!is_valid(x))
         return nai();
 
-    return representation_dec(neg(x.first), x.second);
+    return neg(x, p1788::infsup::unchecked);
+}
+
+// neg ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::neg(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                p1788::infsup::unchecked_t)
+{
+    return representation_dec(neg(x.first, p1788::infsup::unchecked), x.second);
 }
 
 // neg ( decorated interval ) mixed type
@@ -156,7 +177,20 @@ typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::add(mpfr_bin_ieee754_flavor<T>::representation const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation const& y)
 {
-    if (!is_valid(x) || !is_valid(y) ||  is_empty(x) || is_empty(y))
+    if (!is_valid(x) || !is_valid(y))
+        return empty();
+
+    return add(x, y, p1788::infsup::unchecked);
+}
+
+// add ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::add(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked) || is_empty(y, p1788::infsup::unchecked))
         return empty();
 
     mpfr_var::setup();
@@ -208,17 +242,27 @@ typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::add(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
 {
-    if (!is_valid(x) || !is_valid(y) || is_nai(x) || is_nai(y))
+    if (!is_valid(x) || !is_valid(y))
         return nai();
 
+    return add(x, y, p1788::infsup::unchecked);
+}
+
+// add ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::add(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
+                                p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = add(x.first, y.first);
+    representation bare = add(x.first, y.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             std::min(x.second, y.second),
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
-                                            is_empty(bare) ? p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
+                                            is_empty(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::trv :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -262,7 +306,20 @@ typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::sub(mpfr_bin_ieee754_flavor<T>::representation const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation const& y)
 {
-    if (!is_valid(x) || !is_valid(y) ||  is_empty(x) || is_empty(y))
+    if (!is_valid(x) || !is_valid(y))
+        return empty();
+
+    return sub(x, y, p1788::infsup::unchecked);
+}
+
+// sub ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sub(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked) || is_empty(y, p1788::infsup::unchecked))
         return empty();
 
     mpfr_var::setup();
@@ -313,17 +370,27 @@ typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::sub(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
 {
-    if (!is_valid(x) || !is_valid(y) || is_nai(x) || is_nai(y))
+    if (!is_valid(x) || !is_valid(y))
         return nai();
 
+    return sub(x, y, p1788::infsup::unchecked);
+}
+
+// sub ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sub(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
+                                p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = sub(x.first, y.first);
+    representation bare = sub(x.first, y.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             std::min(x.second, y.second),
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
-                                            is_empty(bare) ? p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
+                                            is_empty(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::trv :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -364,7 +431,20 @@ typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::mul(mpfr_bin_ieee754_flavor<T>::representation const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation const& y)
 {
-    if (!is_valid(x) || !is_valid(y) ||  is_empty(x) || is_empty(y))
+    if (!is_valid(x) || !is_valid(y))
+        return empty();
+
+    return mul(x, y, p1788::infsup::unchecked);
+}
+
+// mul ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::mul(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked) || is_empty(y, p1788::infsup::unchecked))
         return empty();
 
     if (x.first == 0.0 && x.second == 0.0)
@@ -373,10 +453,10 @@ mpfr_bin_ieee754_flavor<T>::mul(mpfr_bin_ieee754_flavor<T>::representation const
     if (y.first == 0.0 && y.second == 0.0)
         return y;
 
-    if (is_entire(x))
+    if (is_entire(x, p1788::infsup::unchecked))
         return x;
 
-    if (is_entire(y))
+    if (is_entire(y, p1788::infsup::unchecked))
         return y;
 
 
@@ -533,17 +613,27 @@ typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::mul(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
 {
-    if (!is_valid(x) || !is_valid(y) || is_nai(x) || is_nai(y))
+    if (!is_valid(x) || !is_valid(y))
         return nai();
 
+    return mul(x, y, p1788::infsup::unchecked);
+}
+
+// mul ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::mul(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
+                                p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = mul(x.first, y.first);
+    representation bare = mul(x.first, y.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             std::min(x.second, y.second),
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
-                                            is_empty(bare) ? p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
+                                            is_empty(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::trv :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -584,7 +674,20 @@ typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::div(mpfr_bin_ieee754_flavor<T>::representation const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation const& y)
 {
-    if (!is_valid(x) || !is_valid(y) ||  is_empty(x) || is_empty(y))
+    if (!is_valid(x) || !is_valid(y))
+        return empty();
+
+    return div(x, y, p1788::infsup::unchecked);
+}
+
+// div ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::div(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked) || is_empty(y, p1788::infsup::unchecked))
         return empty();
 
     if (y.first == 0.0 && y.second == 0.0)
@@ -751,17 +854,28 @@ typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::div(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
                                 mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
 {
-    if (!is_valid(x) || !is_valid(y) || is_nai(x) || is_nai(y))
+    if (!is_valid(x) || !is_valid(y))
         return nai();
 
+    return div(x, y, p1788::infsup::unchecked);
+}
+
+// div ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::div(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
+                                p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = div(x.first, y.first);
+    representation bare = div(x.first, y.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             std::min(x.second, y.second),
-                                            is_member(0.0, y) || is_empty(bare) ?  p1788::decoration::decoration::trv :
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            (y.first.first <= 0.0 && 0.0 <= y.first.second)
+                                            || is_empty(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -794,6 +908,149 @@ mpfr_bin_ieee754_flavor<T>::div(mpfr_bin_ieee754_flavor<T>::representation_dec_t
 }
 
 
+// compound assignment
+
+// add_assign ( bare interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::add_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    x = add(x, y);
+}
+
+// add_assign ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::add_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& y)
+{
+    x = add(x, y);
+}
+
+// add_assign ( decorated interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::add_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
+{
+    x = add(x, y);
+}
+
+// add_assign ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::add_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& y)
+{
+    x = add(x, y);
+}
+
+
+// sub_assign ( bare interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::sub_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    x = sub(x, y);
+}
+
+// sub_assign ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::sub_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& y)
+{
+    x = sub(x, y);
+}
+
+// sub_assign ( decorated interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::sub_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
+{
+    x = sub(x, y);
+}
+
+// sub_assign ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::sub_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& y)
+{
+    x = sub(x, y);
+}
+
+
+// mul_assign ( bare interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::mul_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    x = mul(x, y);
+}
+
+// mul_assign ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::mul_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& y)
+{
+    x = mul(x, y);
+}
+
+// mul_assign ( decorated interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::mul_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
+{
+    x = mul(x, y);
+}
+
+// mul_assign ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::mul_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& y)
+{
+    x = mul(x, y);
+}
+
+
+// div_assign ( bare interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::div_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    x = div(x, y);
+}
+
+// div_assign ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::div_assign(mpfr_bin_ieee754_flavor<T>::representation& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& y)
+{
+    x = div(x, y);
+}
+
+// div_assign ( decorated interval )
+template<typename T>
+void mpfr_bin_ieee754_flavor<T>::div_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
+{
+    x = div(x, y);
+}
+
+// div_assign ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+void mpfr_bin_ieee754_flavor<T>::div_assign(mpfr_bin_ieee754_flavor<T>::representation_dec& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& y)
+{
+    x = div(x, y);
+}
+
+
+
 // recip
 
 // recip ( bare interval )
@@ -804,7 +1061,16 @@ mpfr_bin_ieee754_flavor<T>::recip(mpfr_bin_ieee754_flavor<T>::representation con
     if (!is_valid(x))
         return empty();
 
-    return div(representation(1.0, 1.0), x);
+    return recip(x, p1788::infsup::unchecked);
+}
+
+// recip ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::recip(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                  p1788::infsup::unchecked_t)
+{
+    return div(representation(1.0, 1.0), x, p1788::infsup::unchecked);
 }
 
 // recip ( bare interval ) mixed type
@@ -836,17 +1102,27 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::recip(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
 {
-    if (!is_valid(x) || is_nai(x))
+    if (!is_valid(x))
         return nai();
 
+    return recip(x, p1788::infsup::unchecked);
+}
+
+// recip ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::recip(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                  p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = recip(x.first);
+    representation bare = recip(x.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             x.second,
-                                            is_member(0.0, x) || is_empty(bare) ?  p1788::decoration::decoration::trv :
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            (x.first.first <= 0.0 && 0.0 <= x.first.second)
+                                            || is_empty(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -883,7 +1159,19 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::sqr(mpfr_bin_ieee754_flavor<T>::representation const& x)
 {
-    if (!is_valid(x) || is_empty(x))
+    if (!is_valid(x))
+        return empty();
+
+    return sqr(x, p1788::infsup::unchecked);
+}
+
+// sqr ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sqr(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked))
         return empty();
 
     mpfr_var::setup();
@@ -934,17 +1222,26 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::sqr(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
 {
-    if (!is_valid(x) || is_nai(x))
+    if (!is_valid(x))
         return nai();
 
+    return sqr(x, p1788::infsup::unchecked);
+}
+
+// sqr ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sqr(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = sqr(x.first);
+    representation bare = sqr(x.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             x.second,
-                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            is_empty(bare, p1788::infsup::unchecked) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -982,7 +1279,19 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation
 mpfr_bin_ieee754_flavor<T>::sqrt(mpfr_bin_ieee754_flavor<T>::representation const& x)
 {
-    if (!is_valid(x) || is_empty(x) || x.second < 0.0)
+    if (!is_valid(x))
+        return empty();
+
+    return sqrt(x, p1788::infsup::unchecked);
+}
+
+// sqrt ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sqrt(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                 p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked) || x.second < 0.0)
         return empty();
 
     mpfr_var::setup();
@@ -1034,17 +1343,26 @@ template<typename T>
 typename mpfr_bin_ieee754_flavor<T>::representation_dec
 mpfr_bin_ieee754_flavor<T>::sqrt(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
 {
-    if (!is_valid(x) || is_nai(x))
+    if (!is_valid(x))
         return nai();
 
+    return sqrt(x, p1788::infsup::unchecked);
+}
+
+// sqrt ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sqrt(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                 p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = sqrt(x.first);
+    representation bare = sqrt(x.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             x.second,
-                                            x.first.first < 0.0 || is_empty(bare) ?  p1788::decoration::decoration::trv :
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            x.first.first < 0.0 || is_empty(bare, p1788::infsup::unchecked) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
@@ -1083,8 +1401,22 @@ mpfr_bin_ieee754_flavor<T>::fma(mpfr_bin_ieee754_flavor<T>::representation const
                                 mpfr_bin_ieee754_flavor<T>::representation const& y,
                                 mpfr_bin_ieee754_flavor<T>::representation const& z)
 {
-    if (!is_valid(x) || !is_valid(y) || !is_valid(z)
-            ||  is_empty(x) || is_empty(y) || is_empty(z))
+    if (!is_valid(x) || !is_valid(y) || !is_valid(z))
+        return empty();
+
+    return fma(x, y, z, p1788::infsup::unchecked);
+}
+
+// fma ( bare interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::fma(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                mpfr_bin_ieee754_flavor<T>::representation const& z,
+                                p1788::infsup::unchecked_t)
+{
+    if (is_empty(x, p1788::infsup::unchecked) || is_empty(y, p1788::infsup::unchecked)
+            || is_empty(z, p1788::infsup::unchecked))
         return empty();
 
     if (x.first == 0.0 && x.second == 0.0)
@@ -1093,10 +1425,10 @@ mpfr_bin_ieee754_flavor<T>::fma(mpfr_bin_ieee754_flavor<T>::representation const
     if (y.first == 0.0 && y.second == 0.0)
         return z;
 
-    if (is_entire(x))
+    if (is_entire(x, p1788::infsup::unchecked))
         return x;
 
-    if (is_entire(y))
+    if (is_entire(y, p1788::infsup::unchecked))
         return y;
 
 
@@ -1286,18 +1618,28 @@ mpfr_bin_ieee754_flavor<T>::fma(mpfr_bin_ieee754_flavor<T>::representation_dec c
                                 mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
                                 mpfr_bin_ieee754_flavor<T>::representation_dec const& z)
 {
-    if (!is_valid(x) || !is_valid(y) || !is_valid(z)
-            || is_nai(x) || is_nai(y) || is_nai(z))
+    if (!is_valid(x) || !is_valid(y) || !is_valid(z))
         return nai();
 
+    return fma(x, y, z, p1788::infsup::unchecked);
+}
+
+// fma ( decorated interval ) unchecked
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::fma(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
+                                mpfr_bin_ieee754_flavor<T>::representation_dec const& z,
+                                p1788::infsup::unchecked_t)
+{
     // compute bare result
-    representation bare = fma(x.first, y.first, z.first);
+    representation bare = fma(x.first, y.first, z.first, p1788::infsup::unchecked);
 
     // compute decoration
     p1788::decoration::decoration dec = std::min(
                                             std::min(std::min(x.second, y.second), z.second),
-                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
-                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            is_empty(bare, p1788::infsup::unchecked) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare, p1788::infsup::unchecked) ? p1788::decoration::decoration::com :
                                             p1788::decoration::decoration::dac);
     return representation_dec(bare, dec);
 }
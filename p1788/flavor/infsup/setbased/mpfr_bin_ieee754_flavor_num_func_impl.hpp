@@ -167,6 +167,44 @@ mpfr_bin_ieee754_flavor<T>::sup(mpfr_bin_ieee754_flavor<T>::representation_dec_t
 
 
 
+// native mid and rad
+template<typename T>
+bool mpfr_bin_ieee754_flavor<T>::native_mid_rad()
+{
+    return std::is_floating_point<T>::value && std::numeric_limits<T>::radix == 2
+           && FLT_EVAL_METHOD == 0 && std::fegetround() == FE_TONEAREST;
+}
+
+template<typename T>
+T mpfr_bin_ieee754_flavor<T>::mid_native(T a, T b)
+{
+    T const min2 = 2 * std::numeric_limits<T>::min();
+
+    // The halving is exact for |a|, |b| >= 2 * min. Otherwise a + b can not
+    // overflow and its rounding commutes with the halving, or it is exact if
+    // the midpoint is subnormal.
+    if (std::abs(a) >= min2 && std::abs(b) >= min2)
+        return T(0.5) * a + T(0.5) * b;
+
+    return T(0.5) * (a + b);
+}
+
+template<typename T>
+T mpfr_bin_ieee754_flavor<T>::sub_rndu_native(T a, T b)
+{
+    T d = a - b;
+
+    if (std::isinf(d))
+        return d;
+
+    // exact error of the rounded difference (TwoSum)
+    T t = d - a;
+    T e = (a - (d - t)) + (-b - t);
+
+    return e > 0 ? std::nextafter(d, std::numeric_limits<T>::infinity()) : d;
+}
+
+
 // mid ( bare interval )
 template<typename T>
 T
@@ -175,7 +213,15 @@ mpfr_bin_ieee754_flavor<T>::mid(mpfr_bin_ieee754_flavor<T>::representation const
     if (!is_valid(x) || is_empty(x))
         return std::numeric_limits<T>::quiet_NaN();
 
-    if (is_entire(x))
+    return mid_nonempty(x);
+}
+
+// midpoint of a nonempty interval
+template<typename T>
+T
+mpfr_bin_ieee754_flavor<T>::mid_nonempty(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (x.first == -std::numeric_limits<T>::infinity() && x.second == std::numeric_limits<T>::infinity())
         return +0.0;
 
     if (x.first == -std::numeric_limits<T>::infinity())
@@ -184,6 +230,12 @@ mpfr_bin_ieee754_flavor<T>::mid(mpfr_bin_ieee754_flavor<T>::representation const
     if (x.second == std::numeric_limits<T>::infinity())
         return std::numeric_limits<T>::max();
 
+    if (native_mid_rad())
+    {
+        T res = mid_native(x.first, x.second);
+        return res == -0.0 ? +0.0 : res;
+    }
+
 
     // extended EMIN for error free division by 2
     typedef p1788::util::mpfr_var<mpfr_var::PREC,
@@ -346,6 +398,13 @@ mpfr_bin_ieee754_flavor<T>::mid_rad(mpfr_bin_ieee754_flavor<T>::representation c
     // compute mid point
     std::pair<T,T> mr(mid(x), 0.0);
 
+    if (native_mid_rad())
+    {
+        // maximum distance of the midpoint to the lower and the upper bound, see below
+        mr.second = std::max(sub_rndu_native(mr.first, x.first), sub_rndu_native(x.second, mr.first));
+        return mr;
+    }
+
     mpfr_var::setup();
 
     mpfr_var m(mr.first, MPFR_RNDN);
@@ -642,6 +701,192 @@ mpfr_bin_ieee754_flavor<T>::mig(mpfr_bin_ieee754_flavor<T>::representation_dec_t
 }
 
 
+// num_array
+template<typename T>
+template<typename Op>
+void
+mpfr_bin_ieee754_flavor<T>::num_array(T const* inf, T const* sup, T* out, std::size_t n, Op op)
+{
+    // The result is computed for every element and the one of an invalid
+    // element is replaced afterwards, hence the loop is free of branches and
+    // can be vectorized. Invalid elements are recorded in a floating point
+    // flag, an integer reduction mixed with floating point comparisons is not
+    // vectorized.
+    T invalid = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        T l = inf[i];
+        T u = sup[i];
+        T r = op(l, u);
+
+        bool valid = ((l <= u) & (l != std::numeric_limits<T>::infinity())
+                      & (u != -std::numeric_limits<T>::infinity()))
+                     | ((l != l) & (u != u));
+
+        invalid = valid ? invalid : T(1);
+        out[i] = valid ? r : std::numeric_limits<T>::quiet_NaN();
+    }
+
+    if (invalid != 0)
+        p1788::exception::signal_invalid_operand();
+}
+
+// mid_native_array
+template<typename T>
+T
+mpfr_bin_ieee754_flavor<T>::mid_native_array(T l, T u)
+{
+    T const max = std::numeric_limits<T>::max();
+    T const inf = std::numeric_limits<T>::infinity();
+
+    // (a + b) / 2 is correct for finite bounds unless a + b overflows, then
+    // both bounds are large and a / 2 + b / 2 is correct, see mid_native.
+    // Floating point operations that only one arm of a selection depends on
+    // are moved into a branch by the compiler, which prevents the
+    // vectorization. Hence m1 is part of the condition, it is NaN only if m2
+    // is NaN as well.
+    T m1 = T(0.5) * l + T(0.5) * u;
+    T m2 = T(0.5) * (l + u);
+    T m = (std::abs(m2) <= max) | (m1 != m1) ? m2 : m1;
+
+    // unbounded cases of mid_nonempty and +0 instead of -0
+    bool li = l == -inf;
+    bool ui = u == inf;
+    T s = li ? (ui ? T(0) : -max) : (ui ? max : T(0));
+
+    return li | ui | (m == 0) ? s : m;
+}
+
+// sub_rndu_native_array
+template<typename T>
+T
+mpfr_bin_ieee754_flavor<T>::sub_rndu_native_array(T a, T b)
+{
+    T d = a - b;
+
+    // exact error of the rounded difference (TwoSum), NaN if d is infinite
+    T t = d - a;
+    T e = (a - (d - t)) + (-b - t);
+
+    T up = next_up_nonneg(d);
+
+    return e > 0 ? up : d;
+}
+
+// next_up_nonneg
+template<typename T>
+T
+mpfr_bin_ieee754_flavor<T>::next_up_nonneg(T x)
+{
+    // integer type of the size of T for binary32 and binary64, the bits are
+    // only accessed if the format is one of them
+    typedef typename std::conditional<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>::type bits;
+
+    if (std::numeric_limits<T>::is_iec559
+            && ((sizeof(T) == sizeof(std::uint64_t) && std::numeric_limits<T>::digits == 53)
+                || (sizeof(T) == sizeof(std::uint32_t) && std::numeric_limits<T>::digits == 24)))
+    {
+        bits b;
+        std::memcpy(&b, &x, sizeof(bits));
+        ++b;
+        std::memcpy(&x, &b, sizeof(bits));
+
+        return x;
+    }
+
+    return std::nextafter(x, std::numeric_limits<T>::infinity());
+}
+
+// wid ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::wid(T const* inf, T const* sup, T* out, std::size_t n)
+{
+    if (!native_mid_rad())
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = wid(representation(inf[i], sup[i]));
+
+        return;
+    }
+
+    num_array(inf, sup, out, n, [](T l, T u) -> T
+    {
+        T r = sub_rndu_native_array(u, l);
+        return r == 0 ? T(0) : r;
+    });
+}
+
+// mid ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::mid(T const* inf, T const* sup, T* out, std::size_t n)
+{
+    if (!native_mid_rad())
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = mid(representation(inf[i], sup[i]));
+
+        return;
+    }
+
+    num_array(inf, sup, out, n, [](T l, T u) -> T
+    {
+        return mid_native_array(l, u);
+    });
+}
+
+// rad ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::rad(T const* inf, T const* sup, T* out, std::size_t n)
+{
+    if (!native_mid_rad())
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = rad(representation(inf[i], sup[i]));
+
+        return;
+    }
+
+    // same as the native mid_rad
+    num_array(inf, sup, out, n, [](T l, T u) -> T
+    {
+        T m = mid_native_array(l, u);
+        return std::max(sub_rndu_native_array(m, l), sub_rndu_native_array(u, m));
+    });
+}
+
+// mag ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::mag(T const* inf, T const* sup, T* out, std::size_t n)
+{
+    num_array(inf, sup, out, n, [](T l, T u) -> T
+    {
+        T xl = std::abs(l);
+        T xu = std::abs(u);
+
+        return xl > xu ? xl : xu;
+    });
+}
+
+// mig ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::mig(T const* inf, T const* sup, T* out, std::size_t n)
+{
+    num_array(inf, sup, out, n, [](T l, T u) -> T
+    {
+        T xl = std::abs(l);
+        T xu = std::abs(u);
+
+        return (l < 0) & (u > 0) ? T(0) : (xl < xu ? xl : xu);
+    });
+}
+
+
 
 } // namespace setbased
 
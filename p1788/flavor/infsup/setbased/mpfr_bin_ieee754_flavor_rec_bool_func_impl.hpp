@@ -134,6 +134,40 @@ bool mpfr_bin_ieee754_flavor<T>::is_member(T_ m, mpfr_bin_ieee754_flavor<T>::rep
 }
 
 
+// is_member ( bare interval ) array version
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::is_member(T const* m, T const* inf, T const* sup, std::uint64_t* out, std::size_t n)
+{
+    bool_mask(out, n, [m, inf, sup](std::size_t i) -> unsigned
+    {
+        unsigned valid = bool_mask_valid(inf[i], sup[i]);
+
+        return (unsigned(inf[i] <= m[i]) & unsigned(m[i] <= sup[i])
+                & unsigned(m[i] != std::numeric_limits<T>::infinity())
+                & unsigned(m[i] != -std::numeric_limits<T>::infinity()) & valid)
+               | ((valid ^ 1u) << 1);
+    });
+}
+
+// is_member ( bare interval ) array version with a fixed number
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::is_member(T m, T const* inf, T const* sup, std::uint64_t* out, std::size_t n)
+{
+    unsigned finite = unsigned(m != std::numeric_limits<T>::infinity())
+                      & unsigned(m != -std::numeric_limits<T>::infinity());
+
+    bool_mask(out, n, [m, finite, inf, sup](std::size_t i) -> unsigned
+    {
+        unsigned valid = bool_mask_valid(inf[i], sup[i]);
+
+        return (unsigned(inf[i] <= m) & unsigned(m <= sup[i]) & finite & valid)
+               | ((valid ^ 1u) << 1);
+    });
+}
+
+
 } // namespace setbased
 
 } // namespace infsup
@@ -0,0 +1,1716 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_REC_ELEM_FUNC_IMPL_HPP
+#define LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_REC_ELEM_FUNC_IMPL_HPP
+
+
+namespace p1788
+{
+
+namespace flavor
+{
+
+namespace infsup
+{
+
+namespace setbased
+{
+
+// rootn_ui
+//
+// x^(1/n) for n > 0, mpfr_root is deprecated since MPFR 4.0.0
+template<typename T>
+int mpfr_bin_ieee754_flavor<T>::rootn_ui(mpfr_var& x, unsigned long n, mpfr_rnd_t rnd)
+{
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,0,0)
+    return mpfr_rootn_ui(x(), x(), n, rnd);
+#else
+    return mpfr_root(x(), x(), n, rnd);
+#endif
+}
+
+// compoundm1_point
+//
+// (1 + x)^y - 1 rounded to T using the rounding mode rnd. The base 1 + x is
+// formed exactly and the power is computed in a working precision which
+// compensates the cancellation of the subtraction for small x * y.
+// Points of the closure of the domain with the base 0 are handled by
+// mpfr_pow, e.g. (1 + (-1))^0 - 1 = 0.
+template<typename T>
+T mpfr_bin_ieee754_flavor<T>::compoundm1_point(T x, T y, mpfr_rnd_t rnd)
+{
+    // extended exponent range for the intermediate results
+    typedef p1788::util::mpfr_var<mpfr_var::PREC,
+            4 * mpfr_var::EMIN,
+            4 * mpfr_var::EMAX,
+            false>  ext_mpfr_var;
+
+    ext_mpfr_var::setup();
+
+    mpfr_var xv(x, MPFR_RNDN);
+    mpfr_var yv(y, MPFR_RNDN);
+
+    mpfr_exp_t ex = mpfr_regular_p(xv()) ? mpfr_get_exp(xv()) : 0;
+    mpfr_exp_t ey = mpfr_regular_p(yv()) ? mpfr_get_exp(yv()) : 0;
+
+    mpfr_prec_t prec = 2 * mpfr_var::PREC + 64 + (ex < 0 ? -ex : ex) + (ex + ey < 0 ? -(ex + ey) : 0);
+
+    mpfr_t b, p;
+    mpfr_inits2(prec, b, p, (mpfr_ptr) 0);
+
+    // exact
+    mpfr_add_ui(b, xv(), 1, MPFR_RNDN);
+
+    mpfr_pow(p, b, yv(), rnd);
+    mpfr_sub_ui(p, p, 1, rnd);
+
+    // convert to T with directed rounding (gradual underflow is handled by the conversion),
+    // the result is >= -1
+    T r = std::max(p1788::util::mpfr_get_trait<T>::apply(p, rnd), static_cast<T>(-1.0));
+
+    mpfr_clears(b, p, (mpfr_ptr) 0);
+
+    mpfr_var::setup();
+
+    return r;
+}
+
+
+
+// rootn
+
+// rootn ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::rootn(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                  int n)
+{
+    if (!is_valid(x) || is_empty(x) || n == 0)
+        return empty();
+
+    mpfr_var::setup();
+
+    // positive
+    if (n > 0)
+    {
+        // even, domain [0,+inf]
+        representation xx = n % 2 == 0 ? intersection(x, representation(0.0, std::numeric_limits<T>::infinity())) : x;
+
+        if (is_empty(xx))
+            return xx;
+
+        mpfr_var l(xx.first, MPFR_RNDD);
+        mpfr_var u(xx.second, MPFR_RNDU);
+
+        l.subnormalize(rootn_ui(l, n, MPFR_RNDD), MPFR_RNDD);
+        u.subnormalize(rootn_ui(u, n, MPFR_RNDU), MPFR_RNDU);
+
+        return representation(l.template get<T>(MPFR_RNDD), u.template get<T>(MPFR_RNDU));
+    }
+
+    // negative, x^(1/n) is the inverse function of pown(x, n)
+
+    // even, domain (0,+inf]
+    if (n % 2 == 0)
+    {
+        if (x.second <= 0.0)
+            return empty();
+
+        mpfr_var xu(x.second, MPFR_RNDU);
+        mpfr_var l;
+        pown_rev_inf(xu, l, n);
+
+        if (x.first <= 0.0)
+            return representation(l.template get<T>(MPFR_RNDD), std::numeric_limits<T>::infinity());
+
+        mpfr_var xl(x.first, MPFR_RNDD);
+        mpfr_var u;
+        pown_rev_sup(xl, u, n);
+
+        return representation(l.template get<T>(MPFR_RNDD), u.template get<T>(MPFR_RNDU));
+    }
+
+    // odd, domain [-inf,0) and (0,+inf]
+    if (x.first == 0.0 && x.second == 0.0)
+        return empty();
+
+    if (x.first < 0.0 && x.second > 0.0)
+        return entire();
+
+    mpfr_var l;
+    mpfr_var u;
+
+    if (x.second == 0.0)
+    {
+        mpfr_set_inf(l(), -1);
+    }
+    else
+    {
+        mpfr_var xu(x.second, MPFR_RNDU);
+        pown_rev_inf(xu, l, n);
+    }
+
+    if (x.first == 0.0)
+    {
+        mpfr_set_inf(u(), 1);
+    }
+    else
+    {
+        mpfr_var xl(x.first, MPFR_RNDD);
+        pown_rev_sup(xl, u, n);
+    }
+
+    return representation(l.template get<T>(MPFR_RNDD), u.template get<T>(MPFR_RNDU));
+}
+
+// rootn ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::rootn(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x,
+                                  int n)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::rootn(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x), n
+               )
+           );
+}
+
+// rootn ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::rootn(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                  int n)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = rootn(x.first, n);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            n == 0
+                                            || (n > 0 && n % 2 == 0 && x.first.first < 0.0)
+                                            || (n < 0 && n % 2 == 0 && x.first.first <= 0.0)
+                                            || (n < 0 && n % 2 != 0 && is_member(0.0, x))
+                                            || is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// rootn ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::rootn(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x,
+                                  int n)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::rootn(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x), n
+               )
+           );
+}
+
+
+// expm1
+
+// expm1 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::expm1(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    mpfr_var::setup();
+    mpfr_var l(x.first, MPFR_RNDD);
+    mpfr_var u(x.second, MPFR_RNDU);
+
+    l.subnormalize(mpfr_expm1(l(), l(), MPFR_RNDD), MPFR_RNDD);
+    u.subnormalize(mpfr_expm1(u(), u(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(l.template get<T>(MPFR_RNDD), u.template get<T>(MPFR_RNDU));
+}
+
+// expm1 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::expm1(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::expm1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// expm1 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::expm1(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = expm1(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// expm1 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::expm1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::expm1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// log1p
+
+// log1p ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::log1p(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    representation xx = intersection(x, representation(-1.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(xx))
+        return xx;
+
+    if (x.second <= -1.0)
+        return empty();
+
+    mpfr_var::setup();
+    mpfr_var xl(xx.first, MPFR_RNDD);
+    mpfr_var xu(xx.second, MPFR_RNDU);
+
+    xl.subnormalize(mpfr_log1p(xl(), xl(), MPFR_RNDD), MPFR_RNDD);
+    xu.subnormalize(mpfr_log1p(xu(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(xl.template get<T>(MPFR_RNDD), xu.template get<T>(MPFR_RNDU));
+}
+
+// log1p ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::log1p(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::log1p(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// log1p ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::log1p(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = log1p(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first <= -1.0 || is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// log1p ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::log1p(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::log1p(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// compoundm1
+
+// compoundm1 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::compoundm1(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    if (!is_valid(x) || !is_valid(y) || is_empty(y))
+        return empty();
+
+    // (1 + x)^y - 1, same case distinction as pow with the base 1 + x
+    representation xx = intersection(x, representation(-1.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(xx))
+        return xx;
+
+    if (xx.second == -1.0)
+    {
+        if (y.second <= 0.0)
+        {
+            return empty();
+        }
+        else
+        {
+            return representation(-1.0, -1.0);
+        }
+    }
+
+    T z_lower;
+    T z_upper;
+
+    if (0.0 <= y.first)
+    {
+        if (xx.second <= 0.0)
+        {
+            z_lower = compoundm1_point(xx.first, y.second, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.second, y.first, MPFR_RNDU);
+        }
+        else if (0.0 <= xx.first)
+        {
+            z_lower = compoundm1_point(xx.first, y.first, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.second, y.second, MPFR_RNDU);
+        }
+        else     // xx.first < 0 && 0 < xx.second
+        {
+            z_lower = compoundm1_point(xx.first, y.second, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.second, y.second, MPFR_RNDU);
+        }
+    }
+    else if (y.second <= 0.0)
+    {
+        if (xx.second <= 0.0)
+        {
+            z_lower = compoundm1_point(xx.second, y.second, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.first, y.first, MPFR_RNDU);
+        }
+        else if (0.0 <= xx.first)
+        {
+            z_lower = compoundm1_point(xx.second, y.first, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.first, y.second, MPFR_RNDU);
+        }
+        else     // xx.first < 0 && 0 < xx.second
+        {
+            z_lower = compoundm1_point(xx.second, y.first, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.first, y.first, MPFR_RNDU);
+        }
+    }
+    else     // y.first < 0 && 0 < y.second
+    {
+        if (xx.second <= 0.0)
+        {
+            z_lower = compoundm1_point(xx.first, y.second, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.first, y.first, MPFR_RNDU);
+        }
+        else if (0.0 <= xx.first)
+        {
+            z_lower = compoundm1_point(xx.second, y.first, MPFR_RNDD);
+            z_upper = compoundm1_point(xx.second, y.second, MPFR_RNDU);
+        }
+        else     // xx.first < 0 && 0 < xx.second
+        {
+            z_lower = std::min(compoundm1_point(xx.first, y.second, MPFR_RNDD),
+                               compoundm1_point(xx.second, y.first, MPFR_RNDD));
+            z_upper = std::max(compoundm1_point(xx.first, y.first, MPFR_RNDU),
+                               compoundm1_point(xx.second, y.second, MPFR_RNDU));
+        }
+    }
+
+    return representation(z_lower, z_upper);
+}
+
+// compoundm1 ( bare interval ) mixed type
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::compoundm1(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& y)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(x) || !mpfr_bin_ieee754_flavor<T2>::is_valid(y))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::compoundm1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(y)
+               )
+           );
+}
+
+// compoundm1 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::compoundm1(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
+{
+    if (!is_valid(x) || !is_valid(y) || is_nai(x) || is_nai(y))
+        return nai();
+
+    // compute bare result
+    representation bare = compoundm1(x.first, y.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            std::min(x.second, y.second),
+                                            x.first.first < -1.0 || (is_member(-1.0, x) && y.first.first <= 0.0) || is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// compoundm1 ( decorated interval ) mixed type
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::compoundm1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& x,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& y)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(x) || !mpfr_bin_ieee754_flavor<T2>::is_valid(y)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(x) || mpfr_bin_ieee754_flavor<T2>::is_nai(y))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::compoundm1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(y)
+               )
+           );
+}
+
+
+// hypot
+
+// hypot ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::hypot(mpfr_bin_ieee754_flavor<T>::representation const& x,
+                                  mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    if (!is_valid(x) || !is_valid(y) || is_empty(x) || is_empty(y))
+        return empty();
+
+    mpfr_var::setup();
+
+    // increasing in |x| and |y|
+    mpfr_var xl(mig(x), MPFR_RNDD);
+    mpfr_var xu(mag(x), MPFR_RNDU);
+    mpfr_var yl(mig(y), MPFR_RNDD);
+    mpfr_var yu(mag(y), MPFR_RNDU);
+
+    xl.subnormalize(mpfr_hypot(xl(), xl(), yl(), MPFR_RNDD), MPFR_RNDD);
+    xu.subnormalize(mpfr_hypot(xu(), xu(), yu(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(xl.template get<T>(MPFR_RNDD), xu.template get<T>(MPFR_RNDU));
+}
+
+// hypot ( bare interval ) mixed type
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::hypot(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& x,
+                                  mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& y)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(x) || !mpfr_bin_ieee754_flavor<T2>::is_valid(y))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::hypot(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(y)
+               )
+           );
+}
+
+// hypot ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::hypot(mpfr_bin_ieee754_flavor<T>::representation_dec const& x,
+                                  mpfr_bin_ieee754_flavor<T>::representation_dec const& y)
+{
+    if (!is_valid(x) || !is_valid(y) || is_nai(x) || is_nai(y))
+        return nai();
+
+    // compute bare result
+    representation bare = hypot(x.first, y.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            std::min(x.second, y.second),
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// hypot ( decorated interval ) mixed type
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::hypot(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& x,
+                                  mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& y)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(x) || !mpfr_bin_ieee754_flavor<T2>::is_valid(y)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(x) || mpfr_bin_ieee754_flavor<T2>::is_nai(y))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::hypot(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(y)
+               )
+           );
+}
+
+
+// rsqrt
+
+// rsqrt ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::rsqrt(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    representation xx = intersection(x, representation(0.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(xx))
+        return xx;
+
+    if (x.second <= 0.0)
+        return empty();
+
+    mpfr_var::setup();
+    mpfr_var xl(xx.first <= 0.0 ? 0.0 : xx.first, MPFR_RNDD);
+    mpfr_var xu(xx.second, MPFR_RNDU);
+
+    // decreasing, rsqrt(+0) = +inf and rsqrt(+inf) = +0
+    xu.subnormalize(mpfr_rec_sqrt(xu(), xu(), MPFR_RNDD), MPFR_RNDD);
+    xl.subnormalize(mpfr_rec_sqrt(xl(), xl(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(xu.template get<T>(MPFR_RNDD), xl.template get<T>(MPFR_RNDU));
+}
+
+// rsqrt ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::rsqrt(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::rsqrt(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// rsqrt ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::rsqrt(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = rsqrt(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first <= 0.0 || is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// rsqrt ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::rsqrt(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::rsqrt(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// The pi-scaled functions are backed by the MPFR primitives of MPFR 4.2.0 or newer
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,2,0)
+
+
+// sinpi
+
+// sinpi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sinpi(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    mpfr_var::setup();
+
+    mpfr_var xl(x.first, MPFR_RNDD);
+    mpfr_var xu(x.second, MPFR_RNDU);
+
+
+
+    mpfr_var w;
+    mpfr_sub(w(), xu(), xl(), MPFR_RNDU);
+
+    mpfr_var tmp;
+
+    // cospi(lower)
+    tmp.subnormalize(mpfr_cospi(tmp(), xl(), MPFR_RNDD), MPFR_RNDD);
+    int df_lower = mpfr_sgn(tmp());
+
+    // cospi(upper)
+    tmp.subnormalize(mpfr_cospi(tmp(), xu(), MPFR_RNDU), MPFR_RNDU);
+    int df_upper = mpfr_sgn(tmp());
+
+    if (df_lower != df_upper)
+    {
+        if (df_lower == 0)
+        {
+            if (mpfr_cmp_ui(w(), 1) > 0)
+                return representation(-1.0, 1.0);
+        }
+        else if (df_upper == 0)
+        {
+            if (mpfr_cmp_ui(w(), 1) > 0)
+                return representation(-1.0, 1.0);
+        }
+        else
+        {
+            if (mpfr_cmp_ui(w(), 2) > 0)
+                return representation(-1.0, 1.0);
+
+            if (df_lower > 0)
+            {
+                mpfr_var l1;
+                mpfr_var l2;
+                l1.subnormalize(mpfr_sinpi(l1(), xl(), MPFR_RNDD), MPFR_RNDD);
+                l2.subnormalize(mpfr_sinpi(l2(), xu(), MPFR_RNDD), MPFR_RNDD);
+
+                return representation(std::min(l1.template get<T>(MPFR_RNDD), l2.template get<T>(MPFR_RNDD)), 1.0);
+            }
+
+            mpfr_var u1;
+            mpfr_var u2;
+            u1.subnormalize(mpfr_sinpi(u1(), xl(), MPFR_RNDU), MPFR_RNDU);
+            u2.subnormalize(mpfr_sinpi(u2(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+            return representation(-1.0, std::max(u1.template get<T>(MPFR_RNDU), u2.template get<T>(MPFR_RNDU)));
+        }
+    }
+    else if (mpfr_cmp_ui(w(), 1) > 0)
+        return representation(-1.0, 1.0);
+
+    mpfr_var l1;
+    mpfr_var l2;
+    l1.subnormalize(mpfr_sinpi(l1(), xl(), MPFR_RNDD), MPFR_RNDD);
+    l2.subnormalize(mpfr_sinpi(l2(), xu(), MPFR_RNDD), MPFR_RNDD);
+
+    mpfr_var u1;
+    mpfr_var u2;
+    u1.subnormalize(mpfr_sinpi(u1(), xl(), MPFR_RNDU), MPFR_RNDU);
+    u2.subnormalize(mpfr_sinpi(u2(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(std::min(l1.template get<T>(MPFR_RNDD), l2.template get<T>(MPFR_RNDD)),
+                          std::max(u1.template get<T>(MPFR_RNDU), u2.template get<T>(MPFR_RNDU)));
+}
+
+// sinpi ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sinpi(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::sinpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// sinpi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sinpi(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = sinpi(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// sinpi ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sinpi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::sinpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// cospi
+
+// cospi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::cospi(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    mpfr_var::setup();
+
+    mpfr_var xl(x.first, MPFR_RNDD);
+    mpfr_var xu(x.second, MPFR_RNDU);
+
+
+    mpfr_var w;
+    mpfr_sub(w(), xu(), xl(), MPFR_RNDU);
+
+    mpfr_var tmp;
+
+    // -sinpi(lower)
+    tmp.subnormalize(mpfr_sinpi(tmp(), xl(), MPFR_RNDD), MPFR_RNDD);
+    mpfr_neg(tmp(), tmp(), MPFR_RNDD);
+    int df_lower = mpfr_sgn(tmp());
+
+    // -sinpi(upper)
+    tmp.subnormalize(mpfr_sinpi(tmp(), xu(), MPFR_RNDU), MPFR_RNDU);
+    mpfr_neg(tmp(), tmp(), MPFR_RNDU);
+    int df_upper = mpfr_sgn(tmp());
+
+    if (df_lower != df_upper)
+    {
+        if (df_lower == 0)
+        {
+            if (mpfr_cmp_ui(w(), 1) > 0)
+                return representation(-1.0, 1.0);
+        }
+        else if (df_upper == 0)
+        {
+            if (mpfr_cmp_ui(w(), 1) > 0)
+                return representation(-1.0, 1.0);
+        }
+        else
+        {
+            if (mpfr_cmp_ui(w(), 2) > 0)
+                return representation(-1.0, 1.0);
+
+            if (df_lower > 0)
+            {
+                mpfr_var l1;
+                mpfr_var l2;
+                l1.subnormalize(mpfr_cospi(l1(), xl(), MPFR_RNDD), MPFR_RNDD);
+                l2.subnormalize(mpfr_cospi(l2(), xu(), MPFR_RNDD), MPFR_RNDD);
+
+                return representation(std::min(l1.template get<T>(MPFR_RNDD), l2.template get<T>(MPFR_RNDD)), 1.0);
+            }
+
+            mpfr_var u1;
+            mpfr_var u2;
+            u1.subnormalize(mpfr_cospi(u1(), xl(), MPFR_RNDU), MPFR_RNDU);
+            u2.subnormalize(mpfr_cospi(u2(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+            return representation(-1.0, std::max(u1.template get<T>(MPFR_RNDU), u2.template get<T>(MPFR_RNDU)));
+        }
+    }
+    else if (mpfr_cmp_ui(w(), 1) > 0)
+        return representation(-1.0, 1.0);
+
+    mpfr_var l1;
+    mpfr_var l2;
+    l1.subnormalize(mpfr_cospi(l1(), xl(), MPFR_RNDD), MPFR_RNDD);
+    l2.subnormalize(mpfr_cospi(l2(), xu(), MPFR_RNDD), MPFR_RNDD);
+
+    mpfr_var u1;
+    mpfr_var u2;
+    u1.subnormalize(mpfr_cospi(u1(), xl(), MPFR_RNDU), MPFR_RNDU);
+    u2.subnormalize(mpfr_cospi(u2(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(std::min(l1.template get<T>(MPFR_RNDD), l2.template get<T>(MPFR_RNDD)),
+                          std::max(u1.template get<T>(MPFR_RNDU), u2.template get<T>(MPFR_RNDU)));
+}
+
+// cospi ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::cospi(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::cospi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// cospi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::cospi(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = cospi(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// cospi ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::cospi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::cospi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// tanpi
+
+// tanpi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::tanpi(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    mpfr_var::setup();
+
+    mpfr_var xl(x.first, MPFR_RNDD);
+    mpfr_var xu(x.second, MPFR_RNDU);
+
+    mpfr_var w;
+    mpfr_sub(w(), xu(), xl(), MPFR_RNDU);
+
+    // period 1, each interval with a width >= 1 contains a pole
+    if (mpfr_cmp_ui(w(), 1) >= 0)
+        return entire();
+
+    // poles at the half-integers, x is a half-integer iff 2x is an odd integer
+    mpfr_var tmp;
+    mpfr_mul_2ui(tmp(), xl(), 1, MPFR_RNDN);
+    bool pole_lower = mpfr_integer_p(tmp()) && !mpfr_integer_p(xl());
+    mpfr_mul_2ui(tmp(), xu(), 1, MPFR_RNDN);
+    bool pole_upper = mpfr_integer_p(tmp()) && !mpfr_integer_p(xu());
+
+    if (pole_lower && pole_upper)
+        return empty();
+
+    if (pole_lower)
+        mpfr_set_inf(xl(), -1);
+    else
+        xl.subnormalize(mpfr_tanpi(xl(), xl(), MPFR_RNDD), MPFR_RNDD);
+
+    if (pole_upper)
+        mpfr_set_inf(xu(), 1);
+    else
+        xu.subnormalize(mpfr_tanpi(xu(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+    // pole in the interior
+    if (mpfr_cmp(xl(), xu()) > 0)
+        return entire();
+
+    return representation(xl.template get<T>(MPFR_RNDD), xu.template get<T>(MPFR_RNDU));
+}
+
+// tanpi ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::tanpi(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::tanpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// tanpi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::tanpi(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = tanpi(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) || bare.first == -std::numeric_limits<T>::infinity()
+                                            || bare.second == std::numeric_limits<T>::infinity() ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// tanpi ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::tanpi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::tanpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// asinpi
+
+// asinpi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::asinpi(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    representation xx = intersection(x, representation(-1.0, 1.0));
+
+    if (is_empty(xx))
+        return xx;
+
+    mpfr_var::setup();
+
+    mpfr_var xl(xx.first, MPFR_RNDD);
+    mpfr_var xu(xx.second, MPFR_RNDU);
+
+    xl.subnormalize(mpfr_asinpi(xl(), xl(), MPFR_RNDD), MPFR_RNDD);
+    xu.subnormalize(mpfr_asinpi(xu(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(xl.template get<T>(MPFR_RNDD), xu.template get<T>(MPFR_RNDU));
+}
+
+// asinpi ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::asinpi(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::asinpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// asinpi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::asinpi(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = asinpi(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first < -1.0 || x.first.second > 1.0 || is_empty(bare) ?  p1788::decoration::decoration::trv
+                                            : p1788::decoration::decoration::com);
+    return representation_dec(bare, dec);
+}
+
+// asinpi ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::asinpi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::asinpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// acospi
+
+// acospi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::acospi(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    representation xx = intersection(x, representation(-1.0, 1.0));
+
+    if (is_empty(xx))
+        return xx;
+
+    mpfr_var::setup();
+
+    mpfr_var xl(xx.first, MPFR_RNDD);
+    mpfr_var xu(xx.second, MPFR_RNDU);
+
+    xu.subnormalize(mpfr_acospi(xu(), xu(), MPFR_RNDD), MPFR_RNDD);
+    xl.subnormalize(mpfr_acospi(xl(), xl(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(xu.template get<T>(MPFR_RNDD), xl.template get<T>(MPFR_RNDU));
+}
+
+// acospi ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::acospi(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::acospi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// acospi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::acospi(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = acospi(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first < -1.0 || x.first.second > 1.0 || is_empty(bare) ?  p1788::decoration::decoration::trv
+                                            : p1788::decoration::decoration::com);
+    return representation_dec(bare, dec);
+}
+
+// acospi ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::acospi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::acospi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// atanpi
+
+// atanpi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atanpi(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    mpfr_var::setup();
+
+    mpfr_var xl(x.first, MPFR_RNDD);
+    mpfr_var xu(x.second, MPFR_RNDU);
+
+    xl.subnormalize(mpfr_atanpi(xl(), xl(), MPFR_RNDD), MPFR_RNDD);
+    xu.subnormalize(mpfr_atanpi(xu(), xu(), MPFR_RNDU), MPFR_RNDU);
+
+    return representation(xl.template get<T>(MPFR_RNDD), xu.template get<T>(MPFR_RNDU));
+}
+
+// atanpi ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atanpi(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atanpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// atanpi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atanpi(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = atanpi(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv : p1788::decoration::decoration::com);
+    return representation_dec(bare, dec);
+}
+
+// atanpi ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atanpi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atanpi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+// atan2pi
+
+// atan2pi ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2pi(mpfr_bin_ieee754_flavor<T>::representation const& y,
+                                  mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(y) || !is_valid(x) || is_empty(y) || is_empty(x) ||
+            (y.first == 0.0 && y.second == 0.0 && x.first == 0.0 && x.second == 0.0))
+        return empty();
+
+    mpfr_var::setup();
+
+    mpfr_var l;
+    mpfr_var u;
+
+    mpfr_var yl(y.first, MPFR_RNDD);
+    mpfr_var yu(y.second, MPFR_RNDU);
+    mpfr_var xl(x.first, MPFR_RNDD);
+    mpfr_var xu(x.second, MPFR_RNDU);
+
+    if (y.first >= 0.0 && y.second > 0.0)
+    {
+        if (x.first == 0.0 && x.second == 0.0)
+        {
+            l.subnormalize(mpfr_atan2pi(l(), yu(), xl(), MPFR_RNDD), MPFR_RNDD);  // 1/2
+            u.subnormalize(mpfr_atan2pi(u(), yu(), xl(), MPFR_RNDU), MPFR_RNDU);  // 1/2
+        }
+        else if (x.first >= 0.0)
+        {
+            l.subnormalize(mpfr_atan2pi(l(), yl(), xu(), MPFR_RNDD), MPFR_RNDD);
+            u.subnormalize(mpfr_atan2pi(u(), yu(), xl(), MPFR_RNDU), MPFR_RNDU);
+        }
+        else if (x.second <= 0.0)
+        {
+            l.subnormalize(mpfr_atan2pi(l(), yu(), xu(), MPFR_RNDD), MPFR_RNDD);
+
+            if (y.first == 0.0)
+                u.set(1.0, MPFR_RNDU);   // 1
+            else
+                u.subnormalize(mpfr_atan2pi(u(), yl(), xl(), MPFR_RNDU), MPFR_RNDU);
+        }
+        else
+        {
+            if (y.first == 0.0)
+            {
+                l.set(0.0, MPFR_RNDD);
+                u.set(1.0, MPFR_RNDU);   // 1
+            }
+            else
+            {
+                l.subnormalize(mpfr_atan2pi(l(), yl(), xu(), MPFR_RNDD), MPFR_RNDD);
+                u.subnormalize(mpfr_atan2pi(u(), yl(), xl(), MPFR_RNDU), MPFR_RNDU);
+            }
+        }
+    }
+    else if (y.first < 0.0 && y.second <= 0.0)
+    {
+        if (x.first == 0.0 && x.second == 0.0)
+        {
+            l.subnormalize(mpfr_atan2pi(l(), yl(), xl(), MPFR_RNDD), MPFR_RNDD);  // -1/2
+            u.subnormalize(mpfr_atan2pi(u(), yl(), xl(), MPFR_RNDU), MPFR_RNDU);  // -1/2
+        }
+        else if (x.first >= 0.0)
+        {
+            l.subnormalize(mpfr_atan2pi(l(), yl(), xl(), MPFR_RNDD), MPFR_RNDD);
+            u.subnormalize(mpfr_atan2pi(u(), yu(), xu(), MPFR_RNDU), MPFR_RNDU);
+        }
+        else if (x.second <= 0.0)
+        {
+            if (y.second == 0.0)
+            {
+                u.set(1.0, MPFR_RNDU);   // 1
+                l.subnormalize(mpfr_neg(l(), u(), MPFR_RNDD), MPFR_RNDD);   // -1
+            }
+            else
+            {
+                l.subnormalize(mpfr_atan2pi(l(), yu(), xl(), MPFR_RNDD), MPFR_RNDD);
+                u.subnormalize(mpfr_atan2pi(u(), yl(), xu(), MPFR_RNDU), MPFR_RNDU);
+            }
+        }
+        else
+        {
+            if (y.second == 0.0)
+            {
+                u.set(1.0, MPFR_RNDU);   // 1
+                l.subnormalize(mpfr_neg(l(), u(), MPFR_RNDD), MPFR_RNDD);   // -1
+            }
+            else
+            {
+                l.subnormalize(mpfr_atan2pi(l(), yu(), xl(), MPFR_RNDD), MPFR_RNDD);
+                u.subnormalize(mpfr_atan2pi(u(), yu(), xu(), MPFR_RNDU), MPFR_RNDU);
+            }
+        }
+    }
+    else if (y.first == 0.0 && y.second == 0.0)
+    {
+        if (x.first >= 0.0)
+        {
+            l.set(0.0, MPFR_RNDD);
+            u.set(0.0, MPFR_RNDU);
+        }
+        else if (x.second <= 0.0)
+        {
+            l.set(1.0, MPFR_RNDD);   // 1
+            u.set(1.0, MPFR_RNDU);   // 1
+        }
+        else
+        {
+            l.set(0.0, MPFR_RNDD);
+            u.set(1.0, MPFR_RNDU);   // 1
+        }
+    }
+    else
+    {
+        if (x.first >= 0.0)
+        {
+            l.subnormalize(mpfr_atan2pi(l(), yl(), xl(), MPFR_RNDD), MPFR_RNDD);
+            u.subnormalize(mpfr_atan2pi(u(), yu(), xl(), MPFR_RNDU), MPFR_RNDU);
+        }
+        else
+        {
+            u.set(1.0, MPFR_RNDU);   // 1
+            l.subnormalize(mpfr_neg(l(), u(), MPFR_RNDD), MPFR_RNDD);   // -1
+        }
+    }
+
+
+    return representation(l.template get<T>(MPFR_RNDD), u.template get<T>(MPFR_RNDU));
+}
+
+// atan2pi ( bare interval ) mixed type
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2pi(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& y,
+                                    mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(y) || !mpfr_bin_ieee754_flavor<T2>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atan2pi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(y),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// atan2pi ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2pi(mpfr_bin_ieee754_flavor<T>::representation_dec const& y,
+                                    mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(y) || !is_valid(x) || is_nai(y) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = atan2pi(y.first, x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            std::min(y.second, x.second),
+                                            (is_member(0.0, y) && is_member(0.0, x)) || is_empty(bare) ? p1788::decoration::decoration::trv :
+                                            y.first.first < 0.0 && y.first.second >= 0.0 && x.first.first < 0.0 ? p1788::decoration::decoration::def :
+                                            (y.first.first == 0.0 && x.first.first < 0.0) || !is_common_interval(bare) ? p1788::decoration::decoration::dac :
+                                            p1788::decoration::decoration::com);
+    return representation_dec(bare, dec);
+}
+
+// atan2pi ( decorated interval ) mixed type
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2pi(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& y,
+                                    mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(y) || !mpfr_bin_ieee754_flavor<T2>::is_valid(x)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(y) || mpfr_bin_ieee754_flavor<T2>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atan2pi(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(y),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+#endif
+
+
+} // namespace setbased
+
+} // namespace infsup
+
+} // namespace flavor
+
+} // namespace p1788
+
+#endif // LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_REC_ELEM_FUNC_IMPL_HPP
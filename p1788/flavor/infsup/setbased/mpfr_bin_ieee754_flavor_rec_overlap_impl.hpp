@@ -176,6 +176,192 @@ mpfr_bin_ieee754_flavor<T>::overlap(mpfr_bin_ieee754_flavor<T>::representation_d
 }
 
 
+// Batched overlap
+//
+// For non-empty intervals x = [a,b] and y = [c,d] the scalar version only depends on
+// the three-way comparisons of (a,c), (b,d), (b,c) and (a,d). Each comparison
+// contributes a "less" and an "equal" bit, the emptiness of x and y two further
+// bits (comparisons with NaN bounds are false, hence the comparison bits of an empty
+// interval are 0). The resulting 10 bit index is mapped to the state by a table
+// which is built once from overlap_state(), a transcription of the decision tree of
+// the scalar version on the comparison bits.
+
+
+// overlap_state ( comparison bits )
+template<typename T>
+p1788::overlapping::overlapping_state
+mpfr_bin_ieee754_flavor<T>::overlap_state(unsigned index)
+{
+    bool lt_ac = index & overlap_lt_ac;
+    bool eq_ac = index & overlap_eq_ac;
+    bool lt_bd = index & overlap_lt_bd;
+    bool eq_bd = index & overlap_eq_bd;
+    bool lt_bc = index & overlap_lt_bc;
+    bool eq_bc = index & overlap_eq_bc;
+    bool lt_ad = index & overlap_lt_ad;
+    bool eq_ad = index & overlap_eq_ad;
+
+    if (index & overlap_empty_x)
+        return index & overlap_empty_y ? p1788::overlapping::overlapping_state::both_empty
+               : p1788::overlapping::overlapping_state::first_empty;
+
+    if (index & overlap_empty_y)
+        return p1788::overlapping::overlapping_state::second_empty;
+
+    // !before
+    if (!lt_bc)
+    {
+        if (lt_bd || eq_bd)
+        {
+            if (eq_ac)
+                return lt_bd ? p1788::overlapping::overlapping_state::starts : p1788::overlapping::overlapping_state::equal;
+
+            if (eq_bd)
+                return lt_ac ? p1788::overlapping::overlapping_state::finished_by : p1788::overlapping::overlapping_state::finishes;
+
+            if (!eq_bc)
+                return lt_ac ? p1788::overlapping::overlapping_state::overlaps : p1788::overlapping::overlapping_state::contained_by;
+
+            return p1788::overlapping::overlapping_state::meets;
+        }
+
+        if (lt_ad || eq_ad)
+        {
+            if (lt_ac || eq_ac)
+                return lt_ac ? p1788::overlapping::overlapping_state::contains : p1788::overlapping::overlapping_state::started_by;
+
+            if (lt_ad)
+                return p1788::overlapping::overlapping_state::overlapped_by;
+
+            return p1788::overlapping::overlapping_state::met_by;
+        }
+
+        return p1788::overlapping::overlapping_state::after;
+    }
+
+    // before
+    return p1788::overlapping::overlapping_state::before;
+}
+
+// overlap_table
+template<typename T>
+std::uint16_t const*
+mpfr_bin_ieee754_flavor<T>::overlap_table()
+{
+    struct table
+    {
+        std::uint16_t states[overlap_table_size];
+
+        table()
+        {
+            for (unsigned i = 0; i < overlap_table_size; ++i)
+                states[i] = static_cast<std::uint16_t>(overlap_state(i));
+        }
+    };
+
+    static const table t;
+
+    return t.states;
+}
+
+// overlap_valid ( bare interval )
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::overlap_valid(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    return bool_mask_valid(x.first, x.second);
+}
+
+// overlap_valid ( decorated interval )
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::overlap_valid(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    // branch free version of is_valid without signaling
+    unsigned ill = unsigned(x.second == p1788::decoration::decoration::ill);
+    unsigned trv = unsigned(x.second == p1788::decoration::decoration::trv);
+    unsigned com = unsigned(x.second == p1788::decoration::decoration::com);
+    unsigned empty = unsigned(x.first.first != x.first.first) & unsigned(x.first.second != x.first.second);
+    unsigned bounded = unsigned(x.first.first != -std::numeric_limits<T>::infinity())
+                       & unsigned(x.first.second != std::numeric_limits<T>::infinity());
+
+    return (empty & (ill | trv))
+           | ((ill ^ 1u) & unsigned(x.first.first <= x.first.second)
+              & unsigned(x.first.first != std::numeric_limits<T>::infinity())
+              & unsigned(x.first.second != -std::numeric_limits<T>::infinity())
+              & ((com ^ 1u) | bounded));
+}
+
+// overlap_index ( bare interval, bare interval )
+template<typename T>
+unsigned
+mpfr_bin_ieee754_flavor<T>::overlap_index(mpfr_bin_ieee754_flavor<T>::representation const& x,
+        mpfr_bin_ieee754_flavor<T>::representation const& y)
+{
+    // bitwise operators instead of logical ones to keep the computation branch free
+    return (unsigned(x.first < y.first) * overlap_lt_ac)
+           | (unsigned(x.first == y.first) * overlap_eq_ac)
+           | (unsigned(x.second < y.second) * overlap_lt_bd)
+           | (unsigned(x.second == y.second) * overlap_eq_bd)
+           | (unsigned(x.second < y.first) * overlap_lt_bc)
+           | (unsigned(x.second == y.first) * overlap_eq_bc)
+           | (unsigned(x.first < y.second) * overlap_lt_ad)
+           | (unsigned(x.first == y.second) * overlap_eq_ad)
+           | (unsigned(x.first != x.first) * overlap_empty_x)
+           | (unsigned(y.first != y.first) * overlap_empty_y);
+}
+
+// overlap ( bare interval, bare interval ) batched
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::overlap(mpfr_bin_ieee754_flavor<T>::representation const* x,
+                                    mpfr_bin_ieee754_flavor<T>::representation const* y,
+                                    p1788::overlapping::overlapping_state* out, std::size_t n)
+{
+    std::uint16_t const* table = overlap_table();
+
+    unsigned invalid = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        unsigned valid = overlap_valid(x[i]) & overlap_valid(y[i]);
+
+        // an invalid pair is mapped to undefined (= 0)
+        out[i] = static_cast<p1788::overlapping::overlapping_state>(table[overlap_index(x[i], y[i])] & (0u - valid));
+        invalid |= valid ^ 1u;
+    }
+
+    if (invalid)
+        p1788::exception::signal_invalid_operand();
+}
+
+// overlap ( decorated interval, decorated interval ) batched
+template<typename T>
+void
+mpfr_bin_ieee754_flavor<T>::overlap(mpfr_bin_ieee754_flavor<T>::representation_dec const* x,
+                                    mpfr_bin_ieee754_flavor<T>::representation_dec const* y,
+                                    p1788::overlapping::overlapping_state* out, std::size_t n)
+{
+    std::uint16_t const* table = overlap_table();
+
+    unsigned invalid = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        unsigned valid = overlap_valid(x[i]) & overlap_valid(y[i]);
+        unsigned defined = valid & unsigned(x[i].second != p1788::decoration::decoration::ill)
+                           & unsigned(y[i].second != p1788::decoration::decoration::ill);
+
+        // an invalid pair or a pair containing NaI is mapped to undefined (= 0)
+        out[i] = static_cast<p1788::overlapping::overlapping_state>(table[overlap_index(x[i].first, y[i].first)] & (0u - defined));
+        invalid |= valid ^ 1u;
+    }
+
+    if (invalid)
+        p1788::exception::signal_invalid_operand();
+}
+
+
 } // namespace setbased
 
 } // namespace infsup
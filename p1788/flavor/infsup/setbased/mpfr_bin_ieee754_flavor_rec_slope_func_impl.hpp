@@ -0,0 +1,1118 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_REC_SLOPE_FUNC_IMPL_HPP
+#define LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_REC_SLOPE_FUNC_IMPL_HPP
+
+
+namespace p1788
+{
+
+namespace flavor
+{
+
+namespace infsup
+{
+
+namespace setbased
+{
+
+// slope_point
+//
+// Encloses the value of the slope function f at the point x. The slope
+// functions are normalized such that f(0) = 1. For infinite x the limit
+// value is returned. The numerators of the slope functions suffer from
+// cancellation near 0, therefore they are computed with outward rounding
+// in a working precision which grows with the magnitude of 1/x and an
+// extended exponent range. The denominators x^2 and x^3 are exact.
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::slope_point(mpfr_bin_ieee754_flavor<T>::slope_kind f,
+                                        T x)
+{
+    if (x == 0.0)
+        return representation(1.0, 1.0);
+
+    if (std::isinf(x))
+    {
+        bool zero;
+
+        switch (f)
+        {
+        case slope_kind::exp1:
+        case slope_kind::exp2:
+            zero = x < 0.0;
+            break;
+        case slope_kind::cosh2:
+        case slope_kind::sinh3:
+            zero = false;
+            break;
+        default:
+            zero = true;
+        }
+
+        T lim = zero ? 0.0 : std::numeric_limits<T>::infinity();
+        return representation(lim, lim);
+    }
+
+    // extended exponent range for x^3 and the intermediate results
+    typedef p1788::util::mpfr_var<mpfr_var::PREC,
+            4 * mpfr_var::EMIN,
+            4 * mpfr_var::EMAX,
+            false>  ext_mpfr_var;
+
+    ext_mpfr_var::setup();
+
+    // working precision, compensates the cancellation of the numerator (up to 2 |e| bits)
+    // and resolves the deviation of the result from f(0) = 1 (up to 2 |e| bits)
+    mpfr_var xv(x, MPFR_RNDN);
+    mpfr_exp_t e = mpfr_get_exp(xv());
+    mpfr_prec_t prec = 3 * mpfr_var::PREC + 64 + (e < 0 ? -4 * e : 0);
+
+    mpfr_t v, nl, nu, d;
+    mpfr_inits2(prec, v, nl, nu, d, (mpfr_ptr) 0);
+
+    // exact
+    mpfr_set(v, xv(), MPFR_RNDN);
+
+    long c;
+    int k;
+
+    switch (f)
+    {
+    case slope_kind::exp1:          // 2 (exp(x) - 1 - x) / x^2
+        mpfr_expm1(nl, v, MPFR_RNDD);
+        mpfr_expm1(nu, v, MPFR_RNDU);
+        mpfr_sub(nl, nl, v, MPFR_RNDD);
+        mpfr_sub(nu, nu, v, MPFR_RNDU);
+        c = 2;
+        k = 2;
+        break;
+    case slope_kind::exp2:          // 6 (exp(x) - 1 - x - x^2 / 2) / x^3
+        mpfr_expm1(nl, v, MPFR_RNDD);
+        mpfr_expm1(nu, v, MPFR_RNDU);
+        mpfr_sub(nl, nl, v, MPFR_RNDD);
+        mpfr_sub(nu, nu, v, MPFR_RNDU);
+        mpfr_sqr(d, v, MPFR_RNDN);          // exact
+        mpfr_div_2ui(d, d, 1, MPFR_RNDN);   // exact
+        mpfr_sub(nl, nl, d, MPFR_RNDD);
+        mpfr_sub(nu, nu, d, MPFR_RNDU);
+        c = 6;
+        k = 3;
+        break;
+    case slope_kind::log1:          // 2 (x - log(1 + x)) / x^2
+        mpfr_log1p(nu, v, MPFR_RNDD);
+        mpfr_log1p(nl, v, MPFR_RNDU);
+        mpfr_sub(nl, v, nl, MPFR_RNDD);
+        mpfr_sub(nu, v, nu, MPFR_RNDU);
+        c = 2;
+        k = 2;
+        break;
+    case slope_kind::log2:          // 3 (log(1 + x) - x + x^2 / 2) / x^3
+        mpfr_log1p(nl, v, MPFR_RNDD);
+        mpfr_log1p(nu, v, MPFR_RNDU);
+        mpfr_sub(nl, nl, v, MPFR_RNDD);
+        mpfr_sub(nu, nu, v, MPFR_RNDU);
+        mpfr_sqr(d, v, MPFR_RNDN);          // exact
+        mpfr_div_2ui(d, d, 1, MPFR_RNDN);   // exact
+        mpfr_add(nl, nl, d, MPFR_RNDD);
+        mpfr_add(nu, nu, d, MPFR_RNDU);
+        c = 3;
+        k = 3;
+        break;
+    case slope_kind::cos2:          // 2 (1 - cos(x)) / x^2
+        mpfr_cos(nu, v, MPFR_RNDD);
+        mpfr_cos(nl, v, MPFR_RNDU);
+        mpfr_ui_sub(nl, 1, nl, MPFR_RNDD);
+        mpfr_ui_sub(nu, 1, nu, MPFR_RNDU);
+        c = 2;
+        k = 2;
+        break;
+    case slope_kind::sin3:          // 6 (x - sin(x)) / x^3
+        mpfr_sin(nu, v, MPFR_RNDD);
+        mpfr_sin(nl, v, MPFR_RNDU);
+        mpfr_sub(nl, v, nl, MPFR_RNDD);
+        mpfr_sub(nu, v, nu, MPFR_RNDU);
+        c = 6;
+        k = 3;
+        break;
+    case slope_kind::asin3:         // 6 (asin(x) - x) / x^3
+        mpfr_asin(nl, v, MPFR_RNDD);
+        mpfr_asin(nu, v, MPFR_RNDU);
+        mpfr_sub(nl, nl, v, MPFR_RNDD);
+        mpfr_sub(nu, nu, v, MPFR_RNDU);
+        c = 6;
+        k = 3;
+        break;
+    case slope_kind::atan3:         // 3 (x - atan(x)) / x^3
+        mpfr_atan(nu, v, MPFR_RNDD);
+        mpfr_atan(nl, v, MPFR_RNDU);
+        mpfr_sub(nl, v, nl, MPFR_RNDD);
+        mpfr_sub(nu, v, nu, MPFR_RNDU);
+        c = 3;
+        k = 3;
+        break;
+    case slope_kind::cosh2:         // 2 (cosh(x) - 1) / x^2
+        mpfr_cosh(nl, v, MPFR_RNDD);
+        mpfr_cosh(nu, v, MPFR_RNDU);
+        mpfr_sub_ui(nl, nl, 1, MPFR_RNDD);
+        mpfr_sub_ui(nu, nu, 1, MPFR_RNDU);
+        c = 2;
+        k = 2;
+        break;
+    default:                        // 6 (sinh(x) - x) / x^3
+        mpfr_sinh(nl, v, MPFR_RNDD);
+        mpfr_sinh(nu, v, MPFR_RNDU);
+        mpfr_sub(nl, nl, v, MPFR_RNDD);
+        mpfr_sub(nu, nu, v, MPFR_RNDU);
+        c = 6;
+        k = 3;
+        break;
+    }
+
+    // denominator x^k, exact
+    mpfr_pow_ui(d, v, k, MPFR_RNDN);
+
+    mpfr_mul_si(nl, nl, c, MPFR_RNDD);
+    mpfr_mul_si(nu, nu, c, MPFR_RNDU);
+
+    if (mpfr_sgn(d) > 0)
+    {
+        mpfr_div(nl, nl, d, MPFR_RNDD);
+        mpfr_div(nu, nu, d, MPFR_RNDU);
+    }
+    else
+    {
+        mpfr_swap(nl, nu);
+        mpfr_div(nl, nl, d, MPFR_RNDD);
+        mpfr_div(nu, nu, d, MPFR_RNDU);
+    }
+
+    // convert to T with directed rounding (gradual underflow is handled by the conversion),
+    // slope functions are positive
+    T l = std::max(p1788::util::mpfr_get_trait<T>::apply(nl, MPFR_RNDD), static_cast<T>(0.0));
+    T u = p1788::util::mpfr_get_trait<T>::apply(nu, MPFR_RNDU);
+
+    mpfr_clears(v, nl, nu, d, (mpfr_ptr) 0);
+
+    mpfr_var::setup();
+
+    return representation(l, u);
+}
+
+
+
+// exp_slope1
+
+// exp_slope1 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::exp_slope1(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    // increasing
+    return representation(slope_point(slope_kind::exp1, x.first).first,
+                          slope_point(slope_kind::exp1, x.second).second);
+}
+
+// exp_slope1 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::exp_slope1(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::exp_slope1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// exp_slope1 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::exp_slope1(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = exp_slope1(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// exp_slope1 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::exp_slope1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::exp_slope1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// exp_slope2
+
+// exp_slope2 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::exp_slope2(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    // increasing
+    return representation(slope_point(slope_kind::exp2, x.first).first,
+                          slope_point(slope_kind::exp2, x.second).second);
+}
+
+// exp_slope2 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::exp_slope2(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::exp_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// exp_slope2 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::exp_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = exp_slope2(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// exp_slope2 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::exp_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::exp_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// log_slope1
+
+// log_slope1 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::log_slope1(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    // domain (-1,+inf]
+    representation xx = intersection(x, representation(-1.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(xx) || xx.second == -1.0)
+        return empty();
+
+    // decreasing, pole at -1
+    return representation(slope_point(slope_kind::log1, xx.second).first,
+                          xx.first == -1.0 ? std::numeric_limits<T>::infinity()
+                          : slope_point(slope_kind::log1, xx.first).second);
+}
+
+// log_slope1 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::log_slope1(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::log_slope1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// log_slope1 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::log_slope1(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = log_slope1(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first <= -1.0 || is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// log_slope1 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::log_slope1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::log_slope1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// log_slope2
+
+// log_slope2 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::log_slope2(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    // domain (-1,+inf]
+    representation xx = intersection(x, representation(-1.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(xx) || xx.second == -1.0)
+        return empty();
+
+    // decreasing, pole at -1
+    return representation(slope_point(slope_kind::log2, xx.second).first,
+                          xx.first == -1.0 ? std::numeric_limits<T>::infinity()
+                          : slope_point(slope_kind::log2, xx.first).second);
+}
+
+// log_slope2 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::log_slope2(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::log_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// log_slope2 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::log_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = log_slope2(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first <= -1.0 || is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// log_slope2 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::log_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::log_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// cos_slope2
+
+// cos_slope2 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::cos_slope2(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    T m = mig(x);
+    T n = mag(x);
+
+    mpfr_var::setup();
+    mpfr_var pi2;
+    mpfr_const_pi(pi2(), MPFR_RNDD);
+    mpfr_mul_2ui(pi2(), pi2(), 1, MPFR_RNDD);
+
+    // 2 pi is irrational, hence n <= pi2 <=> n < 2 pi
+    T const pi2d = pi2.template get<T>(MPFR_RNDD);
+
+    // even and decreasing in |x| on [0, 2 pi]
+    if (n <= pi2d)
+        return representation(slope_point(slope_kind::cos2, n).first,
+                              slope_point(slope_kind::cos2, m).second);
+
+    // cos_slope2(x) = 2 (1 - cos(x)) / x^2 has zeros at 2 k pi, k != 0,
+    // and is bounded by 4 / x^2 which is less than its value at x <= 2 pi
+    mpfr_var b;
+    if (m <= pi2d)
+    {
+        mpfr_const_pi(b(), MPFR_RNDD);
+        mpfr_mul_2ui(b(), b(), 1, MPFR_RNDD);
+    }
+    else
+    {
+        b.set(m, MPFR_RNDD);
+    }
+
+    mpfr_sqr(b(), b(), MPFR_RNDD);
+    b.subnormalize(mpfr_ui_div(b(), 4, b(), MPFR_RNDU), MPFR_RNDU);
+
+    T u = b.template get<T>(MPFR_RNDU);
+
+    return representation(0.0, m <= pi2d ? std::max(u, slope_point(slope_kind::cos2, m).second) : u);
+}
+
+// cos_slope2 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::cos_slope2(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::cos_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// cos_slope2 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::cos_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = cos_slope2(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// cos_slope2 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::cos_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::cos_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// sin_slope3
+
+// sin_slope3 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sin_slope3(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    // even and decreasing in |x|
+    return representation(slope_point(slope_kind::sin3, mag(x)).first,
+                          slope_point(slope_kind::sin3, mig(x)).second);
+}
+
+// sin_slope3 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sin_slope3(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::sin_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// sin_slope3 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sin_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = sin_slope3(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// sin_slope3 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sin_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::sin_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// asin_slope3
+
+// asin_slope3 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::asin_slope3(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x))
+        return empty();
+
+    // domain [-1,1]
+    representation xx = intersection(x, representation(-1.0, 1.0));
+
+    if (is_empty(xx))
+        return empty();
+
+    // even and increasing in |x|
+    return representation(slope_point(slope_kind::asin3, mig(xx)).first,
+                          slope_point(slope_kind::asin3, mag(xx)).second);
+}
+
+// asin_slope3 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::asin_slope3(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::asin_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// asin_slope3 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::asin_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = asin_slope3(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            x.first.first < -1.0 || x.first.second > 1.0 || is_empty(bare) ?  p1788::decoration::decoration::trv
+                                            : p1788::decoration::decoration::com);
+    return representation_dec(bare, dec);
+}
+
+// asin_slope3 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::asin_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::asin_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// atan_slope3
+
+// atan_slope3 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan_slope3(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    // even and decreasing in |x|
+    return representation(slope_point(slope_kind::atan3, mag(x)).first,
+                          slope_point(slope_kind::atan3, mig(x)).second);
+}
+
+// atan_slope3 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan_slope3(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atan_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// atan_slope3 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = atan_slope3(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// atan_slope3 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atan_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// cosh_slope2
+
+// cosh_slope2 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::cosh_slope2(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    // even and increasing in |x|
+    return representation(slope_point(slope_kind::cosh2, mig(x)).first,
+                          slope_point(slope_kind::cosh2, mag(x)).second);
+}
+
+// cosh_slope2 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::cosh_slope2(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::cosh_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// cosh_slope2 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::cosh_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = cosh_slope2(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// cosh_slope2 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::cosh_slope2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::cosh_slope2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+// sinh_slope3
+
+// sinh_slope3 ( bare interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sinh_slope3(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return empty();
+
+    // even and increasing in |x|
+    return representation(slope_point(slope_kind::sinh3, mig(x)).first,
+                          slope_point(slope_kind::sinh3, mag(x)).second);
+}
+
+// sinh_slope3 ( bare interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::sinh_slope3(mpfr_bin_ieee754_flavor<T>::representation_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::sinh_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// sinh_slope3 ( decorated interval )
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sinh_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return nai();
+
+    // compute bare result
+    representation bare = sinh_slope3(x.first);
+
+    // compute decoration
+    p1788::decoration::decoration dec = std::min(
+                                            x.second,
+                                            is_empty(bare) ?  p1788::decoration::decoration::trv :
+                                            is_common_interval(bare) ? p1788::decoration::decoration::com :
+                                            p1788::decoration::decoration::dac);
+    return representation_dec(bare, dec);
+}
+
+// sinh_slope3 ( decorated interval ) mixed type
+template<typename T>
+template<typename T_>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::sinh_slope3(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T_> const& x)
+{
+    static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T_>::is_valid(x) || mpfr_bin_ieee754_flavor<T_>::is_nai(x))
+        return nai();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T_>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::sinh_slope3(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+
+
+
+} // namespace setbased
+
+} // namespace infsup
+
+} // namespace flavor
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_REC_SLOPE_FUNC_IMPL_HPP
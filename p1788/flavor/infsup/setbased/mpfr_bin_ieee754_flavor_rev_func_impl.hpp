@@ -207,7 +207,7 @@ mpfr_bin_ieee754_flavor<T>::abs_rev(mpfr_bin_ieee754_flavor<T>::representation c
     if (c.second < 0.0)
         return empty();
 
-    representation p(std::max(0.0, c.first), c.second);
+    representation p(std::max(static_cast<T>(0.0), c.first), c.second);
     representation n = neg(p);
 
     return convex_hull(intersection(p, x), intersection(n, x));
@@ -1662,6 +1662,705 @@ mpfr_bin_ieee754_flavor<T>::mul_rev(mpfr_bin_ieee754_flavor<T>::representation_d
 
 
 
+// pow_rev1
+
+// bare version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(b) || !is_valid(c) || !is_valid(x) || is_empty(b) || is_empty(c) || is_empty(x))
+        return empty();
+
+    // pow is only defined for a base >= 0 and its range is [0,+inf]
+    representation xx = intersection(x, representation(0.0, std::numeric_limits<T>::infinity()));
+    representation cc = intersection(c, representation(0.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(xx) || is_empty(cc))
+        return empty();
+
+    representation res = empty();
+
+    // 0^y = 0 for y > 0
+    if (cc.first == 0.0 && b.second > 0.0)
+        res = intersection(xx, representation(0.0, 0.0));
+
+    // x > 0:  y * log(x) = log(z)  =>  x = exp(log(z) / y)
+    representation lc = log(cc);
+
+    if (!is_empty(lc))
+    {
+        auto lx = mul_rev_to_pair(b, lc);
+
+        res = convex_hull(res, intersection(exp(lx.first), xx));
+        res = convex_hull(res, intersection(exp(lx.second), xx));
+    }
+
+    return res;
+}
+
+// bare mixed type version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(b)
+            || !mpfr_bin_ieee754_flavor<T2>::is_valid(c)
+            || !mpfr_bin_ieee754_flavor<T3>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2,T3>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::pow_rev1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(b),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(c),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// decorated version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(b) || !is_valid(c) || !is_valid(x) || is_nai(b) || is_nai(c) || is_nai(x))
+        return nai();
+
+    // call bare version and set decoration to trv
+    return representation_dec(pow_rev1(b.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+// decorated mixedtype version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(b) || !mpfr_bin_ieee754_flavor<T2>::is_valid(c) || !mpfr_bin_ieee754_flavor<T3>::is_valid(x)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(b) || mpfr_bin_ieee754_flavor<T2>::is_nai(c) || mpfr_bin_ieee754_flavor<T3>::is_nai(x))
+        return nai();
+
+    // call bare mixedtype version and set decoration to trv
+    return representation_dec(pow_rev1(b.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+
+// bare binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation const& c)
+{
+    // call bare ternary version with x = entire
+    return pow_rev1(b, c, entire());
+}
+
+// bare binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call bare ternary version with x = entire
+    return pow_rev1(b, c, entire());
+}
+
+// decorated binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec const& c)
+{
+    // call decorated ternary version with x = entire
+    return pow_rev1(b, c, entire_dec());
+}
+
+// decorated binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& b,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call decorated ternary version with x = entire
+    return pow_rev1(b, c, entire_dec());
+}
+
+
+
+
+// pow_rev2
+
+// bare version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(a) || !is_valid(c) || !is_valid(x) || is_empty(a) || is_empty(c) || is_empty(x))
+        return empty();
+
+    // pow is only defined for a base >= 0 and its range is [0,+inf]
+    representation aa = intersection(a, representation(0.0, std::numeric_limits<T>::infinity()));
+    representation cc = intersection(c, representation(0.0, std::numeric_limits<T>::infinity()));
+
+    if (is_empty(aa) || is_empty(cc))
+        return empty();
+
+    representation res = empty();
+
+    // 0^y = 0 for y > 0
+    if (aa.first == 0.0 && cc.first == 0.0 && x.second > 0.0)
+        res = intersection(x, representation(0.0, std::numeric_limits<T>::infinity()));
+
+    // a > 0:  y * log(a) = log(z)  =>  y = log(z) / log(a)
+    representation la = log(aa);
+    representation lc = log(cc);
+
+    if (!is_empty(la) && !is_empty(lc))
+    {
+        auto y = mul_rev_to_pair(la, lc);
+
+        res = convex_hull(res, intersection(y.first, x));
+        res = convex_hull(res, intersection(y.second, x));
+    }
+
+    return res;
+}
+
+// bare mixed type version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(a)
+            || !mpfr_bin_ieee754_flavor<T2>::is_valid(c)
+            || !mpfr_bin_ieee754_flavor<T3>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2,T3>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::pow_rev2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(a),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(c),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// decorated version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(a) || !is_valid(c) || !is_valid(x) || is_nai(a) || is_nai(c) || is_nai(x))
+        return nai();
+
+    // call bare version and set decoration to trv
+    return representation_dec(pow_rev2(a.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+// decorated mixedtype version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(a) || !mpfr_bin_ieee754_flavor<T2>::is_valid(c) || !mpfr_bin_ieee754_flavor<T3>::is_valid(x)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(a) || mpfr_bin_ieee754_flavor<T2>::is_nai(c) || mpfr_bin_ieee754_flavor<T3>::is_nai(x))
+        return nai();
+
+    // call bare mixedtype version and set decoration to trv
+    return representation_dec(pow_rev2(a.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+
+// bare binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation const& c)
+{
+    // call bare ternary version with x = entire
+    return pow_rev2(a, c, entire());
+}
+
+// bare binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call bare ternary version with x = entire
+    return pow_rev2(a, c, entire());
+}
+
+// decorated binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec const& c)
+{
+    // call decorated ternary version with x = entire
+    return pow_rev2(a, c, entire_dec());
+}
+
+// decorated binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::pow_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& a,
+                                     mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call decorated ternary version with x = entire
+    return pow_rev2(a, c, entire_dec());
+}
+
+
+
+
+// atan2_rev1
+
+// bare version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(b) || !is_valid(c) || !is_valid(x) || is_empty(b) || is_empty(c) || is_empty(x))
+        return empty();
+
+    representation const pos(0.0, std::numeric_limits<T>::infinity());
+    representation const neg(-std::numeric_limits<T>::infinity(), 0.0);
+
+    representation res = empty();
+
+    // quadrant q: y = x' * tan(c), with the signs of x' and y given by the quadrant
+    for (int q = 0; q < 4; ++q)
+    {
+        representation t = atan2_rev_tan(c, q);
+        representation bq = intersection(b, q == 0 || q == 3 ? pos : neg);
+
+        // x' = 0 only leads to the origin, which is not part of the domain
+        if (is_empty(t) || is_empty(bq) || (bq.first == 0.0 && bq.second == 0.0))
+            continue;
+
+        res = convex_hull(res, intersection(intersection(mul(bq, t), q < 2 ? pos : neg), x));
+    }
+
+    // +pi/2 and -pi/2 are reached on the y-axis
+    if (is_member(0.0, b))
+    {
+        representation pi2 = atan2_rev_tan(c, 4);
+
+        if (pi2.first < 0.0 && x.first < 0.0)
+            res = convex_hull(res, intersection(neg, x));
+
+        if (pi2.second > 0.0 && x.second > 0.0)
+            res = convex_hull(res, intersection(pos, x));
+    }
+
+    return res;
+}
+
+// bare mixed type version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(b)
+            || !mpfr_bin_ieee754_flavor<T2>::is_valid(c)
+            || !mpfr_bin_ieee754_flavor<T3>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2,T3>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atan2_rev1(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(b),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(c),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// decorated version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(b) || !is_valid(c) || !is_valid(x) || is_nai(b) || is_nai(c) || is_nai(x))
+        return nai();
+
+    // call bare version and set decoration to trv
+    return representation_dec(atan2_rev1(b.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+// decorated mixedtype version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(b) || !mpfr_bin_ieee754_flavor<T2>::is_valid(c) || !mpfr_bin_ieee754_flavor<T3>::is_valid(x)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(b) || mpfr_bin_ieee754_flavor<T2>::is_nai(c) || mpfr_bin_ieee754_flavor<T3>::is_nai(x))
+        return nai();
+
+    // call bare mixedtype version and set decoration to trv
+    return representation_dec(atan2_rev1(b.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+
+// bare binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& c)
+{
+    // call bare ternary version with x = entire
+    return atan2_rev1(b, c, entire());
+}
+
+// bare binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call bare ternary version with x = entire
+    return atan2_rev1(b, c, entire());
+}
+
+// decorated binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& c)
+{
+    // call decorated ternary version with x = entire
+    return atan2_rev1(b, c, entire_dec());
+}
+
+// decorated binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev1(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& b,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call decorated ternary version with x = entire
+    return atan2_rev1(b, c, entire_dec());
+}
+
+
+
+
+// atan2_rev2
+
+// bare version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(a) || !is_valid(c) || !is_valid(x) || is_empty(a) || is_empty(c) || is_empty(x))
+        return empty();
+
+    representation const pos(0.0, std::numeric_limits<T>::infinity());
+    representation const neg(-std::numeric_limits<T>::infinity(), 0.0);
+
+    representation res = empty();
+
+    // quadrant q: x' = y / tan(c), with the signs of x' and y given by the quadrant
+    for (int q = 0; q < 4; ++q)
+    {
+        representation t = atan2_rev_tan(c, q);
+        representation aq = intersection(a, q < 2 ? pos : neg);
+
+        // y = 0 and tan(c) != 0 only leads to the origin, which is not part of the domain
+        if (is_empty(t) || is_empty(aq) || (aq.first == 0.0 && aq.second == 0.0 && !is_member(0.0, t)))
+            continue;
+
+        res = convex_hull(res, mul_rev(t, aq, intersection(x, q == 0 || q == 3 ? pos : neg)));
+    }
+
+    // +pi/2 and -pi/2 are reached on the y-axis
+    if (is_member(0.0, x))
+    {
+        representation pi2 = atan2_rev_tan(c, 4);
+
+        if ((pi2.first < 0.0 && a.first < 0.0) || (pi2.second > 0.0 && a.second > 0.0))
+            res = convex_hull(res, representation(0.0, 0.0));
+    }
+
+    return res;
+}
+
+// bare mixed type version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(a)
+            || !mpfr_bin_ieee754_flavor<T2>::is_valid(c)
+            || !mpfr_bin_ieee754_flavor<T3>::is_valid(x))
+        return empty();
+
+    // determine max. precision
+    typedef typename p1788::util::max_precision_type<T,T1,T2,T3>::type T_MAX;
+
+    // 1.) convert inputs to max precision; 2.) compute result in max precision; 3.) convert result to desired precision
+    // Error free for floating point inf-sup intervals due to  outward rounding
+    return convert_hull(
+               mpfr_bin_ieee754_flavor<T_MAX>::atan2_rev2(
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(a),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(c),
+                   mpfr_bin_ieee754_flavor<T_MAX>::convert_hull(x)
+               )
+           );
+}
+
+// decorated version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(a) || !is_valid(c) || !is_valid(x) || is_nai(a) || is_nai(c) || is_nai(x))
+        return nai();
+
+    // call bare version and set decoration to trv
+    return representation_dec(atan2_rev2(a.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+// decorated mixedtype version
+template<typename T>
+template<typename T1, typename T2, typename T3>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T3> const& x)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T3>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    if (!mpfr_bin_ieee754_flavor<T1>::is_valid(a) || !mpfr_bin_ieee754_flavor<T2>::is_valid(c) || !mpfr_bin_ieee754_flavor<T3>::is_valid(x)
+            || mpfr_bin_ieee754_flavor<T1>::is_nai(a) || mpfr_bin_ieee754_flavor<T2>::is_nai(c) || mpfr_bin_ieee754_flavor<T3>::is_nai(x))
+        return nai();
+
+    // call bare mixedtype version and set decoration to trv
+    return representation_dec(atan2_rev2(a.first, c.first, x.first), p1788::decoration::decoration::trv);
+}
+
+
+// bare binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation const& c)
+{
+    // call bare ternary version with x = entire
+    return atan2_rev2(a, c, entire());
+}
+
+// bare binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation_type<T1> const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call bare ternary version with x = entire
+    return atan2_rev2(a, c, entire());
+}
+
+// decorated binary version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec const& c)
+{
+    // call decorated ternary version with x = entire
+    return atan2_rev2(a, c, entire_dec());
+}
+
+// decorated binary mixedtype version
+template<typename T>
+template<typename T1, typename T2>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::atan2_rev2(mpfr_bin_ieee754_flavor<T>::representation_dec_type<T1> const& a,
+                                       mpfr_bin_ieee754_flavor<T>::representation_dec_type<T2> const& c)
+{
+    static_assert(std::numeric_limits<T1>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+    static_assert(std::numeric_limits<T2>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    // call decorated ternary version with x = entire
+    return atan2_rev2(a, c, entire_dec());
+}
+
+
+
+
+// atan2_rev helper
+//
+// For q = 0,..,3 the range of tan on the part of c inside the quadrant q
+// (counterclockwise starting with the quadrant x' >= 0, y >= 0) is returned,
+// or empty if c does not intersect the quadrant. The vertical directions
+// +pi/2 and -pi/2 are treated as limits and lead to unbounded ranges.
+// For q = 4 the interval [l,u] is returned with l = -1 if -pi/2 is an element
+// of c (l = 0 otherwise) and u = 1 if +pi/2 is an element of c (u = 0 otherwise).
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::atan2_rev_tan(mpfr_bin_ieee754_flavor<T>::representation const& c,
+        int q)
+{
+    mpfr_var::setup();
+
+    mpfr_var pi_d;
+    mpfr_var pi_u;
+    mpfr_const_pi(pi_d(), MPFR_RNDD);
+    mpfr_const_pi(pi_u(), MPFR_RNDU);
+
+    // pi and pi/2 are irrational, hence a bound of c is either below pi_d or above pi_u
+    T const pid = pi_d.template get<T>(MPFR_RNDD);
+    T const piu = pi_u.template get<T>(MPFR_RNDU);
+
+    // error free division by 2
+    T const pi2d = pid / 2.0;
+    T const pi2u = piu / 2.0;
+
+    T const inf = std::numeric_limits<T>::infinity();
+
+    switch (q)
+    {
+    case 0:     // [0, pi/2)
+        if (c.second < 0.0 || c.first > pi2d)
+            return empty();
+
+        return representation(c.first <= 0.0 ? 0.0 : tan(representation(c.first, c.first)).first,
+                              c.second >= pi2u ? inf : tan(representation(c.second, c.second)).second);
+    case 1:     // (pi/2, pi]
+        if (c.second < pi2u || c.first > pid)
+            return empty();
+
+        return representation(c.first <= pi2d ? -inf : tan(representation(c.first, c.first)).first,
+                              c.second >= piu ? 0.0 : tan(representation(c.second, c.second)).second);
+    case 2:     // (-pi, -pi/2)
+        if (c.second <= -piu || c.first > -pi2u)
+            return empty();
+
+        return representation(c.first <= -piu ? 0.0 : tan(representation(c.first, c.first)).first,
+                              c.second >= -pi2d ? inf : tan(representation(c.second, c.second)).second);
+    case 3:     // (-pi/2, 0]
+        if (c.second < -pi2d || c.first > 0.0)
+            return empty();
+
+        return representation(c.first <= -pi2u ? -inf : tan(representation(c.first, c.first)).first,
+                              c.second >= 0.0 ? 0.0 : tan(representation(c.second, c.second)).second);
+    default:    // -pi/2, +pi/2
+        return representation(c.first <= -pi2u && c.second >= -pi2d ? -1.0 : 0.0,
+                              c.first <= pi2d && c.second >= pi2u ? 1.0 : 0.0);
+    }
+}
+
+
+
+
 } // namespace setbased
 
 } // namespace infsup
@@ -204,6 +204,288 @@ mpfr_bin_ieee754_flavor<T>::convex_hull(mpfr_bin_ieee754_flavor<T>::representati
 }
 
 
+// intersection ( bare interval ) array version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::intersection(mpfr_bin_ieee754_flavor<T>::representation const* x, std::size_t n)
+{
+    const std::size_t block = 256;
+
+    T l = -std::numeric_limits<T>::infinity();
+    T u = std::numeric_limits<T>::infinity();
+    unsigned valid = 1;
+    unsigned empty = 0;
+
+    for (std::size_t i = 0; i < n; i += block)
+    {
+        std::size_t m = std::min(block, n - i);
+
+        // branch free max/min reduction, an empty interval has NaN bounds
+        // for which the comparisons are false
+        for (std::size_t j = i; j < i + m; ++j)
+        {
+            valid &= bool_mask_valid(x[j].first, x[j].second);
+            empty |= unsigned(x[j].first != x[j].first);
+            l = x[j].first > l ? x[j].first : l;
+            u = x[j].second < u ? x[j].second : u;
+        }
+
+        if (!valid || empty || l > u)
+            break;
+    }
+
+    if (!valid)
+    {
+        p1788::exception::signal_invalid_operand();
+        return mpfr_bin_ieee754_flavor<T>::empty();
+    }
+
+    if (empty || l > u)
+        return mpfr_bin_ieee754_flavor<T>::empty();
+
+    return representation(l, u);
+}
+
+// intersection ( decorated interval ) array version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::intersection(mpfr_bin_ieee754_flavor<T>::representation_dec const* x, std::size_t n)
+{
+    // no early exit, a NaI after an empty intermediate result determines the result
+    T l = -std::numeric_limits<T>::infinity();
+    T u = std::numeric_limits<T>::infinity();
+    unsigned valid = 1;
+    unsigned ill = 0;
+    unsigned empty = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        valid &= overlap_valid(x[i]);
+        ill |= unsigned(x[i].second == p1788::decoration::decoration::ill);
+        empty |= unsigned(x[i].first.first != x[i].first.first);
+        l = x[i].first.first > l ? x[i].first.first : l;
+        u = x[i].first.second < u ? x[i].first.second : u;
+    }
+
+    if (!valid)
+        p1788::exception::signal_invalid_operand();
+
+    if (!valid || ill)
+        return nai();
+
+    if (empty || l > u)
+        return representation_dec(mpfr_bin_ieee754_flavor<T>::empty(), p1788::decoration::decoration::trv);
+
+    return representation_dec(representation(l, u), p1788::decoration::decoration::trv);
+}
+
+// convex_hull ( bare interval ) array version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation
+mpfr_bin_ieee754_flavor<T>::convex_hull(mpfr_bin_ieee754_flavor<T>::representation const* x, std::size_t n)
+{
+    T l = std::numeric_limits<T>::infinity();
+    T u = -std::numeric_limits<T>::infinity();
+    unsigned valid = 1;
+
+    // branch free min/max reduction, an empty interval has NaN bounds for
+    // which the comparisons are false
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        valid &= bool_mask_valid(x[i].first, x[i].second);
+        l = x[i].first < l ? x[i].first : l;
+        u = x[i].second > u ? x[i].second : u;
+    }
+
+    if (!valid)
+    {
+        p1788::exception::signal_invalid_operand();
+        return mpfr_bin_ieee754_flavor<T>::empty();
+    }
+
+    // only empty intervals
+    if (l > u)
+        return mpfr_bin_ieee754_flavor<T>::empty();
+
+    return representation(l, u);
+}
+
+// convex_hull ( decorated interval ) array version
+template<typename T>
+typename mpfr_bin_ieee754_flavor<T>::representation_dec
+mpfr_bin_ieee754_flavor<T>::convex_hull(mpfr_bin_ieee754_flavor<T>::representation_dec const* x, std::size_t n)
+{
+    T l = std::numeric_limits<T>::infinity();
+    T u = -std::numeric_limits<T>::infinity();
+    unsigned valid = 1;
+    unsigned ill = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        valid &= overlap_valid(x[i]);
+        ill |= unsigned(x[i].second == p1788::decoration::decoration::ill);
+        l = x[i].first.first < l ? x[i].first.first : l;
+        u = x[i].first.second > u ? x[i].first.second : u;
+    }
+
+    if (!valid)
+        p1788::exception::signal_invalid_operand();
+
+    if (!valid || ill)
+        return nai();
+
+    if (l > u)
+        return representation_dec(mpfr_bin_ieee754_flavor<T>::empty(), p1788::decoration::decoration::trv);
+
+    return representation_dec(representation(l, u), p1788::decoration::decoration::trv);
+}
+
+
+// split point of a nonempty interval
+template<typename T>
+T
+mpfr_bin_ieee754_flavor<T>::split_point(mpfr_bin_ieee754_flavor<T>::representation const& x, T ratio)
+{
+    if (ratio != ratio)
+        return mid_nonempty(x);
+
+    ratio = std::min(std::max(ratio, T(0)), T(1));
+
+    T l = std::max(x.first, -std::numeric_limits<T>::max());
+    T u = std::min(x.second, std::numeric_limits<T>::max());
+
+    // no overflow because both weights are at most 1, the rounding may move
+    // the point slightly out of [l,u]
+    T p = (T(1) - ratio) * l + ratio * u;
+    p = std::min(std::max(p, l), u);
+
+    return p == 0.0 ? +0.0 : p;
+}
+
+// bisect ( bare interval )
+template<typename T>
+std::pair<typename mpfr_bin_ieee754_flavor<T>::representation, typename mpfr_bin_ieee754_flavor<T>::representation>
+mpfr_bin_ieee754_flavor<T>::bisect(mpfr_bin_ieee754_flavor<T>::representation const& x)
+{
+    if (!is_valid(x) || is_empty(x))
+        return std::pair<representation, representation>(empty(), empty());
+
+    T m = mid_nonempty(x);
+
+    return std::pair<representation, representation>(representation(x.first, m), representation(m, x.second));
+}
+
+// bisect ( bare interval ) ratio
+template<typename T>
+std::pair<typename mpfr_bin_ieee754_flavor<T>::representation, typename mpfr_bin_ieee754_flavor<T>::representation>
+mpfr_bin_ieee754_flavor<T>::bisect(mpfr_bin_ieee754_flavor<T>::representation const& x, T ratio)
+{
+    if (!is_valid(x) || is_empty(x))
+        return std::pair<representation, representation>(empty(), empty());
+
+    T p = split_point(x, ratio);
+
+    return std::pair<representation, representation>(representation(x.first, p), representation(p, x.second));
+}
+
+// multisect ( bare interval )
+template<typename T>
+template<typename OutputIt>
+OutputIt
+mpfr_bin_ieee754_flavor<T>::multisect(mpfr_bin_ieee754_flavor<T>::representation const& x, std::size_t k, OutputIt out)
+{
+    if (!is_valid(x) || is_empty(x))
+    {
+        for (std::size_t i = 0; i < k; ++i)
+            *out++ = empty();
+
+        return out;
+    }
+
+    T l = x.first;
+
+    for (std::size_t i = 1; i < k; ++i)
+    {
+        // nondecreasing split points despite the rounding
+        T p = std::max(split_point(x, static_cast<T>(i) / static_cast<T>(k)), l);
+
+        *out++ = representation(l, p);
+        l = p;
+    }
+
+    if (k > 0)
+        *out++ = representation(l, x.second);
+
+    return out;
+}
+
+// bisect ( decorated interval )
+template<typename T>
+std::pair<typename mpfr_bin_ieee754_flavor<T>::representation_dec, typename mpfr_bin_ieee754_flavor<T>::representation_dec>
+mpfr_bin_ieee754_flavor<T>::bisect(mpfr_bin_ieee754_flavor<T>::representation_dec const& x)
+{
+    if (!is_valid(x) || is_nai(x))
+        return std::pair<representation_dec, representation_dec>(nai(), nai());
+
+    std::pair<representation, representation> b = bisect(x.first);
+
+    return std::pair<representation_dec, representation_dec>(representation_dec(b.first, x.second),
+            representation_dec(b.second, x.second));
+}
+
+// bisect ( decorated interval ) ratio
+template<typename T>
+std::pair<typename mpfr_bin_ieee754_flavor<T>::representation_dec, typename mpfr_bin_ieee754_flavor<T>::representation_dec>
+mpfr_bin_ieee754_flavor<T>::bisect(mpfr_bin_ieee754_flavor<T>::representation_dec const& x, T ratio)
+{
+    if (!is_valid(x) || is_nai(x))
+        return std::pair<representation_dec, representation_dec>(nai(), nai());
+
+    std::pair<representation, representation> b = bisect(x.first, ratio);
+
+    return std::pair<representation_dec, representation_dec>(representation_dec(b.first, x.second),
+            representation_dec(b.second, x.second));
+}
+
+// multisect ( decorated interval )
+template<typename T>
+template<typename OutputIt>
+OutputIt
+mpfr_bin_ieee754_flavor<T>::multisect(mpfr_bin_ieee754_flavor<T>::representation_dec const& x, std::size_t k, OutputIt out)
+{
+    if (!is_valid(x) || is_nai(x))
+    {
+        for (std::size_t i = 0; i < k; ++i)
+            *out++ = nai();
+
+        return out;
+    }
+
+    if (is_empty(x.first))
+    {
+        for (std::size_t i = 0; i < k; ++i)
+            *out++ = representation_dec(empty(), x.second);
+
+        return out;
+    }
+
+    T l = x.first.first;
+
+    for (std::size_t i = 1; i < k; ++i)
+    {
+        T p = std::max(split_point(x.first, static_cast<T>(i) / static_cast<T>(k)), l);
+
+        *out++ = representation_dec(representation(l, p), x.second);
+        l = p;
+    }
+
+    if (k > 0)
+        *out++ = representation_dec(representation(l, x.first.second), x.second);
+
+    return out;
+}
+
+
 } // namespace setbased
 
 } // namespace infsup
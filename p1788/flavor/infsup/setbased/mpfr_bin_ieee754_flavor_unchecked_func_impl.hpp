@@ -0,0 +1,81 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_UNCHECKED_FUNC_IMPL_HPP
+#define LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_UNCHECKED_FUNC_IMPL_HPP
+
+namespace p1788
+{
+
+namespace flavor
+{
+
+namespace infsup
+{
+
+namespace setbased
+{
+
+
+// The unchecked arithmetic operations are implemented next to their checked
+// counterparts in mpfr_bin_ieee754_flavor_elem_func_impl.hpp
+
+
+// is_empty ( bare interval ) unchecked
+template<typename T>
+bool mpfr_bin_ieee754_flavor<T>::is_empty(representation const& x, p1788::infsup::unchecked_t)
+{
+    // a valid representation is either empty or has no NaN bound
+    return std::isnan(x.first);
+}
+
+// is_entire ( bare interval ) unchecked
+template<typename T>
+bool mpfr_bin_ieee754_flavor<T>::is_entire(representation const& x, p1788::infsup::unchecked_t)
+{
+    return x.first == -std::numeric_limits<T>::infinity()
+           && x.second == std::numeric_limits<T>::infinity();
+}
+
+// is_common_interval ( bare interval ) unchecked
+template<typename T>
+bool mpfr_bin_ieee754_flavor<T>::is_common_interval(representation const& x, p1788::infsup::unchecked_t)
+{
+    // false for the empty interval because comparisons with NaN are false
+    return x.first > -std::numeric_limits<T>::infinity()
+           && x.second < std::numeric_limits<T>::infinity();
+}
+
+
+} // namespace setbased
+
+} // namespace infsup
+
+} // namespace flavor
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_FLAVOR_INFSUP_SETBASED_MPFR_BIN_IEEE754_FLAVOR_UNCHECKED_FUNC_IMPL_HPP
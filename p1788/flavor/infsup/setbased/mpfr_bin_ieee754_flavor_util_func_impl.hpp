@@ -45,11 +45,7 @@ T mpfr_bin_ieee754_flavor<T>::convert_rndd(T_ x)
 {
     static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
 
-    mpfr_var::setup();
-
-    mpfr_var xx(x, MPFR_RNDD);
-
-    T res = xx.template get<T>(MPFR_RNDD);
+    T res = convert_rnd(x, std::round_toward_neg_infinity, conversion_kind<T_>());
 
     return res == 0.0 ? -0.0 : res;     // maps +-0.0 to -0.0
 }
@@ -61,11 +57,7 @@ T mpfr_bin_ieee754_flavor<T>::convert_rndn(T_ x)
 {
     static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
 
-    mpfr_var::setup();
-
-    mpfr_var xx(x, MPFR_RNDN);
-
-    T res = xx.template get<T>(MPFR_RNDN);
+    T res = convert_rnd(x, std::round_to_nearest, conversion_kind<T_>());
 
     return res == 0.0 ? +0.0 : res;     // maps +-0.0 to +0.0
 }
@@ -77,13 +69,80 @@ T mpfr_bin_ieee754_flavor<T>::convert_rndu(T_ x)
 {
     static_assert(std::numeric_limits<T_>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
 
+    T res = convert_rnd(x, std::round_toward_infinity, conversion_kind<T_>());
+
+    return res == 0.0 ? +0.0 : res;     // maps +-0.0 to +0.0
+}
+
+
+// convert T_ to T, every number of T_ is a number of T
+template<typename T>
+template<typename T_>
+T mpfr_bin_ieee754_flavor<T>::convert_rnd(T_ x, std::float_round_style, widening_conversion)
+{
+    return static_cast<T>(x);
+}
+
+// convert T_ to T, every number of T is a number of T_
+template<typename T>
+template<typename T_>
+T mpfr_bin_ieee754_flavor<T>::convert_rnd(T_ x, std::float_round_style rnd, narrowing_conversion)
+{
+    T_ const max = std::numeric_limits<T>::max();
+    T const inf = std::numeric_limits<T>::infinity();
+
+    if (std::isinf(x))
+        return static_cast<T>(x);
+
+    if (rnd == std::round_to_nearest)
+    {
+        // the cast depends on the rounding mode of the floating point environment
+        if (std::fegetround() != FE_TONEAREST)
+            return convert_rnd(x, rnd, mpfr_conversion());
+
+        // numbers above max + ulp(max)/2 are rounded to infinity
+        T_ const lim = max + std::ldexp(static_cast<T_>(1),
+                                        std::numeric_limits<T>::max_exponent - std::numeric_limits<T>::digits - 1);
+
+        if (x >= lim || x <= -lim)
+            return x > 0 ? inf : -inf;
+
+        return x > max ? std::numeric_limits<T>::max() : x < -max ? -std::numeric_limits<T>::max() : static_cast<T>(x);
+    }
+
+    bool up = rnd == std::round_toward_infinity;
+
+    if (x > max)
+        return up ? inf : std::numeric_limits<T>::max();
+
+    if (x < -max)
+        return up ? -std::numeric_limits<T>::max() : -inf;
+
+    // the cast returns one of the two neighbors of x in every rounding mode,
+    // the comparison in T_ is exact
+    T res = static_cast<T>(x);
+
+    if (up && static_cast<T_>(res) < x)
+        res = std::nextafter(res, inf);
+    else if (!up && static_cast<T_>(res) > x)
+        res = std::nextafter(res, -inf);
+
+    return res;
+}
+
+// convert T_ to T via MPFR
+template<typename T>
+template<typename T_>
+T mpfr_bin_ieee754_flavor<T>::convert_rnd(T_ x, std::float_round_style rnd, mpfr_conversion)
+{
     mpfr_var::setup();
 
-    mpfr_var xx(x, MPFR_RNDU);
+    mpfr_rnd_t r = rnd == std::round_toward_neg_infinity ? MPFR_RNDD
+                   : rnd == std::round_toward_infinity ? MPFR_RNDU : MPFR_RNDN;
 
-    T res = xx.template get<T>(MPFR_RNDU);
+    mpfr_var xx(x, r);
 
-    return res == 0.0 ? +0.0 : res;     // maps +-0.0 to +0.0
+    return xx.template get<T>(r);
 }
 
 
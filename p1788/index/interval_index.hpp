@@ -0,0 +1,686 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_INDEX_INTERVAL_INDEX_HPP
+#define LIBIEEEP1788_P1788_INDEX_INTERVAL_INDEX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "p1788/infsup/interval.hpp"
+
+
+namespace p1788
+{
+
+namespace index
+{
+
+
+template<typename T, template<typename> class Flavor>
+class interval_index;
+
+
+/// \brief Static index over a collection of intervals answering stabbing, overlap and containment queries
+///
+/// The index is an implicit interval tree: the nonempty intervals are stored
+/// in one array sorted by their lower bounds, the middle element of a range of
+/// the array is the root of the subtree formed by this range. The root of
+/// every subtree with more than <c>leaf_size</c> elements additionally stores
+/// the minimum and the maximum upper bound of the subtree, smaller ranges are
+/// scanned linearly. Hence there are no pointers and a query traverses the
+/// array from left to right.
+///
+/// A query reports the ids of all intervals x of the index satisfying
+///
+/// <table>
+/// <tr><td>overlapping(y)</td><td><c>!disjoint(x, y)</c></td></tr>
+/// <tr><td>containing(y)</td><td><c>subset(y, x)</c></td></tr>
+/// <tr><td>contained_in(y)</td><td><c>subset(x, y)</c></td></tr>
+/// <tr><td>stabbing(p)</td><td><c>is_member(p, x)</c></td></tr>
+/// </table>
+///
+/// in O(log n + k) for k reported ids, in an unspecified order. Empty
+/// intervals are kept in a separate list.
+///
+/// The index is built in O(n log n) by a bulk constructor and cannot be
+/// modified, see interval_index for a dynamic index.
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+template<typename T, template<typename> class Flavor>
+class static_interval_index
+{
+public:
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+    typedef std::size_t id_type;
+
+    /// \brief Bounds and id of an interval, the empty set is stored as [+&infin;,-&infin;]
+    struct entry
+    {
+        T inf;
+        T sup;
+        id_type id;
+    };
+
+    /// \brief Maximum number of elements of a subtree which is scanned linearly
+    static const std::size_t leaf_size = 8;
+
+
+    /// \brief Creates an empty index
+    static_interval_index()
+        : nodes_(), empty_()
+    { }
+
+    /// \brief Builds the index of the intervals in the range [\p first, \p last)
+    ///
+    /// The i-th interval of the range gets the id <c>first_id + i</c>.
+    template<typename InputIt>
+    static_interval_index(InputIt first, InputIt last, id_type first_id = 0)
+        : nodes_(), empty_()
+    {
+        std::vector<entry> entries;
+
+        for (; first != last; ++first, ++first_id)
+            entries.push_back(make_entry(*first, first_id));
+
+        build(entries);
+    }
+
+    /// \brief Builds the index of the entries \p entries
+    explicit static_interval_index(std::vector<entry> const& entries)
+        : nodes_(), empty_()
+    {
+        build(entries);
+    }
+
+
+    /// \brief Returns the entry of the interval \p x with the id \p id
+    static entry make_entry(interval_type const& x, id_type id)
+    {
+        return entry { interval_type::inf(x), interval_type::sup(x), id };
+    }
+
+    /// \brief Number of intervals
+    std::size_t size() const
+    {
+        return nodes_.size() + empty_.size();
+    }
+
+    /// \brief Checks if the index contains no intervals
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+
+    /// \brief Writes the ids of all intervals x with <c>!disjoint(x, y)</c> to \p out
+    template<typename OutputIt>
+    OutputIt overlapping(interval_type const& y, OutputIt out) const
+    {
+        return collect(overlap_query { interval_type::inf(y), interval_type::sup(y) }, out);
+    }
+
+    /// \brief Writes the ids of all intervals x with <c>subset(y, x)</c> to \p out
+    template<typename OutputIt>
+    OutputIt containing(interval_type const& y, OutputIt out) const
+    {
+        return collect(containing_query { interval_type::inf(y), interval_type::sup(y) }, out);
+    }
+
+    /// \brief Writes the ids of all intervals x with <c>subset(x, y)</c> to \p out
+    template<typename OutputIt>
+    OutputIt contained_in(interval_type const& y, OutputIt out) const
+    {
+        return collect(contained_query { interval_type::inf(y), interval_type::sup(y) }, out);
+    }
+
+    /// \brief Writes the ids of all intervals x with <c>is_member(p, x)</c> to \p out
+    template<typename OutputIt>
+    OutputIt stabbing(T p, OutputIt out) const
+    {
+        if (!std::isfinite(p))
+            return out;
+
+        return collect(containing_query { p, p }, out);
+    }
+
+
+private:
+
+    friend class interval_index<T, Flavor>;
+
+    // element of the implicit tree, min_sup and max_sup are the bounds of the
+    // upper bounds of the subtree and only valid for a subtree with more than
+    // leaf_size elements
+    struct node
+    {
+        T inf;
+        T sup;
+        id_type id;
+        T min_sup;
+        T max_sup;
+    };
+
+    // A query specifies the subtrees which can be skipped (prune), whether the
+    // left subtree has to be visited (left), whether the element and all
+    // elements to its right can be skipped (beyond) and whether an element
+    // which is not beyond is reported (match). Furthermore, it specifies the
+    // behavior if there is no (none) or every (all) nonempty interval to report
+    // and whether empty intervals are reported (with_empty).
+
+    // !disjoint(x, [lo,hi])
+    struct overlap_query
+    {
+        T lo;
+        T hi;
+
+        bool none() const { return lo > hi; }
+        bool all() const { return false; }
+        bool with_empty() const { return false; }
+        bool prune(node const& n) const { return n.max_sup < lo; }
+        bool left(node const&) const { return true; }
+        template<typename E>
+        bool beyond(E const& e) const { return e.inf > hi; }
+        template<typename E>
+        bool match(E const& e) const { return lo <= e.sup; }
+    };
+
+    // subset([lo,hi], x)
+    struct containing_query
+    {
+        T lo;
+        T hi;
+
+        bool none() const { return false; }
+        bool all() const { return lo > hi; }
+        bool with_empty() const { return lo > hi; }
+        bool prune(node const& n) const { return n.max_sup < hi; }
+        bool left(node const&) const { return true; }
+        template<typename E>
+        bool beyond(E const& e) const { return e.inf > lo; }
+        template<typename E>
+        bool match(E const& e) const { return hi <= e.sup; }
+    };
+
+    // subset(x, [lo,hi])
+    struct contained_query
+    {
+        T lo;
+        T hi;
+
+        bool none() const { return lo > hi; }
+        bool all() const { return false; }
+        bool with_empty() const { return true; }
+        bool prune(node const& n) const { return n.min_sup > hi || n.max_sup < lo; }
+        bool left(node const& n) const { return !(n.inf < lo); }
+        template<typename E>
+        bool beyond(E const& e) const { return e.inf > hi; }
+        template<typename E>
+        bool match(E const& e) const { return lo <= e.inf && e.sup <= hi; }
+    };
+
+
+    // checks if the entry e is reported by the query q
+    template<typename Query>
+    static bool matches(Query const& q, entry const& e)
+    {
+        if (e.inf > e.sup)
+            return q.with_empty();
+
+        return !q.none() && (q.all() || (!q.beyond(e) && q.match(e)));
+    }
+
+    // calls f(id) for every id reported by the query q
+    template<typename Query, typename F>
+    void visit(Query const& q, F& f) const
+    {
+        if (q.with_empty())
+            for (id_type id : empty_)
+                f(id);
+
+        if (q.all())
+        {
+            for (node const& n : nodes_)
+                f(n.id);
+        }
+        else if (!q.none())
+        {
+            walk(q, f);
+        }
+    }
+
+    // traverses the implicit tree with an explicit stack of the ranges [l,r)
+    template<typename Query, typename F>
+    void walk(Query const& q, F& f) const
+    {
+        std::size_t stack[2 * (std::numeric_limits<std::size_t>::digits + 1)];
+        std::size_t sp = 0;
+
+        if (!nodes_.empty())
+        {
+            stack[sp++] = 0;
+            stack[sp++] = nodes_.size();
+        }
+
+        while (sp > 0)
+        {
+            std::size_t r = stack[--sp];
+            std::size_t l = stack[--sp];
+
+            if (r - l <= leaf_size)
+            {
+                for (; l < r && !q.beyond(nodes_[l]); ++l)
+                    if (q.match(nodes_[l]))
+                        f(nodes_[l].id);
+
+                continue;
+            }
+
+            std::size_t m = l + (r - l) / 2;
+            node const& n = nodes_[m];
+
+            if (q.prune(n))
+                continue;
+
+            // the right subtree is pushed first to visit the array from left to right
+            if (!q.beyond(n))
+            {
+                if (q.match(n))
+                    f(n.id);
+
+                stack[sp++] = m + 1;
+                stack[sp++] = r;
+            }
+
+            if (q.left(n))
+            {
+                stack[sp++] = l;
+                stack[sp++] = m;
+            }
+        }
+    }
+
+    template<typename Query, typename OutputIt>
+    OutputIt collect(Query const& q, OutputIt out) const
+    {
+        auto f = [&out](id_type id)
+        {
+            *out++ = id;
+        };
+
+        visit(q, f);
+        return out;
+    }
+
+    // appends the entries with alive[id] != 0 to v and returns the number of the other entries
+    std::size_t append_entries(std::vector<entry>& v, std::vector<unsigned char> const& alive) const
+    {
+        std::size_t dropped = 0;
+
+        for (node const& n : nodes_)
+        {
+            if (alive[n.id])
+                v.push_back(entry { n.inf, n.sup, n.id });
+            else
+                ++dropped;
+        }
+
+        for (id_type id : empty_)
+        {
+            if (alive[id])
+                v.push_back(entry { std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), id });
+            else
+                ++dropped;
+        }
+
+        return dropped;
+    }
+
+    void build(std::vector<entry> const& entries)
+    {
+        nodes_.reserve(entries.size());
+
+        for (entry const& e : entries)
+        {
+            if (e.inf > e.sup)
+                empty_.push_back(e.id);
+            else
+                nodes_.push_back(node { e.inf, e.sup, e.id, e.sup, e.sup });
+        }
+
+        std::sort(nodes_.begin(), nodes_.end(),
+                  [](node const& a, node const& b) { return a.inf < b.inf; });
+
+        augment(0, nodes_.size());
+    }
+
+    // computes the minimum and maximum upper bound of the subtree [l,r) and stores it in its root
+    std::pair<T, T> augment(std::size_t l, std::size_t r)
+    {
+        std::pair<T, T> b(std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity());
+
+        if (r - l <= leaf_size)
+        {
+            for (; l < r; ++l)
+            {
+                b.first = std::min(b.first, nodes_[l].sup);
+                b.second = std::max(b.second, nodes_[l].sup);
+            }
+
+            return b;
+        }
+
+        std::size_t m = l + (r - l) / 2;
+        std::pair<T, T> bl = augment(l, m);
+        std::pair<T, T> br = augment(m + 1, r);
+
+        node& n = nodes_[m];
+        n.min_sup = std::min(n.sup, std::min(bl.first, br.first));
+        n.max_sup = std::max(n.sup, std::max(bl.second, br.second));
+
+        return std::pair<T, T>(n.min_sup, n.max_sup);
+    }
+
+
+    std::vector<node> nodes_;
+    std::vector<id_type> empty_;
+};
+
+template<typename T, template<typename> class Flavor>
+const std::size_t static_interval_index<T, Flavor>::leaf_size;
+
+
+/// \brief Dynamic index over a collection of intervals answering stabbing, overlap and containment queries
+///
+/// The index supports the same queries as static_interval_index and
+/// additionally the insertion and removal of intervals. An inserted interval
+/// gets the next unused id, ids are not reused after a removal.
+///
+/// The intervals are stored in a logarithmic number of static indices (the
+/// logarithmic method of Bentley and Saxe). Insertions are collected in a
+/// buffer of <c>buffer_size</c> entries, which is scanned linearly by a query.
+/// A full buffer is merged with the static indices of a size up to twice its
+/// own into a new static index, hence an insertion takes amortized
+/// O(log<sup>2</sup> n) and a query O(log<sup>2</sup> n + k). Removed intervals
+/// are only marked and dropped by the next merge, if they make up more than
+/// half of the stored intervals all indices are rebuilt.
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+template<typename T, template<typename> class Flavor>
+class interval_index
+{
+public:
+
+    typedef T bound_type;
+    typedef static_interval_index<T, Flavor> static_index_type;
+    typedef typename static_index_type::interval_type interval_type;
+    typedef typename static_index_type::id_type id_type;
+    typedef typename static_index_type::entry entry;
+
+    /// \brief Capacity of the insertion buffer
+    static const std::size_t buffer_size = 64;
+
+
+    /// \brief Creates an empty index
+    interval_index()
+        : buffer_(), levels_(), alive_(), size_(0), dead_(0)
+    { }
+
+    /// \brief Creates the index of the intervals in the range [\p first, \p last) with the ids 0, 1, ...
+    template<typename InputIt>
+    interval_index(InputIt first, InputIt last)
+        : buffer_(), levels_(), alive_(), size_(0), dead_(0)
+    {
+        insert(first, last);
+    }
+
+
+    /// \brief Inserts the interval \p x and returns its id
+    id_type insert(interval_type const& x)
+    {
+        id_type id = push(x);
+
+        if (buffer_.size() >= buffer_size)
+            flush();
+
+        return id;
+    }
+
+    /// \brief Inserts the intervals in the range [\p first, \p last) and returns the id of the first one
+    ///
+    /// The intervals get consecutive ids and are merged into the static
+    /// indices at once.
+    template<typename InputIt>
+    id_type insert(InputIt first, InputIt last)
+    {
+        id_type id = alive_.size();
+
+        for (; first != last; ++first)
+            push(*first);
+
+        if (buffer_.size() >= buffer_size)
+            flush();
+
+        return id;
+    }
+
+    /// \brief Removes the interval with the id \p id, returns false if there is no such interval
+    bool erase(id_type id)
+    {
+        if (!contains(id))
+            return false;
+
+        alive_[id] = 0;
+        --size_;
+        ++dead_;
+
+        if (dead_ > size_ && dead_ >= buffer_size)
+            rebuild();
+
+        return true;
+    }
+
+    /// \brief Checks if the index contains an interval with the id \p id
+    bool contains(id_type id) const
+    {
+        return id < alive_.size() && alive_[id];
+    }
+
+    /// \brief Number of intervals
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    /// \brief Checks if the index contains no intervals
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    /// \brief Removes all intervals, the ids are not reused
+    void clear()
+    {
+        buffer_.clear();
+        levels_.clear();
+        std::fill(alive_.begin(), alive_.end(), 0);
+        size_ = 0;
+        dead_ = 0;
+    }
+
+
+    /// \brief Writes the ids of all intervals x with <c>!disjoint(x, y)</c> to \p out
+    template<typename OutputIt>
+    OutputIt overlapping(interval_type const& y, OutputIt out) const
+    {
+        return collect(typename static_index_type::overlap_query { interval_type::inf(y), interval_type::sup(y) }, out);
+    }
+
+    /// \brief Writes the ids of all intervals x with <c>subset(y, x)</c> to \p out
+    template<typename OutputIt>
+    OutputIt containing(interval_type const& y, OutputIt out) const
+    {
+        return collect(typename static_index_type::containing_query { interval_type::inf(y), interval_type::sup(y) }, out);
+    }
+
+    /// \brief Writes the ids of all intervals x with <c>subset(x, y)</c> to \p out
+    template<typename OutputIt>
+    OutputIt contained_in(interval_type const& y, OutputIt out) const
+    {
+        return collect(typename static_index_type::contained_query { interval_type::inf(y), interval_type::sup(y) }, out);
+    }
+
+    /// \brief Writes the ids of all intervals x with <c>is_member(p, x)</c> to \p out
+    template<typename OutputIt>
+    OutputIt stabbing(T p, OutputIt out) const
+    {
+        if (!std::isfinite(p))
+            return out;
+
+        return collect(typename static_index_type::containing_query { p, p }, out);
+    }
+
+
+private:
+
+    id_type push(interval_type const& x)
+    {
+        id_type id = alive_.size();
+
+        alive_.push_back(1);
+        buffer_.push_back(static_index_type::make_entry(x, id));
+        ++size_;
+
+        return id;
+    }
+
+    // merges the buffer into the static indices
+    void flush()
+    {
+        std::vector<entry> carry;
+
+        for (entry const& e : buffer_)
+        {
+            if (alive_[e.id])
+                carry.push_back(e);
+            else
+                --dead_;
+        }
+
+        buffer_.clear();
+        place(carry);
+    }
+
+    // builds a static index of the entries carry and of all smaller indices at
+    // the first free level with a sufficient capacity
+    void place(std::vector<entry>& carry)
+    {
+        if (carry.empty())
+            return;
+
+        std::size_t k = 0;
+
+        for (;; ++k)
+        {
+            if (k == levels_.size())
+                levels_.push_back(static_index_type());
+
+            if (levels_[k].empty() && carry.size() <= (buffer_size << k))
+                break;
+
+            dead_ -= levels_[k].append_entries(carry, alive_);
+            levels_[k] = static_index_type();
+        }
+
+        levels_[k] = static_index_type(carry);
+    }
+
+    // drops all removed intervals
+    void rebuild()
+    {
+        std::vector<entry> carry;
+
+        for (entry const& e : buffer_)
+            if (alive_[e.id])
+                carry.push_back(e);
+
+        for (static_index_type const& level : levels_)
+            level.append_entries(carry, alive_);
+
+        buffer_.clear();
+        levels_.clear();
+        dead_ = 0;
+
+        place(carry);
+    }
+
+    template<typename Query, typename OutputIt>
+    OutputIt collect(Query const& q, OutputIt out) const
+    {
+        auto f = [this, &out](id_type id)
+        {
+            if (alive_[id])
+                *out++ = id;
+        };
+
+        for (entry const& e : buffer_)
+            if (static_index_type::matches(q, e))
+                f(e.id);
+
+        for (static_index_type const& level : levels_)
+            level.visit(q, f);
+
+        return out;
+    }
+
+
+    std::vector<entry> buffer_;
+    std::vector<static_index_type> levels_;
+    std::vector<unsigned char> alive_;
+    std::size_t size_;
+    std::size_t dead_;
+};
+
+template<typename T, template<typename> class Flavor>
+const std::size_t interval_index<T, Flavor>::buffer_size;
+
+
+} // namespace index
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_INDEX_INTERVAL_INDEX_HPP
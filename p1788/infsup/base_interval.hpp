@@ -27,8 +27,18 @@
 #define LIBIEEEP1788_P1788_INFSUP_BASE_INTERVAL_HPP
 
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "p1788/infsup/forward_declaration.hpp"
+#include "p1788/infsup/unchecked.hpp"
 #include "p1788/overlapping/overlapping.hpp"
+#include "p1788/util/threads.hpp"
 
 
 
@@ -346,6 +356,97 @@ public:
     static ConcreteInterval convex_hull(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& x,
                                  base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& y);
 
+    // Result type of the range versions, only iterators over ConcreteInterval are accepted
+    template<typename InputIt>
+    using range_result = typename std::enable_if<
+                         std::is_same<typename std::decay<decltype(*std::declval<InputIt&>())>::type, ConcreteInterval>::value,
+                         ConcreteInterval>::type;
+
+    /// \brief Intersection of all intervals in the range [\p first, \p last)
+    ///
+    /// The intervals are reduced blockwise by the array version of the flavor.
+    /// A range of random access iterators with at least 2^16 elements is split
+    /// among \link p1788::util::get_num_threads() get_num_threads() \endlink threads. The
+    /// reduction stops as soon as the result can not change any more, i.e.
+    /// an empty bare interval or NaI.
+    ///
+    /// \return Entire interval if the range is empty
+    template<typename InputIt>
+    static range_result<InputIt> intersection(InputIt first, InputIt last);
+
+    /// \brief Convex hull of all intervals in the range [\p first, \p last)
+    ///
+    /// See \link intersection(InputIt,InputIt) intersection(InputIt,InputIt) \endlink.
+    ///
+    /// \return Empty interval if the range is empty
+    template<typename InputIt>
+    static range_result<InputIt> convex_hull(InputIt first, InputIt last);
+
+    /// \brief Bisection at the midpoint
+    ///
+    /// The two parts are computed by the flavor in one call without validating
+    /// them again. See the flavor for the treatment of unbounded intervals.
+    inline
+    static std::pair<ConcreteInterval, ConcreteInterval> bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    /// \brief Bisection at the point <c>(1 - ratio) * inf(x) + ratio * sup(x)</c>
+    inline
+    static std::pair<ConcreteInterval, ConcreteInterval> bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+            T ratio);
+
+    /// \brief Multisection into \p k parts of equal width which are written to \p out
+    template<typename OutputIt>
+    static OutputIt multisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x, std::size_t k, OutputIt out);
+
+private:
+
+    // output iterator converting the representations written by the flavor to
+    // ConcreteInterval, the position is advanced by the assignment
+    template<typename OutputIt>
+    struct concrete_output
+    {
+        OutputIt out;
+
+        concrete_output& operator*()
+        {
+            return *this;
+        }
+
+        concrete_output& operator++()
+        {
+            return *this;
+        }
+
+        concrete_output& operator++(int)
+        {
+            return *this;
+        }
+
+        concrete_output& operator=(representation_type const& rep)
+        {
+            *out++ = concrete_interval(rep);
+            return *this;
+        }
+    };
+
+    struct intersection_op;
+    struct convex_hull_op;
+
+    // reduces [first,last) into r, returns true if the reduction has stopped
+    // because r can not change any more, the reduction is also stopped if
+    // stop is set by another thread
+    template<typename Op, typename InputIt>
+    static bool reduce_range(InputIt first, InputIt last, representation_type& r,
+                             std::atomic<bool> const* stop);
+
+    template<typename Op, typename InputIt>
+    static representation_type reduce_range(InputIt first, InputIt last, std::input_iterator_tag);
+
+    template<typename Op, typename InputIt>
+    static representation_type reduce_range(InputIt first, InputIt last, std::random_access_iterator_tag);
+
+public:
+
 ///@}
 
 
@@ -704,6 +805,230 @@ public:
 ///@}
 
 
+// -----------------------------------------------------------------------------
+// Unchecked forward elementary functions
+// -----------------------------------------------------------------------------
+
+///@name Unchecked forward elementary functions
+///
+/// Variants of the basic arithmetic operations selected by the tag
+/// \link p1788::infsup::unchecked_t p1788::infsup::unchecked \endlink which skip the
+/// validation of the operands, see the corresponding functions of the flavor.
+///
+///@{
+
+    inline
+    static ConcreteInterval neg(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval add(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval sub(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval mul(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval div(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval recip(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                  p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval sqr(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval sqrt(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                 p1788::infsup::unchecked_t);
+
+    inline
+    static ConcreteInterval fma(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                base_interval<T, Flavor, RepType, ConcreteInterval> const& z,
+                                p1788::infsup::unchecked_t);
+
+///@}
+
+
+// -----------------------------------------------------------------------------
+// Recommended forward elementary functions
+// -----------------------------------------------------------------------------
+
+///@name Recommended forward elementary functions
+///
+///
+///@{
+
+
+    inline
+    static ConcreteInterval rootn(base_interval<T, Flavor, RepType, ConcreteInterval> const& x, int n);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval rootn(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x, int n);
+
+
+    inline
+    static ConcreteInterval expm1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval expm1(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval log1p(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval log1p(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval compoundm1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval compoundm1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& x,
+                                       base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& y);
+
+
+    inline
+    static ConcreteInterval hypot(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                  base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval hypot(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& x,
+                                  base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& y);
+
+
+    inline
+    static ConcreteInterval rsqrt(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval rsqrt(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval sinpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval sinpi(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval cospi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval cospi(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval tanpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval tanpi(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval asinpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval asinpi(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval acospi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval acospi(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval atanpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval atanpi(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval atan2pi(base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                    base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval atan2pi(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& y,
+                                    base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& x);
+
+
+///@}
+
+
+// -----------------------------------------------------------------------------
+// Compound assignment operators
+// -----------------------------------------------------------------------------
+
+///@name Compound assignment operators
+///
+/// The result is stored in the left operand by the corresponding compound
+/// assignment function of the flavor. The right-hand side may have another
+/// bound type.
+///
+///@{
+
+    inline
+    ConcreteInterval& operator+=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    ConcreteInterval& operator+=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y);
+
+    inline
+    ConcreteInterval& operator-=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    ConcreteInterval& operator-=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y);
+
+    inline
+    ConcreteInterval& operator*=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    ConcreteInterval& operator*=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y);
+
+    inline
+    ConcreteInterval& operator/=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    ConcreteInterval& operator/=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y);
+
+///@}
+
+
+
 // -----------------------------------------------------------------------------
 // Cancellative addition and subtraction
 // -----------------------------------------------------------------------------
@@ -910,6 +1235,98 @@ public:
                                     base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
                                     base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x);
 
+
+    inline
+    static ConcreteInterval pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                                     base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval pow_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+                                     base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c);
+
+    inline
+    static ConcreteInterval pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                                     base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                                     base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1,
+             typename T2, typename RepType2, class ConcreteInterval2,
+             typename T3, typename RepType3, class ConcreteInterval3>
+    inline
+    static ConcreteInterval pow_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+                                     base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+                                     base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x);
+
+
+    inline
+    static ConcreteInterval pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                                     base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval pow_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+                                     base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c);
+
+    inline
+    static ConcreteInterval pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                                     base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                                     base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1,
+             typename T2, typename RepType2, class ConcreteInterval2,
+             typename T3, typename RepType3, class ConcreteInterval3>
+    inline
+    static ConcreteInterval pow_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+                                     base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+                                     base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x);
+
+
+    inline
+    static ConcreteInterval atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval atan2_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+                                       base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c);
+
+    inline
+    static ConcreteInterval atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1,
+             typename T2, typename RepType2, class ConcreteInterval2,
+             typename T3, typename RepType3, class ConcreteInterval3>
+    inline
+    static ConcreteInterval atan2_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+                                       base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+                                       base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x);
+
+
+    inline
+    static ConcreteInterval atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+    inline
+    static ConcreteInterval atan2_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+                                       base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c);
+
+    inline
+    static ConcreteInterval atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T1, typename RepType1, class ConcreteInterval1,
+             typename T2, typename RepType2, class ConcreteInterval2,
+             typename T3, typename RepType3, class ConcreteInterval3>
+    inline
+    static ConcreteInterval atan2_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+                                       base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+                                       base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x);
+
 ///@}
 
 
@@ -928,6 +1345,106 @@ public:
     static p1788::overlapping::overlapping_state
     overlap(base_interval<T, Flavor, RepType, ConcreteInterval> const& x, base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y);
 
+    /// \brief Batched overlapping classification, <c>out[i] = overlap(x[i], y[i])</c> for <c>i = 0, ..., n-1</c>
+    ///
+    /// The representations are copied blockwise into contiguous buffers and
+    /// classified by the batched overlap of the flavor.
+    inline
+    static void overlap(ConcreteInterval const* x, ConcreteInterval const* y,
+                        p1788::overlapping::overlapping_state* out, std::size_t n);
+
+///@}
+
+
+// -----------------------------------------------------------------------------
+// Slope functions
+// -----------------------------------------------------------------------------
+
+///@name Slope functions
+///
+///
+///@{
+
+
+    inline
+    static ConcreteInterval exp_slope1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval exp_slope1(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval exp_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval exp_slope2(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval log_slope1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval log_slope1(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval log_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval log_slope2(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval cos_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval cos_slope2(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval sin_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval sin_slope3(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval asin_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval asin_slope3(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval atan_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval atan_slope3(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval cosh_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval cosh_slope2(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
+
+    inline
+    static ConcreteInterval sinh_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+    template<typename T_, typename RepType_, class ConcreteInterval_>
+    inline
+    static ConcreteInterval sinh_slope3(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& x);
+
 ///@}
 
 
@@ -1116,6 +1633,29 @@ inline
 ConcreteInterval convex_hull(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
 
+template<typename InputIt>
+inline
+auto intersection(InputIt first, InputIt last)
+-> decltype(std::decay<decltype(*first)>::type::intersection(first, last));
+
+template<typename InputIt>
+inline
+auto convex_hull(InputIt first, InputIt last)
+-> decltype(std::decay<decltype(*first)>::type::convex_hull(first, last));
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+std::pair<ConcreteInterval, ConcreteInterval> bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+std::pair<ConcreteInterval, ConcreteInterval> bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+        typename base_interval<T, Flavor, RepType, ConcreteInterval>::bound_type ratio);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval, typename OutputIt>
+inline
+OutputIt multisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x, std::size_t k, OutputIt out);
+
 ///@}
 
 
@@ -1369,6 +1909,150 @@ ConcreteInterval max(base_interval<T, Flavor, RepType, ConcreteInterval> const&
 
 
 
+///@name Unchecked forward elementary functions
+///
+///
+///@{
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval neg(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval add(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval sub(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval mul(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval div(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval recip(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                       p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval sqr(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval sqrt(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                      p1788::infsup::unchecked_t);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval fma(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& z,
+                     p1788::infsup::unchecked_t);
+
+///@}
+
+
+
+///@name Recommended forward elementary functions
+///
+///
+///@{
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval rootn(base_interval<T, Flavor, RepType, ConcreteInterval> const& x, int n);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval expm1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval log1p(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval compoundm1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval hypot(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval rsqrt(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval sinpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval cospi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval tanpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval asinpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval acospi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atanpi(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atan2pi(base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                         base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+///@}
+
+
+
 ///@name Cancellative addition and subtraction
 ///
 ///
@@ -1489,6 +2173,50 @@ ConcreteInterval mul_rev(base_interval<T, Flavor, RepType, ConcreteInterval> con
                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
                          base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
 
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
 ///@}
 
 
@@ -1508,6 +2236,55 @@ overlap(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& x, base_in
 
 
 
+///@name Slope functions
+///
+///
+///@{
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval exp_slope1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval exp_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval log_slope1(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval log_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval cos_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval sin_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval asin_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval atan_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval cosh_slope2(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+inline
+ConcreteInterval sinh_slope3(base_interval<T, Flavor, RepType, ConcreteInterval> const& x);
+
+///@}
+
+
+
 } // namespace infsup
 
 } // namespace p1788
@@ -1519,10 +2296,12 @@ overlap(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& x, base_in
 #include "p1788/infsup/base_interval_rec_bool_func_impl.hpp"
 #include "p1788/infsup/base_interval_set_op_impl.hpp"
 #include "p1788/infsup/base_interval_elem_func_impl.hpp"
+#include "p1788/infsup/base_interval_rec_elem_func_impl.hpp"
 #include "p1788/infsup/base_interval_cancel_func_impl.hpp"
 #include "p1788/infsup/base_interval_mul_rev_to_pair_func_impl.hpp"
 #include "p1788/infsup/base_interval_rev_func_impl.hpp"
 #include "p1788/infsup/base_interval_rec_overlap_impl.hpp"
+#include "p1788/infsup/base_interval_rec_slope_func_impl.hpp"
 
 
 
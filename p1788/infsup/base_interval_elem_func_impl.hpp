@@ -313,6 +313,121 @@ ConcreteInterval operator/(base_interval<T, Flavor, RepType, ConcreteInterval> c
 
 
 
+// compound assignment
+
+// operator+=
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator+=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y)
+{
+    Flavor<T>::add_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+// operator+= mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T_, typename RepType_, class ConcreteInterval_>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator+=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T_>::representation, RepType_>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T_>::representation_dec, RepType_>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    Flavor<T>::add_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+
+// operator-=
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator-=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y)
+{
+    Flavor<T>::sub_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+// operator-= mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T_, typename RepType_, class ConcreteInterval_>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator-=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T_>::representation, RepType_>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T_>::representation_dec, RepType_>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    Flavor<T>::sub_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+
+// operator*=
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator*=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y)
+{
+    Flavor<T>::mul_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+// operator*= mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T_, typename RepType_, class ConcreteInterval_>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator*=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T_>::representation, RepType_>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T_>::representation_dec, RepType_>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    Flavor<T>::mul_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+
+// operator/=
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator/=(base_interval<T, Flavor, RepType, ConcreteInterval> const& y)
+{
+    Flavor<T>::div_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+// operator/= mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T_, typename RepType_, class ConcreteInterval_>
+ConcreteInterval& base_interval<T,Flavor,RepType,ConcreteInterval>::operator/=(base_interval<T_, Flavor, RepType_, ConcreteInterval_> const& y)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T_>::representation, RepType_>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T_>::representation_dec, RepType_>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    Flavor<T>::div_assign(rep_, y.rep_);
+    return static_cast<ConcreteInterval&>(*this);
+}
+
+
+
 // recip
 
 // static
@@ -1573,6 +1688,183 @@ ConcreteInterval max(base_interval<T, Flavor, RepType, ConcreteInterval> const&
 
 
 
+// unchecked functions
+
+// neg unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::neg(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::neg(x.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval neg(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::neg(x, p1788::infsup::unchecked);
+}
+
+// add unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::add(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::add(x.rep_, y.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval add(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::add(x, y, p1788::infsup::unchecked);
+}
+
+// sub unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::sub(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::sub(x.rep_, y.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval sub(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::sub(x, y, p1788::infsup::unchecked);
+}
+
+// mul unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::mul(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::mul(x.rep_, y.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval mul(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::mul(x, y, p1788::infsup::unchecked);
+}
+
+// div unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::div(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::div(x.rep_, y.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval div(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::div(x, y, p1788::infsup::unchecked);
+}
+
+// recip unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::recip(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                         p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::recip(x.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval recip(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                       p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::recip(x, p1788::infsup::unchecked);
+}
+
+// sqr unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::sqr(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::sqr(x.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval sqr(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::sqr(x, p1788::infsup::unchecked);
+}
+
+// sqrt unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::sqrt(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                        p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::sqrt(x.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval sqrt(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                      p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::sqrt(x, p1788::infsup::unchecked);
+}
+
+// fma unchecked
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::fma(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                                                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                                                                       base_interval<T, Flavor, RepType, ConcreteInterval> const& z,
+                                                                       p1788::infsup::unchecked_t)
+{
+    return concrete_interval( Flavor<T>::fma(x.rep_, y.rep_, z.rep_, p1788::infsup::unchecked) );
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval fma(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& y,
+                     base_interval<T, Flavor, RepType, ConcreteInterval> const& z,
+                     p1788::infsup::unchecked_t)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::fma(x, y, z, p1788::infsup::unchecked);
+}
+
+
 } // namespace infsup
 
 } // namespace p1788
@@ -54,6 +54,31 @@ base_interval<T, Flavor, RepType, ConcreteInterval>::overlap(base_interval<T, Fl
     return Flavor<T>::overlap(x.rep_, y.rep_);
 }
 
+// static batched
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+void
+base_interval<T, Flavor, RepType, ConcreteInterval>::overlap(ConcreteInterval const* x, ConcreteInterval const* y,
+        p1788::overlapping::overlapping_state* out, std::size_t n)
+{
+    const std::size_t block = 256;
+
+    RepType xs[block];
+    RepType ys[block];
+
+    for (std::size_t i = 0; i < n; i += block)
+    {
+        std::size_t m = std::min(block, n - i);
+
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            xs[j] = static_cast<base_interval const&>(x[i + j]).rep_;
+            ys[j] = static_cast<base_interval const&>(y[i + j]).rep_;
+        }
+
+        Flavor<T>::overlap(xs, ys, out + i, m);
+    }
+}
+
 // function
 template<typename T1, template<typename> class Flavor, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
 p1788::overlapping::overlapping_state
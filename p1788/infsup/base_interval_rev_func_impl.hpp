@@ -647,6 +647,342 @@ ConcreteInterval mul_rev(base_interval<T, Flavor, RepType, ConcreteInterval> con
 }
 
 
+// pow_rev1
+
+// static binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return concrete_interval( Flavor<T>::pow_rev1(b.rep_, c.rep_) );
+}
+
+// static binary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::pow_rev1(b.rep_, c.rep_) );
+}
+
+// function binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev1(b, c);
+}
+
+
+// static ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return concrete_interval( Flavor<T>::pow_rev1(b.rep_, c.rep_, x.rep_) );
+}
+
+// static ternary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1,
+         typename T2, typename RepType2, class ConcreteInterval2,
+         typename T3, typename RepType3, class ConcreteInterval3>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+        base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value
+                    && std::is_same<typename Flavor<T3>::representation, RepType3>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value
+                       && std::is_same<typename Flavor<T3>::representation_dec, RepType3>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::pow_rev1(b.rep_, c.rep_, x.rep_) );
+}
+
+// function ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval pow_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev1(b, c, x);
+}
+
+
+// pow_rev2
+
+// static binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return concrete_interval( Flavor<T>::pow_rev2(a.rep_, c.rep_) );
+}
+
+// static binary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::pow_rev2(a.rep_, c.rep_) );
+}
+
+// function binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev2(a, c);
+}
+
+
+// static ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return concrete_interval( Flavor<T>::pow_rev2(a.rep_, c.rep_, x.rep_) );
+}
+
+// static ternary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1,
+         typename T2, typename RepType2, class ConcreteInterval2,
+         typename T3, typename RepType3, class ConcreteInterval3>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+        base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value
+                    && std::is_same<typename Flavor<T3>::representation, RepType3>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value
+                       && std::is_same<typename Flavor<T3>::representation_dec, RepType3>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::pow_rev2(a.rep_, c.rep_, x.rep_) );
+}
+
+// function ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval pow_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                          base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::pow_rev2(a, c, x);
+}
+
+
+// atan2_rev1
+
+// static binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return concrete_interval( Flavor<T>::atan2_rev1(b.rep_, c.rep_) );
+}
+
+// static binary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::atan2_rev1(b.rep_, c.rep_) );
+}
+
+// function binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev1(b, c);
+}
+
+
+// static ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return concrete_interval( Flavor<T>::atan2_rev1(b.rep_, c.rep_, x.rep_) );
+}
+
+// static ternary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1,
+         typename T2, typename RepType2, class ConcreteInterval2,
+         typename T3, typename RepType3, class ConcreteInterval3>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev1(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& b,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+        base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value
+                    && std::is_same<typename Flavor<T3>::representation, RepType3>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value
+                       && std::is_same<typename Flavor<T3>::representation_dec, RepType3>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::atan2_rev1(b.rep_, c.rep_, x.rep_) );
+}
+
+// function ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval atan2_rev1(base_interval<T, Flavor, RepType, ConcreteInterval> const& b,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev1(b, c, x);
+}
+
+
+// atan2_rev2
+
+// static binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return concrete_interval( Flavor<T>::atan2_rev2(a.rep_, c.rep_) );
+}
+
+// static binary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1, typename T2, typename RepType2, class ConcreteInterval2>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::atan2_rev2(a.rep_, c.rep_) );
+}
+
+// function binary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev2(a, c);
+}
+
+
+// static ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+        base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return concrete_interval( Flavor<T>::atan2_rev2(a.rep_, c.rep_, x.rep_) );
+}
+
+// static ternary mixed type
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename T1, typename RepType1, class ConcreteInterval1,
+         typename T2, typename RepType2, class ConcreteInterval2,
+         typename T3, typename RepType3, class ConcreteInterval3>
+ConcreteInterval base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev2(base_interval<T1, Flavor, RepType1, ConcreteInterval1> const& a,
+        base_interval<T2, Flavor, RepType2, ConcreteInterval2> const& c,
+        base_interval<T3, Flavor, RepType3, ConcreteInterval3> const& x)
+{
+    // assert that only bare intervals or decorated intervals are used
+    static_assert( (std::is_same<typename Flavor<T>::representation, RepType>::value
+                    && std::is_same<typename Flavor<T1>::representation, RepType1>::value
+                    && std::is_same<typename Flavor<T2>::representation, RepType2>::value
+                    && std::is_same<typename Flavor<T3>::representation, RepType3>::value)
+                   || (std::is_same<typename Flavor<T>::representation_dec, RepType>::value
+                       && std::is_same<typename Flavor<T1>::representation_dec, RepType1>::value
+                       && std::is_same<typename Flavor<T2>::representation_dec, RepType2>::value
+                       && std::is_same<typename Flavor<T3>::representation_dec, RepType3>::value),
+                   "It is not supported by mixed type operations to use "
+                   "interval and decorated_interval types together!"
+                 );
+    // call of mixed-type version
+    return concrete_interval( Flavor<T>::atan2_rev2(a.rep_, c.rep_, x.rep_) );
+}
+
+// function ternary
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+ConcreteInterval atan2_rev2(base_interval<T, Flavor, RepType, ConcreteInterval> const& a,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& c,
+                            base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::atan2_rev2(a, c, x);
+}
+
+
 
 } // namespace infsup
 
@@ -118,6 +118,248 @@ ConcreteInterval convex_hull(base_interval<T, Flavor, RepType, ConcreteInterval>
 
 
 
+
+
+// range versions
+
+// reduction of a block of representations by the array version of the flavor
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+struct base_interval<T,Flavor,RepType,ConcreteInterval>::intersection_op
+{
+    static RepType reduce(RepType const* x, std::size_t n)
+    {
+        return Flavor<T>::intersection(x, n);
+    }
+
+    // an empty bare interval is absorbing
+    static bool done(typename Flavor<T>::representation const& r,
+                     typename Flavor<T>::representation const*, std::size_t)
+    {
+        return Flavor<T>::is_empty(r);
+    }
+
+    // NaI is absorbing, an empty decorated interval is not
+    static bool done(typename Flavor<T>::representation_dec const& r,
+                     typename Flavor<T>::representation_dec const*, std::size_t)
+    {
+        return Flavor<T>::is_nai(r);
+    }
+};
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+struct base_interval<T,Flavor,RepType,ConcreteInterval>::convex_hull_op
+{
+    static RepType reduce(RepType const* x, std::size_t n)
+    {
+        return Flavor<T>::convex_hull(x, n);
+    }
+
+    // the hull of a block is only empty for an invalid operand
+    // if one of the intervals is not empty
+    static bool done(typename Flavor<T>::representation const& r,
+                     typename Flavor<T>::representation const* x, std::size_t n)
+    {
+        if (!Flavor<T>::is_empty(r))
+            return false;
+
+        for (std::size_t i = 0; i < n; ++i)
+            if (!Flavor<T>::is_empty(x[i]))
+                return true;
+
+        return false;
+    }
+
+    static bool done(typename Flavor<T>::representation_dec const& r,
+                     typename Flavor<T>::representation_dec const*, std::size_t)
+    {
+        return Flavor<T>::is_nai(r);
+    }
+};
+
+// sequential reduction
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename Op, typename InputIt>
+bool base_interval<T,Flavor,RepType,ConcreteInterval>::reduce_range(InputIt first, InputIt last,
+        representation_type& r, std::atomic<bool> const* stop)
+{
+    const std::size_t block = 256;
+
+    // the running result is kept as the first element of the next block
+    representation_type buf[block + 1];
+    std::size_t m = 0;
+
+    while (first != last)
+    {
+        for (; m <= block && first != last; ++first, ++m)
+            buf[m] = static_cast<base_interval const&>(*first).rep_;
+
+        r = Op::reduce(buf, m);
+
+        if (Op::done(r, buf, m))
+            return true;
+
+        if (stop && stop->load(std::memory_order_relaxed))
+            return false;
+
+        buf[0] = r;
+        m = 1;
+    }
+
+    // empty range
+    if (m == 0)
+        r = Op::reduce(buf, 0);
+
+    return false;
+}
+
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename Op, typename InputIt>
+RepType base_interval<T,Flavor,RepType,ConcreteInterval>::reduce_range(InputIt first, InputIt last,
+        std::input_iterator_tag)
+{
+    representation_type r;
+    reduce_range<Op>(first, last, r, nullptr);
+    return r;
+}
+
+// parallel reduction
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename Op, typename InputIt>
+RepType base_interval<T,Flavor,RepType,ConcreteInterval>::reduce_range(InputIt first, InputIt last,
+        std::random_access_iterator_tag)
+{
+    typedef typename std::iterator_traits<InputIt>::difference_type difference_type;
+
+    std::size_t const n = static_cast<std::size_t>(last - first);
+    unsigned const parts = p1788::util::num_parts(n, 1 << 16);
+
+    if (parts <= 1)
+        return reduce_range<Op>(first, last, std::input_iterator_tag());
+
+    std::vector<representation_type> partial(parts);
+    std::vector<char> done(parts, 0);
+    std::atomic<bool> stop(false);
+
+    p1788::util::parallel_parts(n, parts, [&](unsigned k, std::size_t i0, std::size_t i1)
+    {
+        if (reduce_range<Op>(first + static_cast<difference_type>(i0),
+                             first + static_cast<difference_type>(i1), partial[k], &stop))
+        {
+            done[k] = 1;
+            stop.store(true, std::memory_order_relaxed);
+        }
+    });
+
+    // the result of a stopped part is final
+    for (unsigned k = 0; k < parts; ++k)
+        if (done[k])
+            return partial[k];
+
+    return Op::reduce(partial.data(), parts);
+}
+
+
+// intersection
+
+// static range version
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename InputIt>
+typename base_interval<T,Flavor,RepType,ConcreteInterval>::template range_result<InputIt>
+base_interval<T,Flavor,RepType,ConcreteInterval>::intersection(InputIt first, InputIt last)
+{
+    return concrete_interval(reduce_range<intersection_op>(first, last,
+                             typename std::iterator_traits<InputIt>::iterator_category()));
+}
+
+// function range version
+template<typename InputIt>
+auto intersection(InputIt first, InputIt last)
+-> decltype(std::decay<decltype(*first)>::type::intersection(first, last))
+{
+    return std::decay<decltype(*first)>::type::intersection(first, last);
+}
+
+
+// convex_hull
+
+// static range version
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename InputIt>
+typename base_interval<T,Flavor,RepType,ConcreteInterval>::template range_result<InputIt>
+base_interval<T,Flavor,RepType,ConcreteInterval>::convex_hull(InputIt first, InputIt last)
+{
+    return concrete_interval(reduce_range<convex_hull_op>(first, last,
+                             typename std::iterator_traits<InputIt>::iterator_category()));
+}
+
+// function range version
+template<typename InputIt>
+auto convex_hull(InputIt first, InputIt last)
+-> decltype(std::decay<decltype(*first)>::type::convex_hull(first, last))
+{
+    return std::decay<decltype(*first)>::type::convex_hull(first, last);
+}
+
+
+
+// bisect
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+std::pair<ConcreteInterval, ConcreteInterval>
+base_interval<T,Flavor,RepType,ConcreteInterval>::bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    std::pair<representation_type, representation_type> b = Flavor<T>::bisect(x.rep_);
+
+    return std::pair<ConcreteInterval, ConcreteInterval>(concrete_interval(b.first), concrete_interval(b.second));
+}
+
+// static ratio
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+std::pair<ConcreteInterval, ConcreteInterval>
+base_interval<T,Flavor,RepType,ConcreteInterval>::bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+        T ratio)
+{
+    std::pair<representation_type, representation_type> b = Flavor<T>::bisect(x.rep_, ratio);
+
+    return std::pair<ConcreteInterval, ConcreteInterval>(concrete_interval(b.first), concrete_interval(b.second));
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+std::pair<ConcreteInterval, ConcreteInterval> bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::bisect(x);
+}
+
+// function ratio
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+std::pair<ConcreteInterval, ConcreteInterval> bisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+        typename base_interval<T, Flavor, RepType, ConcreteInterval>::bound_type ratio)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::bisect(x, ratio);
+}
+
+
+// multisect
+
+// static
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval>
+template<typename OutputIt>
+OutputIt base_interval<T,Flavor,RepType,ConcreteInterval>::multisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x,
+        std::size_t k, OutputIt out)
+{
+    return Flavor<T>::multisect(x.rep_, k, concrete_output<OutputIt> {out}).out;
+}
+
+// function
+template<typename T, template<typename> class Flavor, typename RepType, class ConcreteInterval, typename OutputIt>
+OutputIt multisect(base_interval<T, Flavor, RepType, ConcreteInterval> const& x, std::size_t k, OutputIt out)
+{
+    return base_interval<T,Flavor,RepType,ConcreteInterval>::multisect(x, k, out);
+}
+
+
 } // namespace infsup
 
 } // namespace p1788
@@ -453,6 +453,24 @@ p1788::decoration::decoration decoration(decorated_interval<T, Flavor> const& x)
     return decorated_interval<T, Flavor>::decoration(x);
 }
 
+/// \brief Batched overlapping classification
+///
+/// Computes <c>out[i] = overlap(x[i], y[i])</c> for <c>i = 0, ..., n-1</c>.
+/// The computation is delegated to the static function
+/// \link decorated_interval<T,Flavor>::overlap(decorated_interval<T, Flavor> const* x, decorated_interval<T, Flavor> const* y, p1788::overlapping::overlapping_state* out, std::size_t n) \endlink.
+///
+/// \param x array of \p n intervals
+/// \param y array of \p n intervals
+/// \param out array receiving the \p n overlapping states
+/// \param n number of pairs
+template<typename T, template<typename> class Flavor>
+inline
+void overlap(decorated_interval<T, Flavor> const* x, decorated_interval<T, Flavor> const* y,
+             p1788::overlapping::overlapping_state* out, std::size_t n)
+{
+    decorated_interval<T, Flavor>::overlap(x, y, out, n);
+}
+
 ///@}
 
 
@@ -267,6 +267,32 @@ private:
 
 
 
+///@name Bare interval specific functions
+///
+///
+///@{
+
+/// \brief Batched overlapping classification
+///
+/// Computes <c>out[i] = overlap(x[i], y[i])</c> for <c>i = 0, ..., n-1</c>.
+/// The computation is delegated to the static function
+/// \link interval<T,Flavor>::overlap(interval<T, Flavor> const* x, interval<T, Flavor> const* y, p1788::overlapping::overlapping_state* out, std::size_t n) \endlink.
+///
+/// \param x array of \p n intervals
+/// \param y array of \p n intervals
+/// \param out array receiving the \p n overlapping states
+/// \param n number of pairs
+template<typename T, template<typename> class Flavor>
+inline
+void overlap(interval<T, Flavor> const* x, interval<T, Flavor> const* y,
+             p1788::overlapping::overlapping_state* out, std::size_t n)
+{
+    interval<T, Flavor>::overlap(x, y, out, n);
+}
+
+///@}
+
+
 } // namespace infsup
 
 } // namespace p1788
@@ -0,0 +1,58 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_INFSUP_UNCHECKED_HPP
+#define LIBIEEEP1788_P1788_INFSUP_UNCHECKED_HPP
+
+
+namespace p1788
+{
+
+namespace infsup
+{
+
+
+/// \brief Tag type selecting the unchecked variant of an operation
+///
+/// The arithmetic operations which are overloaded for this tag skip the
+/// validation of their operands. The caller guarantees that every operand is a
+/// valid representation, which holds for all values produced by the
+/// constructors, the I/O functions and the operations of the library. A
+/// representation built by hand has to pass \c is_valid before it is used
+/// with an unchecked operation, otherwise the result is unspecified.
+struct unchecked_t
+{
+};
+
+/// \brief Tag value selecting the unchecked variant of an operation, see \link unchecked_t \endlink
+constexpr unchecked_t unchecked {};
+
+
+} // namespace infsup
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_INFSUP_UNCHECKED_HPP
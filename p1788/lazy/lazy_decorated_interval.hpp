@@ -0,0 +1,372 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_LAZY_LAZY_DECORATED_INTERVAL_HPP
+#define LIBIEEEP1788_P1788_LAZY_LAZY_DECORATED_INTERVAL_HPP
+
+#include <algorithm>
+#include <ostream>
+
+#include "p1788/decoration/decoration.hpp"
+#include "p1788/infsup/interval.hpp"
+#include "p1788/infsup/decorated_interval.hpp"
+
+
+namespace p1788
+{
+
+namespace lazy
+{
+
+
+/// \brief Decorated interval with a lazily computed decoration
+///
+/// Evaluation mode for long chains of decorated operations. A
+/// lazy_decorated_interval stores a bare interval together with a pending
+/// decoration, which is the minimum of the decorations of the inputs and of
+/// the domain checks of the operations applied so far. The local decoration
+/// of a result, i.e. whether it is bounded (com), unbounded (dac) or empty (trv),
+/// is not computed by the operation itself but deferred until it is observed.
+///
+/// This is exact and not only an approximation of the decorated arithmetic
+/// of the flavor. An unbounded result of <c>pos</c>, <c>neg</c>, <c>add</c>,
+/// <c>sub</c>, <c>sqr</c>, <c>sqrt</c>, <c>log</c> and <c>abs</c> always leads
+/// to an unbounded (or empty and therefore trv) result, hence the local
+/// decoration of their operands can be postponed to the end of the chain.
+/// Only operations which may map an unbounded operand to a bounded result
+/// (<c>mul</c>, <c>div</c>, <c>recip</c>, <c>exp</c>, <c>sin</c>, <c>cos</c>)
+/// settle the local decoration of their operands. Furthermore an NaI is
+/// represented by the pending decoration ill with an empty bare interval, hence
+/// no operation has to check for NaI or for an invalid representation.
+///
+/// For a chain built out of com inputs with <c>add</c>, <c>sub</c> and <c>sqr</c>
+/// an operation costs a bare operation and a <c>std::min</c> of two
+/// decorations, the common-ness is checked once by decoration() or
+/// decorated().
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+template<typename T, template<typename> class Flavor>
+class lazy_decorated_interval
+{
+public:
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+    typedef p1788::infsup::decorated_interval<T, Flavor> decorated_interval_type;
+
+
+    /// \brief Creates an empty interval, decoration trv
+    lazy_decorated_interval()
+        : bare_(), dec_(p1788::decoration::decoration::trv)
+    { }
+
+    /// \brief Creates the interval [lower, upper], NaI if the bounds are invalid
+    lazy_decorated_interval(T lower, T upper)
+        : lazy_decorated_interval(decorated_interval_type(lower, upper))
+    { }
+
+    /// \brief Creates the decorated interval \p x
+    lazy_decorated_interval(decorated_interval_type const& x)
+        : bare_(x), dec_(p1788::infsup::decoration(x))
+    { }
+
+    /// \brief Creates the bare interval \p x, the decoration is computed lazily
+    explicit lazy_decorated_interval(interval_type const& x)
+        : bare_(x), dec_(p1788::decoration::decoration::com)
+    { }
+
+    /// \brief Creates the bare interval \p x with the pending decoration \p dec
+    ///
+    /// The decoration of the result is the minimum of \p dec and the local
+    /// decoration of \p x.
+    lazy_decorated_interval(interval_type const& x, p1788::decoration::decoration dec)
+        : bare_(dec == p1788::decoration::decoration::ill ? interval_type() : x), dec_(dec)
+    { }
+
+    /// \brief Returns NaI
+    static lazy_decorated_interval nai()
+    {
+        return lazy_decorated_interval(interval_type(), p1788::decoration::decoration::ill);
+    }
+
+
+    /// \brief Bare interval part
+    interval_type const& interval_part() const
+    {
+        return bare_;
+    }
+
+    /// \brief Decoration of the inputs and operations without the local
+    /// decoration of the interval itself
+    p1788::decoration::decoration pending_decoration() const
+    {
+        return dec_;
+    }
+
+    /// \brief Decoration, the local decoration is checked once
+    p1788::decoration::decoration decoration() const
+    {
+        return std::min(dec_, local_decoration(bare_));
+    }
+
+    /// \brief Checks if the interval is NaI
+    bool is_nai() const
+    {
+        return dec_ == p1788::decoration::decoration::ill;
+    }
+
+    /// \brief Converts into a decorated interval, i.e. the decoration is computed
+    decorated_interval_type decorated() const
+    {
+        return is_nai() ? decorated_interval_type::nai() : decorated_interval_type(bare_, decoration());
+    }
+
+    /// \brief Settles the local decoration into the pending decoration
+    ///
+    /// Afterwards the pending decoration equals the decoration.
+    lazy_decorated_interval settled() const
+    {
+        return lazy_decorated_interval(bare_, decoration());
+    }
+
+
+    /// \brief Decoration of a bare result, com if bounded, trv if empty and dac otherwise
+    static p1788::decoration::decoration local_decoration(interval_type const& x)
+    {
+        return interval_type::is_common_interval(x) ? p1788::decoration::decoration::com :
+               interval_type::is_empty(x) ? p1788::decoration::decoration::trv :
+               p1788::decoration::decoration::dac;
+    }
+
+private:
+
+    interval_type bare_;
+    p1788::decoration::decoration dec_;
+};
+
+
+// -----------------------------------------------------------------------------
+// Operations with unbounded results for unbounded operands, the local
+// decoration of the operands is deferred
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> pos(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return x;
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> neg(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(-x.interval_part(), x.pending_decoration());
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> add(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return lazy_decorated_interval<T, Flavor>(x.interval_part() + y.interval_part(),
+            std::min(x.pending_decoration(), y.pending_decoration()));
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> sub(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return lazy_decorated_interval<T, Flavor>(x.interval_part() - y.interval_part(),
+            std::min(x.pending_decoration(), y.pending_decoration()));
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> sqr(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(sqr(x.interval_part()), x.pending_decoration());
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> abs(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(abs(x.interval_part()), x.pending_decoration());
+}
+
+// trv if x contains negative numbers
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> sqrt(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(sqrt(x.interval_part()),
+            inf(x.interval_part()) < 0.0 ? p1788::decoration::decoration::trv : x.pending_decoration());
+}
+
+// trv if x contains non-positive numbers
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> log(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(log(x.interval_part()),
+            inf(x.interval_part()) <= 0.0 ? p1788::decoration::decoration::trv : x.pending_decoration());
+}
+
+
+// -----------------------------------------------------------------------------
+// Operations which may have bounded results for unbounded operands, the local
+// decoration of the operands is settled
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> mul(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return lazy_decorated_interval<T, Flavor>(x.interval_part() * y.interval_part(),
+            std::min(x.decoration(), y.decoration()));
+}
+
+// trv if y contains 0
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> div(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return lazy_decorated_interval<T, Flavor>(x.interval_part() / y.interval_part(),
+            is_member(0.0, y.interval_part()) ? std::min(x.pending_decoration(), p1788::decoration::decoration::trv)
+            : std::min(x.decoration(), y.decoration()));
+}
+
+// trv if x contains 0
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> recip(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(recip(x.interval_part()),
+            is_member(0.0, x.interval_part()) ? std::min(x.pending_decoration(), p1788::decoration::decoration::trv)
+            : x.decoration());
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> exp(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(exp(x.interval_part()), x.decoration());
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> sin(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(sin(x.interval_part()), x.decoration());
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> cos(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return lazy_decorated_interval<T, Flavor>(cos(x.interval_part()), x.decoration());
+}
+
+
+// -----------------------------------------------------------------------------
+// Operators
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> operator+(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return pos(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> operator-(lazy_decorated_interval<T, Flavor> const& x)
+{
+    return neg(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> operator+(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> operator-(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> operator*(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor> operator/(lazy_decorated_interval<T, Flavor> const& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return div(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor>& operator+=(lazy_decorated_interval<T, Flavor>& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return x = add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor>& operator-=(lazy_decorated_interval<T, Flavor>& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return x = sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor>& operator*=(lazy_decorated_interval<T, Flavor>& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return x = mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline lazy_decorated_interval<T, Flavor>& operator/=(lazy_decorated_interval<T, Flavor>& x,
+        lazy_decorated_interval<T, Flavor> const& y)
+{
+    return x = div(x, y);
+}
+
+
+/// \brief Writes the decorated interval, i.e. the decoration is computed
+template<typename T, template<typename> class Flavor, typename CharT, typename Traits>
+inline std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
+        lazy_decorated_interval<T, Flavor> const& x)
+{
+    return os << x.decorated();
+}
+
+
+} // namespace lazy
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_LAZY_LAZY_DECORATED_INTERVAL_HPP
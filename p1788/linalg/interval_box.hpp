@@ -0,0 +1,661 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_LINALG_INTERVAL_BOX_HPP
+#define LIBIEEEP1788_P1788_LINALG_INTERVAL_BOX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "p1788/infsup/interval.hpp"
+#include "p1788/linalg/interval_vector.hpp"
+
+
+namespace p1788
+{
+
+namespace linalg
+{
+
+
+/// \brief Dimension of an <c>interval_box</c> which is chosen at run time
+constexpr std::size_t dynamic = std::numeric_limits<std::size_t>::max();
+
+
+/// \brief Pool for the bounds of boxes of one dimension
+///
+/// A branch-and-bound run creates and destroys a large number of short-lived
+/// boxes of the same dimension. The pool allocates the bounds of many boxes at
+/// once in one contiguous chunk and keeps the storage of a destroyed box in a
+/// free list for the next one, hence boxes created one after another are
+/// adjacent in memory and no call of the global allocator is required in the
+/// steady state. The chunks are released with the pool.
+///
+/// \note The pool is not thread-safe, use one pool per thread. It has to
+/// outlive all boxes using it.
+///
+/// \tparam T type used for the interval bounds
+///
+template<typename T>
+class box_pool
+{
+public:
+
+    /// \brief Creates a pool for boxes of dimension \p dim
+    ///
+    /// \param dim Dimension of the boxes
+    /// \param chunk_size Number of boxes allocated at once
+    explicit box_pool(std::size_t dim, std::size_t chunk_size = 1024)
+        : dim_(dim),
+          block_size_(std::max(2 * dim, (sizeof(T*) + sizeof(T) - 1) / sizeof(T))),
+          chunk_size_(std::max(chunk_size, std::size_t(1))),
+          chunks_(),
+          free_(nullptr),
+          size_(0)
+    { }
+
+    box_pool(box_pool const&) = delete;
+    box_pool& operator=(box_pool const&) = delete;
+
+
+    /// \brief Dimension of the boxes
+    std::size_t dim() const
+    {
+        return dim_;
+    }
+
+    /// \brief Number of boxes currently using the pool
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    /// \brief Number of boxes the allocated chunks can hold
+    std::size_t capacity() const
+    {
+        return chunks_.size() * chunk_size_;
+    }
+
+    /// \brief Storage for the <c>2 dim()</c> bounds of a box
+    T* allocate()
+    {
+        if (!free_)
+            grow();
+
+        T* p = free_;
+        std::memcpy(&free_, p, sizeof(T*));
+        ++size_;
+
+        return p;
+    }
+
+    /// \brief Returns the storage \p p obtained by allocate() to the pool
+    void deallocate(T* p)
+    {
+        std::memcpy(p, &free_, sizeof(T*));
+        free_ = p;
+        --size_;
+    }
+
+private:
+
+    // allocates a chunk and puts its blocks into the free list, the link to
+    // the next free block is stored in the first bytes of a block
+    void grow()
+    {
+        chunks_.emplace_back(new T[block_size_ * chunk_size_]);
+        T* c = chunks_.back().get();
+
+        // in decreasing order, hence the blocks are handed out in increasing order
+        for (std::size_t i = chunk_size_; i-- > 0; )
+        {
+            T* p = c + i * block_size_;
+            std::memcpy(p, &free_, sizeof(T*));
+            free_ = p;
+        }
+    }
+
+    std::size_t dim_;
+    std::size_t block_size_;
+    std::size_t chunk_size_;
+    std::vector<std::unique_ptr<T[]>> chunks_;
+    T* free_;
+    std::size_t size_;
+};
+
+
+// Bounds of a box of dimension N, the lower bounds followed by the upper bounds
+template<typename T, std::size_t N>
+class box_storage
+{
+public:
+
+    box_storage()
+        : bounds_()
+    { }
+
+    std::size_t size() const
+    {
+        return N;
+    }
+
+    T* bounds()
+    {
+        return bounds_.data();
+    }
+
+    T const* bounds() const
+    {
+        return bounds_.data();
+    }
+
+private:
+
+    std::array<T, 2 * N> bounds_;
+};
+
+// Bounds of a box of a dimension chosen at run time, allocated on the heap or
+// taken from a pool. A copy uses the pool of the original.
+template<typename T>
+class box_storage<T, dynamic>
+{
+public:
+
+    box_storage()
+        : n_(0), pool_(nullptr), bounds_(nullptr)
+    { }
+
+    explicit box_storage(std::size_t n)
+        : n_(n), pool_(nullptr), bounds_(n > 0 ? new T[2 * n] : nullptr)
+    { }
+
+    explicit box_storage(box_pool<T>& pool)
+        : n_(pool.dim()), pool_(&pool), bounds_(pool.allocate())
+    { }
+
+    box_storage(box_storage const& o)
+        : n_(o.n_),
+          pool_(o.pool_),
+          bounds_(o.pool_ ? o.pool_->allocate() : (o.n_ > 0 ? new T[2 * o.n_] : nullptr))
+    {
+        std::copy(o.bounds_, o.bounds_ + 2 * n_, bounds_);
+    }
+
+    box_storage(box_storage&& o)
+        : n_(o.n_), pool_(o.pool_), bounds_(o.bounds_)
+    {
+        o.n_ = 0;
+        o.pool_ = nullptr;
+        o.bounds_ = nullptr;
+    }
+
+    box_storage& operator=(box_storage const& o)
+    {
+        if (this != &o)
+        {
+            // the storage is reused for the same dimension
+            if (n_ == o.n_)
+            {
+                std::copy(o.bounds_, o.bounds_ + 2 * n_, bounds_);
+            }
+            else
+            {
+                box_storage tmp(o);
+                swap(tmp);
+            }
+        }
+
+        return *this;
+    }
+
+    box_storage& operator=(box_storage&& o)
+    {
+        swap(o);
+        return *this;
+    }
+
+    ~box_storage()
+    {
+        if (pool_)
+            pool_->deallocate(bounds_);
+        else
+            delete[] bounds_;
+    }
+
+    std::size_t size() const
+    {
+        return n_;
+    }
+
+    T* bounds()
+    {
+        return bounds_;
+    }
+
+    T const* bounds() const
+    {
+        return bounds_;
+    }
+
+private:
+
+    void swap(box_storage& o)
+    {
+        std::swap(n_, o.n_);
+        std::swap(pool_, o.pool_);
+        std::swap(bounds_, o.bounds_);
+    }
+
+    std::size_t n_;
+    box_pool<T>* pool_;
+    T* bounds_;
+};
+
+
+/// \brief Box, i.e. vector of bare intervals, with the bounds stored as a structure of arrays
+///
+/// In contrast to <c>interval_vector</c> the lower and the upper bounds of the
+/// components are stored in two separate contiguous arrays, in the
+/// representation of the flavor. Hence the numeric functions of all
+/// components (<c>wid</c>, <c>mid</c>, <c>rad</c>, <c>mag</c>, <c>mig</c>) are
+/// computed by the vectorized array versions of the flavor, and the split
+/// heuristics of a branch-and-bound method work on these arrays. The
+/// components are accessed by value.
+///
+/// For a dimension \p N fixed at compile time the bounds are stored in the box
+/// itself. For <c>N = dynamic</c> they are allocated on the heap or taken from
+/// a <c>box_pool</c>.
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+/// \tparam N dimension of the box or <c>dynamic</c>
+///
+template<typename T, template<typename> class Flavor, std::size_t N = dynamic>
+class interval_box
+{
+public:
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+
+    /// \brief Creates a box with all components empty, of dimension 0 for <c>N = dynamic</c>
+    interval_box()
+        : storage_()
+    {
+        fill(interval_type());
+    }
+
+    /// \brief Creates a box of dimension \p n with all components set to \p x, only for <c>N = dynamic</c>
+    ///
+    /// \note As for <c>interval_type</c> the default value is the empty set.
+    explicit interval_box(std::size_t n, interval_type const& x = interval_type())
+        : storage_(n)
+    {
+        fill(x);
+    }
+
+    /// \brief Creates a box of dimension <c>pool.dim()</c> using the storage of \p pool,
+    /// with all components set to \p x, only for <c>N = dynamic</c>
+    ///
+    /// Copies of the box use the pool as well.
+    explicit interval_box(box_pool<T>& pool, interval_type const& x = interval_type())
+        : storage_(pool)
+    {
+        fill(x);
+    }
+
+    /// \brief Creates a box with the components \p l
+    ///
+    /// For a fixed dimension missing components are empty and additional ones are ignored.
+    interval_box(std::initializer_list<interval_type> l)
+        : interval_box(l.begin(), l.size())
+    { }
+
+    /// \brief Creates a box with the components of \p v
+    ///
+    /// For a fixed dimension missing components are empty and additional ones are ignored.
+    explicit interval_box(interval_vector<T, Flavor> const& v)
+        : interval_box(v.data(), v.size())
+    { }
+
+
+    /// \brief Dimension of the box
+    std::size_t size() const
+    {
+        return storage_.size();
+    }
+
+    /// \brief Component \p i
+    interval_type operator[](std::size_t i) const
+    {
+        T l = inf_data()[i];
+
+        return l != l ? interval_type::empty() : interval_type(l, sup_data()[i]);
+    }
+
+    /// \brief Sets the component \p i to \p x
+    void set(std::size_t i, interval_type const& x)
+    {
+        bool e = interval_type::is_empty(x);
+
+        inf_data()[i] = e ? std::numeric_limits<T>::quiet_NaN() : interval_type::inf(x);
+        sup_data()[i] = e ? std::numeric_limits<T>::quiet_NaN() : interval_type::sup(x);
+    }
+
+    /// \brief Array of the lower bounds in the representation of the flavor, NaN for an empty component
+    T* inf_data()
+    {
+        return storage_.bounds();
+    }
+
+    T const* inf_data() const
+    {
+        return storage_.bounds();
+    }
+
+    /// \brief Array of the upper bounds in the representation of the flavor, NaN for an empty component
+    T* sup_data()
+    {
+        return storage_.bounds() + size();
+    }
+
+    T const* sup_data() const
+    {
+        return storage_.bounds() + size();
+    }
+
+private:
+
+    template<typename It>
+    interval_box(It first, std::size_t n)
+        : storage_(make_storage(n, static_cast<box_storage<T, N>*>(nullptr)))
+    {
+        std::size_t k = std::min(n, size());
+
+        for (std::size_t i = 0; i < k; ++i, ++first)
+            set(i, *first);
+
+        for (std::size_t i = k; i < size(); ++i)
+            set(i, interval_type());
+    }
+
+    static box_storage<T, dynamic> make_storage(std::size_t n, box_storage<T, dynamic>*)
+    {
+        return box_storage<T, dynamic>(n);
+    }
+
+    template<std::size_t N_>
+    static box_storage<T, N_> make_storage(std::size_t, box_storage<T, N_>*)
+    {
+        return box_storage<T, N_>();
+    }
+
+    void fill(interval_type const& x)
+    {
+        for (std::size_t i = 0; i < size(); ++i)
+            set(i, x);
+    }
+
+    box_storage<T, N> storage_;
+};
+
+
+/// \brief Componentwise equality of two boxes of the same dimension
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline bool operator==(interval_box<T, Flavor, N> const& x, interval_box<T, Flavor, N> const& y)
+{
+    if (x.size() != y.size())
+        return false;
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (x[i] != y[i])
+            return false;
+
+    return true;
+}
+
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline bool operator!=(interval_box<T, Flavor, N> const& x, interval_box<T, Flavor, N> const& y)
+{
+    return !(x == y);
+}
+
+
+// -----------------------------------------------------------------------------
+// Numeric functions of all components
+// -----------------------------------------------------------------------------
+
+/// \brief Widths of all components of the box \p x
+///
+/// \param out Array of at least <c>x.size()</c> elements, NaN for an empty component
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline void wid(interval_box<T, Flavor, N> const& x, T* out)
+{
+    Flavor<T>::wid(x.inf_data(), x.sup_data(), out, x.size());
+}
+
+/// \brief Midpoints of all components of the box \p x
+///
+/// \param out Array of at least <c>x.size()</c> elements, NaN for an empty component
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline void mid(interval_box<T, Flavor, N> const& x, T* out)
+{
+    Flavor<T>::mid(x.inf_data(), x.sup_data(), out, x.size());
+}
+
+/// \brief Radii of all components of the box \p x
+///
+/// \param out Array of at least <c>x.size()</c> elements, NaN for an empty component
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline void rad(interval_box<T, Flavor, N> const& x, T* out)
+{
+    Flavor<T>::rad(x.inf_data(), x.sup_data(), out, x.size());
+}
+
+/// \brief Magnitudes of all components of the box \p x
+///
+/// \param out Array of at least <c>x.size()</c> elements, NaN for an empty component
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline void mag(interval_box<T, Flavor, N> const& x, T* out)
+{
+    Flavor<T>::mag(x.inf_data(), x.sup_data(), out, x.size());
+}
+
+/// \brief Mignitudes of all components of the box \p x
+///
+/// \param out Array of at least <c>x.size()</c> elements, NaN for an empty component
+template<typename T, template<typename> class Flavor, std::size_t N>
+inline void mig(interval_box<T, Flavor, N> const& x, T* out)
+{
+    Flavor<T>::mig(x.inf_data(), x.sup_data(), out, x.size());
+}
+
+
+// -----------------------------------------------------------------------------
+// Split heuristics and bisection of boxes
+// -----------------------------------------------------------------------------
+
+// number of components processed at once by the heuristics, the widths of a
+// block are kept on the stack
+const std::size_t box_block_size = 64;
+
+/// \brief Index of the widest component of the box \p x
+///
+/// The first one is returned if several components have the same width, 0 is
+/// returned if all components are empty.
+template<typename T, template<typename> class Flavor, std::size_t N>
+std::size_t widest_component(interval_box<T, Flavor, N> const& x)
+{
+    T w[box_block_size];
+    T wmax = -std::numeric_limits<T>::infinity();
+    std::size_t k = 0;
+
+    for (std::size_t i0 = 0; i0 < x.size(); i0 += box_block_size)
+    {
+        std::size_t m = std::min(box_block_size, x.size() - i0);
+
+        Flavor<T>::wid(x.inf_data() + i0, x.sup_data() + i0, w, m);
+
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            if (w[i] > wmax)
+            {
+                wmax = w[i];
+                k = i0 + i;
+            }
+        }
+    }
+
+    return k;
+}
+
+/// \brief Index of the component of the box \p x with the maximal smear
+///
+/// The smear of component i is <c>wid(x[i]) * mag(g[i])</c> (Kearfott), where
+/// g[i] is an enclosure of the partial derivative of the objective or
+/// constraint function with respect to variable i over \p x, e.g.
+/// <c>p1788::ad::gradient::derivatives()</c>. The products are computed with
+/// the current rounding mode since they only serve as a heuristic.
+///
+/// The first one is returned if several components have the same smear, 0 is
+/// returned if all smears are NaN.
+///
+/// \param grad Iterator to the first of <c>x.size()</c> enclosures of the partial derivatives
+template<typename T, template<typename> class Flavor, std::size_t N, typename InputIt>
+std::size_t smear_component(interval_box<T, Flavor, N> const& x, InputIt grad)
+{
+    typedef typename interval_box<T, Flavor, N>::interval_type interval_type;
+
+    T w[box_block_size];
+    T smax = -std::numeric_limits<T>::infinity();
+    std::size_t k = 0;
+
+    for (std::size_t i0 = 0; i0 < x.size(); i0 += box_block_size)
+    {
+        std::size_t m = std::min(box_block_size, x.size() - i0);
+
+        Flavor<T>::wid(x.inf_data() + i0, x.sup_data() + i0, w, m);
+
+        for (std::size_t i = 0; i < m; ++i, ++grad)
+        {
+            // 0 * inf for a point component and an unbounded derivative
+            T s = w[i] == 0 ? T(0) : w[i] * interval_type::mag(*grad);
+
+            if (s > smax)
+            {
+                smax = s;
+                k = i0 + i;
+            }
+        }
+    }
+
+    return k;
+}
+
+/// \brief Bisects the component \p i of the box \p x at its midpoint
+///
+/// \return Pair of boxes which are equal to \p x except for the component \p i,
+/// see <c>p1788::infsup::bisect</c>. The boxes use the pool of \p x.
+template<typename T, template<typename> class Flavor, std::size_t N>
+std::pair<interval_box<T, Flavor, N>, interval_box<T, Flavor, N>> bisect(interval_box<T, Flavor, N> const& x, std::size_t i)
+{
+    typedef typename Flavor<T>::representation representation;
+
+    std::pair<representation, representation> b = Flavor<T>::bisect(representation(x.inf_data()[i], x.sup_data()[i]));
+    std::pair<interval_box<T, Flavor, N>, interval_box<T, Flavor, N>> r(x, x);
+
+    r.first.inf_data()[i] = b.first.first;
+    r.first.sup_data()[i] = b.first.second;
+    r.second.inf_data()[i] = b.second.first;
+    r.second.sup_data()[i] = b.second.second;
+
+    return r;
+}
+
+/// \brief Bisects the component \p i of the box \p x at the given ratio
+template<typename T, template<typename> class Flavor, std::size_t N>
+std::pair<interval_box<T, Flavor, N>, interval_box<T, Flavor, N>> bisect(interval_box<T, Flavor, N> const& x, std::size_t i,
+        T ratio)
+{
+    typedef typename Flavor<T>::representation representation;
+
+    std::pair<representation, representation> b = Flavor<T>::bisect(representation(x.inf_data()[i], x.sup_data()[i]), ratio);
+    std::pair<interval_box<T, Flavor, N>, interval_box<T, Flavor, N>> r(x, x);
+
+    r.first.inf_data()[i] = b.first.first;
+    r.first.sup_data()[i] = b.first.second;
+    r.second.inf_data()[i] = b.second.first;
+    r.second.sup_data()[i] = b.second.second;
+
+    return r;
+}
+
+/// \brief Bisects the widest component of the box \p x at its midpoint
+template<typename T, template<typename> class Flavor, std::size_t N>
+std::pair<interval_box<T, Flavor, N>, interval_box<T, Flavor, N>> bisect(interval_box<T, Flavor, N> const& x)
+{
+    return bisect(x, widest_component(x));
+}
+
+/// \brief Multisection of the component \p i of the box \p x into \p k parts
+///
+/// \param out Output iterator receiving the \p k boxes in increasing order of
+///            the component \p i
+template<typename T, template<typename> class Flavor, std::size_t N, class OutputIt>
+OutputIt multisect(interval_box<T, Flavor, N> const& x, std::size_t i, std::size_t k, OutputIt out)
+{
+    typedef typename Flavor<T>::representation representation;
+
+    std::vector<representation> parts;
+    parts.reserve(k);
+    Flavor<T>::multisect(representation(x.inf_data()[i], x.sup_data()[i]), k, std::back_inserter(parts));
+
+    for (auto const& p : parts)
+    {
+        interval_box<T, Flavor, N> y(x);
+        y.inf_data()[i] = p.first;
+        y.sup_data()[i] = p.second;
+        *out++ = std::move(y);
+    }
+
+    return out;
+}
+
+
+} // namespace linalg
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_LINALG_INTERVAL_BOX_HPP
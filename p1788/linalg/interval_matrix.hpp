@@ -0,0 +1,182 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_LINALG_INTERVAL_MATRIX_HPP
+#define LIBIEEEP1788_P1788_LINALG_INTERVAL_MATRIX_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include "p1788/infsup/interval.hpp"
+
+
+namespace p1788
+{
+
+namespace linalg
+{
+
+
+/// \brief Dense matrix of bare intervals
+///
+/// The components are stored in row-major order.
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+template<typename T, template<typename> class Flavor>
+class interval_matrix
+{
+public:
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+    typedef typename std::vector<interval_type>::iterator iterator;
+    typedef typename std::vector<interval_type>::const_iterator const_iterator;
+
+
+    /// \brief Creates a 0 x 0 matrix
+    interval_matrix()
+        : rows_(0), cols_(0), data_()
+    { }
+
+    /// \brief Creates a \p rows x \p cols matrix with all components set to \p x
+    ///
+    /// \note As for <c>interval_type</c> the default value is the empty set.
+    interval_matrix(std::size_t rows, std::size_t cols, interval_type const& x = interval_type())
+        : rows_(rows), cols_(cols), data_(rows * cols, x)
+    { }
+
+    /// \brief Creates a matrix out of a list of rows
+    ///
+    /// \note All rows have to be of the same length.
+    interval_matrix(std::initializer_list<std::initializer_list<interval_type>> l)
+        : rows_(l.size()), cols_(l.size() ? l.begin()->size() : 0), data_()
+    {
+        data_.reserve(rows_ * cols_);
+
+        for (auto const& r : l)
+            data_.insert(data_.end(), r.begin(), r.end());
+    }
+
+    /// \brief Identity matrix of dimension \p n
+    static interval_matrix identity(std::size_t n)
+    {
+        interval_matrix m(n, n, interval_type(0.0, 0.0));
+
+        for (std::size_t i = 0; i < n; ++i)
+            m(i, i) = interval_type(1.0, 1.0);
+
+        return m;
+    }
+
+
+    std::size_t rows() const
+    {
+        return rows_;
+    }
+
+    std::size_t cols() const
+    {
+        return cols_;
+    }
+
+    interval_type& operator()(std::size_t i, std::size_t j)
+    {
+        return data_[i * cols_ + j];
+    }
+
+    interval_type const& operator()(std::size_t i, std::size_t j) const
+    {
+        return data_[i * cols_ + j];
+    }
+
+    iterator begin()
+    {
+        return data_.begin();
+    }
+
+    iterator end()
+    {
+        return data_.end();
+    }
+
+    const_iterator begin() const
+    {
+        return data_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return data_.end();
+    }
+
+    interval_type* data()
+    {
+        return data_.data();
+    }
+
+    interval_type const* data() const
+    {
+        return data_.data();
+    }
+
+private:
+
+    std::size_t rows_;
+    std::size_t cols_;
+    std::vector<interval_type> data_;
+};
+
+
+/// \brief Componentwise equality of two matrices of the same dimensions
+template<typename T, template<typename> class Flavor>
+inline bool operator==(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+        return false;
+
+    for (auto i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j)
+        if (*i != *j)
+            return false;
+
+    return true;
+}
+
+template<typename T, template<typename> class Flavor>
+inline bool operator!=(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    return !(a == b);
+}
+
+
+} // namespace linalg
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_LINALG_INTERVAL_MATRIX_HPP
@@ -0,0 +1,154 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_LINALG_INTERVAL_VECTOR_HPP
+#define LIBIEEEP1788_P1788_LINALG_INTERVAL_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include "p1788/infsup/interval.hpp"
+
+
+namespace p1788
+{
+
+namespace linalg
+{
+
+
+/// \brief Vector of bare intervals
+///
+/// \tparam T type used for the interval bounds
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+template<typename T, template<typename> class Flavor>
+class interval_vector
+{
+public:
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+    typedef typename std::vector<interval_type>::iterator iterator;
+    typedef typename std::vector<interval_type>::const_iterator const_iterator;
+
+
+    /// \brief Creates a vector of size 0
+    interval_vector()
+        : data_()
+    { }
+
+    /// \brief Creates a vector of size \p n with all components set to \p x
+    ///
+    /// \note As for <c>interval_type</c> the default value is the empty set.
+    explicit interval_vector(std::size_t n, interval_type const& x = interval_type())
+        : data_(n, x)
+    { }
+
+    interval_vector(std::initializer_list<interval_type> l)
+        : data_(l)
+    { }
+
+
+    std::size_t size() const
+    {
+        return data_.size();
+    }
+
+    interval_type& operator[](std::size_t i)
+    {
+        return data_[i];
+    }
+
+    interval_type const& operator[](std::size_t i) const
+    {
+        return data_[i];
+    }
+
+    iterator begin()
+    {
+        return data_.begin();
+    }
+
+    iterator end()
+    {
+        return data_.end();
+    }
+
+    const_iterator begin() const
+    {
+        return data_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return data_.end();
+    }
+
+    interval_type* data()
+    {
+        return data_.data();
+    }
+
+    interval_type const* data() const
+    {
+        return data_.data();
+    }
+
+private:
+
+    std::vector<interval_type> data_;
+};
+
+
+/// \brief Componentwise equality of two vectors of the same size
+template<typename T, template<typename> class Flavor>
+inline bool operator==(interval_vector<T, Flavor> const& x, interval_vector<T, Flavor> const& y)
+{
+    if (x.size() != y.size())
+        return false;
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (x[i] != y[i])
+            return false;
+
+    return true;
+}
+
+template<typename T, template<typename> class Flavor>
+inline bool operator!=(interval_vector<T, Flavor> const& x, interval_vector<T, Flavor> const& y)
+{
+    return !(x == y);
+}
+
+
+} // namespace linalg
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_LINALG_INTERVAL_VECTOR_HPP
@@ -0,0 +1,585 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_LINALG_LINALG_HPP
+#define LIBIEEEP1788_P1788_LINALG_LINALG_HPP
+
+#include <algorithm>
+#include <cfenv>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "p1788/linalg/interval_vector.hpp"
+#include "p1788/linalg/interval_matrix.hpp"
+#include "p1788/util/threads.hpp"
+
+
+namespace p1788
+{
+
+namespace linalg
+{
+
+
+// -----------------------------------------------------------------------------
+// Threads
+// -----------------------------------------------------------------------------
+
+// splits the rows [0,m) among the threads and calls f(i0, i1) for every part,
+// work is the number of floating-point operations and decides whether it pays
+// off to start threads at all, an exception thrown by f is rethrown in the
+// calling thread
+template<class Func>
+void parallel_rows(std::size_t m, double work, Func f)
+{
+    unsigned t = work < (1 << 18) ? 1 : p1788::util::effective_num_threads();
+
+    t = static_cast<unsigned>(std::min<std::size_t>(t, m));
+
+    p1788::util::parallel_parts(m, t, [&f](unsigned, std::size_t i0, std::size_t i1)
+    {
+        f(i0, i1);
+    });
+}
+
+
+// -----------------------------------------------------------------------------
+// Midpoint-radius kernel
+// -----------------------------------------------------------------------------
+
+// Matrix in midpoint-radius form with an additional copy of |mid|, row-major
+template<typename T>
+struct midrad_matrix
+{
+    std::size_t rows;
+    std::size_t cols;
+    std::vector<T> mid;
+    std::vector<T> abs_mid;
+    std::vector<T> rad;
+};
+
+// upper bound of a nonnegative result computed with rounding to nearest
+template<typename T>
+inline T next_up(T x)
+{
+    return std::nextafter(x, std::numeric_limits<T>::infinity());
+}
+
+template<typename T>
+inline T next_down(T x)
+{
+    return std::nextafter(x, -std::numeric_limits<T>::infinity());
+}
+
+// true if the native operations round to nearest in the format of T, the
+// error bounds of the midpoint-radius kernel are only valid in this case
+template<typename T>
+inline bool native_round_to_nearest()
+{
+    return std::numeric_limits<T>::radix == 2 && FLT_EVAL_METHOD == 0 && std::fegetround() == FE_TONEAREST;
+}
+
+// converts the intervals [begin,end) to midpoint-radius form, returns false
+// for empty or unbounded intervals
+template<typename T, class Iter>
+bool to_midrad(Iter begin, Iter end, std::size_t rows, std::size_t cols, midrad_matrix<T>& m)
+{
+    typedef typename std::iterator_traits<Iter>::value_type interval_type;
+
+    m.rows = rows;
+    m.cols = cols;
+    m.mid.resize(rows * cols);
+    m.abs_mid.resize(rows * cols);
+    m.rad.resize(rows * cols);
+
+    std::size_t k = 0;
+
+    for (Iter i = begin; i != end; ++i, ++k)
+    {
+        T l = interval_type::inf(*i);
+        T u = interval_type::sup(*i);
+
+        if (!(std::isfinite(l) && std::isfinite(u)))
+            return false;
+
+        if (l == u)
+        {
+            m.mid[k] = l;
+            m.rad[k] = 0;
+        }
+        else
+        {
+            T c = l * static_cast<T>(0.5) + u * static_cast<T>(0.5);
+            T r = std::max(next_up(u - c), next_up(c - l));
+
+            if (!std::isfinite(r))
+                return false;
+
+            m.mid[k] = c;
+            m.rad[k] = r;
+        }
+
+        m.abs_mid[k] = std::abs(m.mid[k]);
+    }
+
+    return true;
+}
+
+// rows [i0,i1) of C = A * B computed with rounding to nearest
+//
+// cm = mid(A) * mid(B)
+// cs = |mid(A)| * |mid(B)|
+// cr = rad(A) * bp + |mid(A)| * rad(B)     with bp >= |mid(B)| + rad(B)
+//
+// The loops are blocked to keep a panel of B and the rows of C in cache.
+template<typename T>
+void midrad_kernel(midrad_matrix<T> const& a, midrad_matrix<T> const& b, std::vector<T> const& bp,
+                   std::vector<T>& cm, std::vector<T>& cs, std::vector<T>& cr,
+                   std::size_t i0, std::size_t i1)
+{
+    const std::size_t kb = 64;      // block size of the inner dimension
+    const std::size_t jb = 128;     // block size of the columns of C
+
+    std::size_t const k = a.cols;
+    std::size_t const n = b.cols;
+
+    for (std::size_t kk = 0; kk < k; kk += kb)
+    {
+        std::size_t const ke = std::min(kk + kb, k);
+
+        for (std::size_t jj = 0; jj < n; jj += jb)
+        {
+            std::size_t const je = std::min(jj + jb, n);
+
+            for (std::size_t i = i0; i < i1; ++i)
+            {
+                T* __restrict pm = cm.data() + i * n;
+                T* __restrict ps = cs.data() + i * n;
+                T* __restrict pr = cr.data() + i * n;
+
+                for (std::size_t l = kk; l < ke; ++l)
+                {
+                    T const am = a.mid[i * k + l];
+                    T const aa = a.abs_mid[i * k + l];
+                    T const ar = a.rad[i * k + l];
+
+                    T const* __restrict bm = b.mid.data() + l * n;
+                    T const* __restrict ba = b.abs_mid.data() + l * n;
+                    T const* __restrict br = b.rad.data() + l * n;
+                    T const* __restrict bb = bp.data() + l * n;
+
+                    for (std::size_t j = jj; j < je; ++j)
+                    {
+                        pm[j] += am * bm[j];
+                        ps[j] += aa * ba[j];
+                        pr[j] += ar * bb[j] + aa * br[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Enclosure of A * B in midpoint-radius arithmetic (Rump) with a priori error
+// bounds for the floating-point products computed with rounding to nearest.
+//
+// With u = eps/2, eta = denorm_min and k the inner dimension the computed
+// dot products satisfy
+//
+//   |cm - mid(A) mid(B)| <= gamma_k |mid(A)| |mid(B)| + k eta
+//   |mid(A)| |mid(B)|    <= (cs + k eta) (1 + 2ku)
+//   rad(A) (|mid(B)| + rad(B)) + |mid(A)| rad(B) <= (cr + 2k eta) (1 + 4ku)
+//
+// for 4ku <= 1/2 and gamma_k <= ku (1 + 2ku). The radius of the result
+// is the sum of these bounds, evaluated with upward rounding emulated by
+// next_up. Returns false on overflow, the result is then unspecified.
+template<typename T>
+bool midrad_mul(midrad_matrix<T> const& a, midrad_matrix<T> const& b, std::vector<T>& lower, std::vector<T>& upper)
+{
+    std::size_t const m = a.rows;
+    std::size_t const k = a.cols;
+    std::size_t const n = b.cols;
+
+    T const u = std::numeric_limits<T>::epsilon() / 2;
+    T const eta = std::numeric_limits<T>::denorm_min();
+
+    T const ku = next_up(static_cast<T>(k) * u);
+
+    if (!(4 * ku <= static_cast<T>(0.5)))
+        return false;
+
+    // |mid(B)| + rad(B) rounded upward
+    std::vector<T> bp(b.mid.size());
+    for (std::size_t i = 0; i < bp.size(); ++i)
+        bp[i] = b.rad[i] == 0 ? b.abs_mid[i] : next_up(b.abs_mid[i] + b.rad[i]);
+
+    std::vector<T> cm(m * n, 0);
+    std::vector<T> cs(m * n, 0);
+    std::vector<T> cr(m * n, 0);
+
+    parallel_rows(m, static_cast<double>(m) * n * k, [&](std::size_t i0, std::size_t i1)
+    {
+        midrad_kernel(a, b, bp, cm, cs, cr, i0, i1);
+    });
+
+    T const keta = next_up(static_cast<T>(k) * eta);
+    T const c1 = next_up(1 + next_up(2 * ku));
+    T const c2 = next_up(1 + next_up(4 * ku));
+    T const gamma = next_up(ku * c1);
+
+    lower.resize(m * n);
+    upper.resize(m * n);
+
+    for (std::size_t i = 0; i < m * n; ++i)
+    {
+        T s = next_up(next_up(cs[i] + keta) * c1);
+        T r = next_up(next_up(cr[i] + 2 * keta) * c2);
+
+        r = next_up(next_up(r + next_up(gamma * s)) + keta);
+
+        lower[i] = next_down(cm[i] - r);
+        upper[i] = next_up(cm[i] + r);
+
+        if (!(std::isfinite(lower[i]) && std::isfinite(upper[i])))
+            return false;
+    }
+
+    return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Products
+// -----------------------------------------------------------------------------
+
+/// \brief Inf-sup reference of the matrix product \p a * \p b
+///
+/// Every component is accumulated with the interval operations <c>mul</c> and
+/// <c>add</c> of the flavor.
+///
+/// \note The number of columns of \p a has to be equal to the number of rows of \p b.
+template<typename T, template<typename> class Flavor>
+interval_matrix<T, Flavor> mul_infsup(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    typedef typename interval_matrix<T, Flavor>::interval_type interval_type;
+
+    interval_matrix<T, Flavor> c(a.rows(), b.cols(), interval_type(0.0, 0.0));
+
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t l = 0; l < a.cols(); ++l)
+            for (std::size_t j = 0; j < b.cols(); ++j)
+                c(i, j) = interval_type::add(c(i, j), interval_type::mul(a(i, l), b(l, j)));
+
+    return c;
+}
+
+/// \brief Inf-sup reference of the matrix-vector product \p a * \p x
+///
+/// \note The number of columns of \p a has to be equal to the size of \p x.
+template<typename T, template<typename> class Flavor>
+interval_vector<T, Flavor> mul_infsup(interval_matrix<T, Flavor> const& a, interval_vector<T, Flavor> const& x)
+{
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    interval_vector<T, Flavor> y(a.rows(), interval_type(0.0, 0.0));
+
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t l = 0; l < a.cols(); ++l)
+            y[i] = interval_type::add(y[i], interval_type::mul(a(i, l), x[l]));
+
+    return y;
+}
+
+/// \brief Matrix product \p a * \p b
+///
+/// The product is computed in midpoint-radius arithmetic with native floating-point
+/// operations (rounding to nearest) and rigorous bounds for the rounding errors,
+/// following S. M. Rump, Fast interval matrix multiplication, Numer. Algorithms 61 (2012).
+/// The loops are cache blocked and, for large matrices, the rows of the result are
+/// distributed among p1788::util::get_num_threads() threads. The result encloses the result
+/// of mul_infsup() and is wider by a factor of at most about 1.5.
+///
+/// If a component is empty or unbounded, an overflow occurs or the native
+/// operations do not round to nearest (e.g. the rounding mode is changed), the
+/// inf-sup reference mul_infsup() is used.
+///
+/// \note The number of columns of \p a has to be equal to the number of rows of \p b.
+template<typename T, template<typename> class Flavor>
+interval_matrix<T, Flavor> mul(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    static_assert(std::numeric_limits<T>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    typedef typename interval_matrix<T, Flavor>::interval_type interval_type;
+
+    midrad_matrix<T> ma;
+    midrad_matrix<T> mb;
+    std::vector<T> lower;
+    std::vector<T> upper;
+
+    if (a.cols() == 0
+            || !native_round_to_nearest<T>()
+            || !to_midrad(a.begin(), a.end(), a.rows(), a.cols(), ma)
+            || !to_midrad(b.begin(), b.end(), b.rows(), b.cols(), mb)
+            || !midrad_mul(ma, mb, lower, upper))
+        return mul_infsup(a, b);
+
+    interval_matrix<T, Flavor> c(a.rows(), b.cols());
+
+    for (std::size_t i = 0; i < lower.size(); ++i)
+        c.data()[i] = interval_type(lower[i], upper[i]);
+
+    return c;
+}
+
+/// \brief Matrix-vector product \p a * \p x
+///
+/// Computed as mul(interval_matrix, interval_matrix) with a single column.
+///
+/// \note The number of columns of \p a has to be equal to the size of \p x.
+template<typename T, template<typename> class Flavor>
+interval_vector<T, Flavor> mul(interval_matrix<T, Flavor> const& a, interval_vector<T, Flavor> const& x)
+{
+    static_assert(std::numeric_limits<T>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    midrad_matrix<T> ma;
+    midrad_matrix<T> mx;
+    std::vector<T> lower;
+    std::vector<T> upper;
+
+    if (a.cols() == 0
+            || !native_round_to_nearest<T>()
+            || !to_midrad(a.begin(), a.end(), a.rows(), a.cols(), ma)
+            || !to_midrad(x.begin(), x.end(), x.size(), 1, mx)
+            || !midrad_mul(ma, mx, lower, upper))
+        return mul_infsup(a, x);
+
+    interval_vector<T, Flavor> y(a.rows());
+
+    for (std::size_t i = 0; i < lower.size(); ++i)
+        y[i] = interval_type(lower[i], upper[i]);
+
+    return y;
+}
+
+template<typename T, template<typename> class Flavor>
+inline interval_matrix<T, Flavor> operator*(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    return mul(a, b);
+}
+
+template<typename T, template<typename> class Flavor>
+inline interval_vector<T, Flavor> operator*(interval_matrix<T, Flavor> const& a, interval_vector<T, Flavor> const& x)
+{
+    return mul(a, x);
+}
+
+
+// -----------------------------------------------------------------------------
+// Componentwise operations
+// -----------------------------------------------------------------------------
+
+/// \brief Componentwise sum of two vectors of the same size
+template<typename T, template<typename> class Flavor>
+interval_vector<T, Flavor> add(interval_vector<T, Flavor> const& x, interval_vector<T, Flavor> const& y)
+{
+    interval_vector<T, Flavor> z(x.size());
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        z[i] = x[i] + y[i];
+
+    return z;
+}
+
+/// \brief Componentwise difference of two vectors of the same size
+template<typename T, template<typename> class Flavor>
+interval_vector<T, Flavor> sub(interval_vector<T, Flavor> const& x, interval_vector<T, Flavor> const& y)
+{
+    interval_vector<T, Flavor> z(x.size());
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        z[i] = x[i] - y[i];
+
+    return z;
+}
+
+/// \brief Componentwise sum of two matrices of the same dimensions
+template<typename T, template<typename> class Flavor>
+interval_matrix<T, Flavor> add(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    interval_matrix<T, Flavor> c(a.rows(), a.cols());
+
+    for (std::size_t i = 0; i < a.rows() * a.cols(); ++i)
+        c.data()[i] = a.data()[i] + b.data()[i];
+
+    return c;
+}
+
+/// \brief Componentwise difference of two matrices of the same dimensions
+template<typename T, template<typename> class Flavor>
+interval_matrix<T, Flavor> sub(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    interval_matrix<T, Flavor> c(a.rows(), a.cols());
+
+    for (std::size_t i = 0; i < a.rows() * a.cols(); ++i)
+        c.data()[i] = a.data()[i] - b.data()[i];
+
+    return c;
+}
+
+template<typename T, template<typename> class Flavor>
+inline interval_vector<T, Flavor> operator+(interval_vector<T, Flavor> const& x, interval_vector<T, Flavor> const& y)
+{
+    return add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline interval_vector<T, Flavor> operator-(interval_vector<T, Flavor> const& x, interval_vector<T, Flavor> const& y)
+{
+    return sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline interval_matrix<T, Flavor> operator+(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    return add(a, b);
+}
+
+template<typename T, template<typename> class Flavor>
+inline interval_matrix<T, Flavor> operator-(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b)
+{
+    return sub(a, b);
+}
+
+
+
+// -----------------------------------------------------------------------------
+// Bisection of boxes
+// -----------------------------------------------------------------------------
+
+/// \brief Index of the widest component of the box \p x
+///
+/// The first one is returned if several components have the same width, 0 is
+/// returned if all components are empty.
+template<typename T, template<typename> class Flavor>
+std::size_t widest_component(interval_vector<T, Flavor> const& x)
+{
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    std::size_t k = 0;
+    T w = -std::numeric_limits<T>::infinity();
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        T wi = interval_type::wid(x[i]);
+
+        if (wi > w)
+        {
+            w = wi;
+            k = i;
+        }
+    }
+
+    return k;
+}
+
+/// \brief Bisects the component \p i of the box \p x at its midpoint
+///
+/// \return Pair of boxes which are equal to \p x except for the component \p i,
+/// see <c>p1788::infsup::bisect</c>
+template<typename T, template<typename> class Flavor>
+std::pair<interval_vector<T, Flavor>, interval_vector<T, Flavor>> bisect(interval_vector<T, Flavor> const& x, std::size_t i)
+{
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    std::pair<interval_type, interval_type> b = interval_type::bisect(x[i]);
+    std::pair<interval_vector<T, Flavor>, interval_vector<T, Flavor>> r(x, x);
+
+    r.first[i] = b.first;
+    r.second[i] = b.second;
+
+    return r;
+}
+
+/// \brief Bisects the component \p i of the box \p x at the given ratio
+template<typename T, template<typename> class Flavor>
+std::pair<interval_vector<T, Flavor>, interval_vector<T, Flavor>> bisect(interval_vector<T, Flavor> const& x, std::size_t i,
+        T ratio)
+{
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    std::pair<interval_type, interval_type> b = interval_type::bisect(x[i], ratio);
+    std::pair<interval_vector<T, Flavor>, interval_vector<T, Flavor>> r(x, x);
+
+    r.first[i] = b.first;
+    r.second[i] = b.second;
+
+    return r;
+}
+
+/// \brief Bisects the widest component of the box \p x at its midpoint
+template<typename T, template<typename> class Flavor>
+std::pair<interval_vector<T, Flavor>, interval_vector<T, Flavor>> bisect(interval_vector<T, Flavor> const& x)
+{
+    return bisect(x, widest_component(x));
+}
+
+/// \brief Multisection of the component \p i of the box \p x into \p k parts
+///
+/// \param out Output iterator receiving the \p k boxes in increasing order of
+///            the component \p i
+template<typename T, template<typename> class Flavor, class OutputIt>
+OutputIt multisect(interval_vector<T, Flavor> const& x, std::size_t i, std::size_t k, OutputIt out)
+{
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    std::vector<interval_type> parts;
+    parts.reserve(k);
+    interval_type::multisect(x[i], k, std::back_inserter(parts));
+
+    for (auto const& p : parts)
+    {
+        interval_vector<T, Flavor> y(x);
+        y[i] = p;
+        *out++ = std::move(y);
+    }
+
+    return out;
+}
+
+
+} // namespace linalg
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_LINALG_LINALG_HPP
@@ -0,0 +1,357 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_LINALG_VERIFY_SOLVE_HPP
+#define LIBIEEEP1788_P1788_LINALG_VERIFY_SOLVE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "p1788/linalg/linalg.hpp"
+
+
+namespace p1788
+{
+
+namespace linalg
+{
+
+
+/// \brief Iterations used by verify_solve() to tighten a verified enclosure
+enum class solve_method
+{
+    krawczyk,       ///< Krawczyk iteration <c>E := E</c> &cap; <c>(Z + (I - RA) E)</c>
+    gauss_seidel    ///< Interval Gauss-Seidel sweeps on the preconditioned system <c>RA E = Z</c>
+};
+
+
+// -----------------------------------------------------------------------------
+// Preconditioner
+// -----------------------------------------------------------------------------
+
+// approximate inverse of the n x n matrix a (row-major) computed with rounding
+// to nearest by an LU decomposition with partial pivoting. The columns of the
+// inverse are computed in parallel. Returns false for a zero pivot or overflow.
+template<typename T>
+bool approximate_inverse(std::vector<T> a, std::size_t n, std::vector<T>& r)
+{
+    std::vector<std::size_t> p(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+        p[i] = i;
+
+    // P a = L U, L is stored below the diagonal with an implicit unit diagonal
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        std::size_t piv = k;
+
+        for (std::size_t i = k + 1; i < n; ++i)
+            if (std::abs(a[i * n + k]) > std::abs(a[piv * n + k]))
+                piv = i;
+
+        if (!(a[piv * n + k] != 0 && std::isfinite(a[piv * n + k])))
+            return false;
+
+        if (piv != k)
+        {
+            std::swap_ranges(a.begin() + k * n, a.begin() + (k + 1) * n, a.begin() + piv * n);
+            std::swap(p[k], p[piv]);
+        }
+
+        for (std::size_t i = k + 1; i < n; ++i)
+        {
+            T const f = a[i * n + k] /= a[k * n + k];
+
+            for (std::size_t j = k + 1; j < n; ++j)
+                a[i * n + j] -= f * a[k * n + j];
+        }
+    }
+
+    r.assign(n * n, 0);
+
+    // column j of the inverse solves L U x = P e_j
+    parallel_rows(n, 2.0 * n * n * n, [&](std::size_t j0, std::size_t j1)
+    {
+        std::vector<T> x(n);
+
+        for (std::size_t j = j0; j < j1; ++j)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] = p[i] == j ? 1 : 0;
+
+                for (std::size_t l = 0; l < i; ++l)
+                    x[i] -= a[i * n + l] * x[l];
+            }
+
+            for (std::size_t i = n; i-- > 0; )
+            {
+                for (std::size_t l = i + 1; l < n; ++l)
+                    x[i] -= a[i * n + l] * x[l];
+
+                x[i] /= a[i * n + i];
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+                r[i * n + j] = x[i];
+        }
+    });
+
+    for (T v : r)
+        if (!std::isfinite(v))
+            return false;
+
+    return true;
+}
+
+// y = a * x with rounding to nearest, a is n x n
+template<typename T>
+void approximate_mul(std::vector<T> const& a, std::vector<T> const& x, std::vector<T>& y)
+{
+    std::size_t const n = x.size();
+
+    y.assign(n, 0);
+
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            y[i] += a[i * n + j] * x[j];
+}
+
+
+// products of the verification, the midpoint-radius products mul() if the
+// native operations round to nearest and the inf-sup references otherwise
+template<typename T, template<typename> class Flavor>
+interval_matrix<T, Flavor> verify_mul(interval_matrix<T, Flavor> const& a, interval_matrix<T, Flavor> const& b,
+                                      bool native)
+{
+    return native ? mul(a, b) : mul_infsup(a, b);
+}
+
+template<typename T, template<typename> class Flavor>
+interval_vector<T, Flavor> verify_mul(interval_matrix<T, Flavor> const& a, interval_vector<T, Flavor> const& x,
+                                      bool native)
+{
+    return native ? mul(a, x) : mul_infsup(a, x);
+}
+
+
+// -----------------------------------------------------------------------------
+// Verified solver
+// -----------------------------------------------------------------------------
+
+/// \brief Enclosure of the solution set of the interval linear system \p a x = \p b
+///
+/// Computes an enclosure of { x | A x = b for some A in \p a and b in \p b }
+/// following S. M. Rump, Verification methods: Rigorous results using
+/// floating-point arithmetic, Acta Numerica 19 (2010):
+///
+/// -# An approximate inverse R of mid(\p a) and an approximate solution xs
+///    with one step of iterative refinement are computed in floating-point
+///    arithmetic. The columns of R are computed in parallel.
+/// -# The residual Z = R (\p b - \p a xs) and the matrix C = I - R \p a are
+///    enclosed with the (multi-threaded) products mul().
+/// -# A Krawczyk iteration E := Z + C E with epsilon inflation searches
+///    for a box E with Z + C E in the interior of E. Success proves that
+///    every matrix in \p a is nonsingular and that the solution set is
+///    contained in xs + E.
+/// -# The error enclosure E is tightened with \p method, combining the
+///    old and the new enclosure by <c>intersection</c>.
+///
+/// \param a square matrix
+/// \param b right hand side of the same dimension
+/// \param x is set to the enclosure xs + E, or to entire intervals if the
+///          verification fails
+/// \param method iteration used in step 4
+/// \return true if the enclosure could be verified. False if a component of
+///         \p a or \p b is not a nonempty bounded interval, mid(\p a) is
+///         numerically singular or the iteration does not succeed, which is
+///         typically the case for ill-conditioned or too wide systems.
+///
+/// If the native operations do not round to nearest, e.g. because the rounding
+/// mode is changed, the enclosures of step 2 and 3 are computed with the
+/// inf-sup references mul_infsup() instead of mul(). The results of step 1
+/// are only approximations and do not affect the verification.
+template<typename T, template<typename> class Flavor>
+bool verify_solve(interval_matrix<T, Flavor> const& a, interval_vector<T, Flavor> const& b,
+                  interval_vector<T, Flavor>& x, solve_method method = solve_method::krawczyk)
+{
+    static_assert(std::numeric_limits<T>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    typedef typename interval_vector<T, Flavor>::interval_type interval_type;
+
+    std::size_t const n = b.size();
+
+    // the error bounds of the midpoint-radius products require rounding to nearest
+    bool const native = native_round_to_nearest<T>();
+
+    x = interval_vector<T, Flavor>(n, interval_type::entire());
+
+    std::vector<T> am(n * n);
+    std::vector<T> bm(n);
+
+    for (std::size_t i = 0; i < n * n; ++i)
+    {
+        if (!interval_type::is_common_interval(a.data()[i]))
+            return false;
+
+        am[i] = interval_type::mid(a.data()[i]);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (!interval_type::is_common_interval(b[i]))
+            return false;
+
+        bm[i] = interval_type::mid(b[i]);
+    }
+
+    // approximate inverse and solution
+    std::vector<T> r;
+
+    if (!approximate_inverse(am, n, r))
+        return false;
+
+    std::vector<T> xs;
+    std::vector<T> t;
+    std::vector<T> d;
+
+    approximate_mul(r, bm, xs);
+    approximate_mul(am, xs, t);
+
+    for (std::size_t i = 0; i < n; ++i)
+        t[i] = bm[i] - t[i];
+
+    approximate_mul(r, t, d);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        xs[i] += d[i];
+
+        if (!std::isfinite(xs[i]))
+            return false;
+    }
+
+    // Z = R (b - A xs) and C = I - R A
+    interval_matrix<T, Flavor> ri(n, n);
+    interval_vector<T, Flavor> xi(n);
+
+    for (std::size_t i = 0; i < n * n; ++i)
+        ri.data()[i] = interval_type(r[i], r[i]);
+
+    for (std::size_t i = 0; i < n; ++i)
+        xi[i] = interval_type(xs[i], xs[i]);
+
+    interval_vector<T, Flavor> z = verify_mul(ri, sub(b, verify_mul(a, xi, native)), native);
+    interval_matrix<T, Flavor> ra = verify_mul(ri, a, native);
+    interval_matrix<T, Flavor> c = sub(interval_matrix<T, Flavor>::identity(n), ra);
+
+    // Krawczyk iteration with epsilon inflation
+    interval_type const inflation(static_cast<T>(0.9), static_cast<T>(1.1));
+    interval_type const tiny(-std::numeric_limits<T>::min(), std::numeric_limits<T>::min());
+
+    interval_vector<T, Flavor> e = z;
+    bool verified = false;
+
+    for (int k = 0; k < 15 && !verified; ++k)
+    {
+        interval_vector<T, Flavor> y(n);
+
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = e[i] * inflation + tiny;
+
+        e = add(z, verify_mul(c, y, native));
+
+        verified = true;
+
+        for (std::size_t i = 0; i < n && verified; ++i)
+            verified = interval_type::interior(e[i], y[i]);
+    }
+
+    if (!verified)
+        return false;
+
+    // tighten the enclosure of the error
+    for (int k = 0; k < 10; ++k)
+    {
+        interval_vector<T, Flavor> old = e;
+
+        if (method == solve_method::krawczyk)
+        {
+            interval_vector<T, Flavor> f = add(z, verify_mul(c, e, native));
+
+            for (std::size_t i = 0; i < n; ++i)
+                e[i] = interval_type::intersection(e[i], f[i]);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                interval_type s = z[i];
+
+                for (std::size_t j = 0; j < n; ++j)
+                    if (j != i)
+                        s -= ra(i, j) * e[j];
+
+                e[i] = interval_type::intersection(e[i], s / ra(i, i));
+            }
+        }
+
+        if (e == old)
+            break;
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+        x[i] = xi[i] + e[i];
+
+    return true;
+}
+
+/// \brief Enclosure of the solution set of the interval linear system \p a x = \p b
+///
+/// Convenience version of verify_solve() returning the enclosure, which
+/// consists of entire intervals if the verification fails.
+template<typename T, template<typename> class Flavor>
+interval_vector<T, Flavor> verify_solve(interval_matrix<T, Flavor> const& a, interval_vector<T, Flavor> const& b,
+                                        solve_method method = solve_method::krawczyk)
+{
+    interval_vector<T, Flavor> x;
+
+    verify_solve(a, b, x, method);
+
+    return x;
+}
+
+
+} // namespace linalg
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_LINALG_VERIFY_SOLVE_HPP
@@ -0,0 +1,148 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_MULTIPRECISION_LIMB_POOL_HPP
+#define LIBIEEEP1788_P1788_MULTIPRECISION_LIMB_POOL_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <mpfr.h>
+
+
+namespace p1788
+{
+
+namespace multiprecision
+{
+
+
+/// \brief Pool of initialized MPFR variables, grouped by their precision
+///
+/// Creating an MPFR variable allocates its limbs on the heap. Short-lived
+/// multiple-precision intervals would therefore call <c>malloc</c> and
+/// <c>free</c> twice per operation. The pool keeps released variables with
+/// their limbs in free lists local to each thread, one list per precision,
+/// and hands them out again for variables of the same precision.
+///
+/// At most <c>max_cached</c> variables are kept per precision and thread,
+/// the remaining ones are cleared. A variable may be released by a different
+/// thread than the one which acquired it. The cached variables are cleared
+/// when the thread terminates.
+class limb_pool
+{
+public:
+
+    static const std::size_t max_cached = 1024;
+
+    /// \brief Initializes \p x with the precision \p prec, the value is unspecified
+    static void acquire(mpfr_ptr x, mpfr_prec_t prec)
+    {
+        std::vector<__mpfr_struct>& l = list(prec);
+
+        if (l.empty())
+        {
+            mpfr_init2(x, prec);
+        }
+        else
+        {
+            *x = l.back();
+            l.pop_back();
+        }
+    }
+
+    /// \brief Returns \p x to the pool, \p x must not be used afterwards
+    static void release(mpfr_ptr x)
+    {
+        std::vector<__mpfr_struct>& l = list(mpfr_get_prec(x));
+
+        if (l.size() < max_cached)
+            l.push_back(*x);
+        else
+            mpfr_clear(x);
+    }
+
+    /// \brief Clears all variables cached by the calling thread
+    static void free_cache()
+    {
+        local().clear();
+    }
+
+private:
+
+    struct bucket
+    {
+        mpfr_prec_t prec;
+        std::vector<__mpfr_struct> free;
+    };
+
+    struct state
+    {
+        std::vector<bucket> buckets;
+
+        void clear()
+        {
+            for (bucket& b : buckets)
+                for (__mpfr_struct& x : b.free)
+                    mpfr_clear(&x);
+
+            buckets.clear();
+        }
+
+        ~state()
+        {
+            clear();
+        }
+    };
+
+    static state& local()
+    {
+        static thread_local state s;
+        return s;
+    }
+
+    // Only a few different precisions are in use at the same time, hence a
+    // linear search is sufficient
+    static std::vector<__mpfr_struct>& list(mpfr_prec_t prec)
+    {
+        state& s = local();
+
+        for (bucket& b : s.buckets)
+            if (b.prec == prec)
+                return b.free;
+
+        s.buckets.push_back(bucket {prec, std::vector<__mpfr_struct>()});
+        return s.buckets.back().free;
+    }
+};
+
+
+} // namespace multiprecision
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_MULTIPRECISION_LIMB_POOL_HPP
@@ -0,0 +1,968 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_MULTIPRECISION_MP_INTERVAL_HPP
+#define LIBIEEEP1788_P1788_MULTIPRECISION_MP_INTERVAL_HPP
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include "p1788/exception/exception.hpp"
+#include "p1788/infsup/interval.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+#include "p1788/util/mpfr_var.hpp"
+#include "p1788/multiprecision/limb_pool.hpp"
+
+
+namespace p1788
+{
+
+namespace multiprecision
+{
+
+
+/// \brief Bare inf-sup interval with MPFR bounds of arbitrary precision
+///
+/// The flavor mpfr_bin_ieee754_flavor<T> uses MPFR internally but fixes the
+/// precision of the bounds to the one of the IEEE 754 type T. An mp_interval
+/// stores its bounds as MPFR numbers whose precision is either fixed by the
+/// template parameter \p PREC or, for <c>PREC == 0</c>, chosen at runtime.
+/// This allows to re-evaluate an expression with a higher precision only for
+/// those boxes where the enclosure computed with the IEEE flavor is too wide,
+/// see convert() and to_interval().
+///
+/// The result of an operation has the maximum precision of its operands and
+/// is computed with outward rounding. The arithmetic follows the set-based
+/// flavor: operations return the hull of the range of the function over the
+/// intersection of the operands with the domain, e.g. sqrt([-4,4]) = [0,2].
+///
+/// The limbs of the bounds are taken from the limb_pool. The operations run
+/// in the default exponent range of MPFR, which is restored afterwards, hence
+/// they can be freely mixed with the operations of the IEEE flavor.
+///
+/// \tparam PREC precision of the bounds in bits or 0 for a runtime precision
+///
+template<mpfr_prec_t PREC = 0>
+class mp_interval
+{
+public:
+
+    static_assert(PREC >= 0, "PREC is less than 0!");
+
+    static const mpfr_prec_t static_precision = PREC;
+
+    /// \brief Precision used by the constructors if no precision is specified
+    ///
+    /// For <c>PREC > 0</c> this is \p PREC, otherwise a thread local value
+    /// which is initially 128 and can be changed with set_default_precision().
+    static mpfr_prec_t default_precision()
+    {
+        return PREC > 0 ? PREC : runtime_precision();
+    }
+
+    /// \brief Sets the default precision of the calling thread, has no effect for <c>PREC > 0</c>
+    static void set_default_precision(mpfr_prec_t prec)
+    {
+        runtime_precision() = clamp(prec);
+    }
+
+
+    /// \brief Creates the empty set
+    mp_interval()
+        : mp_interval(default_precision(), uninitialized())
+    {
+        set_empty();
+    }
+
+    /// \brief Creates the interval [\p lower, \p upper], rounded outward to the precision \p prec
+    ///
+    /// The precision is ignored for <c>PREC > 0</c>. If the bounds do not
+    /// specify a valid interval, the empty set is returned and an
+    /// undefined_operation is signaled.
+    template<typename T>
+    mp_interval(T lower, T upper, mpfr_prec_t prec = default_precision())
+        : mp_interval(prec, uninitialized())
+    {
+        static_assert(std::is_floating_point<T>::value, "Only floating point bounds are supported!");
+
+        if (lower <= upper
+                && lower != std::numeric_limits<T>::infinity()
+                && upper != -std::numeric_limits<T>::infinity())
+        {
+            exponent_range r;
+
+            set_bound(l_, lower, MPFR_RNDD);
+            set_bound(u_, upper, MPFR_RNDU);
+        }
+        else
+        {
+            p1788::exception::signal_undefined_operation();
+            set_empty();
+        }
+    }
+
+    /// \brief Converts the interval \p x of an IEEE flavor, rounded outward to the precision \p prec
+    template<typename T, template<typename> class Flavor>
+    explicit mp_interval(p1788::infsup::interval<T, Flavor> const& x, mpfr_prec_t prec = default_precision())
+        : mp_interval(prec, uninitialized())
+    {
+        typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+        if (interval_type::is_empty(x))
+        {
+            set_empty();
+            return;
+        }
+
+        exponent_range r;
+
+        set_bound(l_, interval_type::inf(x), MPFR_RNDD);
+        set_bound(u_, interval_type::sup(x), MPFR_RNDU);
+    }
+
+    /// \brief Converts \p x to the precision \p prec, rounding outward
+    template<mpfr_prec_t P>
+    explicit mp_interval(mp_interval<P> const& x, mpfr_prec_t prec = default_precision())
+        : mp_interval(prec, uninitialized())
+    {
+        exponent_range r;
+
+        mpfr_set(l_, x.lower(), MPFR_RNDD);
+        mpfr_set(u_, x.upper(), MPFR_RNDU);
+    }
+
+    mp_interval(mp_interval const& x)
+        : mp_interval(x.precision(), uninitialized())
+    {
+        mpfr_set(l_, x.l_, MPFR_RNDN);
+        mpfr_set(u_, x.u_, MPFR_RNDN);
+    }
+
+    mp_interval(mp_interval&& x)
+        : mp_interval(x.precision(), uninitialized())
+    {
+        mpfr_swap(l_, x.l_);
+        mpfr_swap(u_, x.u_);
+    }
+
+    mp_interval& operator=(mp_interval const& x)
+    {
+        if (this != &x)
+        {
+            if (precision() != x.precision())
+            {
+                limb_pool::release(l_);
+                limb_pool::release(u_);
+                limb_pool::acquire(l_, x.precision());
+                limb_pool::acquire(u_, x.precision());
+            }
+
+            mpfr_set(l_, x.l_, MPFR_RNDN);
+            mpfr_set(u_, x.u_, MPFR_RNDN);
+        }
+
+        return *this;
+    }
+
+    mp_interval& operator=(mp_interval&& x)
+    {
+        mpfr_swap(l_, x.l_);
+        mpfr_swap(u_, x.u_);
+
+        return *this;
+    }
+
+    ~mp_interval()
+    {
+        limb_pool::release(l_);
+        limb_pool::release(u_);
+    }
+
+
+    /// \brief Empty set with precision \p prec
+    static mp_interval empty(mpfr_prec_t prec = default_precision())
+    {
+        mp_interval r(prec, uninitialized());
+        r.set_empty();
+        return r;
+    }
+
+    /// \brief Entire set with precision \p prec
+    static mp_interval entire(mpfr_prec_t prec = default_precision())
+    {
+        mp_interval r(prec, uninitialized());
+        mpfr_set_inf(r.l_, -1);
+        mpfr_set_inf(r.u_, +1);
+        return r;
+    }
+
+
+    /// \brief Precision of the bounds in bits
+    mpfr_prec_t precision() const
+    {
+        return PREC > 0 ? PREC : mpfr_get_prec(l_);
+    }
+
+    /// \brief Lower bound, +inf for the empty set
+    mpfr_srcptr lower() const
+    {
+        return l_;
+    }
+
+    /// \brief Upper bound, -inf for the empty set
+    mpfr_srcptr upper() const
+    {
+        return u_;
+    }
+
+    /// \brief Encloses the interval in the smallest interval of the IEEE flavor with bounds of type T
+    template<typename T>
+    p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> to_interval() const
+    {
+        typedef p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor> interval_type;
+
+        if (is_empty(*this))
+            return interval_type();
+
+        return interval_type(p1788::util::mpfr_get_trait<T>::apply(l_, MPFR_RNDD),
+                             p1788::util::mpfr_get_trait<T>::apply(u_, MPFR_RNDU));
+    }
+
+
+// -----------------------------------------------------------------------------
+// Conversion
+// -----------------------------------------------------------------------------
+
+    /// \brief Converts \p x to the precision \p prec, rounding outward
+    static mp_interval convert(mp_interval const& x, mpfr_prec_t prec)
+    {
+        return mp_interval(x, prec);
+    }
+
+
+// -----------------------------------------------------------------------------
+// Numeric functions and predicates
+// -----------------------------------------------------------------------------
+
+    static bool is_empty(mp_interval const& x)
+    {
+        return mpfr_greater_p(x.l_, x.u_);
+    }
+
+    static bool is_entire(mp_interval const& x)
+    {
+        return mpfr_inf_p(x.l_) && mpfr_sgn(x.l_) < 0 && mpfr_inf_p(x.u_) && mpfr_sgn(x.u_) > 0;
+    }
+
+    static bool is_member(double m, mp_interval const& x)
+    {
+        return mpfr_cmp_d(x.l_, m) <= 0 && mpfr_cmp_d(x.u_, m) >= 0;
+    }
+
+    static bool subset(mp_interval const& x, mp_interval const& y)
+    {
+        return is_empty(x) || (mpfr_lessequal_p(y.l_, x.l_) && mpfr_lessequal_p(x.u_, y.u_));
+    }
+
+    static bool equal(mp_interval const& x, mp_interval const& y)
+    {
+        return (is_empty(x) && is_empty(y)) || (mpfr_equal_p(x.l_, y.l_) && mpfr_equal_p(x.u_, y.u_));
+    }
+
+    /// \brief Width of \p x rounded upward to double, NaN for the empty set
+    static double wid(mp_interval const& x)
+    {
+        if (is_empty(x))
+            return std::numeric_limits<double>::quiet_NaN();
+
+        exponent_range r;
+
+        mp_interval w(x.precision(), uninitialized());
+        mpfr_sub(w.u_, x.u_, x.l_, MPFR_RNDU);
+
+        return mpfr_get_d(w.u_, MPFR_RNDU);
+    }
+
+
+// -----------------------------------------------------------------------------
+// Set operations
+// -----------------------------------------------------------------------------
+
+    static mp_interval intersection(mp_interval const& x, mp_interval const& y)
+    {
+        mp_interval r(std::max(x.precision(), y.precision()), uninitialized());
+
+        if (is_empty(x) || is_empty(y) || mpfr_less_p(x.u_, y.l_) || mpfr_less_p(y.u_, x.l_))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        mpfr_max(r.l_, x.l_, y.l_, MPFR_RNDD);
+        mpfr_min(r.u_, x.u_, y.u_, MPFR_RNDU);
+
+        return r;
+    }
+
+    static mp_interval convex_hull(mp_interval const& x, mp_interval const& y)
+    {
+        if (is_empty(x))
+            return mp_interval(y, std::max(x.precision(), y.precision()));
+
+        if (is_empty(y))
+            return mp_interval(x, std::max(x.precision(), y.precision()));
+
+        exponent_range e;
+
+        mp_interval r(std::max(x.precision(), y.precision()), uninitialized());
+
+        mpfr_min(r.l_, x.l_, y.l_, MPFR_RNDD);
+        mpfr_max(r.u_, x.u_, y.u_, MPFR_RNDU);
+
+        return r;
+    }
+
+
+// -----------------------------------------------------------------------------
+// Forward elementary functions
+// -----------------------------------------------------------------------------
+
+    static mp_interval pos(mp_interval const& x)
+    {
+        return x;
+    }
+
+    static mp_interval neg(mp_interval const& x)
+    {
+        mp_interval r(x.precision(), uninitialized());
+
+        // exact, -[+inf,-inf] is [+inf,-inf]
+        mpfr_neg(r.l_, x.u_, MPFR_RNDD);
+        mpfr_neg(r.u_, x.l_, MPFR_RNDU);
+
+        return r;
+    }
+
+    static mp_interval add(mp_interval const& x, mp_interval const& y)
+    {
+        mp_interval r(std::max(x.precision(), y.precision()), uninitialized());
+
+        if (is_empty(x) || is_empty(y))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        mpfr_add(r.l_, x.l_, y.l_, MPFR_RNDD);
+        mpfr_add(r.u_, x.u_, y.u_, MPFR_RNDU);
+
+        return r;
+    }
+
+    static mp_interval sub(mp_interval const& x, mp_interval const& y)
+    {
+        mp_interval r(std::max(x.precision(), y.precision()), uninitialized());
+
+        if (is_empty(x) || is_empty(y))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        mpfr_sub(r.l_, x.l_, y.u_, MPFR_RNDD);
+        mpfr_sub(r.u_, x.u_, y.l_, MPFR_RNDU);
+
+        return r;
+    }
+
+    static mp_interval mul(mp_interval const& x, mp_interval const& y)
+    {
+        mp_interval r(std::max(x.precision(), y.precision()), uninitialized());
+
+        if (is_empty(x) || is_empty(y))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        int xl = mpfr_sgn(x.l_);
+        int xu = mpfr_sgn(x.u_);
+        int yl = mpfr_sgn(y.l_);
+        int yu = mpfr_sgn(y.u_);
+
+        if (xl >= 0)
+        {
+            if (yl >= 0)
+            {
+                mul_bound(r.l_, x.l_, y.l_, MPFR_RNDD);
+                mul_bound(r.u_, x.u_, y.u_, MPFR_RNDU);
+            }
+            else if (yu <= 0)
+            {
+                mul_bound(r.l_, x.u_, y.l_, MPFR_RNDD);
+                mul_bound(r.u_, x.l_, y.u_, MPFR_RNDU);
+            }
+            else
+            {
+                mul_bound(r.l_, x.u_, y.l_, MPFR_RNDD);
+                mul_bound(r.u_, x.u_, y.u_, MPFR_RNDU);
+            }
+        }
+        else if (xu <= 0)
+        {
+            if (yl >= 0)
+            {
+                mul_bound(r.l_, x.l_, y.u_, MPFR_RNDD);
+                mul_bound(r.u_, x.u_, y.l_, MPFR_RNDU);
+            }
+            else if (yu <= 0)
+            {
+                mul_bound(r.l_, x.u_, y.u_, MPFR_RNDD);
+                mul_bound(r.u_, x.l_, y.l_, MPFR_RNDU);
+            }
+            else
+            {
+                mul_bound(r.l_, x.l_, y.u_, MPFR_RNDD);
+                mul_bound(r.u_, x.l_, y.l_, MPFR_RNDU);
+            }
+        }
+        else
+        {
+            if (yl >= 0)
+            {
+                mul_bound(r.l_, x.l_, y.u_, MPFR_RNDD);
+                mul_bound(r.u_, x.u_, y.u_, MPFR_RNDU);
+            }
+            else if (yu <= 0)
+            {
+                mul_bound(r.l_, x.u_, y.l_, MPFR_RNDD);
+                mul_bound(r.u_, x.l_, y.l_, MPFR_RNDU);
+            }
+            else
+            {
+                mp_interval t(r.precision(), uninitialized());
+
+                mul_bound(r.l_, x.l_, y.u_, MPFR_RNDD);
+                mul_bound(t.l_, x.u_, y.l_, MPFR_RNDD);
+                mul_bound(r.u_, x.l_, y.l_, MPFR_RNDU);
+                mul_bound(t.u_, x.u_, y.u_, MPFR_RNDU);
+
+                mpfr_min(r.l_, r.l_, t.l_, MPFR_RNDD);
+                mpfr_max(r.u_, r.u_, t.u_, MPFR_RNDU);
+            }
+        }
+
+        return r;
+    }
+
+    static mp_interval div(mp_interval const& x, mp_interval const& y)
+    {
+        mp_interval r(std::max(x.precision(), y.precision()), uninitialized());
+
+        int xl = mpfr_sgn(x.l_);
+        int xu = mpfr_sgn(x.u_);
+        int yl = mpfr_sgn(y.l_);
+        int yu = mpfr_sgn(y.u_);
+
+        if (is_empty(x) || is_empty(y) || (yl == 0 && yu == 0))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        if (xl == 0 && xu == 0)
+        {
+            mpfr_set_zero(r.l_, +1);
+            mpfr_set_zero(r.u_, +1);
+            return r;
+        }
+
+        if ((yl < 0 && yu > 0) || (xl < 0 && xu > 0 && (yl == 0 || yu == 0)))
+        {
+            mpfr_set_inf(r.l_, -1);
+            mpfr_set_inf(r.u_, +1);
+            return r;
+        }
+
+        exponent_range e;
+
+        if (xu <= 0)
+        {
+            if (yu < 0)
+            {
+                mpfr_div(r.l_, x.u_, y.l_, MPFR_RNDD);
+                mpfr_div(r.u_, x.l_, y.u_, MPFR_RNDU);
+            }
+            else if (yl > 0)
+            {
+                mpfr_div(r.l_, x.l_, y.l_, MPFR_RNDD);
+                mpfr_div(r.u_, x.u_, y.u_, MPFR_RNDU);
+            }
+            else if (yu == 0)
+            {
+                mpfr_div(r.l_, x.u_, y.l_, MPFR_RNDD);
+                mpfr_set_inf(r.u_, +1);
+            }
+            else
+            {
+                mpfr_set_inf(r.l_, -1);
+                mpfr_div(r.u_, x.u_, y.u_, MPFR_RNDU);
+            }
+        }
+        else if (xl >= 0)
+        {
+            if (yu < 0)
+            {
+                mpfr_div(r.l_, x.u_, y.u_, MPFR_RNDD);
+                mpfr_div(r.u_, x.l_, y.l_, MPFR_RNDU);
+            }
+            else if (yl > 0)
+            {
+                mpfr_div(r.l_, x.l_, y.u_, MPFR_RNDD);
+                mpfr_div(r.u_, x.u_, y.l_, MPFR_RNDU);
+            }
+            else if (yu == 0)
+            {
+                mpfr_set_inf(r.l_, -1);
+                mpfr_div(r.u_, x.l_, y.l_, MPFR_RNDU);
+            }
+            else
+            {
+                mpfr_div(r.l_, x.l_, y.u_, MPFR_RNDD);
+                mpfr_set_inf(r.u_, +1);
+            }
+        }
+        else
+        {
+            if (yu < 0)
+            {
+                mpfr_div(r.l_, x.u_, y.u_, MPFR_RNDD);
+                mpfr_div(r.u_, x.l_, y.u_, MPFR_RNDU);
+            }
+            else
+            {
+                mpfr_div(r.l_, x.l_, y.l_, MPFR_RNDD);
+                mpfr_div(r.u_, x.u_, y.l_, MPFR_RNDU);
+            }
+        }
+
+        return r;
+    }
+
+    static mp_interval recip(mp_interval const& x)
+    {
+        return div(mp_interval(1.0, 1.0, x.precision()), x);
+    }
+
+    static mp_interval sqr(mp_interval const& x)
+    {
+        mp_interval r(x.precision(), uninitialized());
+
+        if (is_empty(x))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        if (mpfr_sgn(x.l_) >= 0)
+        {
+            mpfr_sqr(r.l_, x.l_, MPFR_RNDD);
+            mpfr_sqr(r.u_, x.u_, MPFR_RNDU);
+        }
+        else if (mpfr_sgn(x.u_) <= 0)
+        {
+            mpfr_sqr(r.l_, x.u_, MPFR_RNDD);
+            mpfr_sqr(r.u_, x.l_, MPFR_RNDU);
+        }
+        else
+        {
+            mpfr_set_zero(r.l_, +1);
+
+            if (mpfr_cmpabs(x.l_, x.u_) > 0)
+                mpfr_sqr(r.u_, x.l_, MPFR_RNDU);
+            else
+                mpfr_sqr(r.u_, x.u_, MPFR_RNDU);
+        }
+
+        return r;
+    }
+
+    static mp_interval sqrt(mp_interval const& x)
+    {
+        mp_interval r(x.precision(), uninitialized());
+
+        if (is_empty(x) || mpfr_sgn(x.u_) < 0)
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        if (mpfr_sgn(x.l_) <= 0)
+            mpfr_set_zero(r.l_, +1);
+        else
+            mpfr_sqrt(r.l_, x.l_, MPFR_RNDD);
+
+        mpfr_sqrt(r.u_, x.u_, MPFR_RNDU);
+
+        return r;
+    }
+
+    static mp_interval exp(mp_interval const& x)
+    {
+        mp_interval r(x.precision(), uninitialized());
+
+        if (is_empty(x))
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        mpfr_exp(r.l_, x.l_, MPFR_RNDD);
+        mpfr_exp(r.u_, x.u_, MPFR_RNDU);
+
+        return r;
+    }
+
+    static mp_interval log(mp_interval const& x)
+    {
+        mp_interval r(x.precision(), uninitialized());
+
+        if (is_empty(x) || mpfr_sgn(x.u_) <= 0)
+        {
+            r.set_empty();
+            return r;
+        }
+
+        exponent_range e;
+
+        if (mpfr_sgn(x.l_) <= 0)
+            mpfr_set_inf(r.l_, -1);
+        else
+            mpfr_log(r.l_, x.l_, MPFR_RNDD);
+
+        mpfr_log(r.u_, x.u_, MPFR_RNDU);
+
+        return r;
+    }
+
+
+// -----------------------------------------------------------------------------
+// Input and output
+// -----------------------------------------------------------------------------
+
+    /// \brief Writes the interval as <c>[l,u]</c> with decimal bounds rounded outward
+    ///
+    /// The number of significant digits is sufficient to distinguish the
+    /// bounds at the precision of the interval.
+    template<typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
+                                                         mp_interval const& x)
+    {
+        if (is_empty(x))
+            return os << "[empty]";
+
+        int digits = static_cast<int>(x.precision() * 0.30103) + 2;
+        std::vector<char> buffer(2 * digits + 64);
+
+        mpfr_sprintf(buffer.data(), "[%.*RDg,%.*RUg]", digits, x.l_, digits, x.u_);
+
+        return os << buffer.data();
+    }
+
+
+private:
+
+    struct uninitialized { };
+
+    // Sets the exponent range to the default of MPFR and restores the
+    // previous range, which may be the one of an IEEE flavor, afterwards
+    class exponent_range
+    {
+    public:
+
+        exponent_range()
+            : emin_(mpfr_get_emin()), emax_(mpfr_get_emax())
+        {
+            mpfr_set_emin(1 - (mpfr_exp_t(1) << 30));
+            mpfr_set_emax((mpfr_exp_t(1) << 30) - 1);
+        }
+
+        ~exponent_range()
+        {
+            mpfr_set_emin(emin_);
+            mpfr_set_emax(emax_);
+        }
+
+    private:
+        mpfr_exp_t emin_;
+        mpfr_exp_t emax_;
+    };
+
+    // Bounds with the precision prec taken from the limb pool, the value is unspecified
+    mp_interval(mpfr_prec_t prec, uninitialized)
+    {
+        prec = PREC > 0 ? PREC : clamp(prec);
+
+        limb_pool::acquire(l_, prec);
+        limb_pool::acquire(u_, prec);
+    }
+
+    static mpfr_prec_t clamp(mpfr_prec_t prec)
+    {
+        return std::min(std::max(prec, mpfr_prec_t(MPFR_PREC_MIN)), mpfr_prec_t(MPFR_PREC_MAX));
+    }
+
+    static mpfr_prec_t& runtime_precision()
+    {
+        static thread_local mpfr_prec_t prec = 128;
+        return prec;
+    }
+
+    void set_empty()
+    {
+        mpfr_set_inf(l_, +1);
+        mpfr_set_inf(u_, -1);
+    }
+
+    static void set_bound(mpfr_ptr x, float v, mpfr_rnd_t rnd)
+    {
+        mpfr_set_flt(x, v, rnd);
+    }
+
+    static void set_bound(mpfr_ptr x, double v, mpfr_rnd_t rnd)
+    {
+        mpfr_set_d(x, v, rnd);
+    }
+
+    static void set_bound(mpfr_ptr x, long double v, mpfr_rnd_t rnd)
+    {
+        mpfr_set_ld(x, v, rnd);
+    }
+
+    // Product of two bounds, 0 times infinity is 0 for intervals
+    static void mul_bound(mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b, mpfr_rnd_t rnd)
+    {
+        if (mpfr_zero_p(a) || mpfr_zero_p(b))
+            mpfr_set_zero(r, +1);
+        else
+            mpfr_mul(r, a, b, rnd);
+    }
+
+    mpfr_t l_;
+    mpfr_t u_;
+};
+
+
+// -----------------------------------------------------------------------------
+// Free functions and operators
+// -----------------------------------------------------------------------------
+
+template<mpfr_prec_t PREC>
+bool is_empty(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::is_empty(x);
+}
+
+template<mpfr_prec_t PREC>
+bool is_entire(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::is_entire(x);
+}
+
+template<mpfr_prec_t PREC>
+bool is_member(double m, mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::is_member(m, x);
+}
+
+template<mpfr_prec_t PREC>
+bool subset(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::subset(x, y);
+}
+
+template<mpfr_prec_t PREC>
+bool equal(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::equal(x, y);
+}
+
+template<mpfr_prec_t PREC>
+double wid(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::wid(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> intersection(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::intersection(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> convex_hull(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::convex_hull(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> pos(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::pos(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> neg(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::neg(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> add(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::add(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> sub(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::sub(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> mul(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::mul(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> div(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::div(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> recip(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::recip(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> sqr(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::sqr(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> sqrt(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::sqrt(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> exp(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::exp(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> log(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::log(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> operator+(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::pos(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> operator-(mp_interval<PREC> const& x)
+{
+    return mp_interval<PREC>::neg(x);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> operator+(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::add(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> operator-(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::sub(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> operator*(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::mul(x, y);
+}
+
+template<mpfr_prec_t PREC>
+mp_interval<PREC> operator/(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::div(x, y);
+}
+
+template<mpfr_prec_t PREC>
+bool operator==(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return mp_interval<PREC>::equal(x, y);
+}
+
+template<mpfr_prec_t PREC>
+bool operator!=(mp_interval<PREC> const& x, mp_interval<PREC> const& y)
+{
+    return !mp_interval<PREC>::equal(x, y);
+}
+
+
+} // namespace multiprecision
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_MULTIPRECISION_MP_INTERVAL_HPP
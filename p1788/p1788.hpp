@@ -41,5 +41,7 @@
 
 #include "p1788/reduction/reduction.hpp"
 
+#include "p1788/p1788_extern_template.hpp"
+
 
 #endif // LIBIEEEP1788_P1788_P1788_HPP
@@ -0,0 +1,83 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_P1788_EXTERN_TEMPLATE_HPP
+#define LIBIEEEP1788_P1788_P1788_EXTERN_TEMPLATE_HPP
+
+#include "p1788/infsup/interval.hpp"
+#include "p1788/infsup/decorated_interval.hpp"
+
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+//              Explicit instantiations of the common interval types
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+
+// The flavor mpfr_bin_ieee754_flavor and the interval types interval and
+// decorated_interval (including their base class base_interval) for float,
+// double and long double are explicitly instantiated in the compiled library
+// libp1788 (see src/).
+//
+// If P1788_EXTERN_TEMPLATES is defined before p1788/p1788.hpp is included, the
+// instantiations are declared extern and every translation unit uses the
+// instantiations of libp1788 instead of instantiating them again. The program
+// has to be linked against libp1788 in this case.
+//
+// Member templates, i.e. the mixed type operations, and the non-member
+// functions are still instantiated in the translation units.
+
+
+#define LIBIEEEP1788_P1788_INSTANTIATE_INTERVAL_TYPES(EXTERN_, T)                       \
+    EXTERN_ template class p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;  \
+    EXTERN_ template class p1788::infsup::base_interval<T,                              \
+        p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor,                       \
+        p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>::representation,    \
+        p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>>; \
+    EXTERN_ template class p1788::infsup::interval<T,                                   \
+        p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;                      \
+    EXTERN_ template class p1788::infsup::base_interval<T,                              \
+        p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor,                       \
+        p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>::representation_dec, \
+        p1788::infsup::decorated_interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>>; \
+    EXTERN_ template class p1788::infsup::decorated_interval<T,                         \
+        p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+#define LIBIEEEP1788_P1788_INSTANTIATE_ALL(EXTERN_)                                    \
+    LIBIEEEP1788_P1788_INSTANTIATE_INTERVAL_TYPES(EXTERN_, float)                       \
+    LIBIEEEP1788_P1788_INSTANTIATE_INTERVAL_TYPES(EXTERN_, double)                      \
+    LIBIEEEP1788_P1788_INSTANTIATE_INTERVAL_TYPES(EXTERN_, long double)
+
+
+#ifdef P1788_EXTERN_TEMPLATES
+
+LIBIEEEP1788_P1788_INSTANTIATE_ALL(extern)
+
+#endif
+
+
+#endif // LIBIEEEP1788_P1788_P1788_EXTERN_TEMPLATE_HPP
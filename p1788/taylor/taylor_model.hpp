@@ -0,0 +1,969 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef LIBIEEEP1788_P1788_TAYLOR_TAYLOR_MODEL_HPP
+#define LIBIEEEP1788_P1788_TAYLOR_TAYLOR_MODEL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "p1788/infsup/interval.hpp"
+#include "p1788/affine/arena.hpp"
+
+
+namespace p1788
+{
+
+namespace taylor
+{
+
+
+/// \brief Taylor model <c>p(t) + R</c> over the normalized domain <c>t</c> &isin; [-1,1]<sup>n</sup>
+///
+/// A Taylor model (Berz, Makino) encloses a function f over a box by a
+/// polynomial p of order at most <c>order()</c> with floating-point
+/// coefficients and an interval remainder R, i.e. f(t) &isin; p(t) + R for all
+/// t in the box. Since the dependency between the variables is kept in the
+/// polynomial, the wrapping effect of interval arithmetic is reduced to the
+/// remainder, which is of order <c>order() + 1</c> in the width of the box.
+///
+/// The variables are normalized, a variable x &isin; [a,b] is represented by
+/// <c>c + r t</c> with the floating-point numbers c &asymp; (a+b)/2 and
+/// r &ge; (b-a)/2, see variable(). Hence every monomial is bounded by [-1,1],
+/// or [0,1] if all exponents are even, and no domain has to be stored.
+///
+/// The polynomial is stored sparse as a list of the nonzero terms sorted by
+/// their monomial, in a <c>std::vector</c> using the arena_allocator of the
+/// affine module. A monomial packs the exponents of the up to
+/// <c>max_variables</c> variables into the bytes of an integer, therefore the
+/// product of two monomials is the sum of the packed exponents.
+///
+/// The operations on the coefficients are performed with rounding to
+/// nearest. Their rounding errors are computed exactly with TwoSum and
+/// TwoProduct, accumulated with directed rounding emulated by
+/// <c>std::nextafter</c> and swept into the remainder, together with the
+/// terms of a degree above the order and the terms with a coefficient of a
+/// magnitude of at most sweep_threshold(). The elementary functions are
+/// evaluated by a Taylor expansion around the constant part with interval
+/// coefficients and a Lagrange remainder.
+///
+/// Empty and unbounded ranges are represented by a model without a
+/// polynomial and with the range as the remainder.
+///
+/// \tparam T type used for the coefficients and the bounds of the remainder
+/// \tparam Flavor template policy class specifying the behavior of the intervals
+///
+/// \note The floating-point environment has to be in the default rounding mode.
+///
+template<typename T, template<typename> class Flavor>
+class taylor_model
+{
+public:
+
+    static_assert(std::numeric_limits<T>::is_iec559, "Only IEEE 754 binary compliant types are supported!");
+
+    typedef T bound_type;
+    typedef p1788::infsup::interval<T, Flavor> interval_type;
+
+    /// \brief Exponents of a monomial, the exponent of variable i is stored in byte i
+    typedef std::uint64_t monomial_type;
+
+    /// \brief Coefficient of a monomial
+    struct term
+    {
+        monomial_type monomial;
+        T coefficient;
+    };
+
+    typedef std::vector<term, p1788::affine::arena_allocator<term>> term_list;
+
+    static const unsigned max_variables = 8;
+    static const unsigned max_order = 127;
+
+
+    /// \brief Creates the empty set
+    taylor_model()
+        : order_(0), terms_(), rem_()
+    { }
+
+    /// \brief Creates the constant \p c
+    taylor_model(T c, unsigned order)
+        : order_(std::min(order, max_order)), terms_(), rem_(0.0, 0.0)
+    {
+        push(terms_, 0, c);
+    }
+
+    /// \brief Creates a constant enclosing the interval \p x
+    ///
+    /// The midpoint of \p x becomes the constant term and \p x minus the
+    /// midpoint the remainder. Empty and unbounded intervals are stored as the
+    /// remainder.
+    taylor_model(interval_type const& x, unsigned order)
+        : order_(std::min(order, max_order)), terms_(), rem_(x)
+    {
+        if (!interval_type::is_common_interval(x))
+            return;
+
+        T c = interval_type::mid(x);
+        push(terms_, 0, c);
+        rem_ = interval_type::sub(x, interval_type(c, c));
+    }
+
+    /// \brief Creates the variable \p i ranging over \p x, i.e. <c>c + r t<sub>i</sub></c>
+    ///
+    /// c is the midpoint of \p x and r an upper bound of the radius, hence the
+    /// range of the model is a superset of \p x and the normalized variable
+    /// t<sub>i</sub> corresponding to the points of \p x is in [-1,1].
+    static taylor_model variable(interval_type const& x, unsigned i, unsigned order)
+    {
+        taylor_model z(x, order);
+
+        if (!interval_type::is_common_interval(x) || i >= max_variables)
+            return z;
+
+        T c = interval_type::mid(x);
+        T r = std::max(add_up(interval_type::sup(x), -c), add_up(c, -interval_type::inf(x)));
+
+        z.rem_ = interval_type(0.0, 0.0);
+
+        if (order > 0)
+            push(z.terms_, monomial(i), r);
+        else
+            z.rem_ = interval_type(-r, r);
+
+        return z;
+    }
+
+
+    /// \brief Monomial t<sub>i</sub><sup>e</sup>
+    static monomial_type monomial(unsigned i, unsigned e = 1)
+    {
+        return static_cast<monomial_type>(e) << (8 * i);
+    }
+
+    /// \brief Exponent of variable \p i in the monomial \p m
+    static unsigned exponent(monomial_type m, unsigned i)
+    {
+        return static_cast<unsigned>((m >> (8 * i)) & 0xFF);
+    }
+
+    /// \brief Total degree of the monomial \p m
+    static unsigned degree(monomial_type m)
+    {
+        // sum of the bytes, valid as long as the sum is below 256
+        return static_cast<unsigned>((m * 0x0101010101010101ull) >> 56);
+    }
+
+
+    /// \brief Magnitude up to which the coefficients are swept into the remainder
+    ///
+    /// The threshold is local to the calling thread and initially
+    /// <c>epsilon<sup>2</sup></c>.
+    static T sweep_threshold()
+    {
+        return threshold();
+    }
+
+    /// \brief Sets the sweep threshold of the calling thread
+    static void set_sweep_threshold(T t)
+    {
+        threshold() = std::abs(t);
+    }
+
+
+    /// \brief Maximal degree of the polynomial
+    unsigned order() const
+    {
+        return order_;
+    }
+
+    /// \brief Nonzero terms of the polynomial, sorted by their monomial
+    term_list const& terms() const
+    {
+        return terms_;
+    }
+
+    /// \brief Remainder
+    interval_type const& remainder() const
+    {
+        return rem_;
+    }
+
+    /// \brief Coefficient of the monomial \p m
+    T coefficient(monomial_type m) const
+    {
+        auto i = std::lower_bound(terms_.begin(), terms_.end(), m,
+                                  [](term const& s, monomial_type k) { return s.monomial < k; });
+
+        return i != terms_.end() && i->monomial == m ? i->coefficient : static_cast<T>(0);
+    }
+
+    /// \brief Enclosure of the range of the polynomial over [-1,1]<sup>n</sup>
+    interval_type polynomial_bound() const
+    {
+        T c = 0;
+        T lo = 0;
+        T hi = 0;
+
+        for (auto const& s : terms_)
+        {
+            T a = std::abs(s.coefficient);
+
+            if (s.monomial == 0)
+                c = s.coefficient;
+            else if (!is_even(s.monomial))
+            {
+                lo = add_up(lo, a);
+                hi = add_up(hi, a);
+            }
+            else if (s.coefficient > 0)
+                hi = add_up(hi, a);
+            else
+                lo = add_up(lo, a);
+        }
+
+        return interval_type(-add_up(-c, lo), add_up(c, hi));
+    }
+
+    /// \brief Enclosure of the range of the model over [-1,1]<sup>n</sup>
+    interval_type to_interval() const
+    {
+        return interval_type::add(polynomial_bound(), rem_);
+    }
+
+    /// \brief Enclosure of the range of the model over the box \p t &sube; [-1,1]<sup>n</sup>
+    ///
+    /// Variables without a component in \p t range over [-1,1].
+    interval_type eval(std::vector<interval_type> const& t) const
+    {
+        interval_type r(0.0, 0.0);
+
+        for (auto const& s : terms_)
+        {
+            interval_type p(s.coefficient, s.coefficient);
+
+            for (unsigned i = 0; i < max_variables; ++i)
+            {
+                unsigned e = exponent(s.monomial, i);
+
+                if (e > 0)
+                    p = interval_type::mul(p, interval_type::pown(i < t.size() ? t[i] : interval_type(-1.0, 1.0),
+                                                                  static_cast<int>(e)));
+            }
+
+            r = interval_type::add(r, p);
+        }
+
+        return interval_type::add(r, rem_);
+    }
+
+
+    // -------------------------------------------------------------------------
+    // Operations
+    // -------------------------------------------------------------------------
+
+    static taylor_model neg(taylor_model const& x)
+    {
+        taylor_model z = x;
+        z.rem_ = interval_type::neg(x.rem_);
+
+        for (auto& s : z.terms_)
+            s.coefficient = -s.coefficient;
+
+        return z;
+    }
+
+    static taylor_model add(taylor_model const& x, taylor_model const& y)
+    {
+        return combine(x, y, 1);
+    }
+
+    static taylor_model sub(taylor_model const& x, taylor_model const& y)
+    {
+        return combine(x, y, -1);
+    }
+
+    /// \brief Sum of \p x and the constant \p c
+    static taylor_model add(taylor_model const& x, T c)
+    {
+        return add(x, interval_type(c, c));
+    }
+
+    /// \brief Sum of \p x and a constant enclosed by \p c
+    static taylor_model add(taylor_model const& x, interval_type const& c)
+    {
+        if (!interval_type::is_common_interval(c))
+            return special(interval_type::add(x.to_interval(), c), x.order_);
+
+        T err = 0;
+        T m = interval_type::mid(c);
+        term_list t = x.terms_;
+
+        if (!t.empty() && t.front().monomial == 0)
+            t.front().coefficient = two_sum(t.front().coefficient, m, err);
+        else
+            push_front(t, m);
+
+        return make(t, err, interval_type::add(x.rem_, interval_type::sub(c, interval_type(m, m))), x.order_);
+    }
+
+    /// \brief Product of \p x and the constant \p c
+    static taylor_model mul(taylor_model const& x, T c)
+    {
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size());
+
+        for (auto const& s : x.terms_)
+            push(t, s.monomial, two_prod(s.coefficient, c, err));
+
+        return make(t, err, interval_type::mul(x.rem_, interval_type(c, c)), x.order_);
+    }
+
+    /// \brief Product, the terms of a degree above the order are bounded into the remainder
+    ///
+    /// The remainder is <c>B(p) R<sub>y</sub> + R<sub>x</sub> B(q) + R<sub>x</sub> R<sub>y</sub></c>
+    /// for <c>x = p + R<sub>x</sub></c>, <c>y = q + R<sub>y</sub></c> and the
+    /// polynomial bound B.
+    static taylor_model mul(taylor_model const& x, taylor_model const& y)
+    {
+        unsigned order = std::min(x.order_, y.order_);
+
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() * y.terms_.size());
+
+        for (auto const& s : x.terms_)
+            for (auto const& u : y.terms_)
+            {
+                monomial_type m = s.monomial + u.monomial;
+
+                if (degree(m) > order)
+                    err = add_up(err, mul_up(std::abs(s.coefficient), std::abs(u.coefficient)));
+                else
+                    push(t, m, two_prod(s.coefficient, u.coefficient, err));
+            }
+
+        std::sort(t.begin(), t.end(), [](term const& a, term const& b) { return a.monomial < b.monomial; });
+
+        // merge the terms of equal monomials
+        std::size_t n = 0;
+
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            if (n > 0 && t[n - 1].monomial == t[i].monomial)
+                t[n - 1].coefficient = two_sum(t[n - 1].coefficient, t[i].coefficient, err);
+            else
+                t[n++] = t[i];
+        }
+
+        t.resize(n);
+
+        interval_type r = interval_type::add(
+                              interval_type::add(interval_type::mul(x.polynomial_bound(), y.rem_),
+                                                 interval_type::mul(x.rem_, y.polynomial_bound())),
+                              interval_type::mul(x.rem_, y.rem_));
+
+        return make(t, err, r, order);
+    }
+
+    static taylor_model div(taylor_model const& x, taylor_model const& y)
+    {
+        return mul(x, recip(y));
+    }
+
+    static taylor_model sqr(taylor_model const& x)
+    {
+        return mul(x, x);
+    }
+
+    static taylor_model recip(taylor_model const& x)
+    {
+        interval_type xi = x.to_interval();
+
+        if (interval_type::is_member(0.0, xi))
+            return special(interval_type::recip(xi), x.order_);
+
+        // (-1)^k / x^(k+1)
+        return expand(x, [](unsigned k, interval_type const& t)
+        {
+            interval_type p = interval_type::recip(interval_type::pown(t, static_cast<int>(k + 1)));
+            return k % 2 ? interval_type::neg(p) : p;
+        });
+    }
+
+    static taylor_model sqrt(taylor_model const& x)
+    {
+        interval_type xi = x.to_interval();
+
+        if (!(interval_type::inf(xi) > 0))
+            return special(interval_type::sqrt(xi), x.order_);
+
+        // binomial(1/2, k) sqrt(x) / x^k
+        return expand(x, [](unsigned k, interval_type const& t)
+        {
+            interval_type b(1.0, 1.0);
+
+            for (unsigned j = 1; j <= k; ++j)
+                b = interval_type::div(interval_type::mul(b, interval_type(static_cast<T>(0.5 - (j - 1)), static_cast<T>(0.5 - (j - 1)))),
+                                       interval_type(static_cast<T>(j), static_cast<T>(j)));
+
+            return interval_type::div(interval_type::mul(b, interval_type::sqrt(t)),
+                                      interval_type::pown(t, static_cast<int>(k)));
+        });
+    }
+
+    static taylor_model exp(taylor_model const& x)
+    {
+        if (x.terms_.empty())
+            return special(interval_type::exp(x.rem_), x.order_);
+
+        // exp(x) / k!
+        return expand(x, [](unsigned k, interval_type const& t)
+        {
+            return interval_type::div(interval_type::exp(t), factorial(k));
+        });
+    }
+
+    static taylor_model log(taylor_model const& x)
+    {
+        interval_type xi = x.to_interval();
+
+        if (!(interval_type::inf(xi) > 0))
+            return special(interval_type::log(xi), x.order_);
+
+        // log(x) for k = 0, (-1)^(k-1) / (k x^k) otherwise
+        return expand(x, [](unsigned k, interval_type const& t)
+        {
+            if (k == 0)
+                return interval_type::log(t);
+
+            interval_type p = interval_type::recip(interval_type::mul(interval_type(static_cast<T>(k), static_cast<T>(k)),
+                                                   interval_type::pown(t, static_cast<int>(k))));
+            return k % 2 ? p : interval_type::neg(p);
+        });
+    }
+
+    static taylor_model sin(taylor_model const& x)
+    {
+        if (x.terms_.empty())
+            return special(interval_type::sin(x.rem_), x.order_);
+
+        // sin, cos, -sin, -cos divided by k!
+        return expand(x, [](unsigned k, interval_type const& t)
+        {
+            interval_type d = k % 2 ? interval_type::cos(t) : interval_type::sin(t);
+            return interval_type::div(k % 4 < 2 ? d : interval_type::neg(d), factorial(k));
+        });
+    }
+
+    static taylor_model cos(taylor_model const& x)
+    {
+        if (x.terms_.empty())
+            return special(interval_type::cos(x.rem_), x.order_);
+
+        // cos, -sin, -cos, sin divided by k!
+        return expand(x, [](unsigned k, interval_type const& t)
+        {
+            interval_type d = k % 2 ? interval_type::sin(t) : interval_type::cos(t);
+            return interval_type::div((k + 1) % 4 < 2 ? d : interval_type::neg(d), factorial(k));
+        });
+    }
+
+    /// \brief Composition <c>f(g<sub>0</sub>, ..., g<sub>k-1</sub>, t<sub>k</sub>, ...)</c>
+    ///
+    /// The variable t<sub>i</sub> of \p f is substituted by the model \p g[i],
+    /// the remaining variables are kept. The ranges of the models \p g have to be
+    /// subsets of [-1,1], the domain of \p f, otherwise the result is entire.
+    static taylor_model compose(taylor_model const& f, std::vector<taylor_model> const& g)
+    {
+        unsigned order = f.order_;
+
+        for (auto const& gi : g)
+        {
+            if (!interval_type::subset(gi.to_interval(), interval_type(-1.0, 1.0)))
+                return special(interval_type::entire(), f.order_);
+
+            order = std::min(order, gi.order_);
+        }
+
+        // powers g[i]^e, computed on demand
+        std::vector<std::vector<taylor_model>> pw(std::min<std::size_t>(g.size(), max_variables));
+
+        taylor_model z(0.0, order);
+
+        for (auto const& s : f.terms_)
+        {
+            taylor_model p(s.coefficient, order);
+            monomial_type kept = 0;
+
+            for (unsigned i = 0; i < max_variables; ++i)
+            {
+                unsigned e = exponent(s.monomial, i);
+
+                if (e == 0)
+                    continue;
+
+                if (i >= pw.size())
+                {
+                    kept += monomial(i, e);
+                    continue;
+                }
+
+                if (pw[i].empty())
+                    pw[i].push_back(taylor_model(1.0, order));
+
+                while (pw[i].size() <= e)
+                    pw[i].push_back(mul(pw[i].back(), g[i]));
+
+                p = mul(p, pw[i][e]);
+            }
+
+            if (kept != 0)
+            {
+                taylor_model k = special(interval_type(0.0, 0.0), order);
+                push(k.terms_, kept, static_cast<T>(1));
+                p = mul(p, k);
+            }
+
+            z = add(z, p);
+        }
+
+        z.rem_ = interval_type::add(z.rem_, f.rem_);
+
+        return z;
+    }
+
+private:
+
+    static T& threshold()
+    {
+        static thread_local T t = std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon();
+        return t;
+    }
+
+    static bool is_even(monomial_type m)
+    {
+        return (m & 0x0101010101010101ull) == 0;
+    }
+
+    static T next_up(T x)
+    {
+        return std::nextafter(x, std::numeric_limits<T>::infinity());
+    }
+
+    // exact error e = a + b - s of s = a + b (TwoSum)
+    static T sum_error(T a, T b, T s)
+    {
+        T bb = s - a;
+        return (a - (s - bb)) + (b - bb);
+    }
+
+    // a * b may be inexact although the error computed by fma is 0
+    static bool tiny_product(T a, T b, T p)
+    {
+        return a != 0 && b != 0
+               && std::abs(p) < std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+    }
+
+    // upper bound of a + b
+    static T add_up(T a, T b)
+    {
+        T s = a + b;
+        return sum_error(a, b, s) > 0 ? next_up(s) : s;
+    }
+
+    // upper bound of a * b
+    static T mul_up(T a, T b)
+    {
+        T p = a * b;
+        return std::fma(a, b, -p) > 0 || tiny_product(a, b, p) ? next_up(p) : p;
+    }
+
+    // a + b rounded to nearest, the rounding error (TwoSum) is added to err
+    static T two_sum(T a, T b, T& err)
+    {
+        T s = a + b;
+        T e = sum_error(a, b, s);
+
+        if (e != 0)
+            err = add_up(err, std::abs(e));
+
+        return s;
+    }
+
+    // a * b rounded to nearest, the rounding error (TwoProduct) is added to
+    // err. Below min/eps the error computed by fma may be rounded, next_up
+    // covers the remaining error of at most denorm_min/2.
+    static T two_prod(T a, T b, T& err)
+    {
+        T p = a * b;
+        T e = std::fma(a, b, -p);
+
+        if (tiny_product(a, b, p))
+            err = next_up(add_up(err, std::abs(e)));
+        else if (e != 0)
+            err = add_up(err, std::abs(e));
+
+        return p;
+    }
+
+    static void push(term_list& t, monomial_type m, T coefficient)
+    {
+        if (coefficient != 0)
+        {
+            term s = { m, coefficient };
+            t.push_back(s);
+        }
+    }
+
+    static void push_front(term_list& t, T coefficient)
+    {
+        if (coefficient != 0)
+        {
+            term s = { 0, coefficient };
+            t.insert(t.begin(), s);
+        }
+    }
+
+    // enclosure of k! as an interval
+    static interval_type factorial(unsigned k)
+    {
+        interval_type f(1.0, 1.0);
+
+        for (unsigned j = 2; j <= k; ++j)
+            f = interval_type::mul(f, interval_type(static_cast<T>(j), static_cast<T>(j)));
+
+        return f;
+    }
+
+    // model without a polynomial and the remainder r
+    static taylor_model special(interval_type const& r, unsigned order)
+    {
+        taylor_model z;
+        z.order_ = order;
+        z.rem_ = r;
+        return z;
+    }
+
+    // model with the terms t and the remainder r + [-err,err]. Terms of a
+    // degree above the order and nonconstant terms with a coefficient of a
+    // magnitude of at most sweep_threshold() are swept into the remainder.
+    // Entire on overflow.
+    static taylor_model make(term_list& t, T err, interval_type const& r, unsigned order)
+    {
+        T const eps = sweep_threshold();
+        std::size_t n = 0;
+        bool finite = true;
+
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            T a = std::abs(t[i].coefficient);
+
+            if (a == 0)
+                continue;
+
+            if (degree(t[i].monomial) > order || (t[i].monomial != 0 && a <= eps))
+                err = add_up(err, a);
+            else
+            {
+                finite = finite && std::isfinite(a);
+                t[n++] = t[i];
+            }
+        }
+
+        t.resize(n);
+
+        if (!finite || !std::isfinite(err))
+            return special(interval_type::entire(), order);
+
+        taylor_model z;
+        z.order_ = order;
+        z.terms_.swap(t);
+        z.rem_ = err != 0 ? interval_type::add(r, interval_type(-err, err)) : r;
+
+        return z;
+    }
+
+    // x + s y with s = 1 or s = -1
+    static taylor_model combine(taylor_model const& x, taylor_model const& y, T s)
+    {
+        T err = 0;
+        term_list t;
+        t.reserve(x.terms_.size() + y.terms_.size());
+
+        auto i = x.terms_.begin();
+        auto j = y.terms_.begin();
+
+        while (i != x.terms_.end() || j != y.terms_.end())
+        {
+            if (j == y.terms_.end() || (i != x.terms_.end() && i->monomial < j->monomial))
+            {
+                t.push_back(*i);
+                ++i;
+            }
+            else if (i == x.terms_.end() || j->monomial < i->monomial)
+            {
+                push(t, j->monomial, s * j->coefficient);
+                ++j;
+            }
+            else
+            {
+                push(t, i->monomial, two_sum(i->coefficient, s * j->coefficient, err));
+                ++i;
+                ++j;
+            }
+        }
+
+        interval_type r = s > 0 ? interval_type::add(x.rem_, y.rem_) : interval_type::sub(x.rem_, y.rem_);
+
+        return make(t, err, r, std::min(x.order_, y.order_));
+    }
+
+    // Taylor expansion f(x) = sum_{k=0}^{n} a_k h^k + a_{n+1}(xi) h^(n+1) of the
+    // order n of x around the constant part c of x with h = x - c. coeff(k, t)
+    // encloses f^(k)(t) / k! over the interval t; the polynomial is evaluated
+    // by the Horner scheme in Taylor model arithmetic with the enclosures
+    // a_k = coeff(k, [c,c]), and the Lagrange remainder a_{n+1}(xi) with xi
+    // between c and x is enclosed over the hull of c and the range of x.
+    template<class C>
+    static taylor_model expand(taylor_model const& x, C coeff)
+    {
+        unsigned const n = x.order_;
+
+        T c = x.coefficient(0);
+
+        taylor_model h = x;
+
+        if (!h.terms_.empty() && h.terms_.front().monomial == 0)
+            h.terms_.erase(h.terms_.begin());
+
+        interval_type ci(c, c);
+        interval_type hb = h.to_interval();
+        interval_type xi = interval_type::convex_hull(ci, interval_type::add(ci, hb));
+
+        taylor_model p(coeff(n, ci), n);
+
+        for (unsigned k = n; k-- > 0; )
+            p = add(mul(p, h), coeff(k, ci));
+
+        interval_type r = interval_type::mul(coeff(n + 1, xi), interval_type::pown(hb, static_cast<int>(n + 1)));
+
+        if (!interval_type::is_common_interval(r))
+            return special(interval_type::add(p.to_interval(), r), n);
+
+        p.rem_ = interval_type::add(p.rem_, r);
+
+        return p;
+    }
+
+    unsigned order_;
+    term_list terms_;
+    interval_type rem_;
+};
+
+template<typename T, template<typename> class Flavor>
+const unsigned taylor_model<T, Flavor>::max_variables;
+
+template<typename T, template<typename> class Flavor>
+const unsigned taylor_model<T, Flavor>::max_order;
+
+
+// -----------------------------------------------------------------------------
+// Functions and operators
+// -----------------------------------------------------------------------------
+
+template<typename T, template<typename> class Flavor>
+inline typename taylor_model<T, Flavor>::interval_type to_interval(taylor_model<T, Flavor> const& x)
+{
+    return x.to_interval();
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> neg(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::neg(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> sqr(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::sqr(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> recip(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::recip(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> sqrt(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::sqrt(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> exp(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::exp(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> log(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::log(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> sin(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::sin(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> cos(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::cos(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> add(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> sub(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> mul(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> div(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::div(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> compose(taylor_model<T, Flavor> const& f, std::vector<taylor_model<T, Flavor>> const& g)
+{
+    return taylor_model<T, Flavor>::compose(f, g);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator-(taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::neg(x);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator+(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::add(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator+(taylor_model<T, Flavor> const& x, typename taylor_model<T, Flavor>::bound_type c)
+{
+    return taylor_model<T, Flavor>::add(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator+(typename taylor_model<T, Flavor>::bound_type c, taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::add(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator-(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::sub(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator-(taylor_model<T, Flavor> const& x, typename taylor_model<T, Flavor>::bound_type c)
+{
+    return taylor_model<T, Flavor>::add(x, -c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator-(typename taylor_model<T, Flavor>::bound_type c, taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::add(taylor_model<T, Flavor>::neg(x), c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator*(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::mul(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator*(taylor_model<T, Flavor> const& x, typename taylor_model<T, Flavor>::bound_type c)
+{
+    return taylor_model<T, Flavor>::mul(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator*(typename taylor_model<T, Flavor>::bound_type c, taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::mul(x, c);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator/(taylor_model<T, Flavor> const& x, taylor_model<T, Flavor> const& y)
+{
+    return taylor_model<T, Flavor>::div(x, y);
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator/(taylor_model<T, Flavor> const& x, typename taylor_model<T, Flavor>::bound_type c)
+{
+    return taylor_model<T, Flavor>::div(x, taylor_model<T, Flavor>(c, x.order()));
+}
+
+template<typename T, template<typename> class Flavor>
+inline taylor_model<T, Flavor> operator/(typename taylor_model<T, Flavor>::bound_type c, taylor_model<T, Flavor> const& x)
+{
+    return taylor_model<T, Flavor>::mul(taylor_model<T, Flavor>::recip(x), c);
+}
+
+
+} // namespace taylor
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_TAYLOR_TAYLOR_MODEL_HPP
@@ -101,7 +101,8 @@ enum class ieee754_binary_precision_order : unsigned int
 {
     float_type,
     double_type,
-    long_double_type
+    long_double_type,
+    double_double_type      // p1788::dd::double_double
 };
 
 
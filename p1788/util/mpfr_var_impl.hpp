@@ -44,7 +44,7 @@ template<typename T> class mpfr_get_trait
 template<> class mpfr_get_trait<float>
 {
 public:
-    static float apply(mpfr_t& mp, mpfr_rnd_t rnd)
+    static float apply(mpfr_srcptr mp, mpfr_rnd_t rnd)
     {
         return mpfr_get_flt(mp, rnd);
     }
@@ -54,7 +54,7 @@ public:
 template<> class mpfr_get_trait<double>
 {
 public:
-    static double apply(mpfr_t& mp, mpfr_rnd_t rnd)
+    static double apply(mpfr_srcptr mp, mpfr_rnd_t rnd)
     {
         return mpfr_get_d(mp, rnd);
     }
@@ -64,7 +64,7 @@ public:
 template<> class mpfr_get_trait<long double>
 {
 public:
-    static long double apply(mpfr_t& mp, mpfr_rnd_t rnd)
+    static long double apply(mpfr_srcptr mp, mpfr_rnd_t rnd)
     {
         return mpfr_get_ld(mp, rnd);
     }
@@ -74,7 +74,7 @@ public:
 template<> class mpfr_get_trait<long int>
 {
 public:
-    static long int apply(mpfr_t& mp, mpfr_rnd_t rnd)
+    static long int apply(mpfr_srcptr mp, mpfr_rnd_t rnd)
     {
         return mpfr_get_si(mp, rnd);
     }
@@ -84,7 +84,7 @@ public:
 template<> class mpfr_get_trait<unsigned long int>
 {
 public:
-    static unsigned long int apply(mpfr_t& mp, mpfr_rnd_t rnd)
+    static unsigned long int apply(mpfr_srcptr mp, mpfr_rnd_t rnd)
     {
         return mpfr_get_ui(mp, rnd);
     }
@@ -0,0 +1,135 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#ifndef LIBIEEEP1788_P1788_UTIL_THREADS_HPP
+#define LIBIEEEP1788_P1788_UTIL_THREADS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+
+namespace p1788
+{
+
+namespace util
+{
+
+
+// number of threads used by the parallel operations of the library, i.e. the
+// range versions of the set operations and the products and solvers of
+// p1788::linalg, 0 means hardware concurrency
+inline unsigned& num_threads()
+{
+    static unsigned num_threads_ = 0;
+
+    return num_threads_;
+}
+
+/// \brief Sets the number of threads used by the parallel operations
+///
+/// The setting is shared by the range versions of the set operations and by
+/// the products and solvers of p1788::linalg.
+///
+/// \param n number of threads, 0 uses <c>std::thread::hardware_concurrency()</c>
+/// \return previous value
+inline unsigned set_num_threads(unsigned n)
+{
+    unsigned old = num_threads();
+    num_threads() = n;
+    return old;
+}
+
+inline unsigned get_num_threads()
+{
+    return num_threads();
+}
+
+
+// number of threads which are actually used
+inline unsigned effective_num_threads()
+{
+    return num_threads() ? num_threads() : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// number of parts into which n elements are split, every part has at least
+// min_part elements such that it pays off to start a thread for it
+inline unsigned num_parts(std::size_t n, std::size_t min_part)
+{
+    return static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(effective_num_threads(), n / min_part)));
+}
+
+// splits [0,n) into the given number of parts and calls f(k, i0, i1) for the
+// k-th part in its own thread, an exception thrown by f (e.g. by a signal
+// function) is rethrown in the calling thread after all threads are joined
+template<class Func>
+void parallel_parts(std::size_t n, unsigned parts, Func f)
+{
+    if (parts <= 1)
+    {
+        f(0u, std::size_t(0), n);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(parts);
+    std::size_t const len = (n + parts - 1) / parts;
+
+    for (unsigned k = 0; k < parts; ++k)
+    {
+        std::size_t i0 = std::min(n, k * len);
+        std::size_t i1 = std::min(n, i0 + len);
+
+        threads.push_back(std::thread([&f, &errors, k, i0, i1]()
+        {
+            try
+            {
+                f(k, i0, i1);
+            }
+            catch (...)
+            {
+                errors[k] = std::current_exception();
+            }
+        }));
+    }
+
+    for (auto& th : threads)
+        th.join();
+
+    for (auto const& e : errors)
+        if (e)
+            std::rethrow_exception(e);
+}
+
+
+} // namespace util
+
+} // namespace p1788
+
+
+#endif // LIBIEEEP1788_P1788_UTIL_THREADS_HPP
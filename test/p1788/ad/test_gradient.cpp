@@ -0,0 +1,249 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#define BOOST_TEST_MODULE "Automatic differentiation [p1788/ad/gradient]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/ad/gradient.hpp"
+
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T, std::size_t N = 1>
+using G = p1788::ad::gradient<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor, N>;
+
+
+// the interval x contains y up to a relative error of 1e-12
+bool close(I<double> const& x, double y)
+{
+    return std::abs(mid(x) - y) <= 1e-12 * std::abs(y) + 1e-300 && wid(x) <= 1e-12 * std::abs(y) + 1e-300;
+}
+
+
+BOOST_AUTO_TEST_CASE(gradient_construction_test)
+{
+    G<double, 3> c(I<double>(1.0, 2.0));
+
+    BOOST_CHECK_EQUAL( (G<double, 3>::num_variables()), 3u );
+    BOOST_CHECK_EQUAL( c.value(), I<double>(1.0, 2.0) );
+
+    for (std::size_t i = 0; i < 3; ++i)
+        BOOST_CHECK_EQUAL( c.derivative(i), I<double>(0.0, 0.0) );
+
+    G<double, 3> y = G<double, 3>::variable(I<double>(-1.0, 1.0), 1);
+
+    BOOST_CHECK_EQUAL( y.value(), I<double>(-1.0, 1.0) );
+    BOOST_CHECK_EQUAL( y.derivative(0), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( y.derivative(1), I<double>(1.0, 1.0) );
+    BOOST_CHECK_EQUAL( y.derivative(2), I<double>(0.0, 0.0) );
+
+    G<double> e;
+    BOOST_CHECK( is_empty(e.value()) );
+    BOOST_CHECK_EQUAL( e.derivative(), I<double>(0.0, 0.0) );
+}
+
+BOOST_AUTO_TEST_CASE(gradient_arith_test)
+{
+    G<double, 2> x = G<double, 2>::variable(I<double>(2.0, 2.0), 0);
+    G<double, 2> y = G<double, 2>::variable(I<double>(4.0, 4.0), 1);
+
+    // f = x y + x / y - 3 x + 1, df/dx = y + 1/y - 3, df/dy = x - x/y^2
+    G<double, 2> f = x * y + x / y - I<double>(3.0, 3.0) * x + I<double>(1.0, 1.0);
+
+    BOOST_CHECK_EQUAL( f.value(), I<double>(3.5, 3.5) );
+    BOOST_CHECK_EQUAL( f.derivative(0), I<double>(1.25, 1.25) );
+    BOOST_CHECK_EQUAL( f.derivative(1), I<double>(1.875, 1.875) );
+
+    G<double, 2> g = -(x - y) + fma(x, x, y) - sqr(y) / x;
+
+    BOOST_CHECK_EQUAL( g.value(), I<double>(2.0, 2.0) );
+    BOOST_CHECK_EQUAL( g.derivative(0), I<double>(7.0, 7.0) );
+    BOOST_CHECK_EQUAL( g.derivative(1), I<double>(-2.0, -2.0) );
+
+    G<double, 2> r = recip(y) + pown(x, 3) + pown(x, 0) + pown(y, -1);
+
+    BOOST_CHECK_EQUAL( r.value(), I<double>(9.5, 9.5) );
+    BOOST_CHECK_EQUAL( r.derivative(0), I<double>(12.0, 12.0) );
+    BOOST_CHECK_EQUAL( r.derivative(1), I<double>(-0.125, -0.125) );
+
+    // enclosure of the derivatives over a box
+    G<double> u = G<double>::variable(I<double>(1.0, 2.0));
+    G<double> v = u * u - I<double>(2.0, 2.0) / u;
+
+    BOOST_CHECK( subset(I<double>(3.0, 4.5), v.derivative()) );
+    BOOST_CHECK( subset(I<double>(-1.0, 3.0), v.value()) );
+}
+
+BOOST_AUTO_TEST_CASE(gradient_elem_func_test)
+{
+    typedef std::function<G<double>(G<double> const&)> F;
+    typedef std::function<double(double)> DF;
+
+    struct
+    {
+        F f;
+        DF df;
+        double x;
+    } tests[] =
+    {
+        { [](G<double> const& u) { return sqrt(u); }, [](double x) { return 0.5 / std::sqrt(x); }, 2.0 },
+        { [](G<double> const& u) { return exp(u); }, [](double x) { return std::exp(x); }, 0.7 },
+        { [](G<double> const& u) { return exp2(u); }, [](double x) { return std::log(2.0) * std::exp2(x); }, 0.7 },
+        { [](G<double> const& u) { return exp10(u); }, [](double x) { return std::log(10.0) * std::pow(10.0, x); }, 0.7 },
+        { [](G<double> const& u) { return log(u); }, [](double x) { return 1.0 / x; }, 3.0 },
+        { [](G<double> const& u) { return log2(u); }, [](double x) { return 1.0 / (x * std::log(2.0)); }, 3.0 },
+        { [](G<double> const& u) { return log10(u); }, [](double x) { return 1.0 / (x * std::log(10.0)); }, 3.0 },
+        { [](G<double> const& u) { return sin(u); }, [](double x) { return std::cos(x); }, 0.5 },
+        { [](G<double> const& u) { return cos(u); }, [](double x) { return -std::sin(x); }, 0.5 },
+        { [](G<double> const& u) { return tan(u); }, [](double x) { return 1.0 / (std::cos(x) * std::cos(x)); }, 0.5 },
+        { [](G<double> const& u) { return asin(u); }, [](double x) { return 1.0 / std::sqrt(1.0 - x * x); }, 0.5 },
+        { [](G<double> const& u) { return acos(u); }, [](double x) { return -1.0 / std::sqrt(1.0 - x * x); }, 0.5 },
+        { [](G<double> const& u) { return atan(u); }, [](double x) { return 1.0 / (1.0 + x * x); }, 0.5 },
+        { [](G<double> const& u) { return sinh(u); }, [](double x) { return std::cosh(x); }, 0.5 },
+        { [](G<double> const& u) { return cosh(u); }, [](double x) { return std::sinh(x); }, 0.5 },
+        { [](G<double> const& u) { return tanh(u); }, [](double x) { return 1.0 / (std::cosh(x) * std::cosh(x)); }, 0.5 },
+        { [](G<double> const& u) { return asinh(u); }, [](double x) { return 1.0 / std::sqrt(x * x + 1.0); }, 0.5 },
+        { [](G<double> const& u) { return acosh(u); }, [](double x) { return 1.0 / std::sqrt(x * x - 1.0); }, 1.5 },
+        { [](G<double> const& u) { return atanh(u); }, [](double x) { return 1.0 / (1.0 - x * x); }, 0.5 },
+        { [](G<double> const& u) { return pow(u, I<double>(2.5, 2.5)); }, [](double x) { return 2.5 * std::pow(x, 1.5); }, 3.0 },
+        { [](G<double> const& u) { return pow(I<double>(3.0, 3.0), u); }, [](double x) { return std::log(3.0) * std::pow(3.0, x); }, 0.5 },
+        { [](G<double> const& u) { return pow(u, u); }, [](double x) { return std::pow(x, x) * (std::log(x) + 1.0); }, 1.5 },
+        { [](G<double> const& u) { return atan2(u, I<double>(2.0, 2.0)); }, [](double x) { return 2.0 / (x * x + 4.0); }, 0.5 },
+        { [](G<double> const& u) { return abs(u); }, [](double) { return -1.0; }, -0.5 },
+        { [](G<double> const& u) { return sin(exp(u) * u); }, [](double x) { return std::cos(std::exp(x) * x) * std::exp(x) * (1.0 + x); }, 0.3 }
+    };
+
+    for (auto const& t : tests)
+    {
+        G<double> r = t.f(G<double>::variable(I<double>(t.x, t.x)));
+
+        BOOST_CHECK( close(r.derivative(), t.df(t.x)) );
+    }
+
+    // derivatives enclose the range over a box
+    G<double> s = sin(G<double>::variable(I<double>(0.0, 1.0)));
+    BOOST_CHECK( subset(I<double>(std::cos(1.0), 1.0), s.derivative()) );
+    BOOST_CHECK( subset(s.derivative(), I<double>(0.5, 1.0)) );
+}
+
+BOOST_AUTO_TEST_CASE(gradient_nonsmooth_test)
+{
+    G<double> x = G<double>::variable(I<double>(1.2, 1.5));
+    G<double> y = G<double>::variable(I<double>(0.5, 1.5));
+    G<double> z = G<double>::variable(I<double>(-1.0, 2.0));
+
+    BOOST_CHECK_EQUAL( floor(x).value(), I<double>(1.0, 1.0) );
+    BOOST_CHECK_EQUAL( floor(x).derivative(), I<double>(0.0, 0.0) );
+    BOOST_CHECK( is_entire(floor(y).derivative()) );
+    BOOST_CHECK_EQUAL( ceil(x).derivative(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( trunc(x).derivative(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( round_ties_to_even(G<double>::variable(I<double>(1.2, 1.4))).derivative(), I<double>(0.0, 0.0) );
+    BOOST_CHECK( is_entire(round_ties_to_away(x).derivative()) );
+    BOOST_CHECK_EQUAL( sign(x).derivative(), I<double>(0.0, 0.0) );
+    BOOST_CHECK( is_entire(sign(z).derivative()) );
+
+    // constant arguments have a zero derivative
+    BOOST_CHECK_EQUAL( sign(G<double>(I<double>(-1.0, 1.0))).derivative(), I<double>(0.0, 0.0) );
+
+    BOOST_CHECK_EQUAL( abs(z).value(), I<double>(0.0, 2.0) );
+    BOOST_CHECK_EQUAL( abs(z).derivative(), I<double>(-1.0, 1.0) );
+
+    G<double> m = min(x, I<double>(2.0, 3.0));
+    BOOST_CHECK_EQUAL( m.derivative(), I<double>(1.0, 1.0) );
+    m = max(x, I<double>(2.0, 3.0));
+    BOOST_CHECK_EQUAL( m.derivative(), I<double>(0.0, 0.0) );
+    m = min(y, I<double>(1.0, 1.0));
+    BOOST_CHECK_EQUAL( m.value(), I<double>(0.5, 1.0) );
+    BOOST_CHECK_EQUAL( m.derivative(), I<double>(0.0, 1.0) );
+    m = max(I<double>(1.0, 1.0), y);
+    BOOST_CHECK_EQUAL( m.derivative(), I<double>(0.0, 1.0) );
+}
+
+BOOST_AUTO_TEST_CASE(gradient_multivariate_test)
+{
+    G<double, 2> x = G<double, 2>::variable(I<double>(1.0, 1.0), 0);
+    G<double, 2> y = G<double, 2>::variable(I<double>(1.0, 1.0), 1);
+
+    // d/dx atan2(y, x) = -y / (x^2 + y^2), d/dy atan2(y, x) = x / (x^2 + y^2)
+    G<double, 2> a = atan2(y, x);
+
+    BOOST_CHECK( close(a.value(), std::atan(1.0)) );
+    BOOST_CHECK_EQUAL( a.derivative(0), I<double>(-0.5, -0.5) );
+    BOOST_CHECK_EQUAL( a.derivative(1), I<double>(0.5, 0.5) );
+
+    // float bounds
+    G<float, 2> u = G<float, 2>::variable(I<float>(2.0f, 2.0f), 0);
+    G<float, 2> v = G<float, 2>::variable(I<float>(3.0f, 3.0f), 1);
+    G<float, 2> w = exp(u * v) / u;
+
+    // dw/du = exp(u v) (u v - 1) / u^2, dw/dv = exp(u v)
+    BOOST_CHECK( is_member(std::exp(6.0) * 1.25, w.derivative(0)) );
+    BOOST_CHECK( is_member(std::exp(6.0), w.derivative(1)) );
+    BOOST_CHECK( wid(w.derivative(1)) < 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE(gradient_mean_value_form_test)
+{
+    // f(x) = x (1 - x) over [0.4,0.6], range [0.24,0.25]
+    I<double> x(0.4, 0.6);
+    I<double> c(0.5, 0.5);
+
+    G<double> fx = G<double>::variable(x) * (I<double>(1.0, 1.0) - G<double>::variable(x));
+    G<double> fc = G<double>(c) * (I<double>(1.0, 1.0) - G<double>(c));
+
+    I<double> natural = fx.value();
+    I<double> mean_value = fc.value() + fx.derivative() * (x - c);
+
+    BOOST_CHECK( subset(I<double>(0.24, 0.25), mean_value) );
+    BOOST_CHECK( wid(mean_value) < 0.05 );
+    BOOST_CHECK( wid(natural) > 0.15 );
+}
+
+BOOST_AUTO_TEST_CASE(gradient_newton_test)
+{
+    // interval Newton for x^2 - 2 on [1,2] without a hand-written derivative
+    I<double> x(1.0, 2.0);
+
+    for (int k = 0; k < 10; ++k)
+    {
+        G<double> fx = sqr(G<double>::variable(x)) - I<double>(2.0, 2.0);
+        I<double> c(mid(x), mid(x));
+        I<double> fc = sqr(c) - I<double>(2.0, 2.0);
+
+        x = intersection(x, c - fc / fx.derivative());
+    }
+
+    BOOST_CHECK( is_member(std::sqrt(2.0), x) );
+    BOOST_CHECK( wid(x) < 1e-15 );
+}
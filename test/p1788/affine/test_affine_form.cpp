@@ -0,0 +1,301 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#define BOOST_TEST_MODULE "Affine arithmetic [p1788/affine/affine_form]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/affine/affine_form.hpp"
+
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using AF = p1788::affine::affine_form<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+
+BOOST_AUTO_TEST_CASE(arena_test)
+{
+    using p1788::affine::arena;
+
+    void* p = arena::allocate(24);
+    arena::deallocate(p, 24);
+
+    // same size class, recycled block
+    void* q = arena::allocate(32);
+    BOOST_CHECK( p == q );
+
+    void* r = arena::allocate(32);
+    BOOST_CHECK( r != q );
+    BOOST_CHECK_EQUAL( reinterpret_cast<std::size_t>(r) % 16, 0u );
+
+    arena::deallocate(q, 32);
+    arena::deallocate(r, 32);
+
+    // forwarded to operator new
+    void* big = arena::allocate(1 << 20);
+    arena::deallocate(big, 1 << 20);
+
+    std::vector<int, p1788::affine::arena_allocator<int>> v;
+    for (int i = 0; i < 10000; ++i)
+        v.push_back(i);
+
+    BOOST_CHECK_EQUAL( v[9999], 9999 );
+}
+
+BOOST_AUTO_TEST_CASE(arena_threads_test)
+{
+    using p1788::affine::arena;
+
+    // a block released by a thread which exits is reused by another thread
+    void* p = nullptr;
+    void* q = nullptr;
+
+    std::thread([&p] { p = arena::allocate(1000); }).join();
+    std::thread([p] { arena::deallocate(p, 1000); }).join();
+    std::thread([&q] { q = arena::allocate(1000); arena::deallocate(q, 1000); }).join();
+
+    BOOST_CHECK( p == q );
+
+    // producer and consumer: the blocks released by the consumer are moved
+    // to the global free list and reused by the producer
+    std::size_t const n = 2 * arena::chunk_size / 1024;
+    std::vector<void*> blocks;
+    std::set<void*> released;
+    std::atomic<int> step(0);
+    void* reused = nullptr;
+
+    std::thread producer([&]
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            blocks.push_back(arena::allocate(1024));
+
+        step = 1;
+        while (step != 2)
+            std::this_thread::yield();
+
+        reused = arena::allocate(1024);
+        arena::deallocate(reused, 1024);
+        step = 3;
+    });
+
+    std::thread consumer([&]
+    {
+        while (step != 1)
+            std::this_thread::yield();
+
+        for (void* b : blocks)
+        {
+            released.insert(b);
+            arena::deallocate(b, 1024);
+        }
+
+        step = 2;
+        while (step != 3)
+            std::this_thread::yield();
+    });
+
+    producer.join();
+    consumer.join();
+
+    BOOST_CHECK( released.count(reused) == 1 );
+}
+
+BOOST_AUTO_TEST_CASE(affine_form_conversion_test)
+{
+    AF<double> x(I<double>(1.0, 3.0));
+
+    BOOST_CHECK( !x.is_special() );
+    BOOST_CHECK_EQUAL( x.center(), 2.0 );
+    BOOST_CHECK_EQUAL( x.terms().size(), 1u );
+    BOOST_CHECK( x.radius() >= 1.0 );
+    BOOST_CHECK( subset(I<double>(1.0, 3.0), x.to_interval()) );
+    BOOST_CHECK( wid(x.to_interval()) <= 2.0 + 1e-14 );
+    BOOST_CHECK( to_interval(x) == x.to_interval() );
+
+    AF<double> y(I<double>(1.0, 3.0));
+    BOOST_CHECK( y.terms()[0].symbol > x.terms()[0].symbol );
+
+    AF<double> c(2.5);
+    BOOST_CHECK( !c.is_special() );
+    BOOST_CHECK( c.terms().empty() );
+    BOOST_CHECK_EQUAL( c.to_interval(), I<double>(2.5, 2.5) );
+
+    AF<double> e;
+    BOOST_CHECK( e.is_special() );
+    BOOST_CHECK( is_empty(e.to_interval()) );
+
+    AF<double> u(I<double>(1.0, INF_D));
+    BOOST_CHECK( u.is_special() );
+    BOOST_CHECK_EQUAL( u.to_interval(), I<double>(1.0, INF_D) );
+}
+
+BOOST_AUTO_TEST_CASE(affine_form_dependency_test)
+{
+    AF<double> x(I<double>(1.0, 2.0));
+    AF<double> y(I<double>(-1.0, 1.0));
+
+    BOOST_CHECK_EQUAL( (x - x).to_interval(), I<double>(0.0, 0.0) );
+    BOOST_CHECK( ((x + y) - y).to_interval() == x.to_interval() );
+    BOOST_CHECK_EQUAL( (2.0 * x - x - x).to_interval(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( (x + 1.0 - x).to_interval(), I<double>(1.0, 1.0) );
+    BOOST_CHECK_EQUAL( (-x + x).to_interval(), I<double>(0.0, 0.0) );
+
+    // x (1 - x) over [0.4,0.6] has the range [0.24,0.25]
+    AF<double> z(I<double>(0.4, 0.6));
+    I<double> zi(0.4, 0.6);
+
+    I<double> a = (z * (1.0 - z)).to_interval();
+    I<double> b = zi * (I<double>(1.0, 1.0) - zi);
+
+    BOOST_CHECK( subset(I<double>(0.24, 0.25), a) );
+    BOOST_CHECK( wid(a) < 0.5 * wid(b) );
+
+    // sqr is tighter than the product
+    BOOST_CHECK( subset((sqr(y) - 0.5).to_interval(), I<double>(-0.5, 0.5)) );
+}
+
+BOOST_AUTO_TEST_CASE(affine_form_soundness_test)
+{
+    typedef std::function<AF<double>(AF<double> const&, AF<double> const&)> FA;
+    typedef std::function<I<double>(I<double> const&, I<double> const&)> FI;
+
+    std::vector<std::pair<FA, FI>> functions =
+    {
+        { [](AF<double> const& x, AF<double> const& y) { return x + y - x * y; },
+          [](I<double> const& x, I<double> const& y) { return x + y - x * y; } },
+        { [](AF<double> const& x, AF<double> const& y) { return x / y + sqr(x - y); },
+          [](I<double> const& x, I<double> const& y) { return x / y + sqr(x - y); } },
+        { [](AF<double> const& x, AF<double> const& y) { return sqrt(x) * exp(y) - log(x * y); },
+          [](I<double> const& x, I<double> const& y) { return sqrt(x) * exp(y) - log(x * y); } },
+        { [](AF<double> const& x, AF<double> const& y) { return recip(x) - 3.0 / y + x / 7.0 - (2.0 - y); },
+          [](I<double> const& x, I<double> const& y) { return recip(x) - I<double>(3.0, 3.0) / y + x / I<double>(7.0, 7.0) - (I<double>(2.0, 2.0) - y); } }
+    };
+
+    std::mt19937 gen(1788);
+    std::uniform_real_distribution<double> lower(0.1, 10.0);
+    std::uniform_real_distribution<double> width(0.0, 1.0);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    for (int k = 0; k < 200; ++k)
+    {
+        double xl = lower(gen);
+        double xu = xl + width(gen);
+        double yl = lower(gen);
+        double yu = yl + width(gen);
+
+        AF<double> x(I<double>(xl, xu));
+        AF<double> y(I<double>(yl, yu));
+
+        for (auto const& f : functions)
+        {
+            I<double> r = f.first(x, y).to_interval();
+
+            for (int s = 0; s < 5; ++s)
+            {
+                double t = xl + (xu - xl) * unit(gen);
+                double u = yl + (yu - yl) * unit(gen);
+
+                BOOST_CHECK( subset(f.second(I<double>(t, t), I<double>(u, u)), r) );
+            }
+
+            // the bounds may be attained at the corners, where the interval
+            // evaluation itself overestimates the exact value
+            BOOST_CHECK( !disjoint(f.second(I<double>(xl, xl), I<double>(yu, yu)), r) );
+            BOOST_CHECK( !disjoint(f.second(I<double>(xu, xu), I<double>(yl, yl)), r) );
+        }
+    }
+
+    // negative arguments of recip
+    AF<double> n(I<double>(-3.0, -2.0));
+    BOOST_CHECK( subset(I<double>(-0.5, -1.0 / 3.0), recip(n).to_interval()) );
+}
+
+BOOST_AUTO_TEST_CASE(affine_form_long_computation_test)
+{
+    // y := 2 y - x keeps y = x, interval arithmetic triples the width in every step
+    I<double> xi(1.0, 1.001);
+    AF<double> x(xi);
+
+    I<double> yi = xi;
+    AF<double> y = x;
+
+    for (int k = 0; k < 20; ++k)
+    {
+        yi = I<double>(2.0, 2.0) * yi - xi;
+        y = 2.0 * y - x;
+    }
+
+    BOOST_CHECK( subset(xi, y.to_interval()) );
+    BOOST_CHECK( wid(y.to_interval()) < 0.0011 );
+    BOOST_CHECK( wid(yi) > 1000.0 );
+}
+
+BOOST_AUTO_TEST_CASE(affine_form_special_test)
+{
+    AF<double> x(I<double>(1.0, 2.0));
+    AF<double> u(I<double>(1.0, INF_D));
+    AF<double> z(I<double>(-1.0, 1.0));
+
+    BOOST_CHECK( (x + u).is_special() );
+    BOOST_CHECK_EQUAL( (x + u).to_interval(), I<double>(2.0, INF_D) );
+    BOOST_CHECK( (x * u).is_special() );
+    BOOST_CHECK( (x - u).is_special() );
+
+    BOOST_CHECK( recip(z).is_special() );
+    BOOST_CHECK( is_entire(recip(z).to_interval()) );
+    BOOST_CHECK( (x / z).is_special() );
+
+    BOOST_CHECK( is_empty(log(-x).to_interval()) );
+    BOOST_CHECK( is_empty(sqrt(-x).to_interval()) );
+
+    AF<double> s = sqrt(AF<double>(I<double>(-1.0, 4.0)));
+    BOOST_CHECK( !s.is_special() );
+    BOOST_CHECK_EQUAL( s.to_interval(), I<double>(0.0, 2.0) );
+
+    // overflow
+    AF<double> big(I<double>(1e300, 1e301));
+    BOOST_CHECK( is_entire((big * big).to_interval()) || sup((big * big).to_interval()) == INF_D );
+    BOOST_CHECK( exp(big).is_special() );
+
+    // float
+    AF<float> f(I<float>(1.0f, 2.0f));
+    BOOST_CHECK_EQUAL( (f - f).to_interval(), I<float>(0.0f, 0.0f) );
+    BOOST_CHECK( subset(I<float>(0.5f, 1.0f), recip(f).to_interval()) );
+}
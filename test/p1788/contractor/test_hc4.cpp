@@ -0,0 +1,324 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "HC4 contractor [p1788/contractor/hc4]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/contractor/hc4.hpp"
+
+
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double MAX_D = std::numeric_limits<double>::max();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+typedef p1788::contractor::dag<I<double>> DAG;
+typedef p1788::contractor::hc4<I<double>> HC4;
+typedef HC4::box_type BOX;
+
+
+BOOST_AUTO_TEST_CASE(dag_forward_test)
+{
+    DAG d;
+    auto x = d.variable(0);
+    auto y = d.variable(1);
+    auto f = d.sub(d.mul(x, y), d.constant(I<double>(2.0, 2.0)));
+
+    BOOST_CHECK_EQUAL( d.size(), 5u );
+    BOOST_CHECK_EQUAL( d.variables(), 2u );
+
+    std::vector<I<double>> v;
+    d.forward(BOX {I<double>(-2.0, 2.0), I<double>(1.0, 3.0)}, v);
+
+    BOOST_CHECK_EQUAL( v.size(), 5u );
+    BOOST_CHECK_EQUAL( v[x], I<double>(-2.0, 2.0) );
+    BOOST_CHECK_EQUAL( v[y], I<double>(1.0, 3.0) );
+    BOOST_CHECK_EQUAL( v[f], I<double>(-8.0, 4.0) );
+}
+
+BOOST_AUTO_TEST_CASE(hc4_revise_test)
+{
+    DAG d;
+    auto x = d.variable(0);
+
+    HC4 c(d);
+    c.add_constraint(d.sqr(x), I<double>(2.0, 2.0));
+
+    // nodes may be added after the constraints
+    d.add(x, x);
+
+    BOX b {I<double>(0.0, 10.0)};
+    BOOST_CHECK( c.revise(0, b) );
+    BOOST_CHECK( is_member(std::sqrt(2.0), b[0]) );
+    BOOST_CHECK( wid(b[0]) < 1e-15 );
+
+    b = BOX {I<double>(-10.0, 10.0)};
+    BOOST_CHECK( c.revise(0, b) );
+    BOOST_CHECK( is_member(std::sqrt(2.0), b[0]) );
+    BOOST_CHECK( is_member(-std::sqrt(2.0), b[0]) );
+    BOOST_CHECK( subset(b[0], I<double>(-1.5, 1.5)) );
+
+    b = BOX {I<double>(2.0, 10.0)};
+    BOOST_CHECK( !c.revise(0, b) );
+}
+
+BOOST_AUTO_TEST_CASE(hc4_revise_op_test)
+{
+    DAG d;
+    auto x = d.variable(0);
+    auto y = d.variable(1);
+
+    HC4 c(d);
+    c.add_constraint(d.neg(x), I<double>(1.0, 2.0));                        // 0
+    c.add_constraint(d.add(x, y), I<double>(0.0, 1.0));                     // 1
+    c.add_constraint(d.sub(x, y), I<double>(0.0, 1.0));                     // 2
+    c.add_constraint(d.mul(x, y), I<double>(4.0, 4.0));                     // 3
+    c.add_constraint(d.div(x, y), I<double>(2.0, 2.0));                     // 4
+    c.add_constraint(d.pown(x, 3), I<double>(8.0, 27.0));                   // 5
+    c.add_constraint(d.pow(x, y), I<double>(4.0, 4.0));                     // 6
+    c.add_constraint(d.sqrt(x), I<double>(2.0, 3.0));                       // 7
+    c.add_constraint(d.exp(x), I<double>(1.0, 1.0));                        // 8
+    c.add_constraint(d.log(x), I<double>(0.0, 0.0));                        // 9
+    c.add_constraint(d.sin(x), I<double>(0.0, 0.0));                        // 10
+    c.add_constraint(d.cos(x), I<double>(1.0, 1.0));                        // 11
+    c.add_constraint(d.tan(x), I<double>(0.0, 0.0));                        // 12
+    c.add_constraint(d.cosh(x), I<double>(1.0, 1.0));                       // 13
+    c.add_constraint(d.atan2(x, y), I<double>(0.0, 0.0));                   // 14
+    c.add_constraint(d.abs(x), I<double>(1.0, 2.0));                        // 15
+
+    BOX b {I<double>(-10.0, 10.0), I<double>(-10.0, 10.0)};
+    BOOST_CHECK( c.revise(0, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(-2.0, -1.0) );
+
+    b = BOX {I<double>(-10.0, 10.0), I<double>(0.0, 0.5)};
+    BOOST_CHECK( c.revise(1, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(-0.5, 1.0) );
+    BOOST_CHECK_EQUAL( b[1], I<double>(0.0, 0.5) );
+
+    b = BOX {I<double>(-10.0, 10.0), I<double>(0.0, 0.5)};
+    BOOST_CHECK( c.revise(2, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 1.5) );
+
+    b = BOX {I<double>(1.0, 10.0), I<double>(2.0, 8.0)};
+    BOOST_CHECK( c.revise(3, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(1.0, 2.0) );
+    BOOST_CHECK_EQUAL( b[1], I<double>(2.0, 4.0) );
+
+    b = BOX {I<double>(1.0, 10.0), I<double>(2.0, 8.0)};
+    BOOST_CHECK( c.revise(4, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(4.0, 10.0) );
+    BOOST_CHECK_EQUAL( b[1], I<double>(2.0, 5.0) );
+
+    b = BOX {I<double>(-10.0, 10.0), I<double>()};
+    BOOST_CHECK( c.revise(5, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(2.0, 3.0) );
+
+    b = BOX {I<double>(2.0, 2.0), I<double>(-10.0, 10.0)};
+    BOOST_CHECK( c.revise(6, b) );
+    BOOST_CHECK( is_member(2.0, b[1]) );
+    BOOST_CHECK( wid(b[1]) < 1e-14 );
+
+    b = BOX {I<double>(-10.0, 10.0), I<double>()};
+    BOOST_CHECK( c.revise(7, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(4.0, 9.0) );
+
+    b = BOX {I<double>(-10.0, 10.0), I<double>()};
+    BOOST_CHECK( c.revise(8, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 0.0) );
+
+    b = BOX {I<double>(-10.0, 10.0), I<double>()};
+    BOOST_CHECK( c.revise(9, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(1.0, 1.0) );
+
+    b = BOX {I<double>(1.0, 4.0), I<double>()};
+    BOOST_CHECK( c.revise(10, b) );
+    BOOST_CHECK( is_member(std::acos(-1.0), b[0]) );
+    BOOST_CHECK( wid(b[0]) < 1e-15 );
+
+    b = BOX {I<double>(-1.0, 1.0), I<double>()};
+    BOOST_CHECK( c.revise(11, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 0.0) );
+
+    b = BOX {I<double>(-1.0, 1.0), I<double>()};
+    BOOST_CHECK( c.revise(12, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 0.0) );
+
+    b = BOX {I<double>(-1.0, 1.0), I<double>()};
+    BOOST_CHECK( c.revise(13, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 0.0) );
+
+    b = BOX {I<double>(-1.0, 1.0), I<double>(1.0, 2.0)};
+    BOOST_CHECK( c.revise(14, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( b[1], I<double>(1.0, 2.0) );
+
+    b = BOX {I<double>(-10.0, 0.0), I<double>()};
+    BOOST_CHECK( c.revise(15, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(-2.0, -1.0) );
+}
+
+BOOST_AUTO_TEST_CASE(hc4_shared_subexpression_test)
+{
+    DAG d;
+    auto x = d.variable(0);
+    auto y = d.variable(1);
+    auto t = d.add(x, y);
+
+    HC4 c(d);
+    // (x + y)^2 + (x + y) = 6
+    c.add_constraint(d.add(d.sqr(t), t), I<double>(6.0, 6.0));
+
+    BOX b {I<double>(0.0, 1.0), I<double>(0.0, 10.0)};
+    BOOST_CHECK( c.revise(0, b) );
+    BOOST_CHECK_EQUAL( b[0], I<double>(0.0, 1.0) );
+    BOOST_CHECK( subset(b[1], I<double>(0.0, 2.45)) );
+    BOOST_CHECK( is_member(2.0, b[1]) );
+}
+
+BOOST_AUTO_TEST_CASE(hc4_contract_test)
+{
+    // x - 0.5 y = 1, y - 0.5 x = 0
+    DAG d;
+    auto x = d.variable(0);
+    auto y = d.variable(1);
+    auto h = d.constant(I<double>(0.5, 0.5));
+
+    HC4 c(d);
+    c.add_constraint(d.sub(x, d.mul(h, y)), I<double>(1.0, 1.0));
+    c.add_constraint(d.sub(y, d.mul(h, x)), I<double>(0.0, 0.0));
+
+    BOOST_CHECK_EQUAL( c.size(), 2u );
+    BOOST_CHECK_EQUAL( c.ratio(), 0.01 );
+
+    BOX b {I<double>(-10.0, 10.0), I<double>(-10.0, 10.0)};
+    BOOST_CHECK( c.contract(b) );
+    BOOST_CHECK( is_member(4.0 / 3.0, b[0]) );
+    BOOST_CHECK( is_member(2.0 / 3.0, b[1]) );
+    BOOST_CHECK( wid(b[0]) < 0.5 );
+    BOOST_CHECK( wid(b[1]) < 0.5 );
+
+    // a smaller ratio gives a tighter fixpoint
+    c.set_ratio(0.0);
+    BOX b2 {I<double>(-10.0, 10.0), I<double>(-10.0, 10.0)};
+    BOOST_CHECK( c.contract(b2) );
+    BOOST_CHECK( is_member(4.0 / 3.0, b2[0]) );
+    BOOST_CHECK( is_member(2.0 / 3.0, b2[1]) );
+    BOOST_CHECK( subset(b2[0], b[0]) );
+    BOOST_CHECK( subset(b2[1], b[1]) );
+    BOOST_CHECK( wid(b2[0]) < 1e-14 );
+    BOOST_CHECK( wid(b2[1]) < 1e-14 );
+
+    // infeasible
+    b = BOX {I<double>(-10.0, 10.0), I<double>(1.0, 2.0)};
+    BOOST_CHECK( !c.contract(b) );
+    BOOST_CHECK( is_empty(b[0]) );
+    BOOST_CHECK( is_empty(b[1]) );
+}
+
+BOOST_AUTO_TEST_CASE(hc4_contract_nonlinear_test)
+{
+    // x^2 + y^2 = 1, x - y = 0
+    DAG d;
+    auto x = d.variable(0);
+    auto y = d.variable(1);
+
+    HC4 c(d);
+    c.add_constraint(d.add(d.sqr(x), d.sqr(y)), I<double>(1.0, 1.0));
+    c.add_constraint(d.sub(x, y), I<double>(0.0, 0.0));
+
+    BOX b {I<double>(0.0, 2.0), I<double>(0.0, 2.0)};
+    BOOST_CHECK( c.contract(b) );
+    BOOST_CHECK( is_member(std::sqrt(0.5), b[0]) );
+    BOOST_CHECK( is_member(std::sqrt(0.5), b[1]) );
+    BOOST_CHECK( subset(b[0], I<double>(0.0, 1.0)) );
+    BOOST_CHECK( subset(b[1], I<double>(0.0, 1.0)) );
+
+    // infeasible
+    b = BOX {I<double>(1.0, 2.0), I<double>(0.0, 2.0)};
+    BOOST_CHECK( !c.contract(b) );
+    BOOST_CHECK( is_empty(b[0]) );
+    BOOST_CHECK( is_empty(b[1]) );
+
+    // unbounded
+    b = BOX {I<double>(-INF_D, INF_D), I<double>(0.0, INF_D)};
+    BOOST_CHECK( c.contract(b) );
+    BOOST_CHECK( subset(b[0], I<double>(0.0, 1.0)) );
+    BOOST_CHECK( subset(b[1], I<double>(0.0, 1.0)) );
+}
+
+BOOST_AUTO_TEST_CASE(hc4_branch_and_prune_test)
+{
+    // x^2 - 2 = 0
+    DAG d;
+    auto x = d.variable(0);
+
+    HC4 c(d);
+    c.add_constraint(d.sub(d.sqr(x), d.constant(I<double>(2.0, 2.0))), I<double>(0.0, 0.0));
+
+    std::vector<BOX> boxes;
+    c.branch_and_prune(BOX {I<double>(-10.0, 10.0)}, 1e-8, std::back_inserter(boxes));
+
+    BOOST_CHECK( boxes.size() >= 2u );
+
+    bool pos = false;
+    bool neg = false;
+
+    for (auto const& b : boxes)
+    {
+        BOOST_CHECK( wid(b[0]) < 1e-8 );
+        BOOST_CHECK( subset(b[0], I<double>(-1.5, -1.4)) || subset(b[0], I<double>(1.4, 1.5)) );
+
+        pos = pos || is_member(std::sqrt(2.0), b[0]);
+        neg = neg || is_member(-std::sqrt(2.0), b[0]);
+    }
+
+    BOOST_CHECK( pos );
+    BOOST_CHECK( neg );
+
+    // x^2 + 1 = 0
+    HC4 c2(d);
+    c2.add_constraint(d.sqr(x), I<double>(-1.0, -1.0));
+
+    boxes.clear();
+    c2.branch_and_prune(BOX {I<double>(-INF_D, INF_D)}, 1e-8, std::back_inserter(boxes));
+    BOOST_CHECK( boxes.empty() );
+
+    // unbounded box which can not be bisected any further
+    HC4 c3(d);
+    c3.add_constraint(d.sqr(x), I<double>(1.0, INF_D));
+
+    boxes.clear();
+    c3.branch_and_prune(BOX {I<double>(MAX_D, INF_D)}, 1.0, std::back_inserter(boxes));
+    BOOST_CHECK_EQUAL( boxes.size(), 1u );
+    BOOST_CHECK_EQUAL( boxes[0][0], I<double>(MAX_D, INF_D) );
+}
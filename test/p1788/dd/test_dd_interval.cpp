@@ -0,0 +1,239 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#define BOOST_TEST_MODULE "Double-double intervals [p1788/dd/dd_interval]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/dd/dd_interval.hpp"
+
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <sstream>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double MAX_D = std::numeric_limits<double>::max();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+using p1788::dd::double_double;
+using p1788::dd::dd_interval;
+
+const std::float_round_style DOWN = std::round_toward_neg_infinity;
+const std::float_round_style UP = std::round_toward_infinity;
+
+
+// exact value of a double_double
+struct exact
+{
+    mpfr_t v;
+
+    exact(double_double const& x)
+    {
+        mpfr_init2(v, 2200);
+        mpfr_set_d(v, x.hi(), MPFR_RNDN);
+        mpfr_add_d(v, v, x.lo(), MPFR_RNDN);
+    }
+
+    ~exact()
+    {
+        mpfr_clear(v);
+    }
+};
+
+// checks lower <= f(x, y) <= upper and the relative width of [lower, upper]
+void check_enclosure(double_double const& x, double_double const& y,
+                     std::function<double_double(double_double const&, double_double const&, std::float_round_style)> f,
+                     std::function<int(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t)> g,
+                     double rel)
+{
+    exact ex(x);
+    exact ey(y);
+    mpfr_t r;
+    mpfr_init2(r, 400);
+
+    double_double l = f(x, y, DOWN);
+    double_double u = f(x, y, UP);
+    exact el(l);
+    exact eu(u);
+
+    g(r, ex.v, ey.v, MPFR_RNDD);
+    BOOST_CHECK( mpfr_lessequal_p(el.v, r) );
+    g(r, ex.v, ey.v, MPFR_RNDU);
+    BOOST_CHECK( mpfr_lessequal_p(r, eu.v) );
+
+    mpfr_sub(r, eu.v, el.v, MPFR_RNDU);
+    BOOST_CHECK( mpfr_cmp_d(r, rel * std::abs(l.hi())) <= 0 );
+
+    mpfr_clear(r);
+}
+
+
+BOOST_AUTO_TEST_CASE(double_double_test)
+{
+    BOOST_CHECK( (std::is_same<p1788::util::max_precision_type<double, double_double, float>::type,
+                  double_double>::value) );
+
+    // exact results are returned exactly
+    BOOST_CHECK( double_double::add(1.0, 2.0, DOWN) == double_double(3.0) );
+    BOOST_CHECK( double_double::add(1.0, 1e-30, UP) == double_double(1.0, 1e-30) );
+    BOOST_CHECK( double_double::mul(3.0, double_double(1.0, std::ldexp(1.0, -80)), UP)
+                 == double_double(3.0, 3.0 * std::ldexp(1.0, -80)) );
+    BOOST_CHECK( double_double::div(6.0, 3.0, DOWN) == double_double(2.0) );
+    BOOST_CHECK( double_double::sqrt(16.0, UP) == double_double(4.0) );
+
+    double_double third_l = double_double::div(1.0, 3.0, DOWN);
+    double_double third_u = double_double::div(1.0, 3.0, UP);
+    BOOST_CHECK( third_l < third_u );
+    BOOST_CHECK( third_l.get<double>(DOWN) == 1.0 / 3.0 );
+    BOOST_CHECK( third_u.get<double>(UP) == std::nextafter(1.0 / 3.0, 1.0) );
+    BOOST_CHECK( double_double::sub(third_u, third_l, UP).hi() < std::ldexp(1.0, -104) );
+
+    // overflow
+    BOOST_CHECK( double_double::mul(MAX_D, 2.0, UP).hi() == INF_D );
+    BOOST_CHECK( double_double::mul(MAX_D, 2.0, DOWN).hi() == MAX_D );
+    BOOST_CHECK( double_double::add(MAX_D, MAX_D, DOWN).hi() == MAX_D );
+
+    // long double
+    long double ld = 1.0L + std::ldexp(1.0L, -60);
+    BOOST_CHECK( double_double(ld, DOWN) == double_double(1.0, std::ldexp(1.0, -60)) );
+    BOOST_CHECK( double_double(1.0, std::ldexp(1.0, -60)).get<long double>(UP) == ld );
+    BOOST_CHECK( third_u.get<float>(DOWN) == std::nextafter(1.0f / 3.0f, 0.0f) );
+    BOOST_CHECK( third_u.get<float>(UP) == 1.0f / 3.0f );
+}
+
+BOOST_AUTO_TEST_CASE(double_double_random_test)
+{
+    std::mt19937_64 gen(1788);
+    std::uniform_real_distribution<double> mant(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-1070, 1020);
+    std::uniform_int_distribution<int> near(-60, 60);
+
+    auto random_dd = [&](bool extreme)
+    {
+        int e = extreme ? expo(gen) : near(gen);
+        double h = std::ldexp(mant(gen), e);
+        return double_double(h, h * std::ldexp(mant(gen), -53));
+    };
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        bool extreme = i % 4 == 0;
+        double_double x = random_dd(extreme);
+        double_double y = random_dd(extreme);
+
+        // tight enclosures in the interior of the exponent range
+        double rel = extreme ? INF_D : std::ldexp(1.0, -100);
+
+        check_enclosure(x, y, double_double::add,
+                        [](mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b, mpfr_rnd_t rnd) { return mpfr_add(r, a, b, rnd); },
+                        std::abs(x.hi() + y.hi()) > 1e-10 * std::abs(x.hi()) ? rel : INF_D);
+
+        check_enclosure(x, y, double_double::mul,
+                        [](mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b, mpfr_rnd_t rnd) { return mpfr_mul(r, a, b, rnd); },
+                        rel);
+
+        if (y.hi() != 0.0)
+            check_enclosure(x, y, double_double::div,
+                            [](mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b, mpfr_rnd_t rnd) { return mpfr_div(r, a, b, rnd); },
+                            rel);
+
+        check_enclosure(double_double::abs(x), y,
+                        [](double_double const& a, double_double const&, std::float_round_style rnd)
+                        { return double_double::sqrt(a, rnd); },
+                        [](mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr, mpfr_rnd_t rnd) { return mpfr_sqrt(r, a, rnd); },
+                        rel);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dd_interval_test)
+{
+    dd_interval e;
+
+    BOOST_CHECK( is_empty(e) );
+    BOOST_CHECK( is_empty(e + dd_interval(1.0, 2.0)) );
+    BOOST_CHECK( is_entire(dd_interval::entire()) );
+
+    BOOST_CHECK_EQUAL( (dd_interval(1.0, 2.0) - dd_interval(1.0, 2.0)).to_interval<double>(), I<double>(-1.0, 1.0) );
+    BOOST_CHECK_EQUAL( (dd_interval(-1.0, 2.0) * dd_interval(-3.0, 4.0)).to_interval<double>(), I<double>(-6.0, 8.0) );
+    BOOST_CHECK_EQUAL( (dd_interval(0.0, 0.0) * dd_interval::entire()).to_interval<double>(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( (dd_interval(-2.0, -1.0) * dd_interval(0.0, INF_D)).to_interval<double>(), I<double>(-INF_D, 0.0) );
+    BOOST_CHECK_EQUAL( (dd_interval(1.0, 2.0) / dd_interval(4.0, 8.0)).to_interval<double>(), I<double>(0.125, 0.5) );
+    BOOST_CHECK_EQUAL( (dd_interval(1.0, 2.0) / dd_interval(0.0, 4.0)).to_interval<double>(), I<double>(0.25, INF_D) );
+    BOOST_CHECK( is_entire(dd_interval(1.0, 2.0) / dd_interval(-1.0, 1.0)) );
+    BOOST_CHECK( is_empty(dd_interval(1.0, 2.0) / dd_interval(0.0, 0.0)) );
+    BOOST_CHECK_EQUAL( recip(dd_interval(-4.0, -2.0)).to_interval<double>(), I<double>(-0.5, -0.25) );
+    BOOST_CHECK_EQUAL( sqr(dd_interval(-3.0, 2.0)).to_interval<double>(), I<double>(0.0, 9.0) );
+    BOOST_CHECK_EQUAL( sqrt(dd_interval(-4.0, 4.0)).to_interval<double>(), I<double>(0.0, 2.0) );
+    BOOST_CHECK( is_empty(sqrt(dd_interval(-4.0, -1.0))) );
+
+    BOOST_CHECK_EQUAL( intersection(dd_interval(1.0, 3.0), dd_interval(2.0, 4.0)).to_interval<double>(), I<double>(2.0, 3.0) );
+    BOOST_CHECK_EQUAL( convex_hull(dd_interval(1.0, 2.0), dd_interval(3.0, 4.0)).to_interval<double>(), I<double>(1.0, 4.0) );
+    BOOST_CHECK( is_member(2.5, dd_interval(1.0, 3.0)) );
+
+    // tight enclosure of sqrt(2), the square contains 2
+    dd_interval s = sqrt(dd_interval(2.0, 2.0));
+    BOOST_CHECK( wid(s) < std::ldexp(1.0, -100) );
+    BOOST_CHECK_EQUAL( s.to_interval<double>(), sqrt(I<double>(2.0, 2.0)) );
+    BOOST_CHECK( is_member(2.0, sqr(s)) );
+
+    p1788::exception::clear();
+    BOOST_CHECK( is_empty(dd_interval(2.0, 1.0)) );
+    BOOST_CHECK( p1788::exception::undefined_operation() );
+    p1788::exception::clear();
+
+    std::ostringstream os;
+    os << dd_interval(1.0, 2.0) << " " << e;
+    BOOST_CHECK_EQUAL( os.str(), "[1,2] [empty]" );
+}
+
+BOOST_AUTO_TEST_CASE(dd_interval_mixed_type_test)
+{
+    I<double> x(1.0, 2.0);
+    I<float> y(3.0f, 3.0f);
+
+    dd_interval r = dd_interval(x) / y;
+    BOOST_CHECK_EQUAL( r.to_interval<double>(), x / I<double>(3.0, 3.0) );
+    BOOST_CHECK( wid(I<double>(1.0, 1.0) / dd_interval(y)) < std::ldexp(1.0, -104) );
+
+    BOOST_CHECK( subset(dd_interval(x) + dd_interval(0.5, 0.5), dd_interval(x) + I<double>(0.5, 0.5)) );
+    BOOST_CHECK( equal(x * dd_interval(2.0, 2.0), dd_interval(2.0, 4.0)) );
+    BOOST_CHECK( equal(dd_interval(2.0, 4.0) - x, dd_interval(0.0, 3.0)) );
+
+    BOOST_CHECK_EQUAL( dd_interval(I<long double>(1.0L, 2.0L)).to_interval<long double>(), I<long double>(1.0L, 2.0L) );
+
+    // cancellation which is lost in double
+    I<double> a(1.0, 1.0);
+    I<double> tiny(1e-20, 1e-20);
+    BOOST_CHECK_EQUAL( (a + tiny) - a, I<double>(0.0, std::ldexp(1.0, -52)) );
+    BOOST_CHECK( is_member(1e-20, (dd_interval(a) + tiny) - a) );
+    BOOST_CHECK( wid((dd_interval(a) + tiny) - a) == 0.0 );
+}
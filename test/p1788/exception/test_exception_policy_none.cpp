@@ -0,0 +1,72 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define P1788_EXCEPTION_POLICY P1788_EXCEPTION_POLICY_NONE
+
+#define BOOST_TEST_MODULE "Exceptions, no-op policy [p1788/exception/exception]"
+#include "test/util/boost_test_wrapper.hpp"
+
+#include <limits>
+#include <type_traits>
+
+#include "p1788/p1788.hpp"
+
+using namespace p1788;
+
+template<typename T>
+using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+BOOST_AUTO_TEST_CASE(minimal_exception_policy_none_test)
+{
+    BOOST_CHECK((std::is_same<exception::signal_policy, exception::no_op_policy>::value));
+    BOOST_CHECK(noexcept(exception::signal_policy::signal<exception::invalid_operand_exception>(exception::invalid_operand_bit)));
+
+    exception::set_throw_exception_cwd(exception::undefined_operation_bit | exception::possibly_undefined_operation_bit
+                                       | exception::interval_part_of_nai_bit | exception::invalid_operand_bit);
+    exception::clear();
+
+    // the signaled bit is returned, but neither recorded nor thrown
+    BOOST_CHECK_EQUAL(exception::signal_undefined_operation(), exception::undefined_operation_bit);
+    BOOST_CHECK_EQUAL(exception::signal_possibly_undefined_operation(), exception::possibly_undefined_operation_bit);
+    BOOST_CHECK_EQUAL(exception::signal_interval_part_of_nai(), exception::interval_part_of_nai_bit);
+    BOOST_CHECK_EQUAL(exception::signal_invalid_operand(), exception::invalid_operand_bit);
+    BOOST_CHECK_EQUAL(exception::state(), exception::none_bit);
+
+    // invalid representations are still rejected
+    BOOST_CHECK(!F<double>::is_valid(F<double>::representation(2.0, 1.0)));
+    BOOST_CHECK(!F<double>::is_valid(F<double>::representation(std::numeric_limits<double>::infinity(),
+                                                               std::numeric_limits<double>::infinity())));
+    BOOST_CHECK(F<double>::is_empty(F<double>::add(F<double>::representation(2.0, 1.0),
+                                                   F<double>::representation(1.0, 2.0))));
+
+    BOOST_CHECK_NO_THROW(I<double>(2.0, 1.0));
+    BOOST_CHECK(is_empty(I<double>(2.0, 1.0)));
+    BOOST_CHECK_EQUAL(exception::state(), exception::none_bit);
+
+    exception::set_throw_exception_cwd(exception::none_bit);
+}
@@ -31,7 +31,9 @@
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
 #include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
 
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 template<typename T>
 using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
@@ -1968,3 +1970,123 @@ BOOST_AUTO_TEST_CASE(minimal_disjoint_dec_mixedtype_test)
     p1788::exception::clear();
     p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
 }
+
+// all pairs of bounds, including invalid ones, and the empty interval
+std::vector<REP<double>> bool_mask_inputs()
+{
+    const double MAX_D = std::numeric_limits<double>::max();
+    const double bounds[] = { -INF_D, -MAX_D, -2.0, -1.0, -0.0, 0.0, 1.0, 2.0, MAX_D, INF_D };
+
+    std::vector<REP<double>> v;
+    for (double l : bounds)
+        for (double u : bounds)
+            v.push_back(REP<double>(l, u));
+    v.push_back(F<double>::empty());
+    v.push_back(REP<double>(NaN_D, 1.0));
+
+    return v;
+}
+
+bool bit(std::vector<std::uint64_t> const& mask, std::size_t i)
+{
+    return (mask[i / 64] >> (i % 64)) & 1u;
+}
+
+// compares the array versions of a binary predicate with the scalar one
+void check_bool_mask(bool (*f)(REP<double> const&, REP<double> const&),
+                     void (*g)(double const*, double const*, double const*, double const*, std::uint64_t*, std::size_t),
+                     void (*gy)(double const*, double const*, REP<double> const&, std::uint64_t*, std::size_t),
+                     void (*gx)(REP<double> const&, double const*, double const*, std::uint64_t*, std::size_t))
+{
+    std::vector<REP<double>> v = bool_mask_inputs();
+
+    std::vector<double> xl, xu, yl, yu;
+    for (auto const& a : v)
+        for (auto const& b : v)
+        {
+            xl.push_back(a.first);
+            xu.push_back(a.second);
+            yl.push_back(b.first);
+            yu.push_back(b.second);
+        }
+
+    std::size_t n = xl.size();
+    std::vector<std::uint64_t> mask((n + 63) / 64, ~std::uint64_t(0));
+
+    p1788::exception::clear();
+    g(xl.data(), xu.data(), yl.data(), yu.data(), mask.data(), n);
+    BOOST_CHECK( p1788::exception::invalid_operand() );
+
+    for (std::size_t i = 0; i < n; ++i)
+        BOOST_CHECK_EQUAL( bit(mask, i), f(REP<double>(xl[i], xu[i]), REP<double>(yl[i], yu[i])) );
+
+    // unused bits of the last word
+    BOOST_CHECK_EQUAL( mask.back() >> (n % 64), 0u );
+
+    std::vector<double> vl, vu;
+    for (auto const& a : v)
+    {
+        vl.push_back(a.first);
+        vu.push_back(a.second);
+    }
+
+    std::vector<std::uint64_t> fixed_mask((v.size() + 63) / 64);
+
+    for (auto const& c : v)
+    {
+        gy(vl.data(), vu.data(), c, fixed_mask.data(), v.size());
+        for (std::size_t i = 0; i < v.size(); ++i)
+            BOOST_CHECK_EQUAL( bit(fixed_mask, i), f(v[i], c) );
+
+        gx(c, vl.data(), vu.data(), fixed_mask.data(), v.size());
+        for (std::size_t i = 0; i < v.size(); ++i)
+            BOOST_CHECK_EQUAL( bit(fixed_mask, i), f(c, v[i]) );
+    }
+
+    // only valid inputs: no invalid operand signaled
+    double l[] = { 1.0, NaN_D, -INF_D, 0.0 };
+    double u[] = { 2.0, NaN_D, 0.0, 0.0 };
+
+    p1788::exception::clear();
+    g(l, u, l, u, mask.data(), 4);
+    gy(l, u, REP<double>(-1.0, 1.0), mask.data(), 4);
+    gx(F<double>::empty(), l, u, mask.data(), 4);
+    BOOST_CHECK( !p1788::exception::invalid_operand() );
+
+    g(l, u, l, u, mask.data(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_bool_mask_test)
+{
+    std::vector<REP<double>> v = bool_mask_inputs();
+
+    std::vector<double> l, u;
+    for (auto const& a : v)
+    {
+        l.push_back(a.first);
+        u.push_back(a.second);
+    }
+
+    std::vector<std::uint64_t> mask((v.size() + 63) / 64);
+
+    p1788::exception::clear();
+    F<double>::is_empty(l.data(), u.data(), mask.data(), v.size());
+    BOOST_CHECK( p1788::exception::invalid_operand() );
+    for (std::size_t i = 0; i < v.size(); ++i)
+        BOOST_CHECK_EQUAL( bit(mask, i), F<double>::is_empty(v[i]) );
+
+    F<double>::is_entire(l.data(), u.data(), mask.data(), v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+        BOOST_CHECK_EQUAL( bit(mask, i), F<double>::is_entire(v[i]) );
+
+    check_bool_mask(&F<double>::equal, &F<double>::equal, &F<double>::equal, &F<double>::equal);
+    check_bool_mask(&F<double>::subset, &F<double>::subset, &F<double>::subset, &F<double>::subset);
+    check_bool_mask(&F<double>::less, &F<double>::less, &F<double>::less, &F<double>::less);
+    check_bool_mask(&F<double>::precedes, &F<double>::precedes, &F<double>::precedes, &F<double>::precedes);
+    check_bool_mask(&F<double>::interior, &F<double>::interior, &F<double>::interior, &F<double>::interior);
+    check_bool_mask(&F<double>::strictly_less, &F<double>::strictly_less, &F<double>::strictly_less, &F<double>::strictly_less);
+    check_bool_mask(&F<double>::strictly_precedes, &F<double>::strictly_precedes, &F<double>::strictly_precedes, &F<double>::strictly_precedes);
+    check_bool_mask(&F<double>::disjoint, &F<double>::disjoint, &F<double>::disjoint, &F<double>::disjoint);
+
+    p1788::exception::clear();
+}
@@ -7320,3 +7320,534 @@ BOOST_AUTO_TEST_CASE(minimal_max_dec_mixedtype_test)
 }
 
 
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_add_assign_test)
+{
+    REP<double> x = F<double>::empty();
+    F<double>::add_assign(x, REP<double>(-1.0,1.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(-1.0,1.0);
+    F<double>::add_assign(x, F<double>::empty());
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = F<double>::entire();
+    F<double>::add_assign(x, REP<double>(-1.0,1.0));
+    BOOST_CHECK_EQUAL( x, F<double>::entire() );
+
+    x = REP<double>(-INF_D,2.0);
+    F<double>::add_assign(x, REP<double>(3.0,INF_D));
+    BOOST_CHECK_EQUAL( x, F<double>::entire() );
+
+    x = REP<double>(1.0,2.0);
+    F<double>::add_assign(x, REP<double>(3.0,4.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(4.0,6.0) );
+
+    x = REP<double>(1.0,MAX_D);
+    F<double>::add_assign(x, REP<double>(-3.0,MAX_D));
+    BOOST_CHECK_EQUAL( x, REP<double>(-2.0,INF_D) );
+
+    x = REP<double>(std::stod("0X1.FFFFFFFFFFFFP+0"),std::stod("0X1.FFFFFFFFFFFFP+0"));
+    F<double>::add_assign(x, REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")));
+    BOOST_CHECK_EQUAL( x, REP<double>(std::stod("0X1.0CCCCCCCCCCC4P+1"),std::stod("0X1.0CCCCCCCCCCC5P+1")) );
+
+    x = REP<double>(1.0,2.0);
+    F<double>::add_assign(x, x);
+    BOOST_CHECK_EQUAL( x, REP<double>(2.0,4.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP<double>(1.0,2.0);
+    F<double>::add_assign(x, REP<double>(1.0,-2.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<double>(INF_D,2.0);
+    BOOST_CHECK_THROW( F<double>::add_assign(x, REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_add_assign_mixedtype_test)
+{
+    REP<float> x(1.0f,2.0f);
+    F<float>::add_assign(x, REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")));
+    BOOST_CHECK_EQUAL( x, REP<float>(std::stof("0X1.199998P+0"),std::stof("0X1.0CCCCEP+1")) );
+
+    REP<double> y(1.0,2.0);
+    F<double>::add_assign(y, REP<float>(3.0f,INF_F));
+    BOOST_CHECK_EQUAL( y, REP<double>(4.0,INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP<double>(1.0,2.0);
+    F<double>::add_assign(y, REP<float>(1.0f,-2.0f));
+    BOOST_CHECK( F<double>::is_empty(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<float>(1.0f,2.0f);
+    BOOST_CHECK_THROW( F<float>::add_assign(x, REP<double>(1.0,-INF_D)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_add_assign_dec_test)
+{
+    REP_DEC<double> x(REP<double>(-MAX_D,2.0), DEC::com);
+    F<double>::add_assign(x, REP_DEC<double>(REP<double>(-0.1,5.0), DEC::com));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(-INF_D,7.0), DEC::dac) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::add_assign(x, REP_DEC<double>(REP<double>(5.0,7.0), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(6.0,9.0), DEC::def) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::trv);
+    F<double>::add_assign(x, F<double>::empty_dec());
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL( x.second, DEC::trv );
+
+    x = F<double>::nai();
+    F<double>::add_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::add_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<double>(REP<double>(1.0,-2.0), DEC::com);
+    BOOST_CHECK_THROW( F<double>::add_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_add_assign_dec_mixedtype_test)
+{
+    REP_DEC<float> x(REP<float>(1.0f,2.0f), DEC::com);
+    F<float>::add_assign(x, REP_DEC<double>(REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<float>(REP<float>(std::stof("0X1.199998P+0"),std::stof("0X1.0CCCCEP+1")), DEC::def) );
+
+    REP_DEC<double> y(REP<double>(-MAX_D,2.0), DEC::com);
+    F<double>::add_assign(y, REP_DEC<float>(REP<float>(-1.0f,5.0f), DEC::com));
+    BOOST_CHECK_EQUAL( y, REP_DEC<double>(REP<double>(-INF_D,7.0), DEC::dac) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::add_assign(y, REP_DEC<float>(REP<float>(1.0f,-2.0f), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com);
+    BOOST_CHECK_THROW( F<float>::add_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_sub_assign_test)
+{
+    REP<double> x = F<double>::empty();
+    F<double>::sub_assign(x, REP<double>(-1.0,1.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(-1.0,1.0);
+    F<double>::sub_assign(x, F<double>::empty());
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(-INF_D,2.0);
+    F<double>::sub_assign(x, REP<double>(3.0,4.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(-INF_D,-1.0) );
+
+    x = REP<double>(1.0,2.0);
+    F<double>::sub_assign(x, REP<double>(3.0,4.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(-3.0,-1.0) );
+
+    x = REP<double>(-1.0,MAX_D);
+    F<double>::sub_assign(x, REP<double>(-MAX_D,1.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(-2.0,INF_D) );
+
+    x = REP<double>(std::stod("0X1.FFFFFFFFFFFFP+0"),std::stod("0X1.FFFFFFFFFFFFP+0"));
+    F<double>::sub_assign(x, REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")));
+    BOOST_CHECK_EQUAL( x, REP<double>(std::stod("0X1.E666666666656P+0"),std::stod("0X1.E666666666657P+0")) );
+
+    x = REP<double>(1.0,2.0);
+    F<double>::sub_assign(x, x);
+    BOOST_CHECK_EQUAL( x, REP<double>(-1.0,1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP<double>(1.0,2.0);
+    F<double>::sub_assign(x, REP<double>(1.0,-2.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<double>(INF_D,2.0);
+    BOOST_CHECK_THROW( F<double>::sub_assign(x, REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sub_assign_mixedtype_test)
+{
+    REP<float> x(1.0f,2.0f);
+    F<float>::sub_assign(x, REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")));
+    BOOST_CHECK_EQUAL( x, REP<float>(std::stof("0X1.CCCCCCP-1"),std::stof("0X1.E66668P+0")) );
+
+    REP<double> y(1.0,2.0);
+    F<double>::sub_assign(y, REP<float>(3.0f,INF_F));
+    BOOST_CHECK_EQUAL( y, REP<double>(-INF_D,-1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP<double>(1.0,2.0);
+    F<double>::sub_assign(y, REP<float>(1.0f,-2.0f));
+    BOOST_CHECK( F<double>::is_empty(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<float>(1.0f,2.0f);
+    BOOST_CHECK_THROW( F<float>::sub_assign(x, REP<double>(1.0,-INF_D)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sub_assign_dec_test)
+{
+    REP_DEC<double> x(REP<double>(-1.0,2.0), DEC::com);
+    F<double>::sub_assign(x, REP_DEC<double>(REP<double>(5.0,MAX_D), DEC::com));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(-INF_D,-3.0), DEC::dac) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::sub_assign(x, REP_DEC<double>(REP<double>(5.0,7.0), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(-6.0,-3.0), DEC::def) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::trv);
+    F<double>::sub_assign(x, F<double>::empty_dec());
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL( x.second, DEC::trv );
+
+    x = F<double>::nai();
+    F<double>::sub_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::sub_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<double>(REP<double>(1.0,-2.0), DEC::com);
+    BOOST_CHECK_THROW( F<double>::sub_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sub_assign_dec_mixedtype_test)
+{
+    REP_DEC<float> x(REP<float>(1.0f,2.0f), DEC::com);
+    F<float>::sub_assign(x, REP_DEC<double>(REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<float>(REP<float>(std::stof("0X1.CCCCCCP-1"),std::stof("0X1.E66668P+0")), DEC::def) );
+
+    REP_DEC<double> y(REP<double>(-1.0,2.0), DEC::com);
+    F<double>::sub_assign(y, REP_DEC<float>(REP<float>(5.0f,7.0f), DEC::com));
+    BOOST_CHECK_EQUAL( y, REP_DEC<double>(REP<double>(-8.0,-3.0), DEC::com) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::sub_assign(y, REP_DEC<float>(REP<float>(1.0f,-2.0f), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com);
+    BOOST_CHECK_THROW( F<float>::sub_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_mul_assign_test)
+{
+    REP<double> x = F<double>::empty();
+    F<double>::mul_assign(x, REP<double>(-1.0,1.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(-1.0,1.0);
+    F<double>::mul_assign(x, F<double>::empty());
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = F<double>::entire();
+    F<double>::mul_assign(x, REP<double>(0.0,0.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(0.0,0.0) );
+
+    x = REP<double>(-1.0,2.0);
+    F<double>::mul_assign(x, REP<double>(-3.0,4.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(-6.0,8.0) );
+
+    x = REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.FFFFFFFFFFFFP+0"));
+    F<double>::mul_assign(x, REP<double>(-std::stod("0X1.FFFFFFFFFFFFP+0"),INF_D));
+    BOOST_CHECK_EQUAL( x, REP<double>(-std::stod("0X1.FFFFFFFFFFFE1P+1"),INF_D) );
+
+    x = REP<double>(-2.0,3.0);
+    F<double>::mul_assign(x, x);
+    BOOST_CHECK_EQUAL( x, REP<double>(-6.0,9.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP<double>(1.0,2.0);
+    F<double>::mul_assign(x, REP<double>(1.0,-2.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<double>(INF_D,2.0);
+    BOOST_CHECK_THROW( F<double>::mul_assign(x, REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_mul_assign_mixedtype_test)
+{
+    REP<float> x(1.0f,2.0f);
+    F<float>::mul_assign(x, REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")));
+    BOOST_CHECK_EQUAL( x, REP<float>(std::stof("0X1.999998P-4"),std::stof("0X1.99999AP-3")) );
+
+    REP<double> y(-1.0,2.0);
+    F<double>::mul_assign(y, REP<float>(3.0f,INF_F));
+    BOOST_CHECK_EQUAL( y, F<double>::entire() );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP<double>(1.0,2.0);
+    F<double>::mul_assign(y, REP<float>(1.0f,-2.0f));
+    BOOST_CHECK( F<double>::is_empty(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<float>(1.0f,2.0f);
+    BOOST_CHECK_THROW( F<float>::mul_assign(x, REP<double>(1.0,-INF_D)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_mul_assign_dec_test)
+{
+    REP_DEC<double> x(REP<double>(-MAX_D,2.0), DEC::com);
+    F<double>::mul_assign(x, REP_DEC<double>(REP<double>(-1.0,5.0), DEC::com));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(-INF_D,MAX_D), DEC::dac) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::mul_assign(x, REP_DEC<double>(REP<double>(5.0,7.0), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(5.0,14.0), DEC::def) );
+
+    x = F<double>::nai();
+    F<double>::mul_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::mul_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<double>(REP<double>(1.0,-2.0), DEC::com);
+    BOOST_CHECK_THROW( F<double>::mul_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_mul_assign_dec_mixedtype_test)
+{
+    REP_DEC<float> x(REP<float>(1.0f,2.0f), DEC::com);
+    F<float>::mul_assign(x, REP_DEC<double>(REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<float>(REP<float>(std::stof("0X1.999998P-4"),std::stof("0X1.99999AP-3")), DEC::def) );
+
+    REP_DEC<double> y(REP<double>(-1.0,2.0), DEC::com);
+    F<double>::mul_assign(y, REP_DEC<float>(REP<float>(-3.0f,4.0f), DEC::com));
+    BOOST_CHECK_EQUAL( y, REP_DEC<double>(REP<double>(-6.0,8.0), DEC::com) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::mul_assign(y, REP_DEC<float>(REP<float>(1.0f,-2.0f), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com);
+    BOOST_CHECK_THROW( F<float>::mul_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_div_assign_test)
+{
+    REP<double> x = F<double>::empty();
+    F<double>::div_assign(x, REP<double>(-1.0,1.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(-1.0,1.0);
+    F<double>::div_assign(x, F<double>::empty());
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(-1.0,1.0);
+    F<double>::div_assign(x, REP<double>(0.0,0.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+
+    x = REP<double>(1.0,2.0);
+    F<double>::div_assign(x, REP<double>(-1.0,1.0));
+    BOOST_CHECK_EQUAL( x, F<double>::entire() );
+
+    x = REP<double>(-2.0,-1.0);
+    F<double>::div_assign(x, REP<double>(-10.0,-3.0));
+    BOOST_CHECK_EQUAL( x, REP<double>(std::stod("0X1.9999999999999P-4"),std::stod("0X1.5555555555556P-1")) );
+
+    x = REP<double>(2.0,4.0);
+    F<double>::div_assign(x, x);
+    BOOST_CHECK_EQUAL( x, REP<double>(0.5,2.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP<double>(1.0,2.0);
+    F<double>::div_assign(x, REP<double>(1.0,-2.0));
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<double>(INF_D,2.0);
+    BOOST_CHECK_THROW( F<double>::div_assign(x, REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_div_assign_mixedtype_test)
+{
+    REP<float> x(1.0f,2.0f);
+    F<float>::div_assign(x, REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")));
+    BOOST_CHECK_EQUAL( x, REP<float>(std::stof("0X1.3FFFFEP+3"),std::stof("0X1.4P+4")) );
+
+    REP<double> y(1.0,2.0);
+    F<double>::div_assign(y, REP<float>(4.0f,INF_F));
+    BOOST_CHECK_EQUAL( y, REP<double>(0.0,0.5) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP<double>(1.0,2.0);
+    F<double>::div_assign(y, REP<float>(1.0f,-2.0f));
+    BOOST_CHECK( F<double>::is_empty(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP<float>(1.0f,2.0f);
+    BOOST_CHECK_THROW( F<float>::div_assign(x, REP<double>(1.0,-INF_D)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_div_assign_dec_test)
+{
+    REP_DEC<double> x(REP<double>(-2.0,-1.0), DEC::com);
+    F<double>::div_assign(x, REP_DEC<double>(REP<double>(-10.0,-3.0), DEC::com));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(REP<double>(std::stod("0X1.9999999999999P-4"),std::stod("0X1.5555555555556P-1")), DEC::com) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::div_assign(x, REP_DEC<double>(REP<double>(-1.0,1.0), DEC::com));
+    BOOST_CHECK_EQUAL( x, REP_DEC<double>(F<double>::entire(), DEC::trv) );
+
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::div_assign(x, REP_DEC<double>(REP<double>(0.0,0.0), DEC::com));
+    BOOST_CHECK( F<double>::is_empty(x) );
+    BOOST_CHECK_EQUAL( x.second, DEC::trv );
+
+    x = F<double>::nai();
+    F<double>::div_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    x = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::div_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(x) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<double>(REP<double>(1.0,-2.0), DEC::com);
+    BOOST_CHECK_THROW( F<double>::div_assign(x, REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_div_assign_dec_mixedtype_test)
+{
+    REP_DEC<float> x(REP<float>(1.0f,2.0f), DEC::com);
+    F<float>::div_assign(x, REP_DEC<double>(REP<double>(std::stod("0X1.999999999999AP-4"),std::stod("0X1.999999999999AP-4")), DEC::def));
+    BOOST_CHECK_EQUAL( x, REP_DEC<float>(REP<float>(std::stof("0X1.3FFFFEP+3"),std::stof("0X1.4P+4")), DEC::def) );
+
+    REP_DEC<double> y(REP<double>(-2.0,-1.0), DEC::com);
+    F<double>::div_assign(y, REP_DEC<float>(REP<float>(-10.0f,-3.0f), DEC::com));
+    BOOST_CHECK_EQUAL( y, REP_DEC<double>(REP<double>(std::stod("0X1.9999999999999P-4"),std::stod("0X1.5555555555556P-1")), DEC::com) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    y = REP_DEC<double>(REP<double>(1.0,2.0), DEC::com);
+    F<double>::div_assign(y, REP_DEC<float>(REP<float>(1.0f,-2.0f), DEC::com));
+    BOOST_CHECK( F<double>::is_nai(y) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    x = REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com);
+    BOOST_CHECK_THROW( F<float>::div_assign(x, REP_DEC<double>(REP<double>(1.0,INF_D), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
@@ -34,6 +34,8 @@
 #include <string>
 #include <limits>
 #include <cmath>
+#include <cfenv>
+#include <vector>
 
 template<typename T>
 using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
@@ -1395,3 +1397,144 @@ BOOST_AUTO_TEST_CASE(minimal_mig_dec_mixedtype_test)
     p1788::exception::clear();
     p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
 }
+
+
+// the native computation in the default rounding mode has to give the same
+// results as the computation via MPFR used in the other rounding modes
+template<typename T>
+void check_mid_rad_native()
+{
+    const T inf = std::numeric_limits<T>::infinity();
+    const T max = std::numeric_limits<T>::max();
+    const T min = std::numeric_limits<T>::min();
+    const T dmin = std::numeric_limits<T>::denorm_min();
+
+    std::vector<T> b = { -inf, -max, -std::nextafter(max, T(0)), T(-1), T(-0.1), -2 * min, -min, -3 * dmin, -dmin, T(-0.0),
+                         T(0.0), dmin, 3 * dmin, min, 2 * min + dmin, T(1.0) / 3, T(1), std::nextafter(T(1), inf), max, inf
+                       };
+
+    for (T l : b)
+        for (T u : b)
+        {
+            if (l > u || l == inf || u == -inf)
+                continue;
+
+            std::fesetround(FE_TONEAREST);
+            std::pair<T,T> native = F<T>::mid_rad(REP<T>(l,u));
+            T mid_native = F<T>::mid(REP<T>(l,u));
+            std::fesetround(FE_UPWARD);
+            std::pair<T,T> mpfr = F<T>::mid_rad(REP<T>(l,u));
+            T mid_mpfr = F<T>::mid(REP<T>(l,u));
+            std::fesetround(FE_TONEAREST);
+
+            BOOST_CHECK_EQUAL( native.first, mpfr.first );
+            BOOST_CHECK_EQUAL( std::signbit(native.first), std::signbit(mpfr.first) );
+            BOOST_CHECK_EQUAL( native.second, mpfr.second );
+            BOOST_CHECK_EQUAL( std::signbit(native.second), std::signbit(mpfr.second) );
+            BOOST_CHECK_EQUAL( mid_native, mid_mpfr );
+        }
+}
+
+BOOST_AUTO_TEST_CASE(minimal_mid_rad_native_test)
+{
+    check_mid_rad_native<double>();
+    check_mid_rad_native<float>();
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+}
+
+template<typename T>
+bool same_array_result(T a, T b)
+{
+    return (a != a && b != b) || (a == b && std::signbit(a) == std::signbit(b));
+}
+
+template<typename T>
+void check_num_func_array(int rnd)
+{
+    const T inf = std::numeric_limits<T>::infinity();
+    const T max = std::numeric_limits<T>::max();
+    const T min = std::numeric_limits<T>::min();
+    const T dmin = std::numeric_limits<T>::denorm_min();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+
+    std::vector<T> b = { -inf, -max, -std::nextafter(max, T(0)), T(-1), T(-0.1), -2 * min, -min, -3 * dmin, -dmin, T(-0.0),
+                         T(0.0), dmin, 3 * dmin, min, 2 * min + dmin, T(1.0) / 3, T(1), std::nextafter(T(1), inf), max, inf
+                       };
+
+    std::vector<T> l, u;
+    for (T x : b)
+        for (T y : b)
+            if (x <= y && x != inf && y != -inf)
+            {
+                l.push_back(x);
+                u.push_back(y);
+            }
+
+    // empty set
+    l.push_back(nan);
+    u.push_back(nan);
+
+    std::vector<T> out(l.size());
+
+    std::fesetround(rnd);
+
+    F<T>::wid(l.data(), u.data(), out.data(), l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        BOOST_CHECK( same_array_result(out[i], F<T>::wid(REP<T>(l[i],u[i]))) );
+
+    F<T>::mid(l.data(), u.data(), out.data(), l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        BOOST_CHECK( same_array_result(out[i], F<T>::mid(REP<T>(l[i],u[i]))) );
+
+    F<T>::rad(l.data(), u.data(), out.data(), l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        BOOST_CHECK( same_array_result(out[i], F<T>::rad(REP<T>(l[i],u[i]))) );
+
+    F<T>::mag(l.data(), u.data(), out.data(), l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        BOOST_CHECK( same_array_result(out[i], F<T>::mag(REP<T>(l[i],u[i]))) );
+
+    F<T>::mig(l.data(), u.data(), out.data(), l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        BOOST_CHECK( same_array_result(out[i], F<T>::mig(REP<T>(l[i],u[i]))) );
+
+    // in place
+    std::vector<T> w(u);
+    F<T>::wid(l.data(), w.data(), w.data(), l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        BOOST_CHECK( same_array_result(w[i], F<T>::wid(REP<T>(l[i],u[i]))) );
+
+    std::fesetround(FE_TONEAREST);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_num_func_array_test)
+{
+    check_num_func_array<double>(FE_TONEAREST);
+    check_num_func_array<double>(FE_UPWARD);
+    check_num_func_array<float>(FE_TONEAREST);
+    check_num_func_array<float>(FE_UPWARD);
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    double l[] = { 1.0, 2.0, -INF_D };
+    double u[] = { 3.0, 1.0, INF_D };
+    double out[3];
+
+    F<double>::wid(l, u, out, 3);
+    BOOST_CHECK_EQUAL( out[0], 2.0 );
+    BOOST_CHECK( std::isnan(out[1]) );
+    BOOST_CHECK_EQUAL( out[2], INF_D );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+
+    F<double>::mid(l, u, out, 3);
+    BOOST_CHECK_EQUAL( out[0], 2.0 );
+    BOOST_CHECK( std::isnan(out[1]) );
+    BOOST_CHECK_EQUAL( out[2], 0.0 );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+
+    F<double>::mig(l, u, out, 0);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+}
@@ -31,7 +31,9 @@
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
 #include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
 
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 template<typename T>
 using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
@@ -421,3 +423,45 @@ BOOST_AUTO_TEST_CASE(minimal_mixedtype_is_member_dec_test)
     p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
 }
 
+
+BOOST_AUTO_TEST_CASE(minimal_is_member_mask_test)
+{
+    const double bounds[] = { -INF_D, -MAX_D, -1.0, -0.0, 0.0, 1.0, MAX_D, INF_D, NaN_D };
+
+    std::vector<double> m, l, u;
+    for (double a : bounds)
+        for (double b : bounds)
+            for (double c : bounds)
+            {
+                m.push_back(a);
+                l.push_back(b);
+                u.push_back(c);
+            }
+
+    std::size_t n = m.size();
+    std::vector<std::uint64_t> mask((n + 63) / 64);
+
+    p1788::exception::clear();
+    F<double>::is_member(m.data(), l.data(), u.data(), mask.data(), n);
+    BOOST_CHECK( p1788::exception::invalid_operand() );
+
+    for (std::size_t i = 0; i < n; ++i)
+        BOOST_CHECK_EQUAL( (mask[i / 64] >> (i % 64)) & 1u, F<double>::is_member(m[i], REP<double>(l[i], u[i])) );
+
+    for (double a : bounds)
+    {
+        F<double>::is_member(a, l.data(), u.data(), mask.data(), n);
+
+        for (std::size_t i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL( (mask[i / 64] >> (i % 64)) & 1u, F<double>::is_member(a, REP<double>(l[i], u[i])) );
+    }
+
+    p1788::exception::clear();
+    double vl[] = { 1.0, NaN_D, -INF_D };
+    double vu[] = { 2.0, NaN_D, 0.0 };
+    F<double>::is_member(1.5, vl, vu, mask.data(), 3);
+    BOOST_CHECK_EQUAL( mask[0], 1u );
+    F<double>::is_member(-7.0, vl, vu, mask.data(), 3);
+    BOOST_CHECK_EQUAL( mask[0], 4u );
+    BOOST_CHECK( !p1788::exception::invalid_operand() );
+}
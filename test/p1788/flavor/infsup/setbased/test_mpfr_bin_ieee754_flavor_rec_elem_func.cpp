@@ -0,0 +1,1310 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Flavor: Recommended forward elementary functions [p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor]"
+#include "test/util/boost_test_wrapper.hpp"
+
+#include "p1788/exception/exception.hpp"
+#include "p1788/decoration/decoration.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+#include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
+
+#include <limits>
+
+template<typename T>
+using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
+
+template<typename T>
+using REP = typename F<T>::representation;
+
+template<typename T>
+using REP_DEC = typename F<T>::representation_dec;
+
+typedef p1788::decoration::decoration DEC;
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double NaN_D = std::numeric_limits<double>::quiet_NaN();
+const double MAX_D = std::numeric_limits<double>::max();
+const double MIN_D = std::numeric_limits<double>::min();
+const double DNORM_MIN_D = std::numeric_limits<double>::denorm_min();
+
+const double INF_F = std::numeric_limits<float>::infinity();
+const double NaN_F = std::numeric_limits<float>::quiet_NaN();
+const double MAX_F = std::numeric_limits<float>::max();
+const double MIN_F = std::numeric_limits<float>::min();
+const double DNORM_MIN_F = std::numeric_limits<float>::denorm_min();
+
+BOOST_AUTO_TEST_CASE(minimal_rootn_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(F<double>::empty(), 3) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-INF_D,INF_D), 3), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,0.0), 3), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-0.0,0.0), 3), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(1.0,1.0), 3), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,27.0), 3), REP<double>(-2.0,3.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-1.0,4.0), 3), REP<double>(-1.0,std::stod("0X1.965FEA53D6E3DP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-4.0,-1.0), 3), REP<double>(std::stod("-0X1.965FEA53D6E3DP+0"),-1.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), 3), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(2.0,2.0), 3), REP<double>(std::stod("0X1.428A2F98D728AP+0"),std::stod("0X1.428A2F98D728BP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(4.0,9.0), 3), REP<double>(std::stod("0X1.965FEA53D6E3CP+0"),std::stod("0X1.0A402FCC79299P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,-1.0), 3), REP<double>(-2.0,-1.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,0.0), 3), REP<double>(-2.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,8.0), 3), REP<double>(0.0,2.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,8.0), 3), REP<double>(-2.0,2.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-4.0,0.0), 3), REP<double>(std::stod("-0X1.965FEA53D6E3DP+0"),0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,4.0), 3), REP<double>(0.0,std::stod("0X1.965FEA53D6E3DP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), 3), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(F<double>::empty(), 2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-INF_D,INF_D), 2), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,0.0), 2), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-0.0,0.0), 2), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(1.0,1.0), 2), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,27.0), 2), REP<double>(0.0,std::stod("0X1.4C8DC2E42398P+2")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-1.0,4.0), 2), REP<double>(0.0,2.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-4.0,-1.0), 2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), 2), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(2.0,2.0), 2), REP<double>(std::stod("0X1.6A09E667F3BCCP+0"),std::stod("0X1.6A09E667F3BCDP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(4.0,9.0), 2), REP<double>(2.0,3.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-8.0,-1.0), 2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,0.0), 2), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,8.0), 2), REP<double>(0.0,std::stod("0X1.6A09E667F3BCDP+1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,8.0), 2), REP<double>(0.0,std::stod("0X1.6A09E667F3BCDP+1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-4.0,0.0), 2), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,4.0), 2), REP<double>(0.0,2.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), 2), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(F<double>::empty(), -2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-INF_D,INF_D), -2), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(0.0,0.0), -2) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-0.0,0.0), -2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(1.0,1.0), -2), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,27.0), -2), REP<double>(std::stod("0X1.8A2345CC04425P-3"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-1.0,4.0), -2), REP<double>(0.5,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-4.0,-1.0), -2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), -2), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(2.0,2.0), -2), REP<double>(std::stod("0X1.6A09E667F3BCCP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(4.0,9.0), -2), REP<double>(std::stod("0X1.5555555555555P-2"),0.5) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-8.0,-1.0), -2) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-8.0,0.0), -2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,8.0), -2), REP<double>(std::stod("0X1.6A09E667F3BCCP-2"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,8.0), -2), REP<double>(std::stod("0X1.6A09E667F3BCCP-2"),INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-4.0,0.0), -2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,4.0), -2), REP<double>(0.5,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), -2), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(F<double>::empty(), -3) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-INF_D,INF_D), -3), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(0.0,0.0), -3) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(-0.0,0.0), -3) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(1.0,1.0), -3), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,27.0), -3), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-1.0,4.0), -3), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-4.0,-1.0), -3), REP<double>(-1.0,std::stod("-0X1.428A2F98D728AP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), -3), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(2.0,2.0), -3), REP<double>(std::stod("0X1.965FEA53D6E3CP-1"),std::stod("0X1.965FEA53D6E3DP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(4.0,9.0), -3), REP<double>(std::stod("0X1.EC49B0C1853F3P-2"),std::stod("0X1.428A2F98D728BP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,-1.0), -3), REP<double>(-1.0,-0.5) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,0.0), -3), REP<double>(-INF_D,-0.5) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,8.0), -3), REP<double>(0.5,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-8.0,8.0), -3), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(-4.0,0.0), -3), REP<double>(-INF_D,std::stod("-0X1.428A2F98D728AP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,4.0), -3), REP<double>(std::stod("0X1.428A2F98D728AP-1"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP<double>(0.0,INF_D), -3), REP<double>(0.0,INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP<double>(1.0,-MAX_D), 3) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rootn(REP<double>(1.0,-3.0), 3), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_rootn_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP<double>(2.0,2.0), 3), REP<float>(std::stof("0X1.428A2EP+0"),std::stof("0X1.428A3P+0")) );
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP<double>(-8.0,27.0), 3), REP<float>(-2.0f,3.0f) );
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP<double>(4.0,9.0), 3), REP<float>(std::stof("0X1.965FEAP+0"),std::stof("0X1.0A403P+1")) );
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP<double>(2.0,2.0), -2), REP<float>(std::stof("0X1.6A09E6P-1"),std::stof("0X1.6A09E8P-1")) );
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP<double>(-8.0,27.0), -2), REP<float>(std::stof("0X1.8A2344P-3"),INF_F) );
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP<double>(4.0,9.0), -2), REP<float>(std::stof("0X1.555554P-2"),0.5f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::rootn(REP<double>(1.0,-MAX_D), 3) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rootn(REP<float>(1.0f,-3.0f), 3), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_rootn_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP_DEC<double>(F<double>::empty(),DEC::trv), 3) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(-8.0,27.0),DEC::com), 3), REP_DEC<double>(REP<double>(-2.0,3.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(-1.0,4.0),DEC::com), 3), REP_DEC<double>(REP<double>(-1.0,std::stod("0X1.965FEA53D6E3DP+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(0.0,4.0),DEC::dac), 3), REP_DEC<double>(REP<double>(0.0,std::stod("0X1.965FEA53D6E3DP+0")),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(2.0,INF_D),DEC::def), 3), REP_DEC<double>(REP<double>(std::stod("0X1.428A2F98D728AP+0"),INF_D),DEC::def) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rootn(REP_DEC<double>(F<double>::empty(),DEC::trv), -2) ) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(-8.0,27.0),DEC::com), -2), REP_DEC<double>(REP<double>(std::stod("0X1.8A2345CC04425P-3"),INF_D),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(-1.0,4.0),DEC::com), -2), REP_DEC<double>(REP<double>(0.5,INF_D),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(0.0,4.0),DEC::dac), -2), REP_DEC<double>(REP<double>(0.5,INF_D),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::rootn(REP_DEC<double>(REP<double>(2.0,INF_D),DEC::def), -2), REP_DEC<double>(REP<double>(0.0,std::stod("0X1.6A09E667F3BCDP-1")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::rootn(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), 3) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rootn(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com), 3), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_rootn_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), 2), REP_DEC<float>(REP<float>(std::stof("0X1.6A09E6P+0"),std::stof("0X1.6A09E8P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::rootn(REP_DEC<double>(REP<double>(-1.0,4.0),DEC::def), 2), REP_DEC<float>(REP<float>(-0.0f,2.0f),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::rootn(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), 3) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rootn(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com), 3), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_expm1_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::expm1(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(-INF_D,INF_D)), REP<double>(-1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(-INF_D,0.0)), REP<double>(-1.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(0.0,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(-0.0,0.0)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(-1.0,1.0)), REP<double>(std::stod("-0X1.43A54E4E98865P-1"),std::stod("0X1.B7E151628AED3P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F35AP-997")) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(std::stod("-0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("-0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F35AP-997")) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(-INF_D,-700.0)), REP<double>(-1.0,std::stod("-0X1.FFFFFFFFFFFFFP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(709.0,710.0)), REP<double>(std::stod("0X1.D422D2BE5DC9AP+1022"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP<double>(1.0,5.0)), REP<double>(std::stod("0X1.B7E151628AED2P+0"),std::stod("0X1.26D389970339P+7")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::expm1(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::expm1(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_expm1_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::expm1(REP<double>(-1.0,1.0)), REP<float>(std::stof("-0X1.43A55P-1"),std::stof("0X1.B7E152P+0")) );
+    BOOST_CHECK_EQUAL( F<float>::expm1(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<float>(-0.0f,std::stof("0X1P-149")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::expm1(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::expm1(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_expm1_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::expm1(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("-0X1.43A54E4E98865P-1"),std::stod("0X1.B7E151628AED3P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP_DEC<double>(REP<double>(709.0,710.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.D422D2BE5DC9AP+1022"),INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::expm1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("-0X1.43A54E4E98865P-1"),std::stod("0X1.B7E151628AED3P+0")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::expm1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::expm1(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_expm1_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::expm1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("-0X1.43A55P-1"),std::stof("0X1.B7E152P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::expm1(REP_DEC<double>(REP<double>(709.0,710.0),DEC::def)), REP_DEC<float>(REP<float>(std::stof("0X1.FFFFFEP+127"),INF_F),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::expm1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::expm1(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_log1p_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(-INF_D,INF_D)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(REP<double>(-INF_D,-1.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(REP<double>(-3.0,-2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(REP<double>(-1.0,-1.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(-1.0,0.0)), REP<double>(-INF_D,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(-INF_D,0.0)), REP<double>(-INF_D,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(0.0,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(-0.0,0.0)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.56E1FC2F8F358P-997"),std::stod("0X1.56E1FC2F8F359P-997")) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(-0.5,1.0)), REP<double>(std::stod("-0X1.62E42FEFA39FP-1"),std::stod("0X1.62E42FEFA39FP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.62E42FEFA39EFP-1"),std::stod("0X1.193EA7AAD030BP+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log1p(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log1p_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::log1p(REP<double>(-0.5,1.0)), REP<float>(std::stof("-0X1.62E43P-1"),std::stof("0X1.62E43P-1")) );
+    BOOST_CHECK_EQUAL( F<float>::log1p(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<float>(-0.0f,std::stof("0X1P-149")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::log1p(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log1p(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log1p_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP_DEC<double>(REP<double>(-0.5,1.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("-0X1.62E42FEFA39FP-1"),std::stod("0X1.62E42FEFA39FP-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<double>(REP<double>(-INF_D,std::stod("0X1.62E42FEFA39FP-1")),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log1p(REP_DEC<double>(REP<double>(-2.0,-1.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::log1p(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.62E42FEFA39EFP-1"),std::stod("0X1.193EA7AAD030BP+0")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::log1p(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log1p(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log1p_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::log1p(REP_DEC<double>(REP<double>(-0.5,1.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("-0X1.62E43P-1"),std::stof("0X1.62E43P-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::log1p(REP_DEC<double>(REP<double>(-1.0,0.0),DEC::com)), REP_DEC<float>(REP<float>(-INF_F,0.0f),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::log1p(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log1p(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_compoundm1_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-INF_D,INF_D), REP<double>(-INF_D,INF_D)), REP<double>(-1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-INF_D,-1.0), REP<double>(1.0,2.0)), REP<double>(-1.0,-1.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-1.0,-1.0), REP<double>(1.0,2.0)), REP<double>(-1.0,-1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(REP<double>(-1.0,-1.0), REP<double>(-1.0,0.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(REP<double>(-1.0,-1.0), REP<double>(0.0,0.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(0.0,0.0), REP<double>(-INF_D,INF_D)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(1.0,1.0), REP<double>(2.0,2.0)), REP<double>(3.0,3.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(1.0,2.0), REP<double>(2.0,3.0)), REP<double>(3.0,26.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-0.5,0.0), REP<double>(2.0,3.0)), REP<double>(-0.875,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-0.5,1.0), REP<double>(2.0,3.0)), REP<double>(-0.875,7.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-0.5,0.0), REP<double>(-3.0,-2.0)), REP<double>(-0.0,7.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(1.0,2.0), REP<double>(-3.0,-2.0)), REP<double>(std::stod("-0X1.ED097B425ED0AP-1"),-0.75) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-0.5,1.0), REP<double>(-3.0,-2.0)), REP<double>(-0.875,7.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-0.5,0.0), REP<double>(-1.0,1.0)), REP<double>(-0.5,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(1.0,2.0), REP<double>(-1.0,1.0)), REP<double>(std::stod("-0X1.5555555555556P-1"),2.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-0.5,1.0), REP<double>(-1.0,1.0)), REP<double>(-0.5,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997")), REP<double>(2.0,2.0)), REP<double>(std::stod("0X1.56E1FC2F8F359P-996"),std::stod("0X1.56E1FC2F8F35AP-996")) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(-1.0,1.0), REP<double>(0.0,0.0)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP<double>(0.0,INF_D), REP<double>(0.5,0.5)), REP<double>(-0.0,INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(REP<double>(1.0,-MAX_D), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::compoundm1(REP<double>(1.0,-3.0), REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_compoundm1_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::compoundm1(REP<double>(1.0,2.0), REP<double>(2.0,3.0)), REP<float>(3.0f,26.0f) );
+    BOOST_CHECK_EQUAL( F<float>::compoundm1(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997")), REP<double>(2.0,2.0)), REP<float>(-0.0f,std::stof("0X1P-149")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::compoundm1(REP<double>(1.0,-MAX_D), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::compoundm1(REP<float>(1.0f,-3.0f), REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_compoundm1_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(REP_DEC<double>(F<double>::empty(),DEC::trv), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(2.0,3.0),DEC::com)), REP_DEC<double>(REP<double>(3.0,26.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(-1.0,3.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(0.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(-1.0,3.0),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP_DEC<double>(REP<double>(-2.0,1.0),DEC::com), REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac)), REP_DEC<double>(REP<double>(-1.0,3.0),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::compoundm1(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac), REP_DEC<double>(REP<double>(0.5,0.5),DEC::def)), REP_DEC<double>(REP<double>(-0.0,INF_D),DEC::def) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::compoundm1(REP_DEC<double>(REP<double>(-1.0,-1.0),DEC::com), REP_DEC<double>(REP<double>(-1.0,0.0),DEC::com)) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::compoundm1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::compoundm1(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_compoundm1_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::compoundm1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(2.0,3.0),DEC::com)), REP_DEC<float>(REP<float>(3.0f,26.0f),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::compoundm1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(-1.0f,3.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::compoundm1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::compoundm1(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com), REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_hypot_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::hypot(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::hypot(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(-INF_D,INF_D), REP<double>(-INF_D,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(0.0,0.0), REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(3.0,3.0), REP<double>(4.0,4.0)), REP<double>(5.0,5.0) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(-3.0,2.0), REP<double>(4.0,5.0)), REP<double>(4.0,std::stod("0X1.752E50DB3A3A2P+2")) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(-3.0,-1.0), REP<double>(-5.0,-2.0)), REP<double>(std::stod("0X1.1E3779B97F4A7P+1"),std::stod("0X1.752E50DB3A3A2P+2")) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(-1.0,1.0), REP<double>(-1.0,1.0)), REP<double>(0.0,std::stod("0X1.6A09E667F3BCDP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(1.0,2.0), REP<double>(0.0,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997")), REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.E4E8D12762225P-997"),std::stod("0X1.E4E8D12762226P-997")) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP<double>(std::stod("0X1.7E43C8800759CP+996"),std::stod("0X1.7E43C8800759CP+996")), REP<double>(std::stod("0X1.7E43C8800759CP+996"),std::stod("0X1.7E43C8800759CP+996"))), REP<double>(std::stod("0X1.0E4D50F99B21P+997"),std::stod("0X1.0E4D50F99B211P+997")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::hypot(REP<double>(1.0,-MAX_D), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::hypot(REP<double>(1.0,-3.0), REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_hypot_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::hypot(REP<double>(3.0,3.0), REP<double>(4.0,4.0)), REP<float>(5.0f,5.0f) );
+    BOOST_CHECK_EQUAL( F<float>::hypot(REP<double>(1.0,2.0), REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.6A09E6P+0"),std::stof("0X1.6A09E8P+1")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::hypot(REP<double>(1.0,-MAX_D), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::hypot(REP<float>(1.0f,-3.0f), REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_hypot_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::hypot(REP_DEC<double>(F<double>::empty(),DEC::trv), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP_DEC<double>(REP<double>(3.0,3.0),DEC::com), REP_DEC<double>(REP<double>(4.0,4.0),DEC::com)), REP_DEC<double>(REP<double>(5.0,5.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP_DEC<double>(REP<double>(-3.0,2.0),DEC::dac), REP_DEC<double>(REP<double>(4.0,5.0),DEC::com)), REP_DEC<double>(REP<double>(4.0,std::stod("0X1.752E50DB3A3A2P+2")),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP_DEC<double>(REP<double>(std::stod("0X1.7E43C8800759CP+996"),std::stod("0X1.7E43C8800759CP+996")),DEC::com), REP_DEC<double>(REP<double>(std::stod("0X1.7E43C8800759CP+996"),std::stod("0X1.7E43C8800759CP+996")),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.0E4D50F99B21P+997"),std::stod("0X1.0E4D50F99B211P+997")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::hypot(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::def)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::hypot(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::hypot(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_hypot_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::hypot(REP_DEC<double>(REP<double>(3.0,3.0),DEC::com), REP_DEC<double>(REP<double>(4.0,4.0),DEC::com)), REP_DEC<float>(REP<float>(5.0f,5.0f),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::hypot(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.6A09E6P+0"),std::stof("0X1.6A09E8P+1")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::hypot(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::hypot(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com), REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_rsqrt_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(-INF_D,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP<double>(-INF_D,0.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP<double>(-INF_D,-0.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP<double>(-3.0,-2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP<double>(0.0,0.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(0.0,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(-1.0,4.0)), REP<double>(0.5,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(4.0,4.0)), REP<double>(0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(2.0,3.0)), REP<double>(std::stod("0X1.279A74590331CP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.38D352E5096AFP+498"),std::stod("0X1.38D352E5096BP+498")) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP<double>(0.25,INF_D)), REP<double>(0.0,2.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rsqrt(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_rsqrt_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::rsqrt(REP<double>(2.0,3.0)), REP<float>(std::stof("0X1.279A74P-1"),std::stof("0X1.6A09E8P-1")) );
+    BOOST_CHECK_EQUAL( F<float>::rsqrt(REP<double>(4.0,16.0)), REP<float>(0.25f,0.5f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::rsqrt(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rsqrt(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_rsqrt_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP_DEC<double>(REP<double>(4.0,16.0),DEC::com)), REP_DEC<double>(REP<double>(0.25,0.5),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP_DEC<double>(REP<double>(0.0,4.0),DEC::com)), REP_DEC<double>(REP<double>(0.5,INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::rsqrt(REP_DEC<double>(REP<double>(-1.0,0.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP_DEC<double>(REP<double>(2.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(0.0,std::stod("0X1.6A09E667F3BCDP-1")),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::rsqrt(REP_DEC<double>(REP<double>(2.0,3.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.279A74590331CP-1"),std::stod("0X1.6A09E667F3BCDP-1")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::rsqrt(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rsqrt(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_rsqrt_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::rsqrt(REP_DEC<double>(REP<double>(4.0,16.0),DEC::com)), REP_DEC<float>(REP<float>(0.25f,0.5f),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::rsqrt(REP_DEC<double>(REP<double>(0.0,4.0),DEC::com)), REP_DEC<float>(REP<float>(0.5f,INF_F),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::rsqrt(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::rsqrt(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,2,0)
+
+BOOST_AUTO_TEST_CASE(minimal_sinpi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::sinpi(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(-INF_D,INF_D)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(-0.0,0.0)), REP<double>(-0.0,-0.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.0,INF_D)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.5,0.5)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(1.0,1.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(1.5,1.5)), REP<double>(-1.0,-1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.25,0.25)), REP<double>(std::stod("0X1.6A09E667F3BCCP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(std::stod("0X1.5555555555555P-3"),std::stod("0X1.5555555555555P-3"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-2"),0.5) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.0,0.5)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.25,0.75)), REP<double>(std::stod("0X1.6A09E667F3BCCP-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.0,1.0)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(-0.5,0.5)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.5,1.5)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(1.0,2.0)), REP<double>(-1.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(-1.0,3.0)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(0.5,2.5)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.0D4CAB14B6BBFP-995"),std::stod("0X1.0D4CAB14B6BCP-995")) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP<double>(std::stod("0X1P+52"),std::stod("0X1.0000000000001P+52"))), REP<double>(0.0,1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::sinpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinpi(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sinpi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::sinpi(REP<double>(0.25,0.75)), REP<float>(std::stof("0X1.6A09E6P-1"),1.0f) );
+    BOOST_CHECK_EQUAL( F<float>::sinpi(REP<double>(std::stod("0X1.5555555555555P-2"),std::stod("0X1.5555555555555P-2"))), REP<float>(std::stof("0X1.BB67AEP-1"),std::stof("0X1.BB67BP-1")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::sinpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinpi(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sinpi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::sinpi(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP_DEC<double>(REP<double>(0.25,0.75),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.6A09E667F3BCCP-1"),1.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::sinpi(REP_DEC<double>(REP<double>(0.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::sinpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinpi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sinpi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::sinpi(REP_DEC<double>(REP<double>(0.25,0.75),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.6A09E6P-1"),1.0f),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::sinpi(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(-1.0f,1.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::sinpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinpi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_cospi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::cospi(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(-INF_D,INF_D)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.0,INF_D)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.5,0.5)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(1.0,1.0)), REP<double>(-1.0,-1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(1.5,1.5)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.25,0.25)), REP<double>(std::stod("0X1.6A09E667F3BCCP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(std::stod("0X1.5555555555555P-3"),std::stod("0X1.5555555555555P-3"))), REP<double>(std::stod("0X1.BB67AE8584CAAP-1"),std::stod("0X1.BB67AE8584CABP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.0,0.5)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.25,0.75)), REP<double>(std::stod("-0X1.6A09E667F3BCDP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.0,1.0)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(-0.5,0.5)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.5,1.5)), REP<double>(-1.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(1.0,2.0)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(-1.0,3.0)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(0.5,2.5)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP<double>(std::stod("0X1P+52"),std::stod("0X1.0000000000001P+52"))), REP<double>(-1.0,1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::cospi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cospi(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cospi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::cospi(REP<double>(0.25,0.75)), REP<float>(std::stof("-0X1.6A09E8P-1"),std::stof("0X1.6A09E8P-1")) );
+    BOOST_CHECK_EQUAL( F<float>::cospi(REP<double>(std::stod("0X1.5555555555555P-2"),std::stod("0X1.5555555555555P-2"))), REP<float>(0.5f,std::stof("0X1.000002P-1")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::cospi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cospi(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cospi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::cospi(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP_DEC<double>(REP<double>(0.25,0.75),DEC::com)), REP_DEC<double>(REP<double>(std::stod("-0X1.6A09E667F3BCDP-1"),std::stod("0X1.6A09E667F3BCDP-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::cospi(REP_DEC<double>(REP<double>(0.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::cospi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cospi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cospi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::cospi(REP_DEC<double>(REP<double>(0.25,0.75),DEC::com)), REP_DEC<float>(REP<float>(std::stof("-0X1.6A09E8P-1"),std::stof("0X1.6A09E8P-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::cospi(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(-1.0f,1.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::cospi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cospi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_tanpi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::tanpi(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(-INF_D,INF_D)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.0,INF_D)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(-0.0,0.0)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.25,0.25)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(-0.25,0.25)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::tanpi(REP<double>(0.5,0.5)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::tanpi(REP<double>(1.5,1.5)) ) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.0,0.5)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.5,1.0)), REP<double>(-INF_D,-0.0) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(-0.5,0.0)), REP<double>(-INF_D,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(-0.5,0.5)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.25,0.75)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.0,1.0)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(0.125,0.875)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(1.0,1.25)), REP<double>(-0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.0D4CAB14B6BBFP-995"),std::stod("0X1.0D4CAB14B6BCP-995")) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP<double>(std::stod("0X1P+52"),std::stod("0X1.0000000000001P+52"))), REP<double>(-INF_D,INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::tanpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::tanpi(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_tanpi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::tanpi(REP<double>(-0.25,0.25)), REP<float>(-1.0f,1.0f) );
+    BOOST_CHECK_EQUAL( F<float>::tanpi(REP<double>(std::stod("0X1.5555555555555P-2"),std::stod("0X1.5555555555555P-2"))), REP<float>(std::stof("0X1.BB67AEP+0"),std::stof("0X1.BB67BP+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::tanpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::tanpi(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_tanpi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::tanpi(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP_DEC<double>(REP<double>(-0.25,0.25),DEC::com)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP_DEC<double>(REP<double>(0.0,0.5),DEC::com)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP_DEC<double>(REP<double>(0.25,0.75),DEC::com)), REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::tanpi(REP_DEC<double>(REP<double>(0.5,0.5),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP_DEC<double>(REP<double>(1.0,1.25),DEC::def)), REP_DEC<double>(REP<double>(-0.0,1.0),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::tanpi(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::tanpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::tanpi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_tanpi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::tanpi(REP_DEC<double>(REP<double>(-0.25,0.25),DEC::com)), REP_DEC<float>(REP<float>(-1.0f,1.0f),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::tanpi(REP_DEC<double>(REP<double>(0.0,0.5),DEC::com)), REP_DEC<float>(REP<float>(-0.0f,INF_F),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::tanpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::tanpi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_asinpi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::asinpi(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-INF_D,INF_D)), REP<double>(-0.5,0.5) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::asinpi(REP<double>(-INF_D,-2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::asinpi(REP<double>(2.0,INF_D)) ) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-0.0,0.0)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-1.0,1.0)), REP<double>(-0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-1.0,0.5)), REP<double>(-0.5,std::stod("0X1.5555555555556P-3")) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(0.5,0.5)), REP<double>(std::stod("0X1.5555555555555P-3"),std::stod("0X1.5555555555556P-3")) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-0.5,-0.5)), REP<double>(std::stod("-0X1.5555555555556P-3"),std::stod("-0X1.5555555555555P-3")) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(1.0,1.0)), REP<double>(0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-1.0,-1.0)), REP<double>(-0.5,-0.5) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(0.0,INF_D)), REP<double>(0.0,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(-INF_D,0.0)), REP<double>(-0.5,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.B49266DB89B9DP-999"),std::stod("0X1.B49266DB89B9EP-999")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::asinpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asinpi(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_asinpi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::asinpi(REP<double>(0.5,0.5)), REP<float>(std::stof("0X1.555554P-3"),std::stof("0X1.555556P-3")) );
+    BOOST_CHECK_EQUAL( F<float>::asinpi(REP<double>(-1.0,0.25)), REP<float>(-0.5f,std::stof("0X1.4971AP-4")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::asinpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asinpi(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_asinpi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::asinpi(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP_DEC<double>(REP<double>(-1.0,0.5),DEC::com)), REP_DEC<double>(REP<double>(-0.5,std::stod("0X1.5555555555556P-3")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP_DEC<double>(REP<double>(-2.0,0.5),DEC::com)), REP_DEC<double>(REP<double>(-0.5,std::stod("0X1.5555555555556P-3")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP_DEC<double>(REP<double>(0.5,2.0),DEC::dac)), REP_DEC<double>(REP<double>(std::stod("0X1.5555555555555P-3"),0.5),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::asinpi(REP_DEC<double>(REP<double>(0.5,0.5),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.5555555555555P-3"),std::stod("0X1.5555555555556P-3")),DEC::def) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::asinpi(REP_DEC<double>(REP<double>(2.0,3.0),DEC::com)) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::asinpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asinpi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_asinpi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::asinpi(REP_DEC<double>(REP<double>(0.5,0.5),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.555554P-3"),std::stof("0X1.555556P-3")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::asinpi(REP_DEC<double>(REP<double>(-2.0,0.25),DEC::com)), REP_DEC<float>(REP<float>(-0.5f,std::stof("0X1.4971AP-4")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::asinpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asinpi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_acospi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::acospi(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-INF_D,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::acospi(REP<double>(-INF_D,-2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::acospi(REP<double>(2.0,INF_D)) ) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(0.0,0.0)), REP<double>(0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-0.0,0.0)), REP<double>(0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-1.0,1.0)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-1.0,0.5)), REP<double>(std::stod("0X1.5555555555555P-2"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(0.5,0.5)), REP<double>(std::stod("0X1.5555555555555P-2"),std::stod("0X1.5555555555556P-2")) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-0.5,-0.5)), REP<double>(std::stod("0X1.5555555555555P-1"),std::stod("0X1.5555555555556P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(1.0,1.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-1.0,-1.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(0.0,INF_D)), REP<double>(0.0,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(-INF_D,0.0)), REP<double>(0.5,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-2"),0.5) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::acospi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::acospi(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_acospi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::acospi(REP<double>(0.5,0.5)), REP<float>(std::stof("0X1.555554P-2"),std::stof("0X1.555556P-2")) );
+    BOOST_CHECK_EQUAL( F<float>::acospi(REP<double>(-1.0,0.25)), REP<float>(std::stof("0X1.ADA398P-2"),1.0f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::acospi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::acospi(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_acospi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::acospi(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP_DEC<double>(REP<double>(-1.0,0.5),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.5555555555555P-2"),1.0),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP_DEC<double>(REP<double>(-2.0,0.5),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.5555555555555P-2"),1.0),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP_DEC<double>(REP<double>(0.5,2.0),DEC::dac)), REP_DEC<double>(REP<double>(0.0,std::stod("0X1.5555555555556P-2")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::acospi(REP_DEC<double>(REP<double>(0.5,0.5),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.5555555555555P-2"),std::stod("0X1.5555555555556P-2")),DEC::def) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::acospi(REP_DEC<double>(REP<double>(2.0,3.0),DEC::com)) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::acospi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::acospi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_acospi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::acospi(REP_DEC<double>(REP<double>(0.5,0.5),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.555554P-2"),std::stof("0X1.555556P-2")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::acospi(REP_DEC<double>(REP<double>(-2.0,0.25),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.ADA398P-2"),1.0f),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::acospi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::acospi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_atanpi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atanpi(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(-INF_D,INF_D)), REP<double>(-0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(-0.0,0.0)), REP<double>(-0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(0.0,INF_D)), REP<double>(0.0,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(-INF_D,0.0)), REP<double>(-0.5,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(1.0,1.0)), REP<double>(0.25,0.25) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(-1.0,1.0)), REP<double>(-0.25,0.25) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(-INF_D,1.0)), REP<double>(-0.5,0.25) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(0.5,2.0)), REP<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.B49266DB89B9DP-999"),std::stod("0X1.B49266DB89B9EP-999")) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP<double>(std::stod("0X1.7E43C8800759CP+996"),INF_D)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-2"),0.5) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::atanpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atanpi(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atanpi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atanpi(REP<double>(-1.0,1.0)), REP<float>(-0.25f,0.25f) );
+    BOOST_CHECK_EQUAL( F<float>::atanpi(REP<double>(0.5,2.0)), REP<float>(std::stof("0X1.2E405P-3"),std::stof("0X1.68DFD8P-2")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::atanpi(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atanpi(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atanpi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atanpi(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<double>(REP<double>(-0.25,0.25),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(-0.5,0.5),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::atanpi(REP_DEC<double>(REP<double>(0.5,2.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::atanpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atanpi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atanpi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atanpi(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<float>(REP<float>(-0.25f,0.25f),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::atanpi(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::dac)), REP_DEC<float>(REP<float>(-0.5f,0.5f),DEC::dac) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::atanpi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atanpi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2pi_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2pi(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2pi(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(-INF_D,INF_D), REP<double>(-INF_D,INF_D)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2pi(REP<double>(0.0,0.0), REP<double>(0.0,0.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(1.0,1.0), REP<double>(1.0,1.0)), REP<double>(0.25,0.25) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(0.0,0.0), REP<double>(1.0,2.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(0.0,0.0), REP<double>(-2.0,-1.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(1.0,2.0), REP<double>(0.0,0.0)), REP<double>(0.5,0.5) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(-2.0,-1.0), REP<double>(0.0,0.0)), REP<double>(-0.5,-0.5) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(1.0,2.0), REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(0.0,1.0), REP<double>(-1.0,0.0)), REP<double>(0.5,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(-1.0,1.0), REP<double>(-2.0,-1.0)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(-1.0,1.0), REP<double>(1.0,2.0)), REP<double>(-0.25,0.25) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(-2.0,-1.0), REP<double>(-2.0,-1.0)), REP<double>(std::stod("-0X1.B46FEB898833EP-1"),std::stod("-0X1.4B90147677CC2P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(-1.0,0.0), REP<double>(-2.0,2.0)), REP<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP<double>(0.0,INF_D), REP<double>(0.0,INF_D)), REP<double>(0.0,0.5) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2pi(REP<double>(1.0,-MAX_D), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2pi(REP<double>(1.0,-3.0), REP<double>(1.0,2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atan2pi_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan2pi(REP<double>(1.0,2.0), REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.2E405P-3"),std::stof("0X1.68DFD8P-2")) );
+    BOOST_CHECK_EQUAL( F<float>::atan2pi(REP<double>(-1.0,1.0), REP<double>(-2.0,-1.0)), REP<float>(-1.0f,1.0f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::atan2pi(REP<double>(1.0,-MAX_D), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2pi(REP<float>(1.0f,-3.0f), REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atan2pi_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2pi(REP_DEC<double>(F<double>::empty(),DEC::trv), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(-2.0,-1.0),DEC::com)), REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP_DEC<double>(REP<double>(0.0,1.0),DEC::com), REP_DEC<double>(REP<double>(-2.0,-1.0),DEC::com)), REP_DEC<double>(REP<double>(0.75,1.0),DEC::dac) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2pi(REP_DEC<double>(REP<double>(0.0,0.0),DEC::com), REP_DEC<double>(REP<double>(0.0,0.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac), REP_DEC<double>(REP<double>(0.0,0.0),DEC::com)), REP_DEC<double>(REP<double>(0.5,0.5),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::atan2pi(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(1.0,2.0),DEC::def)), REP_DEC<double>(REP<double>(-0.25,0.25),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::atan2pi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2pi(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atan2pi_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan2pi(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.2E405P-3"),std::stof("0X1.68DFD8P-2")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::atan2pi(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(-2.0,-1.0),DEC::dac)), REP_DEC<float>(REP<float>(-1.0f,1.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::atan2pi(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com), REP_DEC<double>(REP<double>(1.0,2.0), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2pi(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com), REP_DEC<float>(REP<float>(1.0f,2.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+#endif
@@ -34,6 +34,7 @@
 
 
 #include <limits>
+#include <vector>
 
 
 template<typename T>
@@ -318,3 +319,99 @@ BOOST_AUTO_TEST_CASE(minimal_overlap_dec_mixedtype_test)
     p1788::exception::clear();
     p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
 }
+
+BOOST_AUTO_TEST_CASE(minimal_overlap_batch_test)
+{
+    const double NAN_D = std::numeric_limits<double>::quiet_NaN();
+    const double MAX_D = std::numeric_limits<double>::max();
+    const double bounds[] = { -INF_D, -MAX_D, -2.0, -1.0, -0.0, 0.0, 1.0, 2.0, 3.0, MAX_D, INF_D };
+
+    // all pairs of bounds, including invalid ones, and the empty interval
+    std::vector<REP<double>> v;
+    for (double l : bounds)
+        for (double u : bounds)
+            v.push_back(REP<double>(l, u));
+    v.push_back(F<double>::empty());
+    v.push_back(REP<double>(NAN_D, 1.0));
+
+    std::vector<REP<double>> x;
+    std::vector<REP<double>> y;
+    for (auto const& a : v)
+        for (auto const& b : v)
+        {
+            x.push_back(a);
+            y.push_back(b);
+        }
+
+    std::vector<OS> out(x.size());
+    std::vector<OS> expected(x.size());
+
+    p1788::exception::clear();
+    for (std::size_t i = 0; i < x.size(); ++i)
+        expected[i] = F<double>::overlap(x[i], y[i]);
+    BOOST_CHECK(p1788::exception::invalid_operand());
+
+    p1788::exception::clear();
+    F<double>::overlap(x.data(), y.data(), out.data(), x.size());
+    BOOST_CHECK(p1788::exception::invalid_operand());
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK_EQUAL(out[i], expected[i]);
+
+    // only valid inputs: no invalid operand signaled
+    p1788::exception::clear();
+    REP<double> vx[] = { REP<double>(1.0, 2.0), F<double>::empty(), REP<double>(-INF_D, 0.0), REP<double>(0.0, 0.0) };
+    REP<double> vy[] = { REP<double>(2.0, 3.0), REP<double>(1.0, 2.0), REP<double>(-INF_D, INF_D), REP<double>(-0.0, 0.0) };
+    OS vout[4];
+    F<double>::overlap(vx, vy, vout, 4);
+    BOOST_CHECK_EQUAL(vout[0], OS::meets);
+    BOOST_CHECK_EQUAL(vout[1], OS::first_empty);
+    BOOST_CHECK_EQUAL(vout[2], OS::starts);
+    BOOST_CHECK_EQUAL(vout[3], OS::equal);
+    BOOST_CHECK(!p1788::exception::invalid_operand());
+
+    F<double>::overlap(vx, vy, vout, 0);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_overlap_dec_batch_test)
+{
+    const double MAX_D = std::numeric_limits<double>::max();
+    const double bounds[] = { -INF_D, -MAX_D, -1.0, 0.0, 1.0, 2.0, MAX_D, INF_D };
+    const DEC decs[] = { DEC::ill, DEC::trv, DEC::def, DEC::dac, DEC::com };
+
+    std::vector<REP_DEC<double>> v;
+    for (double l : bounds)
+        for (double u : bounds)
+            for (DEC d : decs)
+                v.push_back(REP_DEC<double>(REP<double>(l, u), d));
+    for (DEC d : decs)
+        v.push_back(REP_DEC<double>(F<double>::empty(), d));
+
+    std::vector<REP_DEC<double>> x;
+    std::vector<REP_DEC<double>> y;
+    for (auto const& a : v)
+        for (auto const& b : v)
+        {
+            x.push_back(a);
+            y.push_back(b);
+        }
+
+    std::vector<OS> out(x.size());
+
+    p1788::exception::clear();
+    F<double>::overlap(x.data(), y.data(), out.data(), x.size());
+    BOOST_CHECK(p1788::exception::invalid_operand());
+
+    p1788::exception::clear();
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK_EQUAL(out[i], F<double>::overlap(x[i], y[i]));
+
+    p1788::exception::clear();
+    REP_DEC<double> vx[] = { F<double>::nai(), REP_DEC<double>(REP<double>(1.0, 2.0), DEC::com) };
+    REP_DEC<double> vy[] = { REP_DEC<double>(REP<double>(1.0, 2.0), DEC::com), REP_DEC<double>(REP<double>(1.5, INF_D), DEC::dac) };
+    OS vout[2];
+    F<double>::overlap(vx, vy, vout, 2);
+    BOOST_CHECK_EQUAL(vout[0], OS::undefined);
+    BOOST_CHECK_EQUAL(vout[1], OS::overlaps);
+    BOOST_CHECK(!p1788::exception::invalid_operand());
+}
@@ -0,0 +1,917 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Flavor: Recommended slope functions [p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor]"
+#include "test/util/boost_test_wrapper.hpp"
+
+#include "p1788/exception/exception.hpp"
+#include "p1788/decoration/decoration.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+#include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
+
+#include <limits>
+
+template<typename T>
+using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
+
+template<typename T>
+using REP = typename F<T>::representation;
+
+template<typename T>
+using REP_DEC = typename F<T>::representation_dec;
+
+typedef p1788::decoration::decoration DEC;
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double NaN_D = std::numeric_limits<double>::quiet_NaN();
+const double MAX_D = std::numeric_limits<double>::max();
+const double MIN_D = std::numeric_limits<double>::min();
+const double DNORM_MIN_D = std::numeric_limits<double>::denorm_min();
+
+const double INF_F = std::numeric_limits<float>::infinity();
+const double NaN_F = std::numeric_limits<float>::quiet_NaN();
+const double MAX_F = std::numeric_limits<float>::max();
+const double MIN_F = std::numeric_limits<float>::min();
+const double DNORM_MIN_F = std::numeric_limits<float>::denorm_min();
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope1_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::exp_slope1(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(-INF_D,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(-1.0,1.0)), REP<double>(std::stod("0X1.78B56362CEF37P-1"),std::stod("0X1.6FC2A2C515DA6P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.6FC2A2C515DA5P+0"),std::stod("0X1.18E64B8D4DDAEP+1")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(-2.0,-1.0)), REP<double>(std::stod("0X1.22A555477F039P-1"),std::stod("0X1.78B56362CEF38P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(0.0,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(-INF_D,-1.0)), REP<double>(0.0,std::stod("0X1.78B56362CEF38P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(1.0,std::stod("0X1.0000000000001P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<double>(1000.0,1000.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+1023"),INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::exp_slope1(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope1(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope1_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::exp_slope1(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.6FC2A2P+0"),std::stof("0X1.18E64CP+1")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP<float>(-1.0f,0.5f)), REP<double>(std::stod("0X1.78B56362CEF37P-1"),std::stod("0X1.3094C70F034DFP+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::exp_slope1(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope1(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope1_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::exp_slope1(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.6FC2A2C515DA5P+0"),std::stod("0X1.18E64B8D4DDAEP+1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.78B56362CEF37P-1"),std::stod("0X1.6FC2A2C515DA6P+0")),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope1(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::exp_slope1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope1(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope1_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::exp_slope1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.6FC2A2P+0"),std::stof("0X1.18E64CP+1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::exp_slope1(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(1.0f,INF_F),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::exp_slope1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope1(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope2_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::exp_slope2(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(-INF_D,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(-1.0,1.0)), REP<double>(std::stod("0X1.95DFD5D793258P-1"),std::stod("0X1.4F47E84F418F0P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.4F47E84F418EFP+0"),std::stod("0X1.CAB2E2A7E990AP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(-2.0,-1.0)), REP<double>(std::stod("0X1.4C080014C17A9P-1"),std::stod("0X1.95DFD5D793259P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(0.0,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(-INF_D,-1.0)), REP<double>(0.0,std::stod("0X1.95DFD5D793259P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(1.0,std::stod("0X1.0000000000001P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<double>(1000.0,1000.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+1023"),INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::exp_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope2(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope2_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::exp_slope2(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.4F47E8P+0"),std::stof("0X1.CAB2E4P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP<float>(-1.0f,0.5f)), REP<double>(std::stod("0X1.95DFD5D793258P-1"),std::stod("0X1.237CAA5A13D36P+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::exp_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope2(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope2_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::exp_slope2(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.4F47E84F418EFP+0"),std::stod("0X1.CAB2E2A7E990AP+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.95DFD5D793258P-1"),std::stod("0X1.4F47E84F418F0P+0")),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::exp_slope2(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::exp_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope2(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_exp_slope2_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::exp_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.4F47E8P+0"),std::stof("0X1.CAB2E4P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::exp_slope2(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(1.0f,INF_F),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::exp_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::exp_slope2(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope1_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(-INF_D,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(REP<double>(-1.0,-1.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(REP<double>(-2.0,-1.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(-1.0,0.0)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(-0.5,1.0)), REP<double>(std::stod("0X1.3A37A020B8C21P-1"),std::stod("0X1.8B90BFBE8E7BDP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.CD82B0AA5F9EAP-2"),std::stod("0X1.3A37A020B8C22P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(0.0,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(REP<double>(-3.0,-2.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-1"),1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope1(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope1_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::log_slope1(REP<double>(-0.5,1.0)), REP<float>(std::stof("0X1.3A37AP-1"),std::stof("0X1.8B90CP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP<float>(1.0f,2.0f)), REP<double>(std::stod("0X1.CD82B0AA5F9EAP-2"),std::stod("0X1.3A37A020B8C22P-1")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::log_slope1(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope1(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope1_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP_DEC<double>(REP<double>(-0.5,1.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.3A37A020B8C21P-1"),std::stod("0X1.8B90BFBE8E7BDP+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.3A37A020B8C21P-1"),INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope1(REP_DEC<double>(REP<double>(-2.0,-1.0),DEC::dac)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.CD82B0AA5F9EAP-2"),std::stod("0X1.3A37A020B8C22P-1")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::log_slope1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope1(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope1_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::log_slope1(REP_DEC<double>(REP<double>(-0.5,1.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.3A37AP-1"),std::stof("0X1.8B90CP+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::log_slope1(REP_DEC<double>(REP<double>(-1.0,0.0),DEC::com)), REP_DEC<float>(REP<float>(1.0f,INF_F),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::log_slope1(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope1(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope2_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(-INF_D,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(REP<double>(-1.0,-1.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(REP<double>(-2.0,-1.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(-1.0,0.0)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(-0.5,1.0)), REP<double>(std::stod("0X1.28AC8FCEEADCDP-1"),std::stod("0X1.A2B23F3BAB737P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.A5DDFB803848FP-2"),std::stod("0X1.28AC8FCEEADCEP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(0.0,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(REP<double>(-3.0,-2.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-1"),1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope2(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope2_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::log_slope2(REP<double>(-0.5,1.0)), REP<float>(std::stof("0X1.28AC8EP-1"),std::stof("0X1.A2B24P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP<float>(1.0f,2.0f)), REP<double>(std::stod("0X1.A5DDFB803848FP-2"),std::stod("0X1.28AC8FCEEADCEP-1")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::log_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope2(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope2_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP_DEC<double>(REP<double>(-0.5,1.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.28AC8FCEEADCDP-1"),std::stod("0X1.A2B23F3BAB737P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.28AC8FCEEADCDP-1"),INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::log_slope2(REP_DEC<double>(REP<double>(-2.0,-1.0),DEC::dac)) ) );
+    BOOST_CHECK_EQUAL( F<double>::log_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.A5DDFB803848FP-2"),std::stod("0X1.28AC8FCEEADCEP-1")),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::log_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope2(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_log_slope2_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::log_slope2(REP_DEC<double>(REP<double>(-0.5,1.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.28AC8EP-1"),std::stof("0X1.A2B24P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::log_slope2(REP_DEC<double>(REP<double>(-1.0,0.0),DEC::com)), REP_DEC<float>(REP<float>(1.0f,INF_F),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::log_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::log_slope2(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_cos_slope2_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::cos_slope2(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(-INF_D,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(1.0,1.0)), REP<double>(std::stod("0X1.D6BAFE095F2E8P-1"),std::stod("0X1.D6BAFE095F2E9P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(1.0,7.0)), REP<double>(0.0,std::stod("0X1.D6BAFE095F2E9P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(-1.0,2.0)), REP<double>(std::stod("0X1.6A88995D4DC81P-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(7.0,20.0)), REP<double>(0.0,std::stod("0X1.4E5E0A72F053AP-4")) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<double>(100.0,INF_D)), REP<double>(0.0,std::stod("0X1.A36E2EB1C432DP-12")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::cos_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cos_slope2(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cos_slope2_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::cos_slope2(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.6A8898P-1"),std::stof("0X1.D6BBP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP<float>(-1.0f,0.5f)), REP<double>(std::stod("0X1.D6BAFE095F2E8P-1"),1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::cos_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cos_slope2(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cos_slope2_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::cos_slope2(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.6A88995D4DC81P-1"),std::stod("0X1.D6BAFE095F2E9P-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.D6BAFE095F2E8P-1"),1.0),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::cos_slope2(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::cos_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cos_slope2(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cos_slope2_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::cos_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.6A8898P-1"),std::stof("0X1.D6BBP-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::cos_slope2(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(0.0f,1.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::cos_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cos_slope2(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_sin_slope3_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::sin_slope3(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(-INF_D,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(-1.0,1.0)), REP<double>(std::stod("0X1.E7004A5C9B26BP-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.A2D46CFE2B8CBP-1"),std::stod("0X1.E7004A5C9B26CP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(-2.0,-1.0)), REP<double>(std::stod("0X1.A2D46CFE2B8CBP-1"),std::stod("0X1.E7004A5C9B26CP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(0.0,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(-INF_D,-1.0)), REP<double>(0.0,std::stod("0X1.E7004A5C9B26CP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<double>(1000.0,1000.0)), REP<double>(std::stod("0X1.9251FB237845BP-18"),std::stod("0X1.9251FB237845CP-18")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::sin_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sin_slope3(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sin_slope3_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::sin_slope3(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.A2D46CP-1"),std::stof("0X1.E7004CP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP<float>(-1.0f,0.5f)), REP<double>(std::stod("0X1.E7004A5C9B26BP-1"),1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::sin_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sin_slope3(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sin_slope3_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::sin_slope3(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.A2D46CFE2B8CBP-1"),std::stod("0X1.E7004A5C9B26CP-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.E7004A5C9B26BP-1"),1.0),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::sin_slope3(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::sin_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sin_slope3(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sin_slope3_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::sin_slope3(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.A2D46CP-1"),std::stof("0X1.E7004CP-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::sin_slope3(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(0.0f,1.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::sin_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sin_slope3(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_asin_slope3_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::asin_slope3(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(-INF_D,INF_D)), REP<double>(1.0,std::stod("0X1.B65F1FCCC8749P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(-1.0,1.0)), REP<double>(1.0,std::stod("0X1.B65F1FCCC8749P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(0.0,0.5)), REP<double>(1.0,std::stod("0X1.21FB54442D185P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(-2.0,2.0)), REP<double>(1.0,std::stod("0X1.B65F1FCCC8749P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(1.0,1.0)), REP<double>(std::stod("0X1.B65F1FCCC8748P+1"),std::stod("0X1.B65F1FCCC8749P+1")) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::asin_slope3(REP<double>(2.0,3.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(1.0,std::stod("0X1.0000000000001P+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::asin_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asin_slope3(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_asin_slope3_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::asin_slope3(REP<double>(0.0,0.5)), REP<float>(1.0f,std::stof("0X1.21FB56P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP<float>(-0.5f,0.25f)), REP<double>(1.0,std::stod("0X1.21FB54442D185P+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::asin_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asin_slope3(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_asin_slope3_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::asin_slope3(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP_DEC<double>(REP<double>(0.0,0.5),DEC::com)), REP_DEC<double>(REP<double>(1.0,std::stod("0X1.21FB54442D185P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP_DEC<double>(REP<double>(-2.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(1.0,std::stod("0X1.B65F1FCCC8749P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::asin_slope3(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::dac)), REP_DEC<double>(REP<double>(1.0,std::stod("0X1.B65F1FCCC8749P+1")),DEC::dac) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::asin_slope3(REP_DEC<double>(REP<double>(2.0,3.0),DEC::def)) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::asin_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asin_slope3(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_asin_slope3_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::asin_slope3(REP_DEC<double>(REP<double>(0.0,0.5),DEC::com)), REP_DEC<float>(REP<float>(1.0f,std::stof("0X1.21FB56P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::asin_slope3(REP_DEC<double>(REP<double>(-2.0,2.0),DEC::dac)), REP_DEC<float>(REP<float>(1.0f,std::stof("0X1.B65F2P+1")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::asin_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::asin_slope3(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan_slope3_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan_slope3(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(-INF_D,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(-1.0,1.0)), REP<double>(std::stod("0X1.49A0E033378B7P-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.56DADA39E6299P-2"),std::stod("0X1.49A0E033378B8P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(-2.0,-1.0)), REP<double>(std::stod("0X1.56DADA39E6299P-2"),std::stod("0X1.49A0E033378B8P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(0.0,INF_D)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(-INF_D,-1.0)), REP<double>(0.0,std::stod("0X1.49A0E033378B8P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP-1"),1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<double>(1000.0,1000.0)), REP<double>(std::stod("0X1.920566D7D32CP-19"),std::stod("0X1.920566D7D32C1P-19")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan_slope3(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atan_slope3_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan_slope3(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.56DADAP-2"),std::stof("0X1.49A0E2P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP<float>(-1.0f,0.5f)), REP<double>(std::stod("0X1.49A0E033378B7P-1"),1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::atan_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan_slope3(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atan_slope3_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan_slope3(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.56DADA39E6299P-2"),std::stod("0X1.49A0E033378B8P-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.49A0E033378B7P-1"),1.0),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::atan_slope3(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(0.0,1.0),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::atan_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan_slope3(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_atan_slope3_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan_slope3(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.56DADAP-2"),std::stof("0X1.49A0E2P-1")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::atan_slope3(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(0.0f,1.0f),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::atan_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan_slope3(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_cosh_slope2_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::cosh_slope2(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(-INF_D,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(-1.0,1.0)), REP<double>(1.0,std::stod("0X1.160EAA3B3EAA1P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.160EAA3B3EAAP+0"),std::stod("0X1.618FA0DF2D9BDP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(-2.0,-1.0)), REP<double>(std::stod("0X1.160EAA3B3EAAP+0"),std::stod("0X1.618FA0DF2D9BDP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(0.0,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(-INF_D,-1.0)), REP<double>(std::stod("0X1.160EAA3B3EAAP+0"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(1.0,std::stod("0X1.0000000000001P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<double>(1000.0,1000.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+1023"),INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::cosh_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cosh_slope2(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cosh_slope2_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::cosh_slope2(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.160EAAP+0"),std::stof("0X1.618FA2P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP<float>(-1.0f,0.5f)), REP<double>(1.0,std::stod("0X1.160EAA3B3EAA1P+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::cosh_slope2(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cosh_slope2(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cosh_slope2_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::cosh_slope2(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.160EAA3B3EAAP+0"),std::stod("0X1.618FA0DF2D9BDP+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(1.0,std::stod("0X1.160EAA3B3EAA1P+0")),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::cosh_slope2(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::cosh_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cosh_slope2(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_cosh_slope2_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::cosh_slope2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.160EAAP+0"),std::stof("0X1.618FA2P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::cosh_slope2(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(1.0f,INF_F),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::cosh_slope2(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::cosh_slope2(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_sinh_slope3_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::sinh_slope3(F<double>::empty()) ) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(-INF_D,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(-0.0,0.0)), REP<double>(1.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(-1.0,1.0)), REP<double>(1.0,std::stod("0X1.0D1BE99D8590FP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(1.0,2.0)), REP<double>(std::stod("0X1.0D1BE99D8590EP+0"),std::stod("0X1.385B71592527P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(-2.0,-1.0)), REP<double>(std::stod("0X1.0D1BE99D8590EP+0"),std::stod("0X1.385B71592527P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(0.0,INF_D)), REP<double>(1.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(-INF_D,-1.0)), REP<double>(std::stod("0X1.0D1BE99D8590EP+0"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(std::stod("0X1.56E1FC2F8F359P-997"),std::stod("0X1.56E1FC2F8F359P-997"))), REP<double>(1.0,std::stod("0X1.0000000000001P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<double>(1000.0,1000.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+1023"),INF_D) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::sinh_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinh_slope3(REP<double>(1.0,-3.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sinh_slope3_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::sinh_slope3(REP<double>(1.0,2.0)), REP<float>(std::stof("0X1.0D1BE8P+0"),std::stof("0X1.385B72P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP<float>(-1.0f,0.5f)), REP<double>(1.0,std::stod("0X1.0D1BE99D8590FP+0")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty( F<float>::sinh_slope3(REP<double>(1.0,-MAX_D)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinh_slope3(REP<float>(1.0f,-3.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sinh_slope3_dec_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::sinh_slope3(REP_DEC<double>(F<double>::empty(),DEC::trv)) ) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.0D1BE99D8590EP+0"),std::stod("0X1.385B71592527P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(1.0,std::stod("0X1.0D1BE99D8590FP+0")),DEC::def) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::dac)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::dac) );
+    BOOST_CHECK_EQUAL( F<double>::sinh_slope3(REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv)), REP_DEC<double>(REP<double>(1.0,INF_D),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::sinh_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinh_slope3(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_sinh_slope3_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::sinh_slope3(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), REP_DEC<float>(REP<float>(std::stof("0X1.0D1BE8P+0"),std::stof("0X1.385B72P+0")),DEC::com) );
+    BOOST_CHECK_EQUAL( F<float>::sinh_slope3(REP_DEC<double>(REP<double>(0.0,INF_D),DEC::def)), REP_DEC<float>(REP<float>(1.0f,INF_F),DEC::def) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai( F<float>::sinh_slope3(REP_DEC<double>(REP<double>(1.0,-MAX_D), DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::sinh_slope3(REP_DEC<float>(REP<float>(1.0f,-3.0f), DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
@@ -2287,22 +2287,397 @@ BOOST_AUTO_TEST_CASE(minimal_mul_rev_dec_ten_mixedtype_test)
 
 
 
-//BOOST_AUTO_TEST_CASE(minimal_pow_rev1_test)
-//{
-//    BOOST_CHECK(false);
-//}
-//
-//BOOST_AUTO_TEST_CASE(minimal_pow_rev2_test)
-//{
-//    BOOST_CHECK(false);
-//}
-//
-//BOOST_AUTO_TEST_CASE(minimal_atan2_rev1_test)
-//{
-//    BOOST_CHECK(false);
-//}
-//
-//BOOST_AUTO_TEST_CASE(minimal_atan2_rev2_test)
-//{
-//    BOOST_CHECK(false);
-//}
+BOOST_AUTO_TEST_CASE(minimal_pow_rev1_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP<double>(1.0,2.0), REP<double>(1.0,2.0), F<double>::empty()) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(2.0,2.0), REP<double>(4.0,9.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"),std::stod("0X1.8000000000001P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(2.0,3.0), REP<double>(4.0,9.0)), REP<double>(std::stod("0X1.965FEA53D6E3CP+0"),std::stod("0X1.8000000000001P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(-1.0,-1.0), REP<double>(0.25,0.5)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"),std::stod("0X1.0000000000001P+2")) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(0.0,0.0), REP<double>(1.0,1.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP<double>(0.0,0.0), REP<double>(2.0,2.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(1.0,2.0), REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(-1.0,1.0), REP<double>(2.0,4.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP<double>(2.0,2.0), REP<double>(-5.0,-1.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(-INF_D,INF_D), REP<double>(0.0,INF_D)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(-1.0,1.0), REP<double>(2.0,4.0), REP<double>(0.0,1.0)), REP<double>(0.0,std::stod("0X1.0000000000001P-1")) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP<double>(2.0,2.0), REP<double>(4.0,9.0), REP<double>(0.0,2.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"),2.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP<double>(2.0,2.0), REP<double>(4.0,9.0), REP<double>(-3.0,-1.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP<double>(1.0,2.0), REP<double>(0.0,0.0), REP<double>(1.0,2.0)) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty(F<double>::pow_rev1(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev1(REP<double>(1.0,2.0),REP<double>(1.0,2.0),REP<double>(1.0,-2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev1_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::pow_rev1(REP<double>(2.0,2.0), REP<double>(4.0,9.0)), REP<float>(std::stof("0X1.FFFFFEP+0"),std::stof("0X1.800002P+1")) );
+    BOOST_CHECK_EQUAL( F<float>::pow_rev1(REP<double>(-1.0,-1.0), REP<double>(0.25,0.5)), REP<float>(std::stof("0X1.FFFFFEP+0"),std::stof("0X1.000002P+2")) );
+    BOOST_CHECK_EQUAL( F<float>::pow_rev1(REP<double>(-1.0,1.0), REP<double>(2.0,4.0), REP<float>(0.0f,1.0f)), REP<float>(0.0f,std::stof("0X1.000002P-1")) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty(F<float>::pow_rev1(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev1(REP<double>(1.0,2.0),REP<float>(1.0f,-2.0f),REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev1_dec_test)
+{
+    BOOST_CHECK( F<double>::is_nai( F<double>::pow_rev1(F<double>::nai(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::pow_rev1(REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac), F<double>::nai()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(F<double>::empty_dec(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), REP_DEC<double>(REP<double>(4.0,9.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"),std::stod("0X1.8000000000001P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP_DEC<double>(REP<double>(0.0,0.0),DEC::def), REP_DEC<double>(REP<double>(1.0,1.0),DEC::dac)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev1(REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), REP_DEC<double>(REP<double>(-5.0,-1.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev1(REP_DEC<double>(REP<double>(-1.0,1.0),DEC::dac), REP_DEC<double>(REP<double>(2.0,4.0),DEC::com), REP_DEC<double>(REP<double>(0.0,1.0),DEC::def)), REP_DEC<double>(REP<double>(0.0,std::stod("0X1.0000000000001P-1")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai(F<double>::pow_rev1(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def),REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev1_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::pow_rev1(REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), REP_DEC<double>(REP<double>(4.0,9.0),DEC::dac)), REP_DEC<float>(REP<float>(std::stof("0X1.FFFFFEP+0"),std::stof("0X1.800002P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<float>::pow_rev1(REP_DEC<double>(REP<double>(-1.0,-1.0),DEC::def), REP_DEC<double>(REP<double>(0.25,0.5),DEC::trv)), REP_DEC<float>(REP<float>(std::stof("0X1.FFFFFEP+0"),std::stof("0X1.000002P+2")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai(F<float>::pow_rev1(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac),REP_DEC<float>(REP<float>(1.0f,-2.0f),DEC::com),REP_DEC<float>(REP<float>(1.0f,2.0f),DEC::def)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev2_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(REP<double>(1.0,2.0), REP<double>(1.0,2.0), F<double>::empty()) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(2.0,2.0), REP<double>(4.0,8.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFEP+0"),std::stod("0X1.8000000000002P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.5,0.5), REP<double>(4.0,8.0)), REP<double>(std::stod("-0X1.8000000000002P+1"),std::stod("-0X1.FFFFFFFFFFFFEP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(1.0,1.0), REP<double>(1.0,1.0)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(REP<double>(1.0,1.0), REP<double>(2.0,2.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.0,0.0), REP<double>(0.0,0.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.0,2.0), REP<double>(0.0,0.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.5,2.0), REP<double>(2.0,2.0)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(REP<double>(2.0,4.0), REP<double>(-1.0,-0.5)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.0,INF_D), REP<double>(-INF_D,INF_D)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.5,2.0), REP<double>(2.0,2.0), REP<double>(0.0,5.0)), REP<double>(std::stod("0X1.FFFFFFFFFFFFEP-1"),5.0) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(2.0,2.0), REP<double>(4.0,8.0), REP<double>(0.0,2.5)), REP<double>(std::stod("0X1.FFFFFFFFFFFFEP+0"),2.5) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(REP<double>(2.0,2.0), REP<double>(4.0,8.0), REP<double>(4.0,5.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP<double>(0.0,0.0), REP<double>(0.0,0.0), REP<double>(-1.0,1.0)), REP<double>(0.0,1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty(F<double>::pow_rev2(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev2(REP<double>(1.0,2.0),REP<double>(1.0,2.0),REP<double>(1.0,-2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev2_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::pow_rev2(REP<double>(2.0,2.0), REP<double>(4.0,8.0)), REP<float>(std::stof("0X1.FFFFFEP+0"),std::stof("0X1.800002P+1")) );
+    BOOST_CHECK_EQUAL( F<float>::pow_rev2(REP<double>(0.5,0.5), REP<double>(4.0,8.0)), REP<float>(std::stof("-0X1.800002P+1"),std::stof("-0X1.FFFFFEP+0")) );
+    BOOST_CHECK_EQUAL( F<float>::pow_rev2(REP<double>(0.5,2.0), REP<double>(2.0,2.0), REP<float>(0.0f,5.0f)), REP<float>(std::stof("0X1.FFFFFEP-1"),5.0f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty(F<float>::pow_rev2(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev2(REP<double>(1.0,2.0),REP<float>(1.0f,-2.0f),REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev2_dec_test)
+{
+    BOOST_CHECK( F<double>::is_nai( F<double>::pow_rev2(F<double>::nai(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::pow_rev2(REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac), F<double>::nai()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(F<double>::empty_dec(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), REP_DEC<double>(REP<double>(4.0,8.0),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.FFFFFFFFFFFFEP+0"),std::stod("0X1.8000000000002P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP_DEC<double>(REP<double>(1.0,1.0),DEC::def), REP_DEC<double>(REP<double>(1.0,1.0),DEC::dac)), REP_DEC<double>(REP<double>(-INF_D,INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::pow_rev2(REP_DEC<double>(REP<double>(2.0,4.0),DEC::com), REP_DEC<double>(REP<double>(-1.0,-0.5),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::pow_rev2(REP_DEC<double>(REP<double>(0.5,2.0),DEC::dac), REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), REP_DEC<double>(REP<double>(0.0,5.0),DEC::def)), REP_DEC<double>(REP<double>(std::stod("0X1.FFFFFFFFFFFFEP-1"),5.0),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai(F<double>::pow_rev2(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def),REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_pow_rev2_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::pow_rev2(REP_DEC<double>(REP<double>(2.0,2.0),DEC::com), REP_DEC<double>(REP<double>(4.0,8.0),DEC::dac)), REP_DEC<float>(REP<float>(std::stof("0X1.FFFFFEP+0"),std::stof("0X1.800002P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<float>::pow_rev2(REP_DEC<double>(REP<double>(0.5,0.5),DEC::def), REP_DEC<double>(REP<double>(4.0,8.0),DEC::trv)), REP_DEC<float>(REP<float>(std::stof("-0X1.800002P+1"),std::stof("-0X1.FFFFFEP+0")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai(F<float>::pow_rev2(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::pow_rev2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac),REP_DEC<float>(REP<float>(1.0f,-2.0f),DEC::com),REP_DEC<float>(REP<float>(1.0f,2.0f),DEC::def)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev1_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP<double>(1.0,2.0), REP<double>(1.0,2.0), F<double>::empty()) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(1.0,2.0), REP<double>(0.5,0.5)), REP<double>(std::stod("0X1.17B4F5BF3474AP-1"),std::stod("0X1.17B4F5BF3474BP+0")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(0.0,1.0)), REP<double>(0.0,std::stod("0X1.8EB245CBEE3A6P+0")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(0.0,2.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP<double>(0.0,0.0), REP<double>(0.0,1.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(0.0,0.0), REP<double>(1.0,2.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(-1.0,-1.0), REP<double>(3.0,4.0)), REP<double>(0.0,std::stod("0X1.23EF71254B87P-3")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(-1.0,-1.0), REP<double>(-4.0,-3.0)), REP<double>(std::stod("-0X1.23EF71254B87P-3"),0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(-1.0,0.0)), REP<double>(std::stod("-0X1.8EB245CBEE3A6P+0"),0.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(5.0,6.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(-INF_D,INF_D), REP<double>(-INF_D,INF_D)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(0.5,0.5), REP<double>(0.0,0.5)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(-1.0,1.0), REP<double>(0.0,2.0), REP<double>(-1.0,1.0)), REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP<double>(0.0,0.0), REP<double>(-2.0,2.0), REP<double>(-1.0,1.0)), REP<double>(-1.0,1.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty(F<double>::atan2_rev1(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev1(REP<double>(1.0,2.0),REP<double>(1.0,2.0),REP<double>(1.0,-2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev1_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev1(REP<double>(1.0,2.0), REP<double>(0.5,0.5)), REP<float>(std::stof("0X1.17B4F4P-1"),std::stof("0X1.17B4F6P+0")) );
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev1(REP<double>(-1.0,-1.0), REP<double>(3.0,4.0)), REP<float>(0.0f,std::stof("0X1.23EF72P-3")) );
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev1(REP<double>(1.0,1.0), REP<double>(0.0,1.0), REP<float>(0.0f,1.0f)), REP<float>(0.0f,1.0f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty(F<float>::atan2_rev1(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev1(REP<double>(1.0,2.0),REP<float>(1.0f,-2.0f),REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev1_dec_test)
+{
+    BOOST_CHECK( F<double>::is_nai( F<double>::atan2_rev1(F<double>::nai(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac), F<double>::nai()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(F<double>::empty_dec(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(0.5,0.5),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.17B4F5BF3474AP-1"),std::stod("0X1.17B4F5BF3474BP+0")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(0.0,0.0),DEC::def), REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(5.0,6.0),DEC::com)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,1.0),DEC::dac), REP_DEC<double>(REP<double>(0.5,0.5),DEC::com), REP_DEC<double>(REP<double>(0.0,0.5),DEC::def)) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai(F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def),REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev1_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(0.5,0.5),DEC::dac)), REP_DEC<float>(REP<float>(std::stof("0X1.17B4F4P-1"),std::stof("0X1.17B4F6P+0")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev1(REP_DEC<double>(REP<double>(-1.0,-1.0),DEC::def), REP_DEC<double>(REP<double>(3.0,4.0),DEC::trv)), REP_DEC<float>(REP<float>(0.0f,std::stof("0X1.23EF72P-3")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai(F<float>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev1(REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac),REP_DEC<float>(REP<float>(1.0f,-2.0f),DEC::com),REP_DEC<float>(REP<float>(1.0f,2.0f),DEC::def)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev2_test)
+{
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(F<double>::empty(), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(REP<double>(1.0,2.0), F<double>::empty()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(REP<double>(1.0,2.0), REP<double>(1.0,2.0), F<double>::empty()) ) );
+
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(0.0,0.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(0.0,0.0), REP<double>(0.0,0.0)), REP<double>(0.0,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(1.0,2.0), REP<double>(0.5,0.5)), REP<double>(std::stod("0X1.D49AD7E47C0A1P+0"),std::stod("0X1.D49AD7E47C0A4P+1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(1.0,2.0)), REP<double>(std::stod("-0X1.D4A42E92FAA4FP-2"),std::stod("0X1.48C05D04E1CFFP-1")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(2.0,3.0)), REP<double>(std::stod("-0X1.C0F9E5D665E16P+2"),std::stod("-0X1.D4A42E92FAA4CP-2")) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(0.0,0.0), REP<double>(3.0,4.0)), REP<double>(-INF_D,0.0) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(-1.0,-1.0), REP<double>(-1.0,0.0)), REP<double>(std::stod("0X1.48C05D04E1CFDP-1"),INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(-1.0,-1.0), REP<double>(-2.0,-1.5)), REP<double>(std::stod("-0X1.D4A42E92FAA4FP-2"),std::stod("0X1.22779A914B0E6P-4")) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(5.0,6.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(-INF_D,INF_D), REP<double>(-INF_D,INF_D)), REP<double>(-INF_D,INF_D) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(-1.0,1.0), REP<double>(1.0,2.0), REP<double>(-1.0,1.0)), REP<double>(std::stod("-0X1.D4A42E92FAA4FP-2"),std::stod("0X1.48C05D04E1CFFP-1")) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(0.5,0.5), REP<double>(0.0,1.0)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(1.0,2.0), REP<double>(0.0,0.0)), REP<double>(0.0,0.0) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty(F<double>::atan2_rev2(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev2(REP<double>(1.0,2.0),REP<double>(1.0,2.0),REP<double>(1.0,-2.0)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev2_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev2(REP<double>(1.0,2.0), REP<double>(0.5,0.5)), REP<float>(std::stof("0X1.D49AD6P+0"),std::stof("0X1.D49AD8P+1")) );
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev2(REP<double>(1.0,1.0), REP<double>(1.0,2.0)), REP<float>(std::stof("-0X1.D4A43P-2"),std::stof("0X1.48C05EP-1")) );
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev2(REP<double>(-1.0,-1.0), REP<double>(-2.0,-1.5), REP<float>(-1.0f,0.0f)), REP<float>(std::stof("-0X1.D4A43P-2"),0.0f) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_empty(F<float>::atan2_rev2(REP<double>(1.0,-2.0), REP<double>(1.0,2.0)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev2(REP<double>(1.0,2.0),REP<float>(1.0f,-2.0f),REP<float>(1.0f,2.0f)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev2_dec_test)
+{
+    BOOST_CHECK( F<double>::is_nai( F<double>::atan2_rev2(F<double>::nai(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac), F<double>::nai()) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(F<double>::empty_dec(), REP_DEC<double>(REP<double>(1.0, 2.0),DEC::dac)) ) );
+
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(0.5,0.5),DEC::com)), REP_DEC<double>(REP<double>(std::stod("0X1.D49AD7E47C0A1P+0"),std::stod("0X1.D49AD7E47C0A4P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(0.0,0.0),DEC::def), REP_DEC<double>(REP<double>(0.0,0.0),DEC::dac)), REP_DEC<double>(REP<double>(0.0,INF_D),DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,1.0),DEC::com), REP_DEC<double>(REP<double>(0.0,0.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,1.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(0.0,0.0),DEC::def)), REP_DEC<double>(REP<double>(0.0,0.0),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai(F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::def),REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_atan2_rev2_dec_mixedtype_test)
+{
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::com), REP_DEC<double>(REP<double>(0.5,0.5),DEC::dac)), REP_DEC<float>(REP<float>(std::stof("0X1.D49AD6P+0"),std::stof("0X1.D49AD8P+1")),DEC::trv) );
+    BOOST_CHECK_EQUAL( F<float>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,1.0),DEC::def), REP_DEC<double>(REP<double>(1.0,2.0),DEC::trv)), REP_DEC<float>(REP<float>(std::stof("-0X1.D4A43P-2"),std::stof("0X1.48C05EP-1")),DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<float>::is_nai(F<float>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,-2.0),DEC::dac), REP_DEC<double>(REP<double>(1.0,2.0),DEC::com)) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::atan2_rev2(REP_DEC<double>(REP<double>(1.0,2.0),DEC::dac),REP_DEC<float>(REP<float>(1.0f,-2.0f),DEC::com),REP_DEC<float>(REP<float>(1.0f,2.0f),DEC::def)), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
@@ -26,6 +26,10 @@
 #define BOOST_TEST_MODULE "Flavor: Set operations [p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor]"
 #include "test/util/boost_test_wrapper.hpp"
 
+#include <cmath>
+#include <iterator>
+#include <vector>
+
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
 #include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
 
@@ -215,3 +219,228 @@ BOOST_AUTO_TEST_CASE(minimal_convex_hull_dec_mixedtype_test)
     p1788::exception::clear();
     p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
 }
+
+
+BOOST_AUTO_TEST_CASE(minimal_intersection_array_test)
+{
+    REP<double> x[] = { REP<double>(1.0,3.0), REP<double>(2.1,4.0), REP<double>(-INF_D,2.5), F<double>::entire() };
+
+    BOOST_CHECK_EQUAL( F<double>::intersection(x, 4), REP<double>(2.1,2.5) );
+    BOOST_CHECK_EQUAL( F<double>::intersection(x, 1), REP<double>(1.0,3.0) );
+    BOOST_CHECK_EQUAL( F<double>::intersection(x, 0), F<double>::entire() );
+
+    // reduction over several blocks compared with the binary version
+    std::vector<REP<double>> y;
+    REP<double> r = F<double>::entire();
+    for (int i = 0; i < 1000; ++i)
+    {
+        y.push_back(REP<double>(-1000.0 + i * 0.5, 2000.0 - i));
+        r = F<double>::intersection(r, y.back());
+    }
+    BOOST_CHECK_EQUAL( F<double>::intersection(y.data(), y.size()), r );
+
+    y[700] = REP<double>(3000.0, 4000.0);
+    BOOST_CHECK( F<double>::is_empty( F<double>::intersection(y.data(), y.size()) ) );
+    y[700] = F<double>::empty();
+    BOOST_CHECK( F<double>::is_empty( F<double>::intersection(y.data(), y.size()) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    x[2] = REP<double>(1.0,-3.0);
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::intersection(x, 4) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::intersection(x, 4), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_intersection_dec_array_test)
+{
+    REP_DEC<double> x[] = { REP_DEC<double>(REP<double>(1.0,3.0), DEC::com), REP_DEC<double>(REP<double>(2.1,4.0), DEC::def),
+                            F<double>::empty_dec(), F<double>::nai()
+                          };
+
+    BOOST_CHECK_EQUAL( F<double>::intersection(x, 2), REP_DEC<double>(REP<double>(2.1,3.0), DEC::trv) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::intersection(x, 3) ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::intersection(x, 4) ) );
+    BOOST_CHECK_EQUAL( F<double>::intersection(x, 0), REP_DEC<double>(F<double>::entire(), DEC::trv) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    x[1] = REP_DEC<double>(REP<double>(1.0,-3.0), DEC::trv);
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::intersection(x, 3) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+}
+
+BOOST_AUTO_TEST_CASE(minimal_convex_hull_array_test)
+{
+    REP<double> x[] = { F<double>::empty(), REP<double>(1.0,3.0), REP<double>(2.1,4.0), F<double>::empty(), REP<double>(-2.0,-1.0) };
+
+    BOOST_CHECK_EQUAL( F<double>::convex_hull(x, 5), REP<double>(-2.0,4.0) );
+    BOOST_CHECK_EQUAL( F<double>::convex_hull(x, 3), REP<double>(1.0,4.0) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::convex_hull(x, 1) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::convex_hull(x, 0) ) );
+
+    std::vector<REP<double>> y;
+    REP<double> r = F<double>::empty();
+    for (int i = 0; i < 1000; ++i)
+    {
+        y.push_back(i % 7 ? REP<double>(-i * 0.25, i * 0.5) : F<double>::empty());
+        r = F<double>::convex_hull(r, y.back());
+    }
+    BOOST_CHECK_EQUAL( F<double>::convex_hull(y.data(), y.size()), r );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    x[3] = REP<double>(NAN_D,3.0);
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::convex_hull(x, 5) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::convex_hull(x, 5), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_convex_hull_dec_array_test)
+{
+    REP_DEC<double> x[] = { REP_DEC<double>(REP<double>(1.0,3.0), DEC::com), F<double>::empty_dec(),
+                            REP_DEC<double>(REP<double>(2.1,4.0), DEC::def), F<double>::nai()
+                          };
+
+    BOOST_CHECK_EQUAL( F<double>::convex_hull(x, 3), REP_DEC<double>(REP<double>(1.0,4.0), DEC::trv) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::convex_hull(x, 4) ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::convex_hull(x, 0) ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    x[2] = REP_DEC<double>(REP<double>(1.0,-3.0), DEC::trv);
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::convex_hull(x, 3) ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_bisect_test)
+{
+    typedef std::pair<REP<double>,REP<double>> PAIR;
+
+    BOOST_CHECK( F<double>::bisect(REP<double>(1.0,3.0)) == PAIR(REP<double>(1.0,2.0), REP<double>(2.0,3.0)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(2.0,2.0)) == PAIR(REP<double>(2.0,2.0), REP<double>(2.0,2.0)) );
+    BOOST_CHECK( F<double>::bisect(F<double>::entire()) == PAIR(REP<double>(-INF_D,0.0), REP<double>(0.0,INF_D)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(0.0,INF_D)) == PAIR(REP<double>(0.0,MAX_D), REP<double>(MAX_D,INF_D)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(-INF_D,1.0)) == PAIR(REP<double>(-INF_D,-MAX_D), REP<double>(-MAX_D,1.0)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(-MAX_D,MAX_D)) == PAIR(REP<double>(-MAX_D,0.0), REP<double>(0.0,MAX_D)) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::bisect(F<double>::empty()).first ) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::bisect(F<double>::empty()).second ) );
+
+    BOOST_CHECK( F<double>::bisect(REP<double>(1.0,3.0), 0.25) == PAIR(REP<double>(1.0,1.5), REP<double>(1.5,3.0)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(1.0,3.0), 0.0) == PAIR(REP<double>(1.0,1.0), REP<double>(1.0,3.0)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(1.0,3.0), 2.0) == PAIR(REP<double>(1.0,3.0), REP<double>(3.0,3.0)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(1.0,3.0), NAN_D) == PAIR(REP<double>(1.0,2.0), REP<double>(2.0,3.0)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(-MAX_D,MAX_D / 2), 0.5) == PAIR(REP<double>(-MAX_D,-MAX_D / 4), REP<double>(-MAX_D / 4,MAX_D / 2)) );
+    BOOST_CHECK( F<double>::bisect(REP<double>(0.0,INF_D), 0.5) == PAIR(REP<double>(0.0,MAX_D / 2), REP<double>(MAX_D / 2,INF_D)) );
+    BOOST_CHECK( F<double>::bisect(F<double>::entire(), 0.5) == PAIR(REP<double>(-INF_D,0.0), REP<double>(0.0,INF_D)) );
+    BOOST_CHECK( !std::signbit(F<double>::bisect(REP<double>(-1.0,1.0), 0.5).first.second) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::bisect(F<double>::empty(), 0.5).first ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_empty( F<double>::bisect(REP<double>(1.0,-3.0)).first ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::invalid_operand_bit);
+    BOOST_CHECK_THROW( F<double>::bisect(REP<double>(1.0,-3.0), 0.5), p1788::exception::invalid_operand_exception);
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+    p1788::exception::set_throw_exception_cwd(p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(minimal_bisect_dec_test)
+{
+    typedef std::pair<REP_DEC<double>,REP_DEC<double>> PAIR;
+
+    BOOST_CHECK( F<double>::bisect(REP_DEC<double>(REP<double>(1.0,3.0), DEC::com)) ==
+                 PAIR(REP_DEC<double>(REP<double>(1.0,2.0), DEC::com), REP_DEC<double>(REP<double>(2.0,3.0), DEC::com)) );
+    BOOST_CHECK( F<double>::bisect(REP_DEC<double>(REP<double>(0.0,INF_D), DEC::dac), 0.5) ==
+                 PAIR(REP_DEC<double>(REP<double>(0.0,MAX_D / 2), DEC::dac), REP_DEC<double>(REP<double>(MAX_D / 2,INF_D), DEC::dac)) );
+    BOOST_CHECK( F<double>::is_empty( F<double>::bisect(F<double>::empty_dec()).first ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::bisect(F<double>::nai()).first ) );
+    BOOST_CHECK( F<double>::is_nai( F<double>::bisect(F<double>::nai(), 0.5).second ) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    p1788::exception::clear();
+    BOOST_CHECK( F<double>::is_nai( F<double>::bisect(REP_DEC<double>(REP<double>(1.0,-3.0), DEC::trv)).first ) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+}
+
+BOOST_AUTO_TEST_CASE(minimal_multisect_test)
+{
+    std::vector<REP<double>> x;
+
+    F<double>::multisect(REP<double>(0.0,4.0), 4, std::back_inserter(x));
+    BOOST_CHECK_EQUAL( x.size(), 4u );
+    BOOST_CHECK_EQUAL( x[0], REP<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( x[1], REP<double>(1.0,2.0) );
+    BOOST_CHECK_EQUAL( x[2], REP<double>(2.0,3.0) );
+    BOOST_CHECK_EQUAL( x[3], REP<double>(3.0,4.0) );
+
+    x.clear();
+    F<double>::multisect(REP<double>(-INF_D,INF_D), 3, std::back_inserter(x));
+    BOOST_CHECK_EQUAL( x.size(), 3u );
+    BOOST_CHECK_EQUAL( x[0].first, -INF_D );
+    BOOST_CHECK_EQUAL( x[0].second, x[1].first );
+    BOOST_CHECK_EQUAL( x[1].second, x[2].first );
+    BOOST_CHECK_EQUAL( x[2].second, INF_D );
+    BOOST_CHECK( x[1].first < 0.0 && 0.0 < x[1].second );
+
+    // contiguous and nondecreasing parts of a narrow interval
+    x.clear();
+    F<double>::multisect(REP<double>(1.0,std::nextafter(1.0, 2.0)), 5, std::back_inserter(x));
+    BOOST_CHECK_EQUAL( x.size(), 5u );
+    BOOST_CHECK_EQUAL( x.front().first, 1.0 );
+    BOOST_CHECK_EQUAL( x.back().second, std::nextafter(1.0, 2.0) );
+    for (std::size_t i = 1; i < x.size(); ++i)
+        BOOST_CHECK( x[i - 1].second == x[i].first && x[i].first <= x[i].second );
+
+    x.clear();
+    F<double>::multisect(REP<double>(0.0,4.0), 0, std::back_inserter(x));
+    BOOST_CHECK( x.empty() );
+    F<double>::multisect(REP<double>(0.0,4.0), 1, std::back_inserter(x));
+    BOOST_CHECK_EQUAL( x.size(), 1u );
+    BOOST_CHECK_EQUAL( x[0], REP<double>(0.0,4.0) );
+
+    x.clear();
+    F<double>::multisect(F<double>::empty(), 2, std::back_inserter(x));
+    BOOST_CHECK_EQUAL( x.size(), 2u );
+    BOOST_CHECK( F<double>::is_empty(x[0]) && F<double>::is_empty(x[1]) );
+
+    std::vector<REP_DEC<double>> xd;
+    F<double>::multisect(REP_DEC<double>(REP<double>(0.0,3.0), DEC::def), 3, std::back_inserter(xd));
+    BOOST_CHECK_EQUAL( xd.size(), 3u );
+    BOOST_CHECK_EQUAL( xd[1], REP_DEC<double>(REP<double>(1.0,2.0), DEC::def) );
+    xd.clear();
+    F<double>::multisect(F<double>::nai(), 2, std::back_inserter(xd));
+    BOOST_CHECK( F<double>::is_nai(xd[0]) && F<double>::is_nai(xd[1]) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+
+    x.clear();
+    p1788::exception::clear();
+    F<double>::multisect(REP<double>(1.0,-3.0), 2, std::back_inserter(x));
+    BOOST_CHECK( F<double>::is_empty(x[0]) && F<double>::is_empty(x[1]) );
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::invalid_operand_bit);
+    p1788::exception::clear();
+}
@@ -0,0 +1,213 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Flavor: Unchecked functions [p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor]"
+#include "test/util/boost_test_wrapper.hpp"
+
+#include <limits>
+#include <vector>
+#include "p1788/decoration/decoration.hpp"
+#include "p1788/exception/exception.hpp"
+#include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
+#include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
+
+template<typename T>
+using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
+
+template<typename T>
+using REP = typename F<T>::representation;
+
+template<typename T>
+using REP_DEC = typename F<T>::representation_dec;
+
+typedef p1788::decoration::decoration DEC;
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double MAX_D = std::numeric_limits<double>::max();
+const double MIN_D = std::numeric_limits<double>::min();
+const double DNORM_MIN_D = std::numeric_limits<double>::denorm_min();
+
+const double NAN_D = std::numeric_limits<double>::quiet_NaN();
+
+const auto UNCHECKED = p1788::infsup::unchecked;
+
+
+// valid bare intervals covering the special cases of the arithmetic operations
+std::vector<REP<double>> bare_inputs()
+{
+    return std::vector<REP<double>>
+    {
+        REP<double>(NAN_D, NAN_D), REP<double>(-INF_D, INF_D), REP<double>(0.0, 0.0),
+        REP<double>(-0.0, 0.0), REP<double>(-INF_D, 0.0), REP<double>(0.0, INF_D),
+        REP<double>(-INF_D, -2.0), REP<double>(3.0, INF_D), REP<double>(-INF_D, 1.5),
+        REP<double>(-0.5, INF_D), REP<double>(1.0, 2.0), REP<double>(-3.0, -0.25),
+        REP<double>(-1.0, 4.0), REP<double>(0.0, 5.0), REP<double>(-7.0, 0.0),
+        REP<double>(0.1, 0.3), REP<double>(-MAX_D, MAX_D), REP<double>(MAX_D, MAX_D),
+        REP<double>(DNORM_MIN_D, MIN_D), REP<double>(-MIN_D, -DNORM_MIN_D)
+    };
+}
+
+// valid decorated intervals, including NaI
+std::vector<REP_DEC<double>> dec_inputs()
+{
+    std::vector<REP_DEC<double>> v;
+
+    for (auto const& x : bare_inputs())
+    {
+        if (F<double>::is_empty(x))
+        {
+            v.push_back(REP_DEC<double>(x, DEC::trv));
+            v.push_back(REP_DEC<double>(x, DEC::ill));
+            continue;
+        }
+
+        v.push_back(REP_DEC<double>(x, DEC::trv));
+        v.push_back(REP_DEC<double>(x, DEC::def));
+        v.push_back(REP_DEC<double>(x, DEC::dac));
+
+        if (F<double>::is_common_interval(x))
+            v.push_back(REP_DEC<double>(x, DEC::com));
+    }
+
+    return v;
+}
+
+bool identical(REP<double> const& x, REP<double> const& y)
+{
+    return F<double>::is_empty(x) ? F<double>::is_empty(y) : x == y;
+}
+
+bool identical(REP_DEC<double> const& x, REP_DEC<double> const& y)
+{
+    return identical(x.first, y.first) && x.second == y.second;
+}
+
+
+BOOST_AUTO_TEST_CASE(minimal_unchecked_bool_func_test)
+{
+    p1788::exception::clear();
+
+    for (auto const& x : bare_inputs())
+    {
+        BOOST_CHECK_EQUAL(F<double>::is_empty(x, UNCHECKED), F<double>::is_empty(x));
+        BOOST_CHECK_EQUAL(F<double>::is_entire(x, UNCHECKED), F<double>::is_entire(x));
+        BOOST_CHECK_EQUAL(F<double>::is_common_interval(x, UNCHECKED), F<double>::is_common_interval(x));
+    }
+
+    BOOST_CHECK(!p1788::exception::invalid_operand());
+}
+
+BOOST_AUTO_TEST_CASE(minimal_unchecked_bare_elem_func_test)
+{
+    p1788::exception::clear();
+
+    auto v = bare_inputs();
+
+    for (auto const& x : v)
+    {
+        BOOST_CHECK(identical(F<double>::neg(x, UNCHECKED), F<double>::neg(x)));
+        BOOST_CHECK(identical(F<double>::recip(x, UNCHECKED), F<double>::recip(x)));
+        BOOST_CHECK(identical(F<double>::sqr(x, UNCHECKED), F<double>::sqr(x)));
+        BOOST_CHECK(identical(F<double>::sqrt(x, UNCHECKED), F<double>::sqrt(x)));
+
+        for (auto const& y : v)
+        {
+            BOOST_CHECK(identical(F<double>::add(x, y, UNCHECKED), F<double>::add(x, y)));
+            BOOST_CHECK(identical(F<double>::sub(x, y, UNCHECKED), F<double>::sub(x, y)));
+            BOOST_CHECK(identical(F<double>::mul(x, y, UNCHECKED), F<double>::mul(x, y)));
+            BOOST_CHECK(identical(F<double>::div(x, y, UNCHECKED), F<double>::div(x, y)));
+
+            for (auto const& z : v)
+                BOOST_CHECK(identical(F<double>::fma(x, y, z, UNCHECKED), F<double>::fma(x, y, z)));
+        }
+    }
+
+    BOOST_CHECK(!p1788::exception::invalid_operand());
+
+    BOOST_CHECK(identical(F<double>::add(REP<double>(1.0, 2.0), REP<double>(0.5, 0.5), UNCHECKED),
+                          REP<double>(1.5, 2.5)));
+    BOOST_CHECK(identical(F<double>::div(REP<double>(1.0, 2.0), REP<double>(-1.0, 4.0), UNCHECKED),
+                          REP<double>(-INF_D, INF_D)));
+    BOOST_CHECK(identical(F<double>::sqrt(REP<double>(-4.0, 4.0), UNCHECKED), REP<double>(0.0, 2.0)));
+    BOOST_CHECK(F<double>::is_empty(F<double>::sqrt(REP<double>(-4.0, -1.0), UNCHECKED)));
+}
+
+BOOST_AUTO_TEST_CASE(minimal_unchecked_dec_elem_func_test)
+{
+    p1788::exception::clear();
+
+    auto v = dec_inputs();
+
+    for (auto const& x : v)
+    {
+        BOOST_CHECK(identical(F<double>::neg(x, UNCHECKED), F<double>::neg(x)));
+        BOOST_CHECK(identical(F<double>::recip(x, UNCHECKED), F<double>::recip(x)));
+        BOOST_CHECK(identical(F<double>::sqr(x, UNCHECKED), F<double>::sqr(x)));
+        BOOST_CHECK(identical(F<double>::sqrt(x, UNCHECKED), F<double>::sqrt(x)));
+
+        for (auto const& y : v)
+        {
+            BOOST_CHECK(identical(F<double>::add(x, y, UNCHECKED), F<double>::add(x, y)));
+            BOOST_CHECK(identical(F<double>::sub(x, y, UNCHECKED), F<double>::sub(x, y)));
+            BOOST_CHECK(identical(F<double>::mul(x, y, UNCHECKED), F<double>::mul(x, y)));
+            BOOST_CHECK(identical(F<double>::div(x, y, UNCHECKED), F<double>::div(x, y)));
+        }
+    }
+
+    for (auto const& x : v)
+        for (auto const& z : v)
+            BOOST_CHECK(identical(F<double>::fma(x, REP_DEC<double>(REP<double>(-1.0, 2.0), DEC::com), z, UNCHECKED),
+                                  F<double>::fma(x, REP_DEC<double>(REP<double>(-1.0, 2.0), DEC::com), z)));
+
+    BOOST_CHECK(!p1788::exception::invalid_operand());
+
+    // NaI propagates without a validity check
+    BOOST_CHECK(F<double>::is_nai(F<double>::add(F<double>::nai(), REP_DEC<double>(REP<double>(1.0, 2.0), DEC::com), UNCHECKED)));
+    BOOST_CHECK(F<double>::is_nai(F<double>::sqrt(F<double>::nai(), UNCHECKED)));
+
+    BOOST_CHECK(identical(F<double>::div(REP_DEC<double>(REP<double>(1.0, 2.0), DEC::com),
+                                         REP_DEC<double>(REP<double>(0.0, 4.0), DEC::com), UNCHECKED),
+                          REP_DEC<double>(REP<double>(0.25, INF_D), DEC::trv)));
+    BOOST_CHECK(identical(F<double>::mul(REP_DEC<double>(REP<double>(1.0, 2.0), DEC::com),
+                                         REP_DEC<double>(REP<double>(3.0, INF_D), DEC::dac), UNCHECKED),
+                          REP_DEC<double>(REP<double>(3.0, INF_D), DEC::dac)));
+}
+
+BOOST_AUTO_TEST_CASE(minimal_unchecked_validation_test)
+{
+    p1788::exception::clear();
+
+    // the checked operations still reject invalid operands
+    BOOST_CHECK(F<double>::is_empty(F<double>::add(REP<double>(2.0, 1.0), REP<double>(1.0, 2.0))));
+    BOOST_CHECK(p1788::exception::invalid_operand());
+
+    p1788::exception::clear();
+
+    BOOST_CHECK(F<double>::is_nai(F<double>::mul(REP_DEC<double>(REP<double>(-INF_D, 1.0), DEC::com),
+                                                 REP_DEC<double>(REP<double>(1.0, 2.0), DEC::com))));
+    BOOST_CHECK(p1788::exception::invalid_operand());
+
+    p1788::exception::clear();
+}
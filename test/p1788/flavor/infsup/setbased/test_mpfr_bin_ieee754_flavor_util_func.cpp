@@ -29,6 +29,9 @@
 #include <string>
 #include <limits>
 #include <cmath>
+#include <cfenv>
+#include <random>
+#include <mpfr.h>
 #include "p1788/decoration/decoration.hpp"
 #include "p1788/flavor/infsup/setbased/mpfr_bin_ieee754_flavor.hpp"
 #include "test/util/mpfr_bin_ieee754_flavor_io_test_util.hpp"
@@ -180,6 +183,105 @@ BOOST_AUTO_TEST_CASE(minimal_convert_rndu_test)
 }
 
 
+// reference conversion of x to T via MPFR
+template<typename T>
+struct mpfr_reference;
+
+template<>
+struct mpfr_reference<float>
+{
+    static float get(mpfr_t x, mpfr_rnd_t rnd) { return mpfr_get_flt(x, rnd); }
+};
+
+template<>
+struct mpfr_reference<double>
+{
+    static double get(mpfr_t x, mpfr_rnd_t rnd) { return mpfr_get_d(x, rnd); }
+};
+
+template<typename T, typename T_>
+void check_convert_rnd(T_ x)
+{
+    mpfr_t m;
+    mpfr_init2(m, 128);
+    mpfr_set_ld(m, x, MPFR_RNDN);
+
+    T d = mpfr_reference<T>::get(m, MPFR_RNDD);
+    T n = mpfr_reference<T>::get(m, MPFR_RNDN);
+    T u = mpfr_reference<T>::get(m, MPFR_RNDU);
+
+    mpfr_clear(m);
+
+    BOOST_CHECK_EQUAL(F<T>::convert_rndd(x), d == 0.0 ? -0.0 : d);
+    BOOST_CHECK_EQUAL(F<T>::convert_rndn(x), n);
+    BOOST_CHECK_EQUAL(F<T>::convert_rndu(x), u);
+
+    BOOST_CHECK(d != 0.0 || std::signbit(F<T>::convert_rndd(x)));
+    BOOST_CHECK(n != 0.0 || !std::signbit(F<T>::convert_rndn(x)));
+    BOOST_CHECK(u != 0.0 || !std::signbit(F<T>::convert_rndu(x)));
+}
+
+BOOST_AUTO_TEST_CASE(random_convert_rnd_test)
+{
+    std::mt19937_64 gen(1788);
+    std::uniform_real_distribution<double> mant(0.5, 1.0);
+    std::uniform_int_distribution<int> exp_d(-1080, 1030);
+    std::uniform_int_distribution<int> exp_f(-155, 135);
+
+    // double -> float, covers subnormal and overflowing floats
+    for (int i = 0; i < 10000; ++i)
+    {
+        double x = std::ldexp(mant(gen), i % 2 ? exp_f(gen) : exp_d(gen));
+        check_convert_rnd<float>(i % 4 < 2 ? x : -x);
+    }
+
+    // long double -> double and long double -> float
+    for (int i = 0; i < 10000; ++i)
+    {
+        long double x = std::ldexp(static_cast<long double>(mant(gen)) + std::ldexp(static_cast<long double>(mant(gen)), -50),
+                                   exp_d(gen));
+        check_convert_rnd<double>(i % 2 ? x : -x);
+        check_convert_rnd<float>(i % 2 ? x : -x);
+    }
+
+    // widening is exact
+    for (int i = 0; i < 1000; ++i)
+    {
+        float x = static_cast<float>(std::ldexp(mant(gen), exp_f(gen)));
+        check_convert_rnd<double>(x);
+        BOOST_CHECK_EQUAL(F<double>::convert_rndd(x), static_cast<double>(x));
+    }
+
+    // ties and the threshold to infinity
+    check_convert_rnd<float>(1.0 + std::ldexp(1.0, -24));
+    check_convert_rnd<float>(1.0 + 3.0 * std::ldexp(1.0, -24));
+    check_convert_rnd<float>(static_cast<double>(MAX_F) + std::ldexp(1.0, 103));
+    check_convert_rnd<float>(static_cast<double>(MAX_F) + std::ldexp(1.0, 102));
+    check_convert_rnd<float>(-static_cast<double>(MAX_F) - std::ldexp(1.0, 103));
+    check_convert_rnd<float>(std::ldexp(1.0, -150));
+    check_convert_rnd<float>(-std::ldexp(1.0, -150));
+    check_convert_rnd<float>(std::ldexp(1.0, -151));
+    check_convert_rnd<float>(MAX_D);
+    check_convert_rnd<float>(-MAX_D);
+    check_convert_rnd<float>(INF_D);
+    check_convert_rnd<float>(-INF_D);
+    check_convert_rnd<float>(0.0);
+    check_convert_rnd<float>(-0.0);
+
+    BOOST_CHECK(std::isnan(F<float>::convert_rndd(NAN_D)));
+    BOOST_CHECK(std::isnan(F<float>::convert_rndn(NAN_D)));
+    BOOST_CHECK(std::isnan(F<float>::convert_rndu(NAN_D)));
+
+    // independent of the rounding mode of the floating point environment
+    std::fesetround(FE_UPWARD);
+    check_convert_rnd<float>(1.0 + std::ldexp(1.0, -30));
+    check_convert_rnd<float>(-1.0 - std::ldexp(1.0, -30));
+    std::fesetround(FE_DOWNWARD);
+    check_convert_rnd<float>(1.0 + std::ldexp(1.0, -30));
+    check_convert_rnd<float>(-1.0 - std::ldexp(1.0, -30));
+    std::fesetround(FE_TONEAREST);
+}
+
 BOOST_AUTO_TEST_CASE(minimal_convert_hull_test)
 {
     BOOST_CHECK_EQUAL(F<double>::convert_hull( REP<double>(std::stod("-0x1.99999A842549Ap+4"), std::stod("0X1.9999999999999P-4")) ), REP<double>(std::stod("-0x1.99999A842549Ap+4"), std::stod("0X1.9999999999999P-4")));
@@ -0,0 +1,250 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#define BOOST_TEST_MODULE "Interval index [p1788/index/interval_index]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/index/interval_index.hpp"
+
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using SII = p1788::index::static_interval_index<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using II = p1788::index::interval_index<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+typedef std::vector<std::size_t> IDS;
+
+
+// random intervals with integer bounds in [-50,50] to produce many ties,
+// including empty, entire, half-unbounded and point intervals
+std::vector<I<double>> random_intervals(std::size_t n, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> bound(-50, 50);
+    std::uniform_int_distribution<int> kind(0, 19);
+
+    std::vector<I<double>> v;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double a = bound(gen) * 1.0;
+        double b = bound(gen) * 1.0;
+
+        switch (kind(gen))
+        {
+        case 0:
+            v.push_back(I<double>::empty());
+            break;
+        case 1:
+            v.push_back(I<double>::entire());
+            break;
+        case 2:
+            v.push_back(I<double>(-INF_D, a));
+            break;
+        case 3:
+            v.push_back(I<double>(a, INF_D));
+            break;
+        case 4:
+            v.push_back(I<double>(a, a));
+            break;
+        default:
+            v.push_back(I<double>(std::min(a, b), std::max(a, b)));
+        }
+    }
+
+    return v;
+}
+
+template<typename Pred>
+IDS scan(std::vector<I<double>> const& v, std::vector<bool> const& alive, Pred pred)
+{
+    IDS r;
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+        if (alive[i] && pred(v[i]))
+            r.push_back(i);
+
+    return r;
+}
+
+IDS sorted(IDS r)
+{
+    std::sort(r.begin(), r.end());
+    return r;
+}
+
+// compares all queries of the index with a linear scan
+template<typename Index>
+void check_queries(Index const& index, std::vector<I<double>> const& v, std::vector<bool> const& alive,
+                   std::vector<I<double>> const& queries)
+{
+    for (I<double> const& y : queries)
+    {
+        IDS r;
+        index.overlapping(y, std::back_inserter(r));
+        BOOST_CHECK( sorted(r) == scan(v, alive, [&y](I<double> const& x) { return !disjoint(x, y); }) );
+
+        r.clear();
+        index.containing(y, std::back_inserter(r));
+        BOOST_CHECK( sorted(r) == scan(v, alive, [&y](I<double> const& x) { return subset(y, x); }) );
+
+        r.clear();
+        index.contained_in(y, std::back_inserter(r));
+        BOOST_CHECK( sorted(r) == scan(v, alive, [&y](I<double> const& x) { return subset(x, y); }) );
+
+        if (is_common_interval(y))
+        {
+            for (double p : { inf(y), sup(y), mid(y), inf(y) - 0.5 })
+            {
+                r.clear();
+                index.stabbing(p, std::back_inserter(r));
+                BOOST_CHECK( sorted(r) == scan(v, alive, [p](I<double> const& x) { return is_member(p, x); }) );
+            }
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(static_interval_index_test)
+{
+    SII<double> e;
+    IDS r;
+
+    BOOST_CHECK( e.empty() );
+    e.overlapping(I<double>::entire(), std::back_inserter(r));
+    e.contained_in(I<double>::entire(), std::back_inserter(r));
+    e.stabbing(0.0, std::back_inserter(r));
+    BOOST_CHECK( r.empty() );
+
+    std::vector<I<double>> s { I<double>(1.0, 2.0), I<double>(2.0, 3.0), I<double>::empty(),
+                               I<double>(-INF_D, 0.0), I<double>(4.0, 4.0) };
+    SII<double> index(s.begin(), s.end(), 10);
+
+    BOOST_CHECK_EQUAL( index.size(), 5u );
+
+    index.stabbing(2.0, std::back_inserter(r));
+    BOOST_CHECK( sorted(r) == IDS({ 10, 11 }) );
+
+    r.clear();
+    index.stabbing(INF_D, std::back_inserter(r));
+    index.stabbing(-INF_D, std::back_inserter(r));
+    index.stabbing(std::numeric_limits<double>::quiet_NaN(), std::back_inserter(r));
+    BOOST_CHECK( r.empty() );
+
+    index.overlapping(I<double>(0.0, 1.0), std::back_inserter(r));
+    BOOST_CHECK( sorted(r) == IDS({ 10, 13 }) );
+
+    r.clear();
+    index.overlapping(I<double>::empty(), std::back_inserter(r));
+    BOOST_CHECK( r.empty() );
+
+    index.containing(I<double>::empty(), std::back_inserter(r));
+    BOOST_CHECK( sorted(r) == IDS({ 10, 11, 12, 13, 14 }) );
+
+    r.clear();
+    index.contained_in(I<double>::empty(), std::back_inserter(r));
+    BOOST_CHECK( sorted(r) == IDS({ 12 }) );
+
+    r.clear();
+    index.contained_in(I<double>(1.0, 4.0), std::back_inserter(r));
+    BOOST_CHECK( sorted(r) == IDS({ 10, 11, 12, 14 }) );
+
+    r.clear();
+    index.containing(I<double>(-1.0, -0.0), std::back_inserter(r));
+    BOOST_CHECK( sorted(r) == IDS({ 13 }) );
+
+    std::vector<I<double>> v = random_intervals(2000, 1788);
+    std::vector<I<double>> q = random_intervals(300, 1789);
+    q.push_back(I<double>::empty());
+    q.push_back(I<double>::entire());
+
+    check_queries(SII<double>(v.begin(), v.end()), v, std::vector<bool>(v.size(), true), q);
+}
+
+BOOST_AUTO_TEST_CASE(interval_index_test)
+{
+    std::vector<I<double>> v = random_intervals(3000, 42);
+    std::vector<I<double>> q = random_intervals(100, 43);
+    q.push_back(I<double>::empty());
+    q.push_back(I<double>::entire());
+
+    std::vector<bool> alive(v.size(), true);
+
+    // bulk insertion of the first half, single insertions of the second one
+    II<double> index(v.begin(), v.begin() + 1500);
+
+    for (std::size_t i = 1500; i < v.size(); ++i)
+        BOOST_CHECK_EQUAL( index.insert(v[i]), i );
+
+    BOOST_CHECK_EQUAL( index.size(), v.size() );
+    check_queries(index, v, alive, q);
+
+    // removal of two thirds, triggers merges with dropped and a rebuild
+    std::mt19937 gen(44);
+
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        std::size_t id = gen() % v.size();
+
+        BOOST_CHECK_EQUAL( index.erase(id), alive[id] );
+        alive[id] = false;
+    }
+
+    BOOST_CHECK( !index.erase(v.size()) );
+    BOOST_CHECK_EQUAL( index.size(), static_cast<std::size_t>(std::count(alive.begin(), alive.end(), true)) );
+    check_queries(index, v, alive, q);
+
+    std::vector<I<double>> w = random_intervals(500, 45);
+    BOOST_CHECK_EQUAL( index.insert(w.begin(), w.end()), v.size() );
+    v.insert(v.end(), w.begin(), w.end());
+    alive.resize(v.size(), true);
+
+    BOOST_CHECK( index.contains(v.size() - 1) );
+    check_queries(index, v, alive, q);
+
+    index.clear();
+    BOOST_CHECK( index.empty() );
+    BOOST_CHECK( !index.contains(0) );
+    BOOST_CHECK_EQUAL( index.insert(I<double>(0.0, 1.0)), v.size() );
+
+    IDS r;
+    index.stabbing(0.5, std::back_inserter(r));
+    BOOST_CHECK( r == IDS({ v.size() }) );
+}
@@ -159,6 +159,52 @@ BOOST_AUTO_TEST_CASE(integration_div_test)
 }
 
 
+BOOST_AUTO_TEST_CASE(integration_compound_assign_test)
+{
+    I<double> x(1.0, 2.0);
+    x += I<double>(3.0, 4.0);
+    BOOST_CHECK_EQUAL( x, I<double>(4.0, 6.0) );
+    x -= I<double>(1.0, 2.0);
+    BOOST_CHECK_EQUAL( x, I<double>(2.0, 5.0) );
+    x *= I<double>(-1.0, 2.0);
+    BOOST_CHECK_EQUAL( x, I<double>(-5.0, 10.0) );
+    x /= I<double>(5.0, 10.0);
+    BOOST_CHECK_EQUAL( x, I<double>(-1.0, 2.0) );
+    BOOST_CHECK_EQUAL( (x += I<double>(1.0, 1.0)), I<double>(0.0, 3.0) );
+    x += I<double>::empty();
+    BOOST_CHECK( is_empty(x) );
+
+    I<double> y(-2.0, -1.0);
+    y /= I<float>(-10.0f, -3.0f);
+    BOOST_CHECK_EQUAL( y, I<double>(std::stod("0X1.9999999999999P-4"),std::stod("0X1.5555555555556P-1")) );
+    I<float> z(1.0f, 2.0f);
+    z += I<double>(std::stod("0X1.999999999999AP-4"), std::stod("0X1.999999999999AP-4"));
+    BOOST_CHECK_EQUAL( z, I<float>(std::stof("0X1.199998P+0"),std::stof("0X1.0CCCCEP+1")) );
+
+
+    DI<double> dx(-MAX_D, 2.0, DEC::com);
+    dx += DI<double>(-0.1, 5.0, DEC::com);
+    BOOST_CHECK_EQUAL( dx, DI<double>(-INF_D, 7.0, DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( dx ), DEC::dac );
+    dx = DI<double>(-1.0, 2.0, DEC::com);
+    dx -= DI<double>(5.0, 7.0, DEC::def);
+    BOOST_CHECK_EQUAL( dx, DI<double>(-8.0, -3.0, DEC::def) );
+    BOOST_CHECK_EQUAL( decoration( dx ), DEC::def );
+    dx = DI<double>(-1.0, 2.0, DEC::com);
+    dx *= DI<double>(-3.0, 4.0, DEC::com);
+    BOOST_CHECK_EQUAL( dx, DI<double>(-6.0, 8.0, DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( dx ), DEC::com );
+    dx /= DI<double>(0.0, 3.0, DEC::com);
+    BOOST_CHECK_EQUAL( dx, DI<double>(-INF_D, INF_D, DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( dx ), DEC::trv );
+
+    DI<float> dz(-2.0f, -1.0f, DEC::com);
+    dz /= DI<double>(-10.0, -3.0, DEC::dac);
+    BOOST_CHECK_EQUAL( dz, DI<float>(std::stof("0X1.999998P-4"),std::stof("0X1.555556P-1"), DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( dz ), DEC::dac );
+}
+
+
 BOOST_AUTO_TEST_CASE(integration_recip_test)
 {
     BOOST_CHECK_EQUAL( recip(I<double>(-50.0, -10.0)), I<double>(std::stod("-0X1.999999999999AP-4"),std::stod("-0X1.47AE147AE147AP-6")) );
@@ -655,3 +701,313 @@ BOOST_AUTO_TEST_CASE(integration_max_test)
     BOOST_CHECK_EQUAL( DI<float>::max(DI<double>(-2.5,3.5), DI<double>(1.0,1.5,DEC::def)), DI<float>(1.0f, 3.5f, DEC::def) );
     BOOST_CHECK_EQUAL( decoration( DI<float>::max(DI<double>(-2.5,3.5), DI<double>(1.0,1.5,DEC::def)) ), DEC::def );
 }
+
+BOOST_AUTO_TEST_CASE(integration_exp_slope1_test)
+{
+    BOOST_CHECK_EQUAL( exp_slope1(I<double>(1.0,2.0)), I<double>(std::stod("0X1.6FC2A2C515DA5P+0"),std::stod("0X1.18E64B8D4DDAEP+1")) );
+    BOOST_CHECK_EQUAL( I<double>::exp_slope1(I<double>(1.0,2.0)), I<double>(std::stod("0X1.6FC2A2C515DA5P+0"),std::stod("0X1.18E64B8D4DDAEP+1")) );
+    BOOST_CHECK_EQUAL( I<float>::exp_slope1(I<double>(1.0,2.0)), I<float>(std::stof("0X1.6FC2A2P+0"),std::stof("0X1.18E64CP+1")) );
+
+    BOOST_CHECK_EQUAL( exp_slope1(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.6FC2A2C515DA5P+0"),std::stod("0X1.18E64B8D4DDAEP+1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( exp_slope1(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::exp_slope1(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,INF_F,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::exp_slope1(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_exp_slope2_test)
+{
+    BOOST_CHECK_EQUAL( exp_slope2(I<double>(1.0,2.0)), I<double>(std::stod("0X1.4F47E84F418EFP+0"),std::stod("0X1.CAB2E2A7E990AP+0")) );
+    BOOST_CHECK_EQUAL( I<double>::exp_slope2(I<double>(1.0,2.0)), I<double>(std::stod("0X1.4F47E84F418EFP+0"),std::stod("0X1.CAB2E2A7E990AP+0")) );
+    BOOST_CHECK_EQUAL( I<float>::exp_slope2(I<double>(1.0,2.0)), I<float>(std::stof("0X1.4F47E8P+0"),std::stof("0X1.CAB2E4P+0")) );
+
+    BOOST_CHECK_EQUAL( exp_slope2(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.4F47E84F418EFP+0"),std::stod("0X1.CAB2E2A7E990AP+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( exp_slope2(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::exp_slope2(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,INF_F,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::exp_slope2(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_log_slope1_test)
+{
+    BOOST_CHECK_EQUAL( log_slope1(I<double>(-0.5,1.0)), I<double>(std::stod("0X1.3A37A020B8C21P-1"),std::stod("0X1.8B90BFBE8E7BDP+0")) );
+    BOOST_CHECK_EQUAL( I<double>::log_slope1(I<double>(-0.5,1.0)), I<double>(std::stod("0X1.3A37A020B8C21P-1"),std::stod("0X1.8B90BFBE8E7BDP+0")) );
+    BOOST_CHECK_EQUAL( I<float>::log_slope1(I<double>(-0.5,1.0)), I<float>(std::stof("0X1.3A37AP-1"),std::stof("0X1.8B90CP+0")) );
+
+    BOOST_CHECK_EQUAL( log_slope1(DI<double>(-0.5,1.0,DEC::com)), DI<double>(std::stod("0X1.3A37A020B8C21P-1"),std::stod("0X1.8B90BFBE8E7BDP+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( log_slope1(DI<double>(-0.5,1.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::log_slope1(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,INF_F,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::log_slope1(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_log_slope2_test)
+{
+    BOOST_CHECK_EQUAL( log_slope2(I<double>(-0.5,1.0)), I<double>(std::stod("0X1.28AC8FCEEADCDP-1"),std::stod("0X1.A2B23F3BAB737P+0")) );
+    BOOST_CHECK_EQUAL( I<double>::log_slope2(I<double>(-0.5,1.0)), I<double>(std::stod("0X1.28AC8FCEEADCDP-1"),std::stod("0X1.A2B23F3BAB737P+0")) );
+    BOOST_CHECK_EQUAL( I<float>::log_slope2(I<double>(-0.5,1.0)), I<float>(std::stof("0X1.28AC8EP-1"),std::stof("0X1.A2B24P+0")) );
+
+    BOOST_CHECK_EQUAL( log_slope2(DI<double>(-0.5,1.0,DEC::com)), DI<double>(std::stod("0X1.28AC8FCEEADCDP-1"),std::stod("0X1.A2B23F3BAB737P+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( log_slope2(DI<double>(-0.5,1.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::log_slope2(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,INF_F,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::log_slope2(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_cos_slope2_test)
+{
+    BOOST_CHECK_EQUAL( cos_slope2(I<double>(1.0,2.0)), I<double>(std::stod("0X1.6A88995D4DC81P-1"),std::stod("0X1.D6BAFE095F2E9P-1")) );
+    BOOST_CHECK_EQUAL( I<double>::cos_slope2(I<double>(1.0,2.0)), I<double>(std::stod("0X1.6A88995D4DC81P-1"),std::stod("0X1.D6BAFE095F2E9P-1")) );
+    BOOST_CHECK_EQUAL( I<float>::cos_slope2(I<double>(1.0,2.0)), I<float>(std::stof("0X1.6A8898P-1"),std::stof("0X1.D6BBP-1")) );
+
+    BOOST_CHECK_EQUAL( cos_slope2(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.6A88995D4DC81P-1"),std::stod("0X1.D6BAFE095F2E9P-1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( cos_slope2(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::cos_slope2(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,1.0f,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::cos_slope2(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_sin_slope3_test)
+{
+    BOOST_CHECK_EQUAL( sin_slope3(I<double>(1.0,2.0)), I<double>(std::stod("0X1.A2D46CFE2B8CBP-1"),std::stod("0X1.E7004A5C9B26CP-1")) );
+    BOOST_CHECK_EQUAL( I<double>::sin_slope3(I<double>(1.0,2.0)), I<double>(std::stod("0X1.A2D46CFE2B8CBP-1"),std::stod("0X1.E7004A5C9B26CP-1")) );
+    BOOST_CHECK_EQUAL( I<float>::sin_slope3(I<double>(1.0,2.0)), I<float>(std::stof("0X1.A2D46CP-1"),std::stof("0X1.E7004CP-1")) );
+
+    BOOST_CHECK_EQUAL( sin_slope3(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.A2D46CFE2B8CBP-1"),std::stod("0X1.E7004A5C9B26CP-1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( sin_slope3(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::sin_slope3(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,1.0f,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::sin_slope3(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_asin_slope3_test)
+{
+    BOOST_CHECK_EQUAL( asin_slope3(I<double>(0.0,0.5)), I<double>(1.0,std::stod("0X1.21FB54442D185P+0")) );
+    BOOST_CHECK_EQUAL( I<double>::asin_slope3(I<double>(0.0,0.5)), I<double>(1.0,std::stod("0X1.21FB54442D185P+0")) );
+    BOOST_CHECK_EQUAL( I<float>::asin_slope3(I<double>(0.0,0.5)), I<float>(1.0f,std::stof("0X1.21FB56P+0")) );
+
+    BOOST_CHECK_EQUAL( asin_slope3(DI<double>(0.0,0.5,DEC::com)), DI<double>(1.0,std::stod("0X1.21FB54442D185P+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( asin_slope3(DI<double>(0.0,0.5,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::asin_slope3(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(1.0f,std::stof("0X1.B65F2P+1"),DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::asin_slope3(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_atan_slope3_test)
+{
+    BOOST_CHECK_EQUAL( atan_slope3(I<double>(1.0,2.0)), I<double>(std::stod("0X1.56DADA39E6299P-2"),std::stod("0X1.49A0E033378B8P-1")) );
+    BOOST_CHECK_EQUAL( I<double>::atan_slope3(I<double>(1.0,2.0)), I<double>(std::stod("0X1.56DADA39E6299P-2"),std::stod("0X1.49A0E033378B8P-1")) );
+    BOOST_CHECK_EQUAL( I<float>::atan_slope3(I<double>(1.0,2.0)), I<float>(std::stof("0X1.56DADAP-2"),std::stof("0X1.49A0E2P-1")) );
+
+    BOOST_CHECK_EQUAL( atan_slope3(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.56DADA39E6299P-2"),std::stod("0X1.49A0E033378B8P-1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( atan_slope3(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::atan_slope3(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(0.0f,1.0f,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::atan_slope3(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_cosh_slope2_test)
+{
+    BOOST_CHECK_EQUAL( cosh_slope2(I<double>(1.0,2.0)), I<double>(std::stod("0X1.160EAA3B3EAAP+0"),std::stod("0X1.618FA0DF2D9BDP+0")) );
+    BOOST_CHECK_EQUAL( I<double>::cosh_slope2(I<double>(1.0,2.0)), I<double>(std::stod("0X1.160EAA3B3EAAP+0"),std::stod("0X1.618FA0DF2D9BDP+0")) );
+    BOOST_CHECK_EQUAL( I<float>::cosh_slope2(I<double>(1.0,2.0)), I<float>(std::stof("0X1.160EAAP+0"),std::stof("0X1.618FA2P+0")) );
+
+    BOOST_CHECK_EQUAL( cosh_slope2(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.160EAA3B3EAAP+0"),std::stod("0X1.618FA0DF2D9BDP+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( cosh_slope2(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::cosh_slope2(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(1.0f,INF_F,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::cosh_slope2(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_sinh_slope3_test)
+{
+    BOOST_CHECK_EQUAL( sinh_slope3(I<double>(1.0,2.0)), I<double>(std::stod("0X1.0D1BE99D8590EP+0"),std::stod("0X1.385B71592527P+0")) );
+    BOOST_CHECK_EQUAL( I<double>::sinh_slope3(I<double>(1.0,2.0)), I<double>(std::stod("0X1.0D1BE99D8590EP+0"),std::stod("0X1.385B71592527P+0")) );
+    BOOST_CHECK_EQUAL( I<float>::sinh_slope3(I<double>(1.0,2.0)), I<float>(std::stof("0X1.0D1BE8P+0"),std::stof("0X1.385B72P+0")) );
+
+    BOOST_CHECK_EQUAL( sinh_slope3(DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.0D1BE99D8590EP+0"),std::stod("0X1.385B71592527P+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( sinh_slope3(DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::sinh_slope3(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(1.0f,INF_F,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::sinh_slope3(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_rootn_test)
+{
+    BOOST_CHECK_EQUAL( rootn(I<double>(4.0,9.0), -2), I<double>(std::stod("0X1.5555555555555P-2"),0.5) );
+    BOOST_CHECK_EQUAL( I<double>::rootn(I<double>(4.0,9.0), -2), I<double>(std::stod("0X1.5555555555555P-2"),0.5) );
+    BOOST_CHECK_EQUAL( I<float>::rootn(I<double>(4.0,9.0), -2), I<float>(std::stof("0X1.555554P-2"),0.5f) );
+
+    BOOST_CHECK_EQUAL( rootn(DI<double>(-1.0,4.0,DEC::com), -2), DI<double>(0.5,INF_D,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( rootn(DI<double>(-1.0,4.0,DEC::com), -2) ), DEC::trv );
+    BOOST_CHECK_EQUAL( DI<float>::rootn(DI<double>(2.0,3.0,DEC::com), -2), DI<float>(std::stof("0X1.279A74P-1"),std::stof("0X1.6A09E8P-1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::rootn(DI<double>(2.0,3.0,DEC::com), -2) ), DEC::com );
+}
+
+BOOST_AUTO_TEST_CASE(integration_expm1_test)
+{
+    BOOST_CHECK_EQUAL( expm1(I<double>(-1.0,1.0)), I<double>(std::stod("-0X1.43A54E4E98865P-1"),std::stod("0X1.B7E151628AED3P+0")) );
+    BOOST_CHECK_EQUAL( I<double>::expm1(I<double>(-1.0,1.0)), I<double>(std::stod("-0X1.43A54E4E98865P-1"),std::stod("0X1.B7E151628AED3P+0")) );
+    BOOST_CHECK_EQUAL( I<float>::expm1(I<double>(-1.0,1.0)), I<float>(std::stof("-0X1.43A55P-1"),std::stof("0X1.B7E152P+0")) );
+
+    BOOST_CHECK_EQUAL( expm1(DI<double>(-1.0,1.0,DEC::com)), DI<double>(std::stod("-0X1.43A54E4E98865P-1"),std::stod("0X1.B7E151628AED3P+0"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( expm1(DI<double>(-1.0,1.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::expm1(DI<double>(709.0,710.0,DEC::com)), DI<float>(std::stof("0X1.FFFFFEP+127"),INF_F,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::expm1(DI<double>(709.0,710.0,DEC::com)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_log1p_test)
+{
+    BOOST_CHECK_EQUAL( log1p(I<double>(-0.5,1.0)), I<double>(std::stod("-0X1.62E42FEFA39FP-1"),std::stod("0X1.62E42FEFA39FP-1")) );
+    BOOST_CHECK_EQUAL( I<double>::log1p(I<double>(-0.5,1.0)), I<double>(std::stod("-0X1.62E42FEFA39FP-1"),std::stod("0X1.62E42FEFA39FP-1")) );
+    BOOST_CHECK_EQUAL( I<float>::log1p(I<double>(-0.5,1.0)), I<float>(std::stof("-0X1.62E43P-1"),std::stof("0X1.62E43P-1")) );
+
+    BOOST_CHECK_EQUAL( log1p(DI<double>(-0.5,1.0,DEC::com)), DI<double>(std::stod("-0X1.62E42FEFA39FP-1"),std::stod("0X1.62E42FEFA39FP-1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( log1p(DI<double>(-0.5,1.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::log1p(DI<double>(-1.0,1.0,DEC::com)), DI<float>(-INF_F,std::stof("0X1.62E43P-1"),DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::log1p(DI<double>(-1.0,1.0,DEC::com)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_compoundm1_test)
+{
+    BOOST_CHECK_EQUAL( compoundm1(I<double>(1.0,2.0), I<double>(2.0,3.0)), I<double>(3.0,26.0) );
+    BOOST_CHECK_EQUAL( I<double>::compoundm1(I<double>(1.0,2.0), I<double>(2.0,3.0)), I<double>(3.0,26.0) );
+    BOOST_CHECK_EQUAL( I<float>::compoundm1(I<double>(1.0,2.0), I<double>(2.0,3.0)), I<float>(3.0f,26.0f) );
+
+    BOOST_CHECK_EQUAL( compoundm1(DI<double>(1.0,2.0,DEC::com), DI<double>(2.0,3.0,DEC::com)), DI<double>(3.0,26.0,DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( compoundm1(DI<double>(1.0,2.0,DEC::com), DI<double>(2.0,3.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::compoundm1(DI<double>(-1.0,1.0,DEC::com), DI<double>(0.0,2.0,DEC::com)), DI<float>(-1.0f,3.0f,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::compoundm1(DI<double>(-1.0,1.0,DEC::com), DI<double>(0.0,2.0,DEC::com)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_hypot_test)
+{
+    BOOST_CHECK_EQUAL( hypot(I<double>(-3.0,2.0), I<double>(4.0,5.0)), I<double>(4.0,std::stod("0X1.752E50DB3A3A2P+2")) );
+    BOOST_CHECK_EQUAL( I<double>::hypot(I<double>(-3.0,2.0), I<double>(4.0,5.0)), I<double>(4.0,std::stod("0X1.752E50DB3A3A2P+2")) );
+    BOOST_CHECK_EQUAL( I<float>::hypot(I<double>(-3.0,2.0), I<double>(4.0,5.0)), I<float>(4.0f,std::stof("0X1.752E52P+2")) );
+
+    BOOST_CHECK_EQUAL( hypot(DI<double>(3.0,3.0,DEC::com), DI<double>(4.0,4.0,DEC::com)), DI<double>(5.0,5.0,DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( hypot(DI<double>(3.0,3.0,DEC::com), DI<double>(4.0,4.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::hypot(DI<double>(1.0,2.0,DEC::dac), DI<double>(1.0,2.0,DEC::com)), DI<float>(std::stof("0X1.6A09E6P+0"),std::stof("0X1.6A09E8P+1"),DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::hypot(DI<double>(1.0,2.0,DEC::dac), DI<double>(1.0,2.0,DEC::com)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_rsqrt_test)
+{
+    BOOST_CHECK_EQUAL( rsqrt(I<double>(2.0,3.0)), I<double>(std::stod("0X1.279A74590331CP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( I<double>::rsqrt(I<double>(2.0,3.0)), I<double>(std::stod("0X1.279A74590331CP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( I<float>::rsqrt(I<double>(2.0,3.0)), I<float>(std::stof("0X1.279A74P-1"),std::stof("0X1.6A09E8P-1")) );
+
+    BOOST_CHECK_EQUAL( rsqrt(DI<double>(4.0,16.0,DEC::com)), DI<double>(0.25,0.5,DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( rsqrt(DI<double>(4.0,16.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::rsqrt(DI<double>(0.0,4.0,DEC::com)), DI<float>(0.5f,INF_F,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::rsqrt(DI<double>(0.0,4.0,DEC::com)) ), DEC::trv );
+}
+
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,2,0)
+
+BOOST_AUTO_TEST_CASE(integration_sinpi_test)
+{
+    BOOST_CHECK_EQUAL( sinpi(I<double>(0.25,0.75)), I<double>(std::stod("0X1.6A09E667F3BCCP-1"),1.0) );
+    BOOST_CHECK_EQUAL( I<double>::sinpi(I<double>(0.25,0.75)), I<double>(std::stod("0X1.6A09E667F3BCCP-1"),1.0) );
+    BOOST_CHECK_EQUAL( I<float>::sinpi(I<double>(0.25,0.75)), I<float>(std::stof("0X1.6A09E6P-1"),1.0f) );
+
+    BOOST_CHECK_EQUAL( sinpi(DI<double>(0.25,0.75,DEC::com)), DI<double>(std::stod("0X1.6A09E667F3BCCP-1"),1.0,DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( sinpi(DI<double>(0.25,0.75,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::sinpi(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(-1.0f,1.0f,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::sinpi(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_cospi_test)
+{
+    BOOST_CHECK_EQUAL( cospi(I<double>(0.25,0.75)), I<double>(std::stod("-0X1.6A09E667F3BCDP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( I<double>::cospi(I<double>(0.25,0.75)), I<double>(std::stod("-0X1.6A09E667F3BCDP-1"),std::stod("0X1.6A09E667F3BCDP-1")) );
+    BOOST_CHECK_EQUAL( I<float>::cospi(I<double>(0.25,0.75)), I<float>(std::stof("-0X1.6A09E8P-1"),std::stof("0X1.6A09E8P-1")) );
+
+    BOOST_CHECK_EQUAL( cospi(DI<double>(0.25,0.75,DEC::com)), DI<double>(std::stod("-0X1.6A09E667F3BCDP-1"),std::stod("0X1.6A09E667F3BCDP-1"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( cospi(DI<double>(0.25,0.75,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::cospi(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(-1.0f,1.0f,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::cospi(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_tanpi_test)
+{
+    BOOST_CHECK_EQUAL( tanpi(I<double>(-0.25,0.25)), I<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( I<double>::tanpi(I<double>(-0.25,0.25)), I<double>(-1.0,1.0) );
+    BOOST_CHECK_EQUAL( I<float>::tanpi(I<double>(-0.25,0.25)), I<float>(-1.0f,1.0f) );
+
+    BOOST_CHECK_EQUAL( tanpi(DI<double>(-0.25,0.25,DEC::com)), DI<double>(-1.0,1.0,DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( tanpi(DI<double>(-0.25,0.25,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::tanpi(DI<double>(0.0,0.5,DEC::com)), DI<float>(-0.0f,INF_F,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::tanpi(DI<double>(0.0,0.5,DEC::com)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_asinpi_test)
+{
+    BOOST_CHECK_EQUAL( asinpi(I<double>(-1.0,0.5)), I<double>(-0.5,std::stod("0X1.5555555555556P-3")) );
+    BOOST_CHECK_EQUAL( I<double>::asinpi(I<double>(-1.0,0.5)), I<double>(-0.5,std::stod("0X1.5555555555556P-3")) );
+    BOOST_CHECK_EQUAL( I<float>::asinpi(I<double>(-1.0,0.5)), I<float>(-0.5f,std::stof("0X1.555556P-3")) );
+
+    BOOST_CHECK_EQUAL( asinpi(DI<double>(-1.0,0.5,DEC::com)), DI<double>(-0.5,std::stod("0X1.5555555555556P-3"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( asinpi(DI<double>(-1.0,0.5,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::asinpi(DI<double>(-2.0,0.5,DEC::com)), DI<float>(-0.5f,std::stof("0X1.555556P-3"),DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::asinpi(DI<double>(-2.0,0.5,DEC::com)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_acospi_test)
+{
+    BOOST_CHECK_EQUAL( acospi(I<double>(-1.0,0.5)), I<double>(std::stod("0X1.5555555555555P-2"),1.0) );
+    BOOST_CHECK_EQUAL( I<double>::acospi(I<double>(-1.0,0.5)), I<double>(std::stod("0X1.5555555555555P-2"),1.0) );
+    BOOST_CHECK_EQUAL( I<float>::acospi(I<double>(-1.0,0.5)), I<float>(std::stof("0X1.555554P-2"),1.0f) );
+
+    BOOST_CHECK_EQUAL( acospi(DI<double>(-1.0,0.5,DEC::com)), DI<double>(std::stod("0X1.5555555555555P-2"),1.0,DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( acospi(DI<double>(-1.0,0.5,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::acospi(DI<double>(-2.0,0.5,DEC::com)), DI<float>(std::stof("0X1.555554P-2"),1.0f,DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::acospi(DI<double>(-2.0,0.5,DEC::com)) ), DEC::trv );
+}
+
+BOOST_AUTO_TEST_CASE(integration_atanpi_test)
+{
+    BOOST_CHECK_EQUAL( atanpi(I<double>(0.5,2.0)), I<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")) );
+    BOOST_CHECK_EQUAL( I<double>::atanpi(I<double>(0.5,2.0)), I<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")) );
+    BOOST_CHECK_EQUAL( I<float>::atanpi(I<double>(0.5,2.0)), I<float>(std::stof("0X1.2E405P-3"),std::stof("0X1.68DFD8P-2")) );
+
+    BOOST_CHECK_EQUAL( atanpi(DI<double>(0.5,2.0,DEC::com)), DI<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( atanpi(DI<double>(0.5,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::atanpi(DI<double>(-INF_D,INF_D,DEC::dac)), DI<float>(-0.5f,0.5f,DEC::dac) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::atanpi(DI<double>(-INF_D,INF_D,DEC::dac)) ), DEC::dac );
+}
+
+BOOST_AUTO_TEST_CASE(integration_atan2pi_test)
+{
+    BOOST_CHECK_EQUAL( atan2pi(I<double>(1.0,2.0), I<double>(1.0,2.0)), I<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")) );
+    BOOST_CHECK_EQUAL( I<double>::atan2pi(I<double>(1.0,2.0), I<double>(1.0,2.0)), I<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2")) );
+    BOOST_CHECK_EQUAL( I<float>::atan2pi(I<double>(1.0,2.0), I<double>(1.0,2.0)), I<float>(std::stof("0X1.2E405P-3"),std::stof("0X1.68DFD8P-2")) );
+
+    BOOST_CHECK_EQUAL( atan2pi(DI<double>(1.0,2.0,DEC::com), DI<double>(1.0,2.0,DEC::com)), DI<double>(std::stod("0X1.2E4051D9DF308P-3"),std::stod("0X1.68DFD7131067CP-2"),DEC::com) );
+    BOOST_CHECK_EQUAL( decoration( atan2pi(DI<double>(1.0,2.0,DEC::com), DI<double>(1.0,2.0,DEC::com)) ), DEC::com );
+    BOOST_CHECK_EQUAL( DI<float>::atan2pi(DI<double>(-1.0,1.0,DEC::com), DI<double>(-2.0,-1.0,DEC::dac)), DI<float>(-1.0f,1.0f,DEC::def) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::atan2pi(DI<double>(-1.0,1.0,DEC::com), DI<double>(-2.0,-1.0,DEC::dac)) ), DEC::def );
+}
+
+#endif
+
+BOOST_AUTO_TEST_CASE(integration_unchecked_test)
+{
+    const auto UNCHECKED = p1788::infsup::unchecked;
+
+    BOOST_CHECK_EQUAL( add(I<double>(1.0, 2.0), I<double>(0.5, 4.0), UNCHECKED), I<double>(1.5, 6.0) );
+    BOOST_CHECK_EQUAL( I<double>::sub(I<double>(1.0, 2.0), I<double>(0.5, 4.0), UNCHECKED), I<double>(-3.0, 1.5) );
+    BOOST_CHECK_EQUAL( mul(I<double>(-1.0, 2.0), I<double>(3.0, 4.0), UNCHECKED), I<double>(-4.0, 8.0) );
+    BOOST_CHECK_EQUAL( div(I<double>(1.0, 2.0), I<double>(-1.0, 4.0), UNCHECKED), I<double>::entire() );
+    BOOST_CHECK_EQUAL( neg(I<double>(1.0, 2.0), UNCHECKED), I<double>(-2.0, -1.0) );
+    BOOST_CHECK_EQUAL( recip(I<double>(2.0, 4.0), UNCHECKED), I<double>(0.25, 0.5) );
+    BOOST_CHECK_EQUAL( sqr(I<double>(-3.0, 2.0), UNCHECKED), I<double>(0.0, 9.0) );
+    BOOST_CHECK_EQUAL( sqrt(I<double>(-4.0, 9.0), UNCHECKED), I<double>(0.0, 3.0) );
+    BOOST_CHECK_EQUAL( fma(I<double>(1.0, 2.0), I<double>(3.0, 4.0), I<double>(-1.0, 1.0), UNCHECKED), I<double>(2.0, 9.0) );
+    BOOST_CHECK( is_empty(add(I<double>::empty(), I<double>(1.0, 2.0), UNCHECKED)) );
+
+    BOOST_CHECK_EQUAL( add(DI<double>(1.0, 2.0), DI<double>(0.5, 4.0), UNCHECKED), DI<double>(1.5, 6.0) );
+    BOOST_CHECK_EQUAL( decoration( add(DI<double>(1.0, 2.0), DI<double>(0.5, 4.0, DEC::def), UNCHECKED) ), DEC::def );
+    BOOST_CHECK_EQUAL( decoration( DI<double>::div(DI<double>(1.0, 2.0), DI<double>(0.0, 4.0), UNCHECKED) ), DEC::trv );
+    BOOST_CHECK_EQUAL( decoration( mul(DI<double>(1.0, 2.0), DI<double>(3.0, INF_D), UNCHECKED) ), DEC::dac );
+    BOOST_CHECK_EQUAL( decoration( sqrt(DI<double>(-4.0, 9.0), UNCHECKED) ), DEC::trv );
+    BOOST_CHECK( is_nai(sub(DI<double>::nai(), DI<double>(1.0, 2.0), UNCHECKED)) );
+
+    // the same values as the checked operations
+    DI<double> x(-0.3, 1.7);
+    DI<double> y(0.1, 2.9, DEC::def);
+    BOOST_CHECK_EQUAL( mul(fma(x, y, x, UNCHECKED), recip(y, UNCHECKED), UNCHECKED), fma(x, y, x) * recip(y) );
+    BOOST_CHECK_EQUAL( decoration( mul(fma(x, y, x, UNCHECKED), recip(y, UNCHECKED), UNCHECKED) ),
+                       decoration( fma(x, y, x) * recip(y) ) );
+}
@@ -28,6 +28,7 @@
 
 
 #include <limits>
+#include <vector>
 
 #include "p1788/p1788.hpp"
 
@@ -55,3 +56,35 @@ BOOST_AUTO_TEST_CASE(integration_overlap_test)
     BOOST_CHECK_EQUAL( DI<float>::overlap(DI<float>(1.0f,2.0f,DEC::com), DI<double>(2.5,2.5,DEC::def)), OS::before );
 }
 
+
+BOOST_AUTO_TEST_CASE(integration_overlap_batch_test)
+{
+    // more pairs than one block of the front end
+    std::vector<I<double>> x;
+    std::vector<I<double>> y;
+    std::vector<DI<double>> xd;
+    std::vector<DI<double>> yd;
+
+    for (int i = 0; i < 600; ++i)
+    {
+        x.push_back(I<double>(i % 7 * 1.0, i % 7 + i % 3 * 1.0));
+        y.push_back(i % 11 == 0 ? I<double>::empty() : I<double>(i % 5 * 1.0, i % 5 + 2.0));
+        xd.push_back(DI<double>(x.back()));
+        yd.push_back(i % 13 == 0 ? DI<double>::nai() : DI<double>(y.back()));
+    }
+
+    std::vector<OS> out(x.size());
+    std::vector<OS> out_dec(x.size());
+
+    overlap(x.data(), y.data(), out.data(), x.size());
+    DI<double>::overlap(xd.data(), yd.data(), out_dec.data(), xd.size());
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL( out[i], overlap(x[i], y[i]) );
+        BOOST_CHECK_EQUAL( out_dec[i], overlap(xd[i], yd[i]) );
+    }
+
+    BOOST_CHECK_EQUAL( out[0], OS::second_empty );
+    BOOST_CHECK_EQUAL( out_dec[13], OS::undefined );
+}
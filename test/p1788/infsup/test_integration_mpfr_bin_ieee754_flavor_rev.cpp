@@ -246,3 +246,83 @@ BOOST_AUTO_TEST_CASE(integration_mul_rev_test)
     BOOST_CHECK_EQUAL( DI<float>::mul_rev(DI<double>(-2.0, -0.1,DEC::def), DI<double>(-2.1, -0.4,DEC::def), DI<double>(0.1,15.0,DEC::def)), DI<float>(std::stof("0X1.999998P-3"), 15.0f,DEC::trv) );
     BOOST_CHECK_EQUAL( decoration( DI<float>::mul_rev(DI<double>(-2.0, -0.1,DEC::def), DI<double>(-2.1, -0.4,DEC::def), DI<double>(0.1,15.0,DEC::def)) ), DEC::trv );
 }
+
+
+BOOST_AUTO_TEST_CASE(integration_pow_rev1_test)
+{
+    BOOST_CHECK_EQUAL( pow_rev1(I<double>(2.0, 2.0), I<double>(4.0, 9.0)), I<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"), std::stod("0X1.8000000000001P+1")) );
+    BOOST_CHECK_EQUAL( I<double>::pow_rev1(I<double>(0.0, 0.0), I<double>(1.0, 1.0)), I<double>(0.0, INF_D) );
+    BOOST_CHECK_EQUAL( I<float>::pow_rev1(I<double>(2.0, 2.0), I<double>(4.0, 9.0)), I<float>(std::stof("0X1.FFFFFEP+0"), std::stof("0X1.800002P+1")) );
+
+    BOOST_CHECK_EQUAL( pow_rev1(I<double>(2.0, 2.0), I<double>(4.0, 9.0), I<double>(0.0, 2.0)), I<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"), 2.0) );
+    BOOST_CHECK_EQUAL( I<double>::pow_rev1(I<double>(1.0, 2.0), I<double>(0.0, 0.0), I<double>(-1.0, 1.0)), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( I<float>::pow_rev1(I<double>(-1.0, 1.0), I<double>(2.0, 4.0), I<float>(0.0f, 1.0f)), I<float>(0.0f, std::stof("0X1.000002P-1")) );
+
+    BOOST_CHECK_EQUAL( pow_rev1(DI<double>(2.0, 2.0, DEC::com), DI<double>(4.0, 9.0, DEC::com)), DI<double>(std::stod("0X1.FFFFFFFFFFFFFP+0"), std::stod("0X1.8000000000001P+1"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( pow_rev1(DI<double>(2.0, 2.0, DEC::com), DI<double>(4.0, 9.0, DEC::com)) ), DEC::trv );
+    BOOST_CHECK_EQUAL( DI<float>::pow_rev1(DI<double>(-1.0, -1.0, DEC::def), DI<double>(0.25, 0.5, DEC::dac)), DI<float>(std::stof("0X1.FFFFFEP+0"), std::stof("0X1.000002P+2"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::pow_rev1(DI<double>(-1.0, -1.0, DEC::def), DI<double>(0.25, 0.5, DEC::dac)) ), DEC::trv );
+
+    BOOST_CHECK_EQUAL( pow_rev1(DI<double>(-1.0, 1.0, DEC::dac), DI<double>(2.0, 4.0, DEC::com), DI<double>(0.0, 1.0, DEC::def)), DI<double>(0.0, std::stod("0X1.0000000000001P-1"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( pow_rev1(DI<double>(-1.0, 1.0, DEC::dac), DI<double>(2.0, 4.0, DEC::com), DI<double>(0.0, 1.0, DEC::def)) ), DEC::trv );
+}
+
+
+BOOST_AUTO_TEST_CASE(integration_pow_rev2_test)
+{
+    BOOST_CHECK_EQUAL( pow_rev2(I<double>(2.0, 2.0), I<double>(4.0, 8.0)), I<double>(std::stod("0X1.FFFFFFFFFFFFEP+0"), std::stod("0X1.8000000000002P+1")) );
+    BOOST_CHECK_EQUAL( I<double>::pow_rev2(I<double>(1.0, 1.0), I<double>(1.0, 1.0)), I<double>(-INF_D, INF_D) );
+    BOOST_CHECK_EQUAL( I<float>::pow_rev2(I<double>(0.5, 0.5), I<double>(4.0, 8.0)), I<float>(std::stof("-0X1.800002P+1"), std::stof("-0X1.FFFFFEP+0")) );
+
+    BOOST_CHECK_EQUAL( pow_rev2(I<double>(0.5, 2.0), I<double>(2.0, 2.0), I<double>(0.0, 5.0)), I<double>(std::stod("0X1.FFFFFFFFFFFFEP-1"), 5.0) );
+    BOOST_CHECK( is_empty( I<double>::pow_rev2(I<double>(2.0, 2.0), I<double>(4.0, 8.0), I<double>(4.0, 5.0)) ) );
+    BOOST_CHECK_EQUAL( I<float>::pow_rev2(I<double>(0.5, 2.0), I<double>(2.0, 2.0), I<float>(0.0f, 5.0f)), I<float>(std::stof("0X1.FFFFFEP-1"), 5.0f) );
+
+    BOOST_CHECK_EQUAL( pow_rev2(DI<double>(2.0, 2.0, DEC::com), DI<double>(4.0, 8.0, DEC::com)), DI<double>(std::stod("0X1.FFFFFFFFFFFFEP+0"), std::stod("0X1.8000000000002P+1"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( pow_rev2(DI<double>(2.0, 2.0, DEC::com), DI<double>(4.0, 8.0, DEC::com)) ), DEC::trv );
+    BOOST_CHECK_EQUAL( DI<float>::pow_rev2(DI<double>(0.5, 0.5, DEC::def), DI<double>(4.0, 8.0, DEC::dac)), DI<float>(std::stof("-0X1.800002P+1"), std::stof("-0X1.FFFFFEP+0"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::pow_rev2(DI<double>(0.5, 0.5, DEC::def), DI<double>(4.0, 8.0, DEC::dac)) ), DEC::trv );
+
+    BOOST_CHECK_EQUAL( pow_rev2(DI<double>(0.5, 2.0, DEC::dac), DI<double>(2.0, 2.0, DEC::com), DI<double>(0.0, 5.0, DEC::def)), DI<double>(std::stod("0X1.FFFFFFFFFFFFEP-1"), 5.0, DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( pow_rev2(DI<double>(0.5, 2.0, DEC::dac), DI<double>(2.0, 2.0, DEC::com), DI<double>(0.0, 5.0, DEC::def)) ), DEC::trv );
+}
+
+
+BOOST_AUTO_TEST_CASE(integration_atan2_rev1_test)
+{
+    BOOST_CHECK_EQUAL( atan2_rev1(I<double>(1.0, 2.0), I<double>(0.5, 0.5)), I<double>(std::stod("0X1.17B4F5BF3474AP-1"), std::stod("0X1.17B4F5BF3474BP+0")) );
+    BOOST_CHECK_EQUAL( I<double>::atan2_rev1(I<double>(0.0, 0.0), I<double>(1.0, 2.0)), I<double>(0.0, INF_D) );
+    BOOST_CHECK_EQUAL( I<float>::atan2_rev1(I<double>(-1.0, -1.0), I<double>(3.0, 4.0)), I<float>(0.0f, std::stof("0X1.23EF72P-3")) );
+
+    BOOST_CHECK_EQUAL( atan2_rev1(I<double>(-1.0, 1.0), I<double>(0.0, 2.0), I<double>(-1.0, 1.0)), I<double>(0.0, 1.0) );
+    BOOST_CHECK( is_empty( I<double>::atan2_rev1(I<double>(1.0, 1.0), I<double>(0.5, 0.5), I<double>(0.0, 0.5)) ) );
+    BOOST_CHECK_EQUAL( I<float>::atan2_rev1(I<double>(1.0, 1.0), I<double>(0.0, 1.0), I<float>(0.0f, 1.0f)), I<float>(0.0f, 1.0f) );
+
+    BOOST_CHECK_EQUAL( atan2_rev1(DI<double>(1.0, 2.0, DEC::com), DI<double>(0.5, 0.5, DEC::com)), DI<double>(std::stod("0X1.17B4F5BF3474AP-1"), std::stod("0X1.17B4F5BF3474BP+0"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( atan2_rev1(DI<double>(1.0, 2.0, DEC::com), DI<double>(0.5, 0.5, DEC::com)) ), DEC::trv );
+    BOOST_CHECK_EQUAL( DI<float>::atan2_rev1(DI<double>(1.0, 2.0, DEC::com), DI<double>(0.5, 0.5, DEC::dac)), DI<float>(std::stof("0X1.17B4F4P-1"), std::stof("0X1.17B4F6P+0"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::atan2_rev1(DI<double>(1.0, 2.0, DEC::com), DI<double>(0.5, 0.5, DEC::dac)) ), DEC::trv );
+
+    BOOST_CHECK_EQUAL( atan2_rev1(DI<double>(0.0, 0.0, DEC::def), DI<double>(-2.0, 2.0, DEC::dac), DI<double>(-1.0, 1.0, DEC::com)), DI<double>(-1.0, 1.0, DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( atan2_rev1(DI<double>(0.0, 0.0, DEC::def), DI<double>(-2.0, 2.0, DEC::dac), DI<double>(-1.0, 1.0, DEC::com)) ), DEC::trv );
+}
+
+
+BOOST_AUTO_TEST_CASE(integration_atan2_rev2_test)
+{
+    BOOST_CHECK_EQUAL( atan2_rev2(I<double>(1.0, 2.0), I<double>(0.5, 0.5)), I<double>(std::stod("0X1.D49AD7E47C0A1P+0"), std::stod("0X1.D49AD7E47C0A4P+1")) );
+    BOOST_CHECK_EQUAL( I<double>::atan2_rev2(I<double>(0.0, 0.0), I<double>(3.0, 4.0)), I<double>(-INF_D, 0.0) );
+    BOOST_CHECK_EQUAL( I<float>::atan2_rev2(I<double>(1.0, 1.0), I<double>(1.0, 2.0)), I<float>(std::stof("-0X1.D4A43P-2"), std::stof("0X1.48C05EP-1")) );
+
+    BOOST_CHECK_EQUAL( atan2_rev2(I<double>(-1.0, 1.0), I<double>(1.0, 2.0), I<double>(-1.0, 1.0)), I<double>(std::stod("-0X1.D4A42E92FAA4FP-2"), std::stod("0X1.48C05D04E1CFFP-1")) );
+    BOOST_CHECK_EQUAL( I<double>::atan2_rev2(I<double>(1.0, 1.0), I<double>(1.0, 2.0), I<double>(0.0, 0.0)), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( I<float>::atan2_rev2(I<double>(-1.0, -1.0), I<double>(-2.0, -1.5), I<float>(-1.0f, 0.0f)), I<float>(std::stof("-0X1.D4A43P-2"), 0.0f) );
+
+    BOOST_CHECK_EQUAL( atan2_rev2(DI<double>(1.0, 2.0, DEC::com), DI<double>(0.5, 0.5, DEC::com)), DI<double>(std::stod("0X1.D49AD7E47C0A1P+0"), std::stod("0X1.D49AD7E47C0A4P+1"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( atan2_rev2(DI<double>(1.0, 2.0, DEC::com), DI<double>(0.5, 0.5, DEC::com)) ), DEC::trv );
+    BOOST_CHECK_EQUAL( DI<float>::atan2_rev2(DI<double>(1.0, 1.0, DEC::def), DI<double>(1.0, 2.0, DEC::trv)), DI<float>(std::stof("-0X1.D4A43P-2"), std::stof("0X1.48C05EP-1"), DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( DI<float>::atan2_rev2(DI<double>(1.0, 1.0, DEC::def), DI<double>(1.0, 2.0, DEC::trv)) ), DEC::trv );
+
+    BOOST_CHECK_EQUAL( atan2_rev2(DI<double>(1.0, 1.0, DEC::dac), DI<double>(1.0, 2.0, DEC::com), DI<double>(0.0, 0.0, DEC::def)), DI<double>(0.0, 0.0, DEC::trv) );
+    BOOST_CHECK_EQUAL( decoration( atan2_rev2(DI<double>(1.0, 1.0, DEC::dac), DI<double>(1.0, 2.0, DEC::com), DI<double>(0.0, 0.0, DEC::def)) ), DEC::trv );
+}
@@ -28,6 +28,9 @@
 
 
 #include <limits>
+#include <list>
+#include <iterator>
+#include <vector>
 
 #include "p1788/p1788.hpp"
 
@@ -59,3 +62,88 @@ BOOST_AUTO_TEST_CASE(integration_convex_hull_test)
     BOOST_CHECK_EQUAL( DI<double>::convex_hull(DI<double>(1.0,3.0), DI<double>(3.0,4.0)), DI<double>(1.0,4.0,DEC::trv) );
     BOOST_CHECK_EQUAL( DI<double>::convex_hull(DI<float>(1.0f,3.0f), DI<long double>::empty()), DI<double>(1.0,3.0,DEC::trv)  );
 }
+
+BOOST_AUTO_TEST_CASE(integration_range_intersection_test)
+{
+    std::vector<I<double>> x = { I<double>(1.0,3.0), I<double>(2.1,4.0), I<double>::entire() };
+    std::list<DI<double>> xd = { DI<double>(1.0,3.0), DI<double>(2.1,4.0), DI<double>::entire() };
+
+    BOOST_CHECK_EQUAL( intersection(x.begin(), x.end()), I<double>(2.1,3.0) );
+    BOOST_CHECK_EQUAL( I<double>::intersection(x.begin(), x.begin()), I<double>::entire() );
+    BOOST_CHECK_EQUAL( intersection(xd.begin(), xd.end()), DI<double>(2.1,3.0,DEC::trv) );
+    xd.push_back(DI<double>::nai());
+    BOOST_CHECK( is_nai( DI<double>::intersection(xd.begin(), xd.end()) ) );
+
+    // large ranges are split among the threads
+    unsigned old = p1788::util::set_num_threads(4);
+
+    std::vector<I<double>> y;
+    std::vector<I<double>> z;
+    for (int i = 0; i < 300000; ++i)
+    {
+        y.push_back(I<double>(-1.0e6 + i * 1.0, 1.0e6 - i * 2.0));
+        z.push_back(i == 250000 ? I<double>::empty() : y.back());
+    }
+    BOOST_CHECK_EQUAL( intersection(y.begin(), y.end()), I<double>(-700001.0,400002.0) );
+    BOOST_CHECK( is_empty( intersection(z.data(), z.data() + z.size()) ) );
+
+    p1788::util::set_num_threads(old);
+}
+
+BOOST_AUTO_TEST_CASE(integration_range_convex_hull_test)
+{
+    std::vector<I<double>> x = { I<double>(1.0,3.0), I<double>::empty(), I<double>(-2.1,-1.0) };
+    std::list<DI<double>> xd = { DI<double>(1.0,3.0), DI<double>::empty(), DI<double>(-2.1,-1.0) };
+
+    BOOST_CHECK_EQUAL( convex_hull(x.begin(), x.end()), I<double>(-2.1,3.0) );
+    BOOST_CHECK_EQUAL( I<double>::convex_hull(x.begin(), x.begin()), I<double>::empty() );
+    BOOST_CHECK_EQUAL( convex_hull(xd.begin(), xd.end()), DI<double>(-2.1,3.0,DEC::trv) );
+    xd.push_front(DI<double>::nai());
+    BOOST_CHECK( is_nai( DI<double>::convex_hull(xd.begin(), xd.end()) ) );
+
+    unsigned old = p1788::util::set_num_threads(4);
+
+    std::vector<DI<double>> y;
+    std::vector<DI<double>> z;
+    for (int i = 0; i < 300000; ++i)
+    {
+        y.push_back(i % 5 ? DI<double>(-i * 0.5, i * 1.0) : DI<double>::empty());
+        z.push_back(i == 100000 ? DI<double>::nai() : y.back());
+    }
+    BOOST_CHECK_EQUAL( convex_hull(y.begin(), y.end()), DI<double>(-149999.5,299999.0,DEC::trv) );
+    BOOST_CHECK( is_nai( DI<double>::convex_hull(z.begin(), z.end()) ) );
+
+    p1788::util::set_num_threads(old);
+}
+
+BOOST_AUTO_TEST_CASE(integration_bisect_test)
+{
+    std::pair<I<double>, I<double>> p = bisect(I<double>(1.0,3.0));
+    BOOST_CHECK_EQUAL( p.first, I<double>(1.0,2.0) );
+    BOOST_CHECK_EQUAL( p.second, I<double>(2.0,3.0) );
+
+    std::pair<I<double>, I<double>> q = I<double>::bisect(I<double>(1.0,3.0), 0.25);
+    BOOST_CHECK_EQUAL( q.first, I<double>(1.0,1.5) );
+    BOOST_CHECK_EQUAL( q.second, I<double>(1.5,3.0) );
+
+    std::pair<I<double>, I<double>> r = bisect(I<double>::entire());
+    BOOST_CHECK_EQUAL( sup(r.first), 0.0 );
+    BOOST_CHECK_EQUAL( inf(r.second), 0.0 );
+    BOOST_CHECK( is_entire( convex_hull(r.first, r.second) ) );
+
+    std::pair<DI<double>, DI<double>> pd = bisect(DI<double>(1.0,3.0,DEC::com), 0.5);
+    BOOST_CHECK_EQUAL( pd.first, DI<double>(1.0,2.0,DEC::com) );
+    BOOST_CHECK_EQUAL( pd.second, DI<double>(2.0,3.0,DEC::com) );
+    BOOST_CHECK( is_nai( bisect(DI<double>::nai()).second ) );
+
+    std::vector<I<double>> v;
+    multisect(I<double>(0.0,4.0), 4, std::back_inserter(v));
+    BOOST_CHECK_EQUAL( v.size(), 4u );
+    BOOST_CHECK_EQUAL( v[0], I<double>(0.0,1.0) );
+    BOOST_CHECK_EQUAL( v[3], I<double>(3.0,4.0) );
+
+    std::vector<DI<double>> vd;
+    DI<double>::multisect(DI<double>(0.0,3.0,DEC::def), 3, std::back_inserter(vd));
+    BOOST_CHECK_EQUAL( vd.size(), 3u );
+    BOOST_CHECK_EQUAL( vd[1], DI<double>(1.0,2.0,DEC::def) );
+}
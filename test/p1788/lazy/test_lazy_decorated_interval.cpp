@@ -0,0 +1,202 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Lazily decorated intervals [p1788/lazy/lazy_decorated_interval]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/lazy/lazy_decorated_interval.hpp"
+
+
+#include <limits>
+#include <vector>
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using DI = p1788::infsup::decorated_interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using LI = p1788::lazy::lazy_decorated_interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+typedef p1788::decoration::decoration DEC;
+
+
+// operations applied to the eager and the lazy type
+struct op_neg { template<typename X> X operator()(X const& x) const { return neg(x); } };
+struct op_sqr { template<typename X> X operator()(X const& x) const { return sqr(x); } };
+struct op_abs { template<typename X> X operator()(X const& x) const { return abs(x); } };
+struct op_sqrt { template<typename X> X operator()(X const& x) const { return sqrt(x); } };
+struct op_log { template<typename X> X operator()(X const& x) const { return log(x); } };
+struct op_recip { template<typename X> X operator()(X const& x) const { return recip(x); } };
+struct op_exp { template<typename X> X operator()(X const& x) const { return exp(x); } };
+struct op_sin { template<typename X> X operator()(X const& x) const { return sin(x); } };
+struct op_cos { template<typename X> X operator()(X const& x) const { return cos(x); } };
+
+struct op_add { template<typename X> X operator()(X const& x, X const& y) const { return x + y; } };
+struct op_sub { template<typename X> X operator()(X const& x, X const& y) const { return x - y; } };
+struct op_mul { template<typename X> X operator()(X const& x, X const& y) const { return x * y; } };
+struct op_div { template<typename X> X operator()(X const& x, X const& y) const { return x / y; } };
+
+
+std::vector<DI<double>> inputs()
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    const double max = std::numeric_limits<double>::max();
+
+    return std::vector<DI<double>>
+    {
+        DI<double>(1.0, 2.0),
+        DI<double>(-3.0, -0.5),
+        DI<double>(-1.0, 4.0),
+        DI<double>(0.0, 0.0),
+        DI<double>(0.0, 1.0),
+        DI<double>(-max, max),
+        DI<double>(max, max),
+        DI<double>(700.0, 800.0),
+        DI<double>(-800.0, -700.0),
+        DI<double>(1.0, inf),
+        DI<double>(-inf, -1.0),
+        DI<double>(-inf, inf),
+        DI<double>(1.0, 2.0, DEC::def),
+        DI<double>(-1.0, 4.0, DEC::trv),
+        DI<double>::empty(),
+        DI<double>::nai()
+    };
+}
+
+void check(DI<double> const& eager, LI<double> const& lazy)
+{
+    BOOST_CHECK_EQUAL( lazy.is_nai(), is_nai(eager) );
+    BOOST_CHECK( lazy.decoration() == decoration(eager) );
+    BOOST_CHECK_EQUAL( lazy.interval_part(), I<double>(eager) );
+    BOOST_CHECK( decoration(lazy.decorated()) == decoration(eager) );
+}
+
+template<typename Op>
+void check_unary(Op op)
+{
+    for (auto const& x : inputs())
+    {
+        check(op(x), op(LI<double>(x)));
+
+        // chains of length two and three
+        check(op(sqr(x)), op(sqr(LI<double>(x))));
+        check(op(x * DI<double>(0.0, 0.0)), op(LI<double>(x) * LI<double>(0.0, 0.0)));
+        check(exp(op(x + x)), exp(op(LI<double>(x) + LI<double>(x))));
+    }
+}
+
+template<typename Op>
+void check_binary(Op op)
+{
+    for (auto const& x : inputs())
+        for (auto const& y : inputs())
+        {
+            check(op(x, y), op(LI<double>(x), LI<double>(y)));
+
+            // chains of length two and three
+            check(op(sqr(x), y), op(sqr(LI<double>(x)), LI<double>(y)));
+            check(op(x, x * y), op(LI<double>(x), LI<double>(x) * LI<double>(y)));
+            check(op(x + y, y) - x, op(LI<double>(x) + LI<double>(y), LI<double>(y)) - LI<double>(x));
+            check(recip(op(exp(x), y)), recip(op(exp(LI<double>(x)), LI<double>(y))));
+        }
+}
+
+
+BOOST_AUTO_TEST_CASE(lazy_decorated_interval_construction_test)
+{
+    const double inf = std::numeric_limits<double>::infinity();
+
+    BOOST_CHECK( LI<double>().decoration() == DEC::trv );
+    BOOST_CHECK( LI<double>(1.0, 2.0).decoration() == DEC::com );
+    BOOST_CHECK( LI<double>(1.0, inf).decoration() == DEC::dac );
+    BOOST_CHECK( LI<double>(2.0, 1.0).is_nai() );
+    BOOST_CHECK( LI<double>::nai().decoration() == DEC::ill );
+    BOOST_CHECK( is_nai(LI<double>::nai().decorated()) );
+
+    BOOST_CHECK( LI<double>(I<double>(1.0, 2.0)).decoration() == DEC::com );
+    BOOST_CHECK( LI<double>(I<double>(-inf, 2.0)).decoration() == DEC::dac );
+    BOOST_CHECK( LI<double>(I<double>()).decoration() == DEC::trv );
+    BOOST_CHECK( LI<double>(I<double>(1.0, 2.0), DEC::def).decoration() == DEC::def );
+    BOOST_CHECK( LI<double>(I<double>(1.0, 2.0), DEC::ill).is_nai() );
+    BOOST_CHECK( LI<double>(DI<double>(1.0, 2.0, DEC::dac)).decoration() == DEC::dac );
+
+    BOOST_CHECK_EQUAL( LI<double>(1.0, 2.0).decorated(), DI<double>(1.0, 2.0) );
+    BOOST_CHECK_EQUAL( LI<double>(1.0, 2.0).interval_part(), I<double>(1.0, 2.0) );
+}
+
+BOOST_AUTO_TEST_CASE(lazy_decorated_interval_deferred_test)
+{
+    const double max = std::numeric_limits<double>::max();
+
+    LI<double> x(max, max);
+
+    // the overflow is only visible in the decoration, not in the pending decoration
+    LI<double> y = x + x;
+    BOOST_CHECK( y.pending_decoration() == DEC::com );
+    BOOST_CHECK( y.decoration() == DEC::dac );
+    BOOST_CHECK( y.settled().pending_decoration() == DEC::dac );
+
+    // the overflow is settled before it is absorbed
+    BOOST_CHECK( (y * LI<double>(0.0, 0.0)).decoration() == DEC::dac );
+    BOOST_CHECK( recip(y).decoration() == DEC::dac );
+    BOOST_CHECK( ((y - y) + LI<double>(1.0, 1.0)).decoration() == DEC::dac );
+
+    // domain violations
+    BOOST_CHECK( sqrt(LI<double>(-1.0, 1.0)).decoration() == DEC::trv );
+    BOOST_CHECK( log(LI<double>(0.0, 1.0)).decoration() == DEC::trv );
+    BOOST_CHECK( (LI<double>(1.0, 2.0) / LI<double>(-1.0, 1.0)).decoration() == DEC::trv );
+    BOOST_CHECK( (LI<double>::nai() / LI<double>(-1.0, 1.0)).is_nai() );
+    BOOST_CHECK( (LI<double>(1.0, 2.0) / LI<double>::nai()).is_nai() );
+    BOOST_CHECK( sqrt(LI<double>::nai()).is_nai() );
+
+    // long chain
+    LI<double> s(0.0, 0.0);
+    for (int i = 0; i < 1000; ++i)
+        s += sqr(LI<double>(0.5, 1.0)) - LI<double>(0.25, 0.5);
+    BOOST_CHECK( s.decoration() == DEC::com );
+    BOOST_CHECK_EQUAL( s.interval_part(), I<double>(-250.0, 750.0) );
+}
+
+BOOST_AUTO_TEST_CASE(lazy_decorated_interval_eager_test)
+{
+    check_unary(op_neg());
+    check_unary(op_sqr());
+    check_unary(op_abs());
+    check_unary(op_sqrt());
+    check_unary(op_log());
+    check_unary(op_recip());
+    check_unary(op_exp());
+    check_unary(op_sin());
+    check_unary(op_cos());
+
+    check_binary(op_add());
+    check_binary(op_sub());
+    check_binary(op_mul());
+    check_binary(op_div());
+}
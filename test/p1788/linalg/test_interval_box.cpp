@@ -0,0 +1,213 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Interval boxes [p1788/linalg/interval_box]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/linalg/interval_box.hpp"
+
+
+#include <limits>
+#include <iterator>
+#include <cmath>
+#include <vector>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double MAX_D = std::numeric_limits<double>::max();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using IV = p1788::linalg::interval_vector<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T, std::size_t N = p1788::linalg::dynamic>
+using IB = p1788::linalg::interval_box<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor, N>;
+
+template<typename T>
+using POOL = p1788::linalg::box_pool<T>;
+
+
+BOOST_AUTO_TEST_CASE(construction_test)
+{
+    IB<double> a;
+    BOOST_CHECK_EQUAL( a.size(), 0u );
+
+    IB<double> b(3, I<double>(1.0, 2.0));
+    BOOST_CHECK_EQUAL( b.size(), 3u );
+    BOOST_CHECK_EQUAL( b[2], I<double>(1.0, 2.0) );
+    BOOST_CHECK_EQUAL( b.inf_data()[1], 1.0 );
+    BOOST_CHECK_EQUAL( b.sup_data()[1], 2.0 );
+
+    IB<double> c(2);
+    BOOST_CHECK( is_empty(c[0]) );
+    BOOST_CHECK( std::isnan(c.inf_data()[0]) );
+
+    IB<double> d {I<double>(1.0, 2.0), I<double>::empty(), I<double>::entire()};
+    BOOST_CHECK_EQUAL( d.size(), 3u );
+    BOOST_CHECK_EQUAL( d[0], I<double>(1.0, 2.0) );
+    BOOST_CHECK( is_empty(d[1]) );
+    BOOST_CHECK( is_entire(d[2]) );
+
+    d.set(1, I<double>(-1.0, 0.0));
+    BOOST_CHECK_EQUAL( d[1], I<double>(-1.0, 0.0) );
+    d.set(0, I<double>::empty());
+    BOOST_CHECK( is_empty(d[0]) );
+
+    IV<double> v {I<double>(1.0, 2.0), I<double>(3.0, 4.0)};
+    IB<double> e(v);
+    BOOST_CHECK_EQUAL( e[1], v[1] );
+
+    IB<double, 3> f;
+    BOOST_CHECK_EQUAL( f.size(), 3u );
+    BOOST_CHECK( is_empty(f[2]) );
+
+    IB<double, 3> g {I<double>(1.0, 2.0)};
+    BOOST_CHECK_EQUAL( g[0], I<double>(1.0, 2.0) );
+    BOOST_CHECK( is_empty(g[1]) );
+
+    IB<double> h(b);
+    BOOST_CHECK( h == b );
+    h.set(0, I<double>(0.0, 0.0));
+    BOOST_CHECK( h != b );
+    BOOST_CHECK( b != d );
+    BOOST_CHECK( b != IB<double>(2, I<double>(1.0, 2.0)) );
+
+    IB<double> k(std::move(h));
+    BOOST_CHECK_EQUAL( k[0], I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( h.size(), 0u );
+}
+
+BOOST_AUTO_TEST_CASE(pool_test)
+{
+    POOL<double> pool(4, 2);
+    BOOST_CHECK_EQUAL( pool.dim(), 4u );
+
+    {
+        IB<double> a(pool, I<double>(1.0, 2.0));
+        IB<double> b(pool);
+        BOOST_CHECK_EQUAL( pool.size(), 2u );
+        BOOST_CHECK_EQUAL( pool.capacity(), 2u );
+        BOOST_CHECK_EQUAL( a.size(), 4u );
+        BOOST_CHECK( is_empty(b[3]) );
+
+        // consecutive boxes are adjacent
+        BOOST_CHECK( b.inf_data() == a.inf_data() + 8 );
+
+        // copies use the pool
+        IB<double> c(a);
+        BOOST_CHECK_EQUAL( pool.size(), 3u );
+        BOOST_CHECK_EQUAL( pool.capacity(), 4u );
+        BOOST_CHECK( c == a );
+
+        b = a;
+        BOOST_CHECK( b == a );
+        BOOST_CHECK_EQUAL( pool.size(), 3u );
+
+        std::pair<IB<double>, IB<double>> p = bisect(a, 2);
+        BOOST_CHECK_EQUAL( pool.size(), 5u );
+    }
+
+    BOOST_CHECK_EQUAL( pool.size(), 0u );
+
+    // the storage is reused
+    IB<double> d(pool);
+    BOOST_CHECK_EQUAL( pool.size(), 1u );
+    BOOST_CHECK_EQUAL( pool.capacity(), 6u );
+}
+
+BOOST_AUTO_TEST_CASE(num_func_test)
+{
+    IB<double> x {I<double>(1.0, 2.0), I<double>(-4.0, 0.0), I<double>::empty(), I<double>(-INF_D, 3.0), I<double>(-3.0, 1.0)};
+    std::vector<double> r(x.size());
+
+    wid(x, r.data());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK( r[i] == wid(x[i]) || (std::isnan(r[i]) && std::isnan(wid(x[i]))) );
+
+    mid(x, r.data());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK( r[i] == mid(x[i]) || (std::isnan(r[i]) && std::isnan(mid(x[i]))) );
+    BOOST_CHECK_EQUAL( r[3], -MAX_D );
+
+    rad(x, r.data());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK( r[i] == rad(x[i]) || (std::isnan(r[i]) && std::isnan(rad(x[i]))) );
+
+    mag(x, r.data());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK( r[i] == mag(x[i]) || (std::isnan(r[i]) && std::isnan(mag(x[i]))) );
+
+    mig(x, r.data());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK( r[i] == mig(x[i]) || (std::isnan(r[i]) && std::isnan(mig(x[i]))) );
+
+    BOOST_CHECK_EQUAL(p1788::exception::state(), p1788::exception::none_bit);
+}
+
+BOOST_AUTO_TEST_CASE(split_test)
+{
+    IB<double> x {I<double>(1.0, 2.0), I<double>(-4.0, 0.0), I<double>(0.0, 4.0)};
+    BOOST_CHECK_EQUAL( widest_component(x), 1u );
+    BOOST_CHECK_EQUAL( widest_component(IB<double>(2)), 0u );
+
+    // more components than one block of the heuristics
+    IB<double> y(150, I<double>(0.0, 1.0));
+    y.set(130, I<double>(0.0, 2.0));
+    BOOST_CHECK_EQUAL( widest_component(y), 130u );
+
+    std::vector<I<double>> g {I<double>(1.0, 1.0), I<double>(-0.25, 0.0), I<double>(0.5, 0.75)};
+    BOOST_CHECK_EQUAL( smear_component(x, g.begin()), 2u );
+    std::vector<I<double>> g2 {I<double>(10.0, 20.0), I<double>(-0.25, 0.0), I<double>(0.5, 0.75)};
+    BOOST_CHECK_EQUAL( smear_component(x, g2.begin()), 0u );
+
+    IB<double, 3> z {I<double>(1.0, 1.0), I<double>(-1.0, 0.0), I<double>(0.0, 0.5)};
+    std::vector<I<double>> h {I<double>::entire(), I<double>(1.0, 1.0), I<double>(1.0, 1.0)};
+    BOOST_CHECK_EQUAL( smear_component(z, h.begin()), 1u );
+
+    std::pair<IB<double>, IB<double>> p = bisect(x);
+    BOOST_CHECK_EQUAL( p.first[1], I<double>(-4.0, -2.0) );
+    BOOST_CHECK_EQUAL( p.second[1], I<double>(-2.0, 0.0) );
+    BOOST_CHECK_EQUAL( p.first[0], x[0] );
+    BOOST_CHECK_EQUAL( p.second[2], x[2] );
+
+    std::pair<IB<double>, IB<double>> q = bisect(x, 2, 0.25);
+    BOOST_CHECK_EQUAL( q.first[2], I<double>(0.0, 1.0) );
+    BOOST_CHECK_EQUAL( q.second[2], I<double>(1.0, 4.0) );
+    BOOST_CHECK_EQUAL( q.first[1], x[1] );
+
+    std::pair<IB<double, 3>, IB<double, 3>> s = bisect(z);
+    BOOST_CHECK_EQUAL( s.first[1], I<double>(-1.0, -0.5) );
+    BOOST_CHECK_EQUAL( s.second[1], I<double>(-0.5, 0.0) );
+
+    std::vector<IB<double>> m;
+    multisect(x, 0, 4, std::back_inserter(m));
+    BOOST_CHECK_EQUAL( m.size(), 4u );
+    BOOST_CHECK_EQUAL( m[0][0], I<double>(1.0, 1.25) );
+    BOOST_CHECK_EQUAL( m[3][0], I<double>(1.75, 2.0) );
+    BOOST_CHECK_EQUAL( m[2][1], x[1] );
+}
@@ -0,0 +1,352 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Interval vectors and matrices [p1788/linalg/linalg]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/linalg/linalg.hpp"
+
+
+#include <algorithm>
+#include <cfenv>
+#include <limits>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+const double MAX_D = std::numeric_limits<double>::max();
+const double MIN_D = std::numeric_limits<double>::min();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using IV = p1788::linalg::interval_vector<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using IM = p1788::linalg::interval_matrix<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+
+// random matrix, intervals of relative width up to 2^-20
+template<typename T>
+IM<T> random_matrix(std::size_t rows, std::size_t cols, std::mt19937& gen)
+{
+    std::uniform_real_distribution<T> dist(-10.0, 10.0);
+    std::uniform_real_distribution<T> rel(0.0, std::ldexp(1.0, -20));
+
+    IM<T> a(rows, cols);
+
+    for (auto& x : a)
+    {
+        T m = dist(gen);
+        T r = std::abs(m) * rel(gen);
+        x = I<T>(m - r, m + r);
+    }
+
+    return a;
+}
+
+// x is a subset of y and at most about 1.5 times wider
+template<typename T>
+bool tight_superset(I<T> const& x, I<T> const& y)
+{
+    return subset(y, x) && wid(x) <= 1.5 * wid(y) + 1e-12 * mag(y) + 1e-300;
+}
+
+
+BOOST_AUTO_TEST_CASE(interval_vector_test)
+{
+    IV<double> x;
+    BOOST_CHECK_EQUAL( x.size(), 0u );
+
+    IV<double> y(3);
+    BOOST_CHECK_EQUAL( y.size(), 3u );
+    BOOST_CHECK( is_empty(y[0]) );
+    BOOST_CHECK( is_empty(y[2]) );
+
+    IV<double> z(2, I<double>(1.0, 2.0));
+    BOOST_CHECK_EQUAL( z[0], I<double>(1.0, 2.0) );
+    BOOST_CHECK_EQUAL( z[1], I<double>(1.0, 2.0) );
+
+    IV<double> v {I<double>(1.0, 2.0), I<double>(-1.0, 0.0)};
+    BOOST_CHECK_EQUAL( v.size(), 2u );
+    BOOST_CHECK_EQUAL( v[1], I<double>(-1.0, 0.0) );
+    BOOST_CHECK_EQUAL( *v.begin(), I<double>(1.0, 2.0) );
+    BOOST_CHECK_EQUAL( v.end() - v.begin(), 2 );
+    BOOST_CHECK( v != z );
+
+    v[1] = I<double>(1.0, 2.0);
+    BOOST_CHECK( v == z );
+
+    BOOST_CHECK_EQUAL( (v + z)[0], I<double>(2.0, 4.0) );
+    BOOST_CHECK_EQUAL( (v - z)[1], I<double>(-1.0, 1.0) );
+    BOOST_CHECK( add(v, z) == (v + z) );
+    BOOST_CHECK( sub(v, z) == (v - z) );
+}
+
+BOOST_AUTO_TEST_CASE(interval_matrix_test)
+{
+    IM<double> a;
+    BOOST_CHECK_EQUAL( a.rows(), 0u );
+    BOOST_CHECK_EQUAL( a.cols(), 0u );
+
+    IM<double> b(2, 3);
+    BOOST_CHECK_EQUAL( b.rows(), 2u );
+    BOOST_CHECK_EQUAL( b.cols(), 3u );
+    BOOST_CHECK( is_empty(b(1, 2)) );
+
+    IM<double> c {{I<double>(1.0, 1.0), I<double>(2.0, 2.0), I<double>(3.0, 3.0)},
+                  {I<double>(4.0, 4.0), I<double>(5.0, 5.0), I<double>(6.0, 6.0)}};
+    BOOST_CHECK_EQUAL( c.rows(), 2u );
+    BOOST_CHECK_EQUAL( c.cols(), 3u );
+    BOOST_CHECK_EQUAL( c(0, 2), I<double>(3.0, 3.0) );
+    BOOST_CHECK_EQUAL( c(1, 0), I<double>(4.0, 4.0) );
+    BOOST_CHECK_EQUAL( c.data()[4], I<double>(5.0, 5.0) );
+
+    IM<double> e = IM<double>::identity(2);
+    BOOST_CHECK_EQUAL( e(0, 0), I<double>(1.0, 1.0) );
+    BOOST_CHECK_EQUAL( e(0, 1), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( e(1, 0), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( e(1, 1), I<double>(1.0, 1.0) );
+
+    BOOST_CHECK( c == c );
+    BOOST_CHECK( c != b );
+    BOOST_CHECK( c != e );
+    BOOST_CHECK_EQUAL( (c + c)(1, 2), I<double>(12.0, 12.0) );
+    BOOST_CHECK_EQUAL( (c - c)(1, 2), I<double>(0.0, 0.0) );
+}
+
+BOOST_AUTO_TEST_CASE(mul_small_test)
+{
+    IM<double> a {{I<double>(1.0, 1.0), I<double>(2.0, 2.0)},
+                  {I<double>(3.0, 3.0), I<double>(4.0, 4.0)}};
+    IV<double> x {I<double>(1.0, 1.0), I<double>(-1.0, 2.0)};
+
+    IV<double> y = a * x;
+    BOOST_CHECK_EQUAL( y.size(), 2u );
+    BOOST_CHECK( subset(I<double>(-1.0, 5.0), y[0]) );
+    BOOST_CHECK( subset(I<double>(-1.0, 11.0), y[1]) );
+    BOOST_CHECK( tight_superset(y[0], I<double>(-1.0, 5.0)) );
+    BOOST_CHECK( tight_superset(y[1], I<double>(-1.0, 11.0)) );
+    BOOST_CHECK( mul_infsup(a, x) == (IV<double> {I<double>(-1.0, 5.0), I<double>(-1.0, 11.0)}) );
+
+    IM<double> c = a * a;
+    BOOST_CHECK_EQUAL( c.rows(), 2u );
+    BOOST_CHECK_EQUAL( c.cols(), 2u );
+    BOOST_CHECK( is_member(7.0, c(0, 0)) );
+    BOOST_CHECK( is_member(10.0, c(0, 1)) );
+    BOOST_CHECK( is_member(15.0, c(1, 0)) );
+    BOOST_CHECK( is_member(22.0, c(1, 1)) );
+    BOOST_CHECK( wid(c(1, 1)) < 1e-13 );
+
+    // identity
+    IM<double> e = IM<double>::identity(2);
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+            BOOST_CHECK( subset(a(i, j), mul(e, a)(i, j)) );
+
+    // 0.1 is not representable
+    IM<double> t {{I<double>(0.1, 0.1)}};
+    IV<double> z {I<double>(3.0, 3.0)};
+    BOOST_CHECK( subset(mul_infsup(t, z)[0], mul(t, z)[0]) );
+}
+
+BOOST_AUTO_TEST_CASE(mul_random_test)
+{
+    std::mt19937 gen(1788);
+
+    IM<double> a = random_matrix<double>(37, 53, gen);
+    IM<double> b = random_matrix<double>(53, 29, gen);
+
+    IM<double> c = mul(a, b);
+    IM<double> r = mul_infsup(a, b);
+
+    BOOST_CHECK_EQUAL( c.rows(), 37u );
+    BOOST_CHECK_EQUAL( c.cols(), 29u );
+
+    for (std::size_t i = 0; i < c.rows(); ++i)
+        for (std::size_t j = 0; j < c.cols(); ++j)
+            BOOST_CHECK( tight_superset(c(i, j), r(i, j)) );
+
+    IV<double> x(53);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = b(i, 3);
+
+    IV<double> y = mul(a, x);
+    IV<double> yr = mul_infsup(a, x);
+
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        BOOST_CHECK( tight_superset(y[i], yr[i]) );
+        BOOST_CHECK_EQUAL( y[i], c(i, 3) );
+    }
+
+    // float
+    IM<float> af = random_matrix<float>(17, 19, gen);
+    IM<float> bf = random_matrix<float>(19, 23, gen);
+    IM<float> cf = mul(af, bf);
+    IM<float> rf = mul_infsup(af, bf);
+
+    for (std::size_t i = 0; i < cf.rows(); ++i)
+        for (std::size_t j = 0; j < cf.cols(); ++j)
+            BOOST_CHECK( subset(rf(i, j), cf(i, j)) );
+}
+
+BOOST_AUTO_TEST_CASE(mul_point_test)
+{
+    // products of point matrices with cancellation
+    IM<double> a {{I<double>(1e16, 1e16), I<double>(1.0, 1.0), I<double>(-1e16, -1e16)}};
+    IV<double> x {I<double>(1.0, 1.0), I<double>(1.0, 1.0), I<double>(1.0, 1.0)};
+
+    BOOST_CHECK( is_member(1.0, mul(a, x)[0]) );
+
+    // underflow
+    IM<double> u {{I<double>(MIN_D, MIN_D), I<double>(-MIN_D, -MIN_D)}};
+    IV<double> v {I<double>(0.5, 0.5), I<double>(0.25, 0.25)};
+
+    BOOST_CHECK( is_member(MIN_D / 4.0, mul(u, v)[0]) );
+    BOOST_CHECK( subset(mul_infsup(u, v)[0], mul(u, v)[0]) );
+}
+
+BOOST_AUTO_TEST_CASE(mul_fallback_test)
+{
+    // unbounded
+    IM<double> a {{I<double>(1.0, INF_D), I<double>(2.0, 2.0)},
+                  {I<double>(3.0, 3.0), I<double>(4.0, 4.0)}};
+    IV<double> x {I<double>(1.0, 1.0), I<double>(-1.0, 2.0)};
+
+    BOOST_CHECK( mul(a, x) == mul_infsup(a, x) );
+    BOOST_CHECK_EQUAL( mul(a, x)[0], I<double>(-1.0, INF_D) );
+    BOOST_CHECK( mul(a, a) == mul_infsup(a, a) );
+
+    // empty
+    IM<double> b {{I<double>(), I<double>(2.0, 2.0)}};
+    BOOST_CHECK( mul(b, x) == mul_infsup(b, x) );
+    BOOST_CHECK( is_empty(mul(b, x)[0]) );
+
+    // overflow
+    IM<double> c {{I<double>(MAX_D, MAX_D), I<double>(MAX_D, MAX_D)}};
+    IV<double> y {I<double>(1.0, 1.0), I<double>(1.0, 2.0)};
+    BOOST_CHECK( mul(c, y) == mul_infsup(c, y) );
+    BOOST_CHECK_EQUAL( mul(c, y)[0], I<double>(MAX_D, INF_D) );
+
+    // empty inner dimension
+    IM<double> d(2, 0);
+    IM<double> e(0, 3);
+    BOOST_CHECK( mul(d, e) == IM<double>(2, 3, I<double>(0.0, 0.0)) );
+
+    // the error bounds of the midpoint-radius product require rounding to nearest
+    std::mt19937 gen(1788);
+    IM<double> f = random_matrix<double>(7, 5, gen);
+    IM<double> g = random_matrix<double>(5, 6, gen);
+    IV<double> z(5, I<double>(-1.0, 2.0));
+
+    std::fesetround(FE_UPWARD);
+    BOOST_CHECK( mul(f, g) == mul_infsup(f, g) );
+    BOOST_CHECK( mul(f, z) == mul_infsup(f, z) );
+    std::fesetround(FE_DOWNWARD);
+    BOOST_CHECK( mul(f, g) == mul_infsup(f, g) );
+    std::fesetround(FE_TONEAREST);
+}
+
+BOOST_AUTO_TEST_CASE(mul_threads_test)
+{
+    std::mt19937 gen(42);
+
+    IM<double> a = random_matrix<double>(96, 80, gen);
+    IM<double> b = random_matrix<double>(80, 72, gen);
+
+    unsigned old = p1788::util::set_num_threads(1);
+    BOOST_CHECK_EQUAL( p1788::util::get_num_threads(), 1u );
+    IM<double> c1 = mul(a, b);
+
+    p1788::util::set_num_threads(4);
+    BOOST_CHECK_EQUAL( p1788::util::get_num_threads(), 4u );
+    IM<double> c4 = mul(a, b);
+
+    p1788::util::set_num_threads(0);
+    IM<double> c0 = mul(a, b);
+
+    BOOST_CHECK( c1 == c4 );
+    BOOST_CHECK( c1 == c0 );
+
+    IM<double> r = mul_infsup(a, b);
+
+    for (std::size_t i = 0; i < r.rows(); ++i)
+        for (std::size_t j = 0; j < r.cols(); ++j)
+            BOOST_CHECK( tight_superset(c4(i, j), r(i, j)) );
+
+    p1788::util::set_num_threads(old);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_rows_exception_test)
+{
+    unsigned old = p1788::util::set_num_threads(4);
+
+    std::vector<char> seen(1000, 0);
+    p1788::linalg::parallel_rows(seen.size(), 1e9, [&](std::size_t i0, std::size_t i1)
+    {
+        for (std::size_t i = i0; i < i1; ++i)
+            seen[i] = 1;
+    });
+    BOOST_CHECK( std::count(seen.begin(), seen.end(), 1) == 1000 );
+
+    BOOST_CHECK_THROW( p1788::linalg::parallel_rows(1000, 1e9, [](std::size_t i0, std::size_t)
+    {
+        if (i0 > 0)
+            throw std::runtime_error("row");
+    }), std::runtime_error );
+
+    p1788::util::set_num_threads(old);
+}
+
+BOOST_AUTO_TEST_CASE(bisect_test)
+{
+    IV<double> v {I<double>(1.0, 2.0), I<double>(-4.0, 0.0), I<double>(0.0, 4.0)};
+    BOOST_CHECK_EQUAL( widest_component(v), 1u );
+    BOOST_CHECK_EQUAL( widest_component(IV<double>(2)), 0u );
+
+    std::pair<IV<double>, IV<double>> p = bisect(v);
+    BOOST_CHECK_EQUAL( p.first[1], I<double>(-4.0, -2.0) );
+    BOOST_CHECK_EQUAL( p.second[1], I<double>(-2.0, 0.0) );
+    BOOST_CHECK_EQUAL( p.first[0], v[0] );
+    BOOST_CHECK_EQUAL( p.second[2], v[2] );
+
+    std::pair<IV<double>, IV<double>> q = bisect(v, 2, 0.25);
+    BOOST_CHECK_EQUAL( q.first[2], I<double>(0.0, 1.0) );
+    BOOST_CHECK_EQUAL( q.second[2], I<double>(1.0, 4.0) );
+    BOOST_CHECK_EQUAL( q.first[1], v[1] );
+
+    std::vector<IV<double>> m;
+    multisect(v, 0, 4, std::back_inserter(m));
+    BOOST_CHECK_EQUAL( m.size(), 4u );
+    BOOST_CHECK_EQUAL( m[0][0], I<double>(1.0, 1.25) );
+    BOOST_CHECK_EQUAL( m[3][0], I<double>(1.75, 2.0) );
+    BOOST_CHECK_EQUAL( m[2][1], v[1] );
+}
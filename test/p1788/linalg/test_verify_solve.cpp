@@ -0,0 +1,284 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#define BOOST_TEST_MODULE "Verified linear systems [p1788/linalg/verify_solve]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/linalg/verify_solve.hpp"
+
+
+#include <cfenv>
+#include <limits>
+#include <random>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using IV = p1788::linalg::interval_vector<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using IM = p1788::linalg::interval_matrix<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+using p1788::linalg::solve_method;
+
+
+// diagonally dominant random system, intervals of relative width up to w
+template<typename T>
+void random_system(std::size_t n, T w, std::mt19937& gen, IM<T>& a, IV<T>& b)
+{
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> rel(0.0, w);
+
+    a = IM<T>(n, n);
+    b = IV<T>(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            T m = dist(gen) + (i == j ? static_cast<T>(n) : 0);
+            T r = std::abs(m) * rel(gen);
+            a(i, j) = I<T>(m - r, m + r);
+        }
+
+        T m = dist(gen);
+        T r = std::abs(m) * rel(gen);
+        b[i] = I<T>(m - r, m + r);
+    }
+}
+
+template<typename T>
+IM<T> mid(IM<T> const& a)
+{
+    IM<T> m(a.rows(), a.cols());
+
+    for (std::size_t i = 0; i < a.rows() * a.cols(); ++i)
+        m.data()[i] = I<T>(mid(a.data()[i]), mid(a.data()[i]));
+
+    return m;
+}
+
+template<typename T>
+IV<T> mid(IV<T> const& b)
+{
+    IV<T> m(b.size());
+
+    for (std::size_t i = 0; i < b.size(); ++i)
+        m[i] = I<T>(mid(b[i]), mid(b[i]));
+
+    return m;
+}
+
+template<typename T>
+bool subset(IV<T> const& x, IV<T> const& y)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (!subset(x[i], y[i]))
+            return false;
+
+    return true;
+}
+
+template<typename T>
+bool is_entire(IV<T> const& x)
+{
+    for (auto const& xi : x)
+        if (!is_entire(xi))
+            return false;
+
+    return true;
+}
+
+
+BOOST_AUTO_TEST_CASE(verify_solve_point_test)
+{
+    // solution (1/11, 7/11)
+    IM<double> a = { { I<double>(4.0, 4.0), I<double>(1.0, 1.0) }, { I<double>(1.0, 1.0), I<double>(3.0, 3.0) } };
+    IV<double> b = { I<double>(1.0, 1.0), I<double>(2.0, 2.0) };
+
+    for (solve_method method : { solve_method::krawczyk, solve_method::gauss_seidel })
+    {
+        IV<double> x;
+
+        BOOST_CHECK( p1788::linalg::verify_solve(a, b, x, method) );
+        BOOST_CHECK( is_member(1.0, x[0] * I<double>(11.0, 11.0)) );
+        BOOST_CHECK( is_member(7.0, x[1] * I<double>(11.0, 11.0)) );
+        BOOST_CHECK( wid(x[0]) <= 1e-15 );
+        BOOST_CHECK( wid(x[1]) <= 1e-15 );
+    }
+
+    BOOST_CHECK( p1788::linalg::verify_solve(IM<double>(), IV<double>()) == IV<double>() );
+}
+
+BOOST_AUTO_TEST_CASE(verify_solve_rounding_mode_test)
+{
+    // solution (1/11, 7/11), verified with the inf-sup products
+    IM<double> a = { { I<double>(4.0, 4.0), I<double>(1.0, 1.0) }, { I<double>(1.0, 1.0), I<double>(3.0, 3.0) } };
+    IV<double> b = { I<double>(1.0, 1.0), I<double>(2.0, 2.0) };
+
+    for (int rnd : { FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO })
+    {
+        IV<double> x;
+
+        std::fesetround(rnd);
+        bool verified = p1788::linalg::verify_solve(a, b, x);
+        std::fesetround(FE_TONEAREST);
+
+        BOOST_CHECK( verified );
+        BOOST_CHECK( is_member(1.0, x[0] * I<double>(11.0, 11.0)) );
+        BOOST_CHECK( is_member(7.0, x[1] * I<double>(11.0, 11.0)) );
+        BOOST_CHECK( wid(x[0]) <= 1e-14 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE(verify_solve_interval_test)
+{
+    std::mt19937 gen(1788);
+
+    for (std::size_t n : { 1u, 5u, 30u })
+    {
+        IM<double> a;
+        IV<double> b;
+        random_system(n, 1e-6, gen, a, b);
+
+        IV<double> xk;
+        IV<double> xg;
+        IV<double> xm;
+
+        BOOST_CHECK( p1788::linalg::verify_solve(a, b, xk, solve_method::krawczyk) );
+        BOOST_CHECK( p1788::linalg::verify_solve(a, b, xg, solve_method::gauss_seidel) );
+        BOOST_CHECK( p1788::linalg::verify_solve(mid(a), mid(b), xm) );
+
+        // the solution of the midpoint system is contained in both enclosures
+        BOOST_CHECK( subset(xm, xk) );
+        BOOST_CHECK( subset(xm, xg) );
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            BOOST_CHECK( wid(xk[i]) <= 1e-4 );
+            BOOST_CHECK( wid(xg[i]) <= 1e-4 );
+        }
+    }
+
+    IM<float> af;
+    IV<float> bf;
+    random_system(10, 1e-4f, gen, af, bf);
+
+    IV<float> xf;
+    IV<float> xfm;
+
+    BOOST_CHECK( p1788::linalg::verify_solve(af, bf, xf) );
+    BOOST_CHECK( p1788::linalg::verify_solve(mid(af), mid(bf), xfm) );
+    BOOST_CHECK( subset(xfm, xf) );
+}
+
+BOOST_AUTO_TEST_CASE(verify_solve_hilbert_test)
+{
+    // Hilbert matrices with the right hand side of the solution (1, ..., 1),
+    // the condition number grows like e^(3.5 n)
+    for (std::size_t n : { 4u, 8u, 14u })
+    {
+        IM<double> a(n, n);
+        IV<double> b(n, I<double>(0.0, 0.0));
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                double d = static_cast<double>(i + j + 1);
+                a(i, j) = I<double>(1.0, 1.0) / I<double>(d, d);
+                b[i] += a(i, j);
+            }
+        }
+
+        IV<double> x;
+        bool verified = p1788::linalg::verify_solve(a, b, x);
+
+        if (n < 14)
+        {
+            BOOST_CHECK( verified );
+
+            for (std::size_t i = 0; i < n; ++i)
+                BOOST_CHECK( is_member(1.0, x[i]) );
+        }
+        else
+        {
+            BOOST_CHECK( !verified );
+            BOOST_CHECK( is_entire(x) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(verify_solve_fail_test)
+{
+    IM<double> singular = { { I<double>(1.0, 1.0), I<double>(2.0, 2.0) }, { I<double>(2.0, 2.0), I<double>(4.0, 4.0) } };
+    IM<double> wide = { { I<double>(-1.0, 1.0), I<double>(1.0, 1.0) }, { I<double>(1.0, 1.0), I<double>(1.0, 1.0) } };
+    IM<double> unbounded = { { I<double>(1.0, INF_D), I<double>(0.0, 0.0) }, { I<double>(0.0, 0.0), I<double>(1.0, 1.0) } };
+    IM<double> empty = { { I<double>(), I<double>(0.0, 0.0) }, { I<double>(0.0, 0.0), I<double>(1.0, 1.0) } };
+    IM<double> id = IM<double>::identity(2);
+
+    IV<double> b = { I<double>(1.0, 1.0), I<double>(1.0, 1.0) };
+
+    IV<double> x;
+
+    BOOST_CHECK( !p1788::linalg::verify_solve(singular, b, x) );
+    BOOST_CHECK( is_entire(x) );
+    BOOST_CHECK( !p1788::linalg::verify_solve(wide, b, x) );
+    BOOST_CHECK( is_entire(x) );
+    BOOST_CHECK( !p1788::linalg::verify_solve(unbounded, b, x) );
+    BOOST_CHECK( is_entire(x) );
+    BOOST_CHECK( !p1788::linalg::verify_solve(empty, b, x) );
+    BOOST_CHECK( is_entire(x) );
+    BOOST_CHECK( !p1788::linalg::verify_solve(id, IV<double>({ I<double>(1.0, 1.0), I<double>(-INF_D, 0.0) }), x) );
+    BOOST_CHECK( is_entire(x) );
+
+    BOOST_CHECK( is_entire(p1788::linalg::verify_solve(singular, b, solve_method::gauss_seidel)) );
+}
+
+BOOST_AUTO_TEST_CASE(verify_solve_threads_test)
+{
+    std::mt19937 gen(17);
+
+    IM<double> a;
+    IV<double> b;
+    random_system(100, 1e-8, gen, a, b);
+
+    unsigned old = p1788::util::set_num_threads(1);
+    IV<double> x1 = p1788::linalg::verify_solve(a, b);
+
+    p1788::util::set_num_threads(4);
+    IV<double> x4 = p1788::linalg::verify_solve(a, b);
+
+    p1788::util::set_num_threads(old);
+
+    BOOST_CHECK( !is_entire(x1) );
+    BOOST_CHECK( x1 == x4 );
+}
@@ -0,0 +1,188 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+
+#define BOOST_TEST_MODULE "Multiple-precision intervals [p1788/multiprecision/mp_interval]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/multiprecision/mp_interval.hpp"
+
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+typedef p1788::multiprecision::mp_interval<> MP;
+
+
+BOOST_AUTO_TEST_CASE(mp_interval_conversion_test)
+{
+    MP x(I<double>(1.0, 2.0), 200);
+
+    BOOST_CHECK_EQUAL( x.precision(), 200 );
+    BOOST_CHECK_EQUAL( x.to_interval<double>(), I<double>(1.0, 2.0) );
+    BOOST_CHECK_EQUAL( MP(I<double>(), 200).to_interval<double>(), I<double>() );
+    BOOST_CHECK( is_entire(MP(I<double>(-INF_D, INF_D))) );
+    BOOST_CHECK_EQUAL( MP(-INF_D, 3.0).to_interval<double>(), I<double>(-INF_D, 3.0) );
+
+    // outward rounding to a lower precision
+    MP y(0.1, 0.1, 8);
+    BOOST_CHECK( mpfr_cmp_d(y.lower(), 0.1) < 0 );
+    BOOST_CHECK( mpfr_cmp_d(y.upper(), 0.1) > 0 );
+    BOOST_CHECK( subset(MP(0.1, 0.1), MP::convert(MP(0.1, 0.1), 8)) );
+
+    // outward rounding to the IEEE formats
+    MP third = MP(1.0, 1.0, 300) / MP(3.0, 3.0, 300);
+    BOOST_CHECK_EQUAL( third.to_interval<double>(), I<double>(1.0, 1.0) / I<double>(3.0, 3.0) );
+    BOOST_CHECK_EQUAL( third.to_interval<float>(), I<float>(1.0f, 1.0f) / I<float>(3.0f, 3.0f) );
+    BOOST_CHECK( wid(third) < std::ldexp(1.0, -290) );
+
+    // results outside of the range of double
+    MP huge = sqr(sqr(MP(1e200, 1e200)));
+    BOOST_CHECK_EQUAL( huge.to_interval<double>(), I<double>(std::numeric_limits<double>::max(), INF_D) );
+
+    // the exponent range of the flavor is not affected
+    I<double> z = I<double>(1.0, 1.0) / I<double>(3.0, 3.0);
+    BOOST_CHECK_EQUAL( MP(z).to_interval<double>(), z );
+
+    p1788::exception::clear();
+    BOOST_CHECK( is_empty(MP(2.0, 1.0)) );
+    BOOST_CHECK( p1788::exception::undefined_operation() );
+    p1788::exception::clear();
+}
+
+BOOST_AUTO_TEST_CASE(mp_interval_precision_test)
+{
+    BOOST_CHECK_EQUAL( MP::default_precision(), 128 );
+    MP::set_default_precision(256);
+    BOOST_CHECK_EQUAL( MP(1.0, 2.0).precision(), 256 );
+    MP::set_default_precision(128);
+
+    // the result has the maximal precision of the operands
+    BOOST_CHECK_EQUAL( (MP(1.0, 2.0, 64) + MP(1.0, 2.0, 300)).precision(), 300 );
+
+    typedef p1788::multiprecision::mp_interval<512> MP512;
+    MP512 a(2.0, 2.0, 64);
+    BOOST_CHECK_EQUAL( a.precision(), 512 );
+    BOOST_CHECK( wid(sqrt(a)) < std::ldexp(1.0, -500) );
+    BOOST_CHECK_EQUAL( MP(sqrt(a), 53).to_interval<double>(), sqrt(I<double>(2.0, 2.0)) );
+
+    // copy and move across precisions
+    MP b(1.0, 2.0, 64);
+    MP c(3.0, 4.0, 200);
+    b = c;
+    BOOST_CHECK_EQUAL( b.precision(), 200 );
+    BOOST_CHECK( b == c );
+    MP d(std::move(c));
+    BOOST_CHECK_EQUAL( d.precision(), 200 );
+    BOOST_CHECK( d == b );
+}
+
+BOOST_AUTO_TEST_CASE(mp_interval_arithmetic_test)
+{
+    MP e;
+
+    BOOST_CHECK( is_empty(e) );
+    BOOST_CHECK( is_empty(e + MP(1.0, 2.0)) );
+    BOOST_CHECK( is_empty(MP(1.0, 2.0) * e) );
+
+    BOOST_CHECK_EQUAL( (MP(1.0, 2.0) - MP(1.0, 2.0)).to_interval<double>(), I<double>(-1.0, 1.0) );
+    BOOST_CHECK_EQUAL( (-MP(1.0, 2.0)).to_interval<double>(), I<double>(-2.0, -1.0) );
+    BOOST_CHECK_EQUAL( (MP(-1.0, 2.0) * MP(-3.0, 4.0)).to_interval<double>(), I<double>(-6.0, 8.0) );
+    BOOST_CHECK_EQUAL( (MP(0.0, 0.0) * MP(-INF_D, INF_D)).to_interval<double>(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( (MP(-2.0, -1.0) * MP(0.0, INF_D)).to_interval<double>(), I<double>(-INF_D, 0.0) );
+
+    BOOST_CHECK_EQUAL( (MP(1.0, 2.0) / MP(4.0, 8.0)).to_interval<double>(), I<double>(0.125, 0.5) );
+    BOOST_CHECK_EQUAL( (MP(1.0, 2.0) / MP(0.0, 4.0)).to_interval<double>(), I<double>(0.25, INF_D) );
+    BOOST_CHECK_EQUAL( (MP(0.0, 1.0) / MP(0.0, 1.0)).to_interval<double>(), I<double>(0.0, INF_D) );
+    BOOST_CHECK( is_entire(MP(1.0, 2.0) / MP(-1.0, 1.0)) );
+    BOOST_CHECK( is_empty(MP(1.0, 2.0) / MP(0.0, 0.0)) );
+    BOOST_CHECK_EQUAL( recip(MP(-4.0, -2.0)).to_interval<double>(), I<double>(-0.5, -0.25) );
+
+    BOOST_CHECK_EQUAL( sqr(MP(-3.0, 2.0)).to_interval<double>(), I<double>(0.0, 9.0) );
+    BOOST_CHECK_EQUAL( sqrt(MP(-4.0, 4.0)).to_interval<double>(), I<double>(0.0, 2.0) );
+    BOOST_CHECK( is_empty(sqrt(MP(-4.0, -1.0))) );
+    BOOST_CHECK_EQUAL( log(MP(0.0, 1.0)).to_interval<double>(), I<double>(-INF_D, 0.0) );
+    BOOST_CHECK( is_empty(log(MP(-1.0, 0.0))) );
+    BOOST_CHECK_EQUAL( exp(MP(0.0, 1.0)).to_interval<double>(), exp(I<double>(0.0, 1.0)) );
+    BOOST_CHECK( is_member(1.0, log(exp(MP(1.0, 1.0, 300)))) );
+    BOOST_CHECK( wid(log(exp(MP(1.0, 1.0, 300)))) < std::ldexp(1.0, -290) );
+
+    BOOST_CHECK_EQUAL( intersection(MP(1.0, 3.0), MP(2.0, 4.0)).to_interval<double>(), I<double>(2.0, 3.0) );
+    BOOST_CHECK( is_empty(intersection(MP(1.0, 2.0), MP(3.0, 4.0))) );
+    BOOST_CHECK_EQUAL( convex_hull(MP(1.0, 2.0), MP(3.0, 4.0)).to_interval<double>(), I<double>(1.0, 4.0) );
+    BOOST_CHECK( is_member(2.5, MP(1.0, 3.0)) );
+    BOOST_CHECK( !is_member(3.5, MP(1.0, 3.0)) );
+
+    std::ostringstream os;
+    os << MP(1.0, 2.0) << " " << e;
+    BOOST_CHECK_EQUAL( os.str(), "[1,2] [empty]" );
+}
+
+// Rump's example, evaluated with increasing precision until the enclosure
+// is tight
+BOOST_AUTO_TEST_CASE(mp_interval_escalation_test)
+{
+    auto rump = [](mpfr_prec_t prec)
+    {
+        MP a(77617.0, 77617.0, prec);
+        MP b(33096.0, 33096.0, prec);
+        MP b2 = sqr(b);
+        MP b4 = sqr(b2);
+        MP b6 = b4 * b2;
+        MP a2 = sqr(a);
+
+        return MP(333.75, 333.75, prec) * b6
+               + a2 * (MP(11.0, 11.0, prec) * a2 * b2 - b6 - MP(121.0, 121.0, prec) * b4 - MP(2.0, 2.0, prec))
+               + MP(5.5, 5.5, prec) * sqr(b4)
+               + a / (MP(2.0, 2.0, prec) * b);
+    };
+
+    BOOST_CHECK( wid(rump(53)) > 1.0 );
+
+    mpfr_prec_t prec = 53;
+    MP r = rump(prec);
+
+    while (wid(r) > 1e-10)
+    {
+        prec *= 2;
+        r = rump(prec);
+    }
+
+    BOOST_CHECK( prec > 53 && prec <= 256 );
+
+    I<double> y = r.to_interval<double>();
+    BOOST_CHECK( inf(y) <= -0.8273960599468 );
+    BOOST_CHECK( sup(y) >= -0.8273960599469 );
+    BOOST_CHECK( wid(y) < 1e-10 );
+}
@@ -0,0 +1,307 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   UnF<double>::less required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Taylor models [p1788/taylor/taylor_model]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+#include "p1788/p1788.hpp"
+#include "p1788/taylor/taylor_model.hpp"
+
+
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+const double INF_D = std::numeric_limits<double>::infinity();
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using TM = p1788::taylor::taylor_model<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+
+// point x = c + r t of the variable v corresponding to the normalized t
+I<double> point(TM<double> const& v, unsigned i, double t)
+{
+    double c = v.coefficient(0);
+    double r = v.coefficient(TM<double>::monomial(i));
+
+    return I<double>(c, c) + I<double>(r, r) * I<double>(t, t);
+}
+
+
+BOOST_AUTO_TEST_CASE(taylor_model_construction_test)
+{
+    typedef TM<double>::monomial_type M;
+
+    M m = TM<double>::monomial(0, 2) + TM<double>::monomial(3, 5);
+    BOOST_CHECK_EQUAL( TM<double>::degree(m), 7u );
+    BOOST_CHECK_EQUAL( TM<double>::exponent(m, 0), 2u );
+    BOOST_CHECK_EQUAL( TM<double>::exponent(m, 3), 5u );
+    BOOST_CHECK_EQUAL( TM<double>::exponent(m, 1), 0u );
+
+    TM<double> x = TM<double>::variable(I<double>(1.0, 3.0), 0, 5);
+
+    BOOST_CHECK_EQUAL( x.order(), 5u );
+    BOOST_CHECK_EQUAL( x.terms().size(), 2u );
+    BOOST_CHECK_EQUAL( x.coefficient(0), 2.0 );
+    BOOST_CHECK_EQUAL( x.coefficient(TM<double>::monomial(0)), 1.0 );
+    BOOST_CHECK_EQUAL( x.coefficient(TM<double>::monomial(1)), 0.0 );
+    BOOST_CHECK_EQUAL( x.remainder(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( x.to_interval(), I<double>(1.0, 3.0) );
+    BOOST_CHECK( to_interval(x) == x.to_interval() );
+    BOOST_CHECK_EQUAL( x.eval({ I<double>(0.5, 1.0) }), I<double>(2.5, 3.0) );
+
+    // the radius is rounded up
+    TM<double> y = TM<double>::variable(I<double>(0.1, 0.7), 1, 5);
+    BOOST_CHECK( subset(I<double>(0.1, 0.7), y.to_interval()) );
+    BOOST_CHECK( wid(y.to_interval()) <= 0.6 + 1e-15 );
+
+    TM<double> c(I<double>(1.0, 2.0), 5);
+    BOOST_CHECK_EQUAL( c.coefficient(0), 1.5 );
+    BOOST_CHECK_EQUAL( c.remainder(), I<double>(-0.5, 0.5) );
+    BOOST_CHECK_EQUAL( c.to_interval(), I<double>(1.0, 2.0) );
+
+    TM<double> e;
+    BOOST_CHECK( e.terms().empty() );
+    BOOST_CHECK( is_empty(e.to_interval()) );
+
+    TM<double> u(I<double>(1.0, INF_D), 5);
+    BOOST_CHECK( u.terms().empty() );
+    BOOST_CHECK_EQUAL( u.to_interval(), I<double>(1.0, INF_D) );
+
+    // order 0, the variable is a constant with a remainder
+    TM<double> z = TM<double>::variable(I<double>(1.0, 3.0), 0, 0);
+    BOOST_CHECK_EQUAL( z.terms().size(), 1u );
+    BOOST_CHECK_EQUAL( z.to_interval(), I<double>(1.0, 3.0) );
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_dependency_test)
+{
+    TM<double> x = TM<double>::variable(I<double>(0.0, 1.0), 0, 4);
+    TM<double> y = TM<double>::variable(I<double>(-1.0, 1.0), 1, 4);
+
+    BOOST_CHECK_EQUAL( (x - x).to_interval(), I<double>(0.0, 0.0) );
+    BOOST_CHECK_EQUAL( ((x + y) - y).to_interval(), x.to_interval() );
+    BOOST_CHECK_EQUAL( (x * y - y * x).to_interval(), I<double>(0.0, 0.0) );
+
+    // x (1 - x) over [0,1] has the range [0,0.25], interval arithmetic [0,1]
+    I<double> a = (x * (1.0 - x)).to_interval();
+    BOOST_CHECK_EQUAL( a, I<double>(0.0, 0.25) );
+    BOOST_CHECK_EQUAL( (sqr(x) - x * x).to_interval(), I<double>(0.0, 0.0) );
+
+    // (x + y)^3 - x^3 - 3 x^2 y - 3 x y^2 - y^3 is exactly 0
+    TM<double> s = x + y;
+    TM<double> p = s * s * s - x * x * x - 3.0 * x * x * y - 3.0 * x * y * y - y * y * y;
+    BOOST_CHECK_EQUAL( p.to_interval(), I<double>(0.0, 0.0) );
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_truncation_test)
+{
+    // the terms above the order are bounded into the remainder
+    TM<double> x = TM<double>::variable(I<double>(-1.0, 1.0), 0, 3);
+    TM<double> p = sqr(sqr(x));
+
+    BOOST_CHECK( p.terms().empty() );
+    BOOST_CHECK_EQUAL( p.remainder(), I<double>(-1.0, 1.0) );
+
+    TM<double> y = TM<double>::variable(I<double>(-1.0, 1.0), 0, 5);
+    TM<double> q = y * y * y;
+    BOOST_CHECK_EQUAL( q.terms().size(), 1u );
+    BOOST_CHECK_EQUAL( q.coefficient(TM<double>::monomial(0, 3)), 1.0 );
+
+    // mixed orders
+    BOOST_CHECK_EQUAL( (p + q).order(), 3u );
+    BOOST_CHECK_EQUAL( (p + q).coefficient(TM<double>::monomial(0, 3)), 1.0 );
+    BOOST_CHECK_EQUAL( (x * y * y * y).order(), 3u );
+    BOOST_CHECK( subset(I<double>(-1.0, 1.0), (x * y * y * y).remainder()) );
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_soundness_test)
+{
+    typedef std::function<TM<double>(TM<double> const&, TM<double> const&)> FT;
+    typedef std::function<I<double>(I<double> const&, I<double> const&)> FI;
+
+    std::vector<std::pair<FT, FI>> functions =
+    {
+        { [](TM<double> const& x, TM<double> const& y) { return x + y - x * y; },
+          [](I<double> const& x, I<double> const& y) { return x + y - x * y; } },
+        { [](TM<double> const& x, TM<double> const& y) { return x / y + sqr(x - y); },
+          [](I<double> const& x, I<double> const& y) { return x / y + sqr(x - y); } },
+        { [](TM<double> const& x, TM<double> const& y) { return sqrt(x) * exp(y) - log(x * y); },
+          [](I<double> const& x, I<double> const& y) { return sqrt(x) * exp(y) - log(x * y); } },
+        { [](TM<double> const& x, TM<double> const& y) { return sin(x) * cos(y) + recip(x) - 3.0 / y + x / 7.0; },
+          [](I<double> const& x, I<double> const& y) { return sin(x) * cos(y) + recip(x) - I<double>(3.0, 3.0) / y + x / I<double>(7.0, 7.0); } }
+    };
+
+    std::mt19937 gen(1788);
+    std::uniform_real_distribution<double> lower(0.1, 10.0);
+    std::uniform_real_distribution<double> width(0.0, 1.0);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+
+    for (int k = 0; k < 100; ++k)
+    {
+        double xl = lower(gen);
+        double xu = xl + width(gen);
+        double yl = lower(gen);
+        double yu = yl + width(gen);
+
+        for (unsigned order : { 0u, 1u, 4u, 8u })
+        {
+            TM<double> x = TM<double>::variable(I<double>(xl, xu), 0, order);
+            TM<double> y = TM<double>::variable(I<double>(yl, yu), 1, order);
+
+            for (auto const& f : functions)
+            {
+                TM<double> r = f.first(x, y);
+                I<double> ri = r.to_interval();
+
+                BOOST_CHECK( !disjoint(ri, f.second(I<double>(xl, xu), I<double>(yl, yu))) );
+
+                for (int s = 0; s < 5; ++s)
+                {
+                    double t = unit(gen);
+                    double u = unit(gen);
+
+                    I<double> v = f.second(point(x, 0, t), point(y, 1, u));
+
+                    BOOST_CHECK( subset(v, ri) || order == 0 );
+                    BOOST_CHECK( !disjoint(v, r.eval({ I<double>(t, t), I<double>(u, u) })) );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_convergence_test)
+{
+    // the remainder is of order n + 1 in the width
+    TM<double> x = TM<double>::variable(I<double>(-0.5, 0.5), 0, 12);
+    TM<double> e = exp(x);
+    TM<double> s = sin(x);
+    TM<double> l = log(1.0 + 0.5 * x);
+
+    BOOST_CHECK( wid(e.remainder()) < 1e-12 );
+    BOOST_CHECK( wid(s.remainder()) < 1e-12 );
+    BOOST_CHECK( wid(l.remainder()) < 1e-6 );
+
+    BOOST_CHECK( std::abs(e.coefficient(TM<double>::monomial(0, 3)) - 0.125 / 6.0) < 1e-15 );
+    BOOST_CHECK( std::abs(s.coefficient(TM<double>::monomial(0, 1)) - 0.5) < 1e-15 );
+    BOOST_CHECK( std::abs(s.coefficient(TM<double>::monomial(0, 2))) < 1e-15 );
+
+    // exp(x) exp(-x) = 1, sin^2 + cos^2 = 1 and sqrt(x)^2 = x up to the
+    // remainder and the bound of the truncated terms of the products
+    BOOST_CHECK( subset((e * exp(-x)).to_interval(), I<double>(1.0 - 1e-9, 1.0 + 1e-9)) );
+    BOOST_CHECK( subset((sqr(s) + sqr(cos(x))).to_interval(), I<double>(1.0 - 1e-10, 1.0 + 1e-10)) );
+
+    TM<double> y = TM<double>::variable(I<double>(1.0, 1.5), 0, 12);
+    BOOST_CHECK( subset((sqr(sqrt(y)) - y).to_interval(), I<double>(-1e-9, 1e-9)) );
+    BOOST_CHECK( subset((y * recip(y)).to_interval(), I<double>(1.0 - 1e-7, 1.0 + 1e-7)) );
+
+    // interval arithmetic overestimates exp(x) exp(-x) by the factor e
+    I<double> xi(-0.5, 0.5);
+    BOOST_CHECK( wid(exp(xi) * exp(-xi)) > 2.0 );
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_sweep_test)
+{
+    TM<double> x = TM<double>::variable(I<double>(-1.0, 1.0), 0, 6);
+    TM<double> y = x + 1e-6 * x * x * x;
+
+    BOOST_CHECK_EQUAL( y.terms().size(), 2u );
+    BOOST_CHECK_EQUAL( y.remainder(), I<double>(0.0, 0.0) );
+
+    double t = TM<double>::sweep_threshold();
+    TM<double>::set_sweep_threshold(1e-3);
+
+    TM<double> z = x + 1e-6 * x * x * x;
+
+    BOOST_CHECK_EQUAL( z.terms().size(), 1u );
+    BOOST_CHECK( subset(I<double>(-1e-6, 1e-6), z.remainder()) );
+    BOOST_CHECK( wid(z.remainder()) < 3e-6 );
+    BOOST_CHECK( subset(y.to_interval(), z.to_interval()) );
+
+    TM<double>::set_sweep_threshold(t);
+    BOOST_CHECK_EQUAL( TM<double>::sweep_threshold(), t );
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_compose_test)
+{
+    // f(t) = exp(t) on [-1,1] composed with g(s) = 0.5 s + 0.25 s^2
+    TM<double> t = TM<double>::variable(I<double>(-1.0, 1.0), 0, 14);
+    TM<double> s = TM<double>::variable(I<double>(-1.0, 1.0), 0, 14);
+
+    TM<double> f = exp(t);
+    TM<double> g = 0.5 * s + 0.25 * sqr(s);
+    TM<double> h = compose(f, std::vector<TM<double>> { g });
+    TM<double> d = exp(g);
+
+    BOOST_CHECK( wid(h.remainder()) < 1e-7 );
+    BOOST_CHECK( subset((h - d).to_interval(), I<double>(-1e-7, 1e-7)) );
+
+    for (double u : { -1.0, -0.3, 0.0, 0.7, 1.0 })
+    {
+        I<double> v = exp(I<double>(0.5 * u + 0.25 * u * u, 0.5 * u + 0.25 * u * u));
+        BOOST_CHECK( !disjoint(v, h.eval({ I<double>(u, u) })) );
+    }
+
+    // the second variable is kept
+    TM<double> y = TM<double>::variable(I<double>(-1.0, 1.0), 1, 14);
+    TM<double> k = compose(t * y, std::vector<TM<double>> { g });
+    BOOST_CHECK_EQUAL( (k - g * y).to_interval(), I<double>(0.0, 0.0) );
+
+    // the range of g exceeds the domain of f
+    TM<double> big = 2.0 * s;
+    BOOST_CHECK( is_entire(compose(f, std::vector<TM<double>> { big }).to_interval()) );
+}
+
+BOOST_AUTO_TEST_CASE(taylor_model_special_test)
+{
+    TM<double> x = TM<double>::variable(I<double>(1.0, 2.0), 0, 5);
+    TM<double> u(I<double>(1.0, INF_D), 5);
+    TM<double> z = TM<double>::variable(I<double>(-1.0, 1.0), 0, 5);
+
+    BOOST_CHECK_EQUAL( (x + u).to_interval(), I<double>(2.0, INF_D) );
+    BOOST_CHECK( is_entire(recip(z).to_interval()) );
+    BOOST_CHECK( is_entire((x / z).to_interval()) );
+
+    BOOST_CHECK( is_empty(log(-x).to_interval()) );
+    BOOST_CHECK( is_empty(sqrt(-x).to_interval()) );
+    BOOST_CHECK_EQUAL( sqrt(z).to_interval(), I<double>(0.0, 1.0) );
+    BOOST_CHECK( is_empty((x + TM<double>()).to_interval()) );
+
+    // overflow
+    TM<double> big = TM<double>::variable(I<double>(1e300, 1e301), 0, 5);
+    BOOST_CHECK_EQUAL( sup((big * big).to_interval()), INF_D );
+    BOOST_CHECK_EQUAL( sup(exp(big).to_interval()), INF_D );
+
+    // float
+    TM<float> f = TM<float>::variable(I<float>(1.0f, 2.0f), 0, 5);
+    BOOST_CHECK_EQUAL( (f - f).to_interval(), I<float>(0.0f, 0.0f) );
+    BOOST_CHECK( subset(I<float>(0.5f, 1.0f), recip(f).to_interval()) );
+}
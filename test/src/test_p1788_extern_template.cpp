@@ -0,0 +1,108 @@
+//
+//                              libieeep1788
+//
+//   An implementation of the preliminary IEEE P1788 standard for
+//   interval arithmetic
+//
+//
+//   Copyright 2013 - 2015
+//
+//   Marco Nehmeier (nehmeier@informatik.uni-wuerzburg.de)
+//   Department of Computer Science,
+//   University of Wuerzburg, Germany
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#define BOOST_TEST_MODULE "Explicit instantiations of libp1788 [p1788/p1788_extern_template]"
+#include "test/util/boost_test_wrapper.hpp"
+
+
+// P1788_EXTERN_TEMPLATES is defined by the build, every instantiation declared
+// extern in p1788/p1788_extern_template.hpp has to be provided by libp1788
+#include "p1788/p1788.hpp"
+
+
+#include <limits>
+
+template<typename T>
+using F = p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor<T>;
+
+template<typename T>
+using I = p1788::infsup::interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+template<typename T>
+using DI = p1788::infsup::decorated_interval<T, p1788::flavor::infsup::setbased::mpfr_bin_ieee754_flavor>;
+
+typedef p1788::decoration::decoration DEC;
+
+
+template<typename T>
+void check_interval()
+{
+    I<T> x(T(1), T(2));
+    I<T> y(T(-1), T(4));
+
+    BOOST_CHECK( x + y == I<T>(T(0), T(6)) );
+    BOOST_CHECK( x - y == I<T>(T(-3), T(3)) );
+    BOOST_CHECK( x * y == I<T>(T(-2), T(8)) );
+    BOOST_CHECK( y / x == I<T>(T(-1), T(4)) );
+    BOOST_CHECK( sqr(y) == I<T>(T(0), T(16)) );
+    BOOST_CHECK( sqrt(I<T>(T(4), T(9))) == I<T>(T(2), T(3)) );
+    BOOST_CHECK( intersection(x, y) == x );
+    BOOST_CHECK( convex_hull(x, y) == y );
+    BOOST_CHECK_EQUAL( inf(x), T(1) );
+    BOOST_CHECK_EQUAL( sup(y), T(4) );
+    BOOST_CHECK_EQUAL( mid(x), T(1.5) );
+    BOOST_CHECK_EQUAL( wid(y), T(5) );
+    BOOST_CHECK( subset(x, y) );
+    BOOST_CHECK( is_empty(I<T>::empty()) );
+    BOOST_CHECK( is_entire(I<T>::entire()) );
+    BOOST_CHECK( is_member(T(0), y) );
+
+    I<T> z("[0.1, 0.2]");
+    BOOST_CHECK( inf(z) <= T(0.1L) );
+    BOOST_CHECK( T(0.2L) <= sup(z) );
+
+    BOOST_CHECK( F<T>::add(typename F<T>::representation(T(1), T(2)), typename F<T>::representation(T(3), T(4)))
+                 == typename F<T>::representation(T(4), T(6)) );
+}
+
+template<typename T>
+void check_decorated_interval()
+{
+    DI<T> x(T(1), T(2));
+    DI<T> y(T(-1), T(4), DEC::def);
+
+    BOOST_CHECK( x + y == DI<T>(T(0), T(6), DEC::def) );
+    BOOST_CHECK( x * y == DI<T>(T(-2), T(8), DEC::def) );
+    BOOST_CHECK( decoration(x / DI<T>(T(0), T(1))) == DEC::trv );
+    BOOST_CHECK( decoration(sqrt(y)) == DEC::trv );
+    BOOST_CHECK_EQUAL( inf(x), T(1) );
+    BOOST_CHECK( is_nai(DI<T>::nai()) );
+    BOOST_CHECK( I<T>(x) == I<T>(T(1), T(2)) );
+}
+
+
+BOOST_AUTO_TEST_CASE(interval_test)
+{
+    check_interval<float>();
+    check_interval<double>();
+    check_interval<long double>();
+}
+
+BOOST_AUTO_TEST_CASE(decorated_interval_test)
+{
+    check_decorated_interval<float>();
+    check_decorated_interval<double>();
+    check_decorated_interval<long double>();
+}